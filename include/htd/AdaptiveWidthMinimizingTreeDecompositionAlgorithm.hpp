@@ -282,6 +282,22 @@ namespace htd
              */
             HTD_API void setNonImprovementLimit(std::size_t nonImprovementLimit);
 
+            /**
+             *  Check whether the algorithm shall terminate as soon as the width of the best decomposition found so far matches the lower bound for the treewidth of the input graph.
+             *
+             *  @note The lower bound is computed via htd::TreeWidthLowerBoundAlgorithm once the first decomposition is available. It is checked before each further decomposition of the decision rounds and before each iteration of the most promising algorithm.
+             *
+             *  @return A boolean flag indicating whether the algorithm shall terminate as soon as the width of the best decomposition found so far matches the lower bound for the treewidth of the input graph.
+             */
+            HTD_API bool isLowerBoundTerminationEnabled(void) const;
+
+            /**
+             *  Set whether the algorithm shall terminate as soon as the width of the best decomposition found so far matches the lower bound for the treewidth of the input graph.
+             *
+             *  @param[in] lowerBoundTerminationEnabled A boolean flag indicating whether the algorithm shall terminate as soon as the width of the best decomposition found so far matches the lower bound for the treewidth of the input graph.
+             */
+            HTD_API void setLowerBoundTerminationEnabled(bool lowerBoundTerminationEnabled);
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
@@ -27,14 +27,18 @@
 
 #include <htd/Globals.hpp>
 #include <htd/Helpers.hpp>
+#include <htd/SymbolTable.hpp>
 
 #include <stdexcept>
-#include <unordered_map>
 
 namespace htd
 {
     /**
      * Implementation of a graph naming providing bi-directional mappings between vertices (and/or edges) and their names.
+     *
+     * Each name is interned exactly once in a symbol table, hence the forward mapping is a dense array indexed by the
+     * vertices (edges) and the reverse mapping does not hold additional copies of the names. Names of type std::string
+     * are stored in the character arena of the symbol table and returned as htd::StringReference handles.
      */
     template <typename VertexNameType, typename EdgeNameType,
               typename VertexNameHashFunction = std::hash<VertexNameType>, typename VertexNameEqualityFunction = std::equal_to<VertexNameType>,
@@ -42,7 +46,17 @@ namespace htd
     class BidirectionalGraphNaming
     {
         public:
-            BidirectionalGraphNaming(void) : vertexNames_(), edgeNames_(), vertexNamesReverseMap_(), edgeNamesReverseMap_()
+            /**
+             *  The type of the references to the vertex names returned by the graph naming.
+             */
+            typedef typename htd::SymbolTable<VertexNameType, VertexNameHashFunction, VertexNameEqualityFunction>::const_reference vertex_name_reference;
+
+            /**
+             *  The type of the references to the edge names returned by the graph naming.
+             */
+            typedef typename htd::SymbolTable<EdgeNameType, EdgeNameHashFunction, EdgeNameEqualityFunction>::const_reference edge_name_reference;
+
+            BidirectionalGraphNaming(void) : vertexNames_(), edgeNames_()
             {
 
             }
@@ -81,7 +95,7 @@ namespace htd
              */
             bool isNamedVertex(htd::vertex_t vertex) const
             {
-                return vertexNames_.count(vertex) == 1;
+                return vertexNames_.contains(vertex);
             }
 
             /**
@@ -93,7 +107,7 @@ namespace htd
              */
             bool isNamedEdge(htd::id_t edgeId) const
             {
-                return edgeNames_.count(edgeId) == 1;
+                return edgeNames_.contains(edgeId);
             }
 
             /**
@@ -103,9 +117,9 @@ namespace htd
              *
              *  @return The name associated with the given vertex.
              */
-            const VertexNameType & vertexName(htd::vertex_t vertex) const
+            vertex_name_reference vertexName(htd::vertex_t vertex) const
             {
-                return vertexNames_.at(vertex);
+                return vertexNames_.symbol(vertex);
             }
 
             /**
@@ -115,9 +129,9 @@ namespace htd
              *
              *  @return The name associated with the given edge.
              */
-            const EdgeNameType & edgeName(htd::id_t edgeId) const
+            edge_name_reference edgeName(htd::id_t edgeId) const
             {
-                return edgeNames_.at(edgeId);
+                return edgeNames_.symbol(edgeId);
             }
 
             /**
@@ -130,25 +144,7 @@ namespace htd
              */
             void setVertexName(htd::vertex_t vertex, const VertexNameType & name)
             {
-                HTD_ASSERT(vertexNamesReverseMap_.count(name) == 0)
-
-                auto position = vertexNames_.find(vertex);
-
-                if (position != vertexNames_.end())
-                {
-                    if (!(position->second == name))
-                    {
-                        auto position2 = vertexNamesReverseMap_.find(position->second);
-
-                        if (position2 != vertexNamesReverseMap_.end())
-                        {
-                            vertexNamesReverseMap_.erase(position2);
-                        }
-                    }
-                }
-
-                vertexNames_[vertex] = name;
-                vertexNamesReverseMap_[name] = vertex;
+                vertexNames_.assign(vertex, name);
             }
 
             /**
@@ -161,25 +157,7 @@ namespace htd
              */
             void setEdgeName(htd::id_t edgeId, const EdgeNameType & name)
             {
-                HTD_ASSERT(edgeNamesReverseMap_.count(name) == 0)
-
-                auto position = edgeNames_.find(edgeId);
-
-                if (position != edgeNames_.end())
-                {
-                    if (!(position->second == name))
-                    {
-                        auto position2 = edgeNamesReverseMap_.find(position->second);
-
-                        if (position2 != edgeNamesReverseMap_.end())
-                        {
-                            edgeNamesReverseMap_.erase(position2);
-                        }
-                    }
-                }
-
-                edgeNames_[edgeId] = name;
-                edgeNamesReverseMap_[name] = edgeId;
+                edgeNames_.assign(edgeId, name);
             }
 
             /**
@@ -198,25 +176,13 @@ namespace htd
             {
                 std::pair<htd::id_t, bool> ret(0, false);
 
-                auto result = vertexNamesReverseMap_.insert(std::make_pair(name, 0));
-
-                htd::vertex_t & vertexId = result.first->second;
-
-                if (result.second)
+                if (!vertexNames_.find(name, ret.first))
                 {
-                    htd::vertex_t newVertex = vertexCreationFunction();
-
-                    ret.first = newVertex;
+                    ret.first = vertexCreationFunction();
 
                     ret.second = true;
 
-                    vertexId = newVertex;
-
-                    vertexNames_.emplace(newVertex, name);
-                }
-                else
-                {
-                    ret.first = vertexId;
+                    vertexNames_.assign(ret.first, name);
                 }
 
                 return ret;
@@ -240,24 +206,7 @@ namespace htd
 
                 for (const VertexNameType & name : names)
                 {
-                    auto result = vertexNamesReverseMap_.emplace(name, htd::Vertex::UNKNOWN);
-
-                    htd::vertex_t & vertexId = result.first->second;
-
-                    if (result.second)
-                    {
-                        htd::vertex_t newVertex = vertexCreationFunction();
-
-                        ret.push_back(newVertex);
-
-                        vertexId = newVertex;
-
-                        vertexNames_.emplace(newVertex, name);
-                    }
-                    else
-                    {
-                        ret.push_back(vertexId);
-                    }
+                    ret.push_back(insertVertex(name, vertexCreationFunction).first);
                 }
 
                 return ret;
@@ -281,24 +230,7 @@ namespace htd
 
                 for (const VertexNameType & name : names)
                 {
-                    auto result = vertexNamesReverseMap_.emplace(name, htd::Vertex::UNKNOWN);
-
-                    htd::vertex_t & vertexId = result.first->second;
-
-                    if (result.second)
-                    {
-                        htd::vertex_t newVertex = vertexCreationFunction();
-
-                        ret.push_back(newVertex);
-
-                        vertexId = newVertex;
-
-                        vertexNames_.emplace(newVertex, name);
-                    }
-                    else
-                    {
-                        ret.push_back(vertexId);
-                    }
+                    ret.push_back(insertVertex(name, vertexCreationFunction).first);
                 }
 
                 return ret;
@@ -311,18 +243,7 @@ namespace htd
              */
             void removeVertexName(htd::vertex_t vertex)
             {
-                auto position = vertexNames_.find(vertex);
-
-                HTD_ASSERT(position != vertexNames_.end())
-
-                auto position2 = vertexNamesReverseMap_.find(position->second);
-
-                if (position2 != vertexNamesReverseMap_.end())
-                {
-                    vertexNamesReverseMap_.erase(position2);
-                }
-
-                vertexNames_.erase(position);
+                vertexNames_.release(vertex);
             }
 
             /**
@@ -332,18 +253,7 @@ namespace htd
              */
             void removeEdgeName(htd::id_t edgeId)
             {
-                auto position = edgeNames_.find(edgeId);
-
-                HTD_ASSERT(position != edgeNames_.end())
-
-                auto position2 = edgeNamesReverseMap_.find(position->second);
-
-                if (position2 != edgeNamesReverseMap_.end())
-                {
-                    edgeNamesReverseMap_.erase(position2);
-                }
-
-                edgeNames_.erase(position);
+                edgeNames_.release(edgeId);
             }
 
             /**
@@ -355,7 +265,7 @@ namespace htd
              */
             bool isVertexName(const VertexNameType & name) const
             {
-                return vertexNamesReverseMap_.count(name) > 0;
+                return vertexNames_.containsSymbol(name);
             }
 
             /**
@@ -367,7 +277,7 @@ namespace htd
              */
             bool isEdgeName(const EdgeNameType & name) const
             {
-                return edgeNamesReverseMap_.count(name) > 0;
+                return edgeNames_.containsSymbol(name);
             }
 
             /**
@@ -379,7 +289,7 @@ namespace htd
              */
             htd::vertex_t lookupVertex(const VertexNameType & name) const
             {
-                return vertexNamesReverseMap_.at(name);
+                return vertexNames_.identifier(name);
             }
 
             /**
@@ -391,7 +301,7 @@ namespace htd
              */
             htd::id_t lookupEdge(const EdgeNameType & name) const
             {
-                return edgeNamesReverseMap_.at(name);
+                return edgeNames_.identifier(name);
             }
 
             /**
@@ -399,31 +309,21 @@ namespace htd
              *
              *  @return A new BidirectionalGraphNaming object identical to the current graph naming.
              */
-            htd::BidirectionalGraphNaming<VertexNameType, EdgeNameType, VertexNameHashFunction, EdgeNameHashFunction, VertexNameEqualityFunction, EdgeNameEqualityFunction> * clone(void) const
+            htd::BidirectionalGraphNaming<VertexNameType, EdgeNameType, VertexNameHashFunction, VertexNameEqualityFunction, EdgeNameHashFunction, EdgeNameEqualityFunction> * clone(void) const
             {
-                auto * ret = new BidirectionalGraphNaming<VertexNameType, EdgeNameType, VertexNameHashFunction, EdgeNameHashFunction, VertexNameEqualityFunction, EdgeNameEqualityFunction>();
-
-                for (auto name : vertexNames_)
-                {
-                    ret->setVertexName(name.first, name.second);
-                }
-
-                for (auto name : edgeNames_)
-                {
-                    ret->setEdgeName(name.first, name.second);
-                }
-
-                return ret;
+                return new BidirectionalGraphNaming<VertexNameType, EdgeNameType, VertexNameHashFunction, VertexNameEqualityFunction, EdgeNameHashFunction, EdgeNameEqualityFunction>(*this);
             }
 
         private:
-            std::unordered_map<htd::vertex_t, VertexNameType> vertexNames_;
-
-            std::unordered_map<htd::id_t, EdgeNameType> edgeNames_;
-
-            std::unordered_map<VertexNameType, htd::vertex_t, VertexNameHashFunction, VertexNameEqualityFunction> vertexNamesReverseMap_;
+            /**
+             *  The interned vertex names, indexed by their vertices.
+             */
+            htd::SymbolTable<VertexNameType, VertexNameHashFunction, VertexNameEqualityFunction> vertexNames_;
 
-            std::unordered_map<EdgeNameType, htd::id_t, EdgeNameHashFunction, EdgeNameEqualityFunction> edgeNamesReverseMap_;
+            /**
+             *  The interned edge names, indexed by the IDs of their edges.
+             */
+            htd::SymbolTable<EdgeNameType, EdgeNameHashFunction, EdgeNameEqualityFunction> edgeNames_;
     };
 }
 
@@ -0,0 +1,108 @@
+/* 
+ * File:   BitsetSetCover.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_BITSETSETCOVER_HPP
+#define HTD_HTD_BITSETSETCOVER_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/ConstCollection.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Set-cover engine which encodes the universe of a set-cover instance as a bitset.
+     *
+     *  Each element which must be covered is mapped to one bit and each container is stored as the bitset
+     *  of the elements it covers. Hence, the coverage of a container with respect to the remaining elements
+     *  is determined via a bitwise conjunction and a population count instead of a sorted-set intersection.
+     *  Containers which do not cover any element are discarded when the instance is constructed.
+     */
+    class BitsetSetCover
+    {
+        public:
+            /**
+             *  Constructor for a new set-cover engine.
+             *
+             *  @param[in] elements     The set of elements which must be covered.
+             *  @param[in] containers   The collection of containers which are available for covering the given elements.
+             *
+             *  @note The vector 'elements' and all vectors stored in the argument 'containers' must be sorted and must not contain duplicates, otherwise the result of this method is undefined.
+             */
+            HTD_API BitsetSetCover(const std::vector<htd::id_t> & elements, const std::vector<std::vector<htd::id_t>> & containers);
+
+            /**
+             *  Constructor for a new set-cover engine.
+             *
+             *  @param[in] elements     The set of elements which must be covered.
+             *  @param[in] containers   The collection of containers which are available for covering the given elements.
+             *
+             *  @note The collection 'elements' and all vectors stored in the argument 'containers' must be sorted and must not contain duplicates, otherwise the result of this method is undefined.
+             */
+            HTD_API BitsetSetCover(const htd::ConstCollection<htd::id_t> & elements, const htd::ConstCollection<std::vector<htd::id_t>> & containers);
+
+            HTD_API virtual ~BitsetSetCover();
+
+            /**
+             *  Check whether the union of all containers includes all elements which must be covered.
+             *
+             *  @return True if the union of all containers includes all elements which must be covered, false otherwise.
+             */
+            HTD_API bool isCoverable(void) const;
+
+            /**
+             *  Compute a set cover via the greedy heuristic which repeatedly selects the container covering the most remaining elements.
+             *
+             *  Ties are broken in favor of the container with the smallest index. The coverage values are kept in a
+             *  priority queue and are only re-evaluated lazily when a container reaches the top of the queue.
+             *
+             *  @param[out] target  The target vector to which the indices of the covering containers shall be appended in ascending order.
+             *
+             *  @note If the elements cannot be covered by the given containers, the target vector remains unchanged.
+             */
+            HTD_API void computeGreedyCover(std::vector<htd::index_t> & target) const;
+
+            /**
+             *  Compute a set cover of minimum cardinality via branch-and-bound search.
+             *
+             *  The search is bounded by the result of the greedy heuristic and by a lower bound derived from the
+             *  size of the largest container. Containers which are dominated by another container are ignored.
+             *
+             *  @param[out] target  The target vector to which the indices of the covering containers shall be appended in ascending order.
+             *
+             *  @note If the elements cannot be covered by the given containers, the target vector remains unchanged.
+             */
+            HTD_API void computeMinimumCover(std::vector<htd::index_t> & target) const;
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_BITSETSETCOVER_HPP */
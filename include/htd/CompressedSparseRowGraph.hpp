@@ -0,0 +1,232 @@
+/* 
+ * File:   CompressedSparseRowGraph.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_COMPRESSEDSPARSEROWGRAPH_HPP
+#define HTD_HTD_COMPRESSEDSPARSEROWGRAPH_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/IMultiHypergraph.hpp>
+#include <htd/LibraryInstance.hpp>
+
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Read-only implementation of the IMultiHypergraph interface which wraps a graph in compressed sparse row (CSR) format
+     *  provided by the caller without copying it.
+     *
+     *  The vertices of the graph are htd::Vertex::FIRST, ..., htd::Vertex::FIRST + vertexCount - 1. The neighbors of the vertex
+     *  htd::Vertex::FIRST + i are stored in adjacency[offsets[i]], ..., adjacency[offsets[i + 1] - 1]. The arrays must fulfill the
+     *  following requirements:
+     *      - Each neighborhood is sorted in ascending order and free of duplicates.
+     *      - No vertex is a neighbor of itself.
+     *      - The neighborhood relation is symmetric.
+     *
+     *  Optionally, the caller may provide the hyperedges of the graph in the same format: The elements of the hyperedge with
+     *  position i (and ID htd::Id::FIRST + i) are stored in hyperedgeElements[hyperedgeOffsets[i]], ...,
+     *  hyperedgeElements[hyperedgeOffsets[i + 1] - 1]. The elements of each hyperedge must be sorted in ascending order and
+     *  free of duplicates and the adjacency arrays must represent the primal graph of the hyperedges. If no hyperedges are
+     *  provided, the graph contains one edge {u, v} with u < v for each pair of neighbors, ordered by u and then by v.
+     *
+     *  @note The arrays are not copied, hence they must not be modified or destroyed as long as the graph or one of its clones is in use.
+     *
+     *  @note The neighborhoods are accessed directly. Functions which return htd::Hyperedge objects create each requested hyperedge
+     *  on first access. The created hyperedges are shared by the graph, its clones and the collections returned by hyperedgesAtPositions(),
+     *  e.g., the induced hyperedges of decompositions of the graph. Algorithms which support graphs of type CompressedSparseRowGraph
+     *  natively (like htd::GraphPreprocessor and htd::BucketEliminationGraphDecompositionAlgorithm) read the arrays directly.
+     *
+     *  @note The constructors check the requirements on the arrays in O(m log d) time, where m is the size of the adjacency array
+     *  and d is the maximum degree. Whether the adjacency arrays represent the primal graph of explicitly given hyperedges is not checked.
+     */
+    class CompressedSparseRowGraph : public virtual htd::IMultiHypergraph
+    {
+        public:
+            /**
+             *  Constructor for a graph whose edges are derived from the given adjacency arrays.
+             *
+             *  @param[in] manager      The management instance to which the new graph belongs.
+             *  @param[in] vertexCount  The number of vertices of the graph.
+             *  @param[in] offsets      The offsets of the neighborhoods within the adjacency array. The array must contain vertexCount + 1 elements.
+             *  @param[in] adjacency    The concatenated neighborhoods of the vertices.
+             *
+             *  @throws std::invalid_argument   If the arrays do not fulfill the requirements of the graph.
+             */
+            HTD_API CompressedSparseRowGraph(const htd::LibraryInstance * const manager, std::size_t vertexCount, const std::size_t * offsets, const htd::vertex_t * adjacency);
+
+            /**
+             *  Constructor for a graph with explicitly given hyperedges.
+             *
+             *  @param[in] manager              The management instance to which the new graph belongs.
+             *  @param[in] vertexCount          The number of vertices of the graph.
+             *  @param[in] offsets              The offsets of the neighborhoods within the adjacency array. The array must contain vertexCount + 1 elements.
+             *  @param[in] adjacency            The concatenated neighborhoods of the vertices.
+             *  @param[in] hyperedgeCount       The number of hyperedges of the graph.
+             *  @param[in] hyperedgeOffsets     The offsets of the hyperedges within the array of hyperedge elements. The array must contain hyperedgeCount + 1 elements.
+             *  @param[in] hyperedgeElements    The concatenated elements of the hyperedges.
+             *
+             *  @throws std::invalid_argument   If the arrays do not fulfill the requirements of the graph.
+             */
+            HTD_API CompressedSparseRowGraph(const htd::LibraryInstance * const manager, std::size_t vertexCount, const std::size_t * offsets, const htd::vertex_t * adjacency, std::size_t hyperedgeCount, const std::size_t * hyperedgeOffsets, const htd::vertex_t * hyperedgeElements);
+
+            /**
+             *  Copy constructor for a graph in CSR format.
+             *
+             *  @note The new graph wraps the same arrays as the original graph.
+             *
+             *  @param[in] original  The original graph.
+             */
+            HTD_API CompressedSparseRowGraph(const CompressedSparseRowGraph & original);
+
+            HTD_API virtual ~CompressedSparseRowGraph();
+
+            HTD_API std::size_t vertexCount(void) const HTD_OVERRIDE;
+
+            HTD_API std::size_t edgeCount(void) const HTD_OVERRIDE;
+
+            HTD_API std::size_t edgeCount(htd::vertex_t vertex) const HTD_OVERRIDE;
+
+            HTD_API bool isVertex(htd::vertex_t vertex) const HTD_OVERRIDE;
+
+            HTD_API bool isEdge(htd::id_t edgeId) const HTD_OVERRIDE;
+
+            HTD_API bool isEdge(htd::vertex_t vertex1, htd::vertex_t vertex2) const HTD_OVERRIDE;
+
+            HTD_API bool isEdge(const std::vector<htd::vertex_t> & elements) const HTD_OVERRIDE;
+
+            HTD_API bool isEdge(const htd::ConstCollection<htd::vertex_t> & elements) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::id_t> associatedEdgeIds(htd::vertex_t vertex1, htd::vertex_t vertex2) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::id_t> associatedEdgeIds(const std::vector<htd::vertex_t> & elements) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::id_t> associatedEdgeIds(const htd::ConstCollection<htd::vertex_t> & elements) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::vertex_t> vertices(void) const HTD_OVERRIDE;
+
+            HTD_API void copyVerticesTo(std::vector<htd::vertex_t> & target) const HTD_OVERRIDE;
+
+            HTD_API htd::vertex_t vertexAtPosition(htd::index_t index) const HTD_OVERRIDE;
+
+            HTD_API bool isConnected(void) const HTD_OVERRIDE;
+
+            HTD_API bool isConnected(htd::vertex_t vertex1, htd::vertex_t vertex2) const HTD_OVERRIDE;
+
+            HTD_API bool isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const HTD_OVERRIDE;
+
+            HTD_API std::size_t neighborCount(htd::vertex_t vertex) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::vertex_t> neighbors(htd::vertex_t vertex) const HTD_OVERRIDE;
+
+            HTD_API void copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const HTD_OVERRIDE;
+
+            HTD_API htd::vertex_t neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const HTD_OVERRIDE;
+
+            HTD_API std::size_t isolatedVertexCount(void) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::vertex_t> isolatedVertices(void) const HTD_OVERRIDE;
+
+            HTD_API htd::vertex_t isolatedVertexAtPosition(htd::index_t index) const HTD_OVERRIDE;
+
+            HTD_API bool isIsolatedVertex(htd::vertex_t vertex) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::Hyperedge> hyperedges(void) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::Hyperedge> hyperedges(htd::vertex_t vertex) const HTD_OVERRIDE;
+
+            HTD_API const htd::Hyperedge & hyperedge(htd::id_t edgeId) const HTD_OVERRIDE;
+
+            HTD_API const htd::Hyperedge & hyperedgeAtPosition(htd::index_t index) const HTD_OVERRIDE;
+
+            HTD_API const htd::Hyperedge & hyperedgeAtPosition(htd::index_t index, htd::vertex_t vertex) const HTD_OVERRIDE;
+
+            HTD_API htd::FilteredHyperedgeCollection hyperedgesAtPositions(const std::vector<htd::index_t> & indices) const HTD_OVERRIDE;
+
+            HTD_API htd::FilteredHyperedgeCollection hyperedgesAtPositions(std::vector<htd::index_t> && indices) const HTD_OVERRIDE;
+
+            /**
+             *  Getter for the offsets of the neighborhoods within the adjacency array.
+             *
+             *  @return The offsets of the neighborhoods within the adjacency array.
+             */
+            HTD_API const std::size_t * offsets(void) const HTD_NOEXCEPT;
+
+            /**
+             *  Getter for the concatenated neighborhoods of the vertices.
+             *
+             *  @return The concatenated neighborhoods of the vertices.
+             */
+            HTD_API const htd::vertex_t * adjacency(void) const HTD_NOEXCEPT;
+
+            /**
+             *  Check whether the hyperedges of the graph were provided explicitly.
+             *
+             *  @return True if the hyperedges of the graph were provided explicitly, false if they are derived from the adjacency arrays.
+             */
+            HTD_API bool hasExplicitHyperedges(void) const HTD_NOEXCEPT;
+
+            /**
+             *  Copy the elements of the hyperedge at the given position to the end of the target vector without materializing the hyperedge.
+             *
+             *  @param[in] index    The position of the hyperedge.
+             *  @param[out] target  The target vector to which the elements, sorted in ascending order, shall be appended.
+             */
+            HTD_API void copyHyperedgeElementsTo(htd::index_t index, std::vector<htd::vertex_t> & target) const;
+
+            HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            HTD_API CompressedSparseRowGraph * clone(void) const HTD_OVERRIDE;
+#else
+            /**
+             *  Create a copy of the current graph which wraps the same arrays.
+             *
+             *  @return A new CompressedSparseRowGraph object identical to the current graph.
+             */
+            HTD_API CompressedSparseRowGraph * clone(void) const;
+
+            HTD_API htd::IGraphStructure * cloneGraphStructure(void) const HTD_OVERRIDE;
+
+            HTD_API htd::IMultiHypergraph * cloneMultiHypergraph(void) const HTD_OVERRIDE;
+#endif
+
+        protected:
+            /**
+             *  Copy assignment operator for a graph in CSR format.
+             *
+             *  @note This operator is protected to prevent assignments to an already initialized graph.
+             */
+            CompressedSparseRowGraph & operator=(const CompressedSparseRowGraph &) { return *this; }
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_COMPRESSEDSPARSEROWGRAPH_HPP */
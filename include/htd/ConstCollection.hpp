@@ -31,11 +31,15 @@
 #include <htd/Algorithm.hpp>
 
 #include <iterator>
+#include <vector>
 
 namespace htd
 {
     /**
      *  Wrapper for immutable collections.
+     *
+     *  Collections wrapping a std::vector refer directly to its contiguous storage. For such collections, iterating over
+     *  the elements does not involve any virtual function calls and the elements can be accessed via data().
      */
     template <typename T>
     class ConstCollection
@@ -60,7 +64,7 @@ namespace htd
              *  @param[in] begin    The begin of the collection to be wrapped.
              *  @param[in] end      The end of the collection to be wrapped.
              */
-            ConstCollection(const htd::ConstIterator<T> & begin, const htd::ConstIterator<T> & end) HTD_NOEXCEPT : begin_(begin), end_(end), size_(std::distance(begin, end))
+            ConstCollection(const htd::ConstIterator<T> & begin, const htd::ConstIterator<T> & end) HTD_NOEXCEPT : begin_(begin), end_(end), size_(distance(begin, end))
             {
 
             }
@@ -133,6 +137,28 @@ namespace htd
                 return end_;
             }
 
+            /**
+             *  Check whether the elements of the collection are stored contiguously.
+             *
+             *  @return True if the elements of the collection are stored contiguously, false otherwise.
+             */
+            bool isContiguous(void) const HTD_NOEXCEPT
+            {
+                return begin_.baseIterator_ == nullptr && end_.baseIterator_ == nullptr;
+            }
+
+            /**
+             *  Getter for the pointer to the first element of the collection.
+             *
+             *  @note The elements of the collection can be accessed via the returned pointer if and only if isContiguous() returns true.
+             *
+             *  @return The pointer to the first element of the collection if its elements are stored contiguously, nullptr otherwise.
+             */
+            const T * data(void) const HTD_NOEXCEPT
+            {
+                return isContiguous() ? begin_.pointer_ : nullptr;
+            }
+
             /**
              *  Access the element at the specific position within the collection.
              *
@@ -142,6 +168,11 @@ namespace htd
              */
             const T & operator[](htd::index_t index) const
             {
+                if (isContiguous())
+                {
+                    return begin_.pointer_[index];
+                }
+
                 htd::ConstIterator<T> position = begin_;
 
                 std::advance(position, index);
@@ -158,6 +189,7 @@ namespace htd
             {
                 begin_ = original.begin_;
                 end_ = original.end_;
+                size_ = original.size_;
 
                 return *this;
             }
@@ -171,6 +203,7 @@ namespace htd
             {
                 begin_ = std::move(original.begin_);
                 end_ = std::move(original.end_);
+                size_ = original.size_;
 
                 return *this;
             }
@@ -185,6 +218,7 @@ namespace htd
             {
                 begin_ = original.begin();
                 end_ = original.end();
+                size_ = original.size();
 
                 return *this;
             }
@@ -224,6 +258,32 @@ namespace htd
                 return ConstCollection<T>(std::begin(collection), std::end(collection), collection.size());
             }
 
+            /**
+             *  Create a new ConstCollection object wrapping the contiguous storage of the provided vector.
+             *
+             *  @note The returned collection and its iterators are invalidated by any operation which invalidates the iterators of the vector.
+             *
+             *  @param[in] collection   The vector which shall be wrapped.
+             */
+            template <typename Allocator>
+            static ConstCollection<T> getInstance(const std::vector<T, Allocator> & collection)
+            {
+                return ConstCollection<T>(htd::ConstIterator<T>(collection.data()), htd::ConstIterator<T>(collection.data() + collection.size()), collection.size());
+            }
+
+            /**
+             *  Create a new ConstCollection object wrapping the provided array.
+             *
+             *  @note The returned collection and its iterators are invalidated as soon as the array is destroyed.
+             *
+             *  @param[in] data The pointer to the first element of the array.
+             *  @param[in] size The number of elements of the array.
+             */
+            static ConstCollection<T> getInstance(const T * data, std::size_t size)
+            {
+                return ConstCollection<T>(htd::ConstIterator<T>(data), htd::ConstIterator<T>(data + size), size);
+            }
+
         private:
             /**
              *  An iterator to the first element of the collection.
@@ -246,6 +306,16 @@ namespace htd
             {
 
             }
+
+            static std::size_t distance(const htd::ConstIterator<T> & begin, const htd::ConstIterator<T> & end)
+            {
+                if (begin.baseIterator_ == nullptr && end.baseIterator_ == nullptr)
+                {
+                    return end.pointer_ - begin.pointer_;
+                }
+
+                return std::distance(begin, end);
+            }
     };
 }
 
@@ -34,8 +34,15 @@
 
 namespace htd
 {
+    template <typename T>
+    class ConstCollection;
+
     /**
      *  Wrapper for iterators of immutable collections.
+     *
+     *  Iterators of contiguous storage (see htd::ConstCollection::getInstance) are represented by a plain pointer instead
+     *  of a heap-allocated base iterator. In this case, all operations are performed directly on the pointer without any
+     *  virtual function calls.
      */
     template <typename T>
     class ConstIterator : public htd::ConstIteratorBase<T>
@@ -79,7 +86,7 @@ namespace htd
             /**
              *  Constructor for an iterator pointing nowhere.
              */
-            ConstIterator(void) HTD_NOEXCEPT : baseIterator_(nullptr)
+            ConstIterator(void) HTD_NOEXCEPT : baseIterator_(nullptr), pointer_(nullptr)
             {
 
             }
@@ -90,7 +97,17 @@ namespace htd
              *  @param[in] iterator The underlying iterator.
              */
             template <class Iter>
-            ConstIterator(Iter iterator) : baseIterator_(new htd::ConstIteratorWrapper<Iter, T>(iterator))
+            ConstIterator(Iter iterator) : baseIterator_(new htd::ConstIteratorWrapper<Iter, T>(iterator)), pointer_(nullptr)
+            {
+
+            }
+
+            /**
+             *  Constructor for an iterator pointing to an element of contiguous storage.
+             *
+             *  @param[in] pointer  The pointer to the element.
+             */
+            ConstIterator(const T * pointer) HTD_NOEXCEPT : baseIterator_(nullptr), pointer_(pointer)
             {
 
             }
@@ -104,7 +121,7 @@ namespace htd
              *  the new iterator wrapper. Deleting the base iterator outside the iterator wrapper or using the same base iterator in
              *  different iterator wrappers will lead to undefined behavior.
              */
-            ConstIterator(htd::ConstIteratorBase<T> * iterator) HTD_NOEXCEPT : baseIterator_(iterator)
+            ConstIterator(htd::ConstIteratorBase<T> * iterator) HTD_NOEXCEPT : baseIterator_(iterator), pointer_(nullptr)
             {
 
             }
@@ -114,7 +131,7 @@ namespace htd
              *
              *  @param[in] original  The original iterator.
              */
-            ConstIterator<T>(const ConstIterator<T> & original) HTD_NOEXCEPT : baseIterator_(nullptr)
+            ConstIterator<T>(const ConstIterator<T> & original) HTD_NOEXCEPT : baseIterator_(nullptr), pointer_(original.pointer_)
             {
                 if (original.baseIterator_ != nullptr)
                 {
@@ -127,7 +144,7 @@ namespace htd
              *
              *  @param[in] original  The original iterator.
              */
-            ConstIterator<T>(ConstIterator<T> && original) HTD_NOEXCEPT : baseIterator_(nullptr)
+            ConstIterator<T>(ConstIterator<T> && original) HTD_NOEXCEPT : baseIterator_(nullptr), pointer_(original.pointer_)
             {
                 if (original.baseIterator_ != nullptr)
                 {
@@ -156,6 +173,10 @@ namespace htd
                 {
                     ++(*baseIterator_);
                 }
+                else
+                {
+                    ++pointer_;
+                }
 
                 return *this;
             }
@@ -167,7 +188,7 @@ namespace htd
              */
             ConstIterator<T> operator++(int) HTD_NOEXCEPT
             {
-                ConstIterator<T> ret(*baseIterator_);
+                ConstIterator<T> ret(*this);
 
                 operator++();
 
@@ -193,6 +214,8 @@ namespace htd
                     baseIterator_ = original.baseIterator_->clone();
                 }
 
+                pointer_ = original.pointer_;
+
                 return *this;
             }
 
@@ -217,6 +240,8 @@ namespace htd
                     original.baseIterator_ = nullptr;
                 }
 
+                pointer_ = original.pointer_;
+
                 return *this;
             }
 
@@ -228,7 +253,7 @@ namespace htd
 
                 if (baseIterator_ == nullptr)
                 {
-                    ret = o->baseIterator_ == nullptr;
+                    ret = o->baseIterator_ == nullptr && pointer_ == o->pointer_;
                 }
                 else if (o->baseIterator_ != nullptr)
                 {
@@ -251,7 +276,7 @@ namespace htd
 
                 if (baseIterator_ == nullptr)
                 {
-                    ret = rhs.baseIterator_ == nullptr;
+                    ret = rhs.baseIterator_ == nullptr && pointer_ == rhs.pointer_;
                 }
                 else if (rhs.baseIterator_ != nullptr)
                 {
@@ -269,7 +294,7 @@ namespace htd
 
                 if (baseIterator_ == nullptr)
                 {
-                    ret = o->baseIterator_ != nullptr;
+                    ret = o->baseIterator_ != nullptr || pointer_ != o->pointer_;
                 }
                 else if (o->baseIterator_ != nullptr)
                 {
@@ -292,7 +317,7 @@ namespace htd
 
                 if (baseIterator_ == nullptr)
                 {
-                    ret = rhs.baseIterator_ != nullptr;
+                    ret = rhs.baseIterator_ != nullptr || pointer_ != rhs.pointer_;
                 }
                 else if (rhs.baseIterator_ != nullptr)
                 {
@@ -304,11 +329,21 @@ namespace htd
 
             const T * operator->(void) const HTD_OVERRIDE
             {
+                if (baseIterator_ == nullptr)
+                {
+                    return pointer_;
+                }
+
                 return baseIterator_->operator->();
             }
 
             const T & operator*(void) const HTD_OVERRIDE
             {
+                if (baseIterator_ == nullptr)
+                {
+                    return *pointer_;
+                }
+
                 return baseIterator_->operator*();
             }
 
@@ -318,7 +353,7 @@ namespace htd
 
                 if (baseIterator_ == nullptr)
                 {
-                    return new ConstIterator<T>();
+                    return new ConstIterator<T>(pointer_);
                 }
                 else
                 {
@@ -329,9 +364,16 @@ namespace htd
             }
 
         private:
+            friend class htd::ConstCollection<T>;
+
             htd::ConstIteratorBase<T> * baseIterator_;
 
-            ConstIterator<T>(const htd::ConstIteratorBase<T> & original) : baseIterator_(original.clone())
+            /**
+             *  The pointer to the current element in case that the iterator refers to contiguous storage.
+             */
+            const T * pointer_;
+
+            ConstIterator<T>(const htd::ConstIteratorBase<T> & original) : baseIterator_(original.clone()), pointer_(nullptr)
             {
 
             }
@@ -0,0 +1,202 @@
+/* 
+ * File:   CopyOnWrite.hpp
+ * 
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_COPYONWRITE_HPP
+#define HTD_HTD_COPYONWRITE_HPP
+
+#include <htd/Globals.hpp>
+
+#include <atomic>
+#include <memory>
+
+namespace htd
+{
+    /**
+     *  Wrapper which shares its content with its copies until one of them is modified.
+     *
+     *  Copying a CopyOnWrite object takes constant time, independent of the size of the content. The content is only
+     *  copied when mutableContent() is called for an object which currently shares its content with another copy.
+     *  Hence, a copy of the content is only created for the objects which are actually modified.
+     *
+     *  In addition to the copies, observers may share the content via sharedContent(). Observers count as owners, i.e.,
+     *  modifying an object whose content is shared with an observer triggers a copy and the observer keeps seeing the
+     *  content as it was when the observer was created.
+     *
+     *  @note Different CopyOnWrite objects sharing the same content may be used concurrently by different threads as
+     *  long as each object is only accessed by a single thread.
+     */
+    template <typename T>
+    class CopyOnWrite
+    {
+        public:
+            /**
+             *  Constructor for a CopyOnWrite object holding a default-constructed content.
+             */
+            CopyOnWrite(void) : content_(std::make_shared<T>())
+            {
+
+            }
+
+            /**
+             *  Constructor for a CopyOnWrite object holding the given content.
+             *
+             *  @param[in] content  The content of the new object.
+             */
+            CopyOnWrite(const T & content) : content_(std::make_shared<T>(content))
+            {
+
+            }
+
+            /**
+             *  Constructor for a CopyOnWrite object holding the given content.
+             *
+             *  @param[in] content  The content of the new object.
+             */
+            CopyOnWrite(T && content) : content_(std::make_shared<T>(std::move(content)))
+            {
+
+            }
+
+            /**
+             *  Copy constructor for a CopyOnWrite object.
+             *
+             *  @note The content is shared with the original object until one of both objects is modified.
+             *
+             *  @param[in] original  The original CopyOnWrite object.
+             */
+            CopyOnWrite(const CopyOnWrite<T> & original) : content_(original.content_)
+            {
+
+            }
+
+            /**
+             *  Destructor for a CopyOnWrite object.
+             */
+            ~CopyOnWrite()
+            {
+
+            }
+
+            /**
+             *  Copy assignment operator for a CopyOnWrite object.
+             *
+             *  @note The content is shared with the original object until one of both objects is modified.
+             *
+             *  @param[in] original  The original CopyOnWrite object.
+             */
+            CopyOnWrite<T> & operator=(const CopyOnWrite<T> & original)
+            {
+                content_ = original.content_;
+
+                return *this;
+            }
+
+            /**
+             *  Getter for the content.
+             *
+             *  @return The content.
+             */
+            const T & content(void) const HTD_NOEXCEPT
+            {
+                return *content_;
+            }
+
+            /**
+             *  Getter for the content.
+             *
+             *  @return The content.
+             */
+            const T & operator*(void) const HTD_NOEXCEPT
+            {
+                return *content_;
+            }
+
+            /**
+             *  Getter for the content.
+             *
+             *  @return A pointer to the content.
+             */
+            const T * operator->(void) const HTD_NOEXCEPT
+            {
+                return content_.get();
+            }
+
+            /**
+             *  Getter for the content which allows to modify it.
+             *
+             *  @note If the content is shared with other copies of the object, it is copied first.
+             *
+             *  @return The content.
+             */
+            T & mutableContent(void)
+            {
+                if (isShared())
+                {
+                    content_ = std::make_shared<T>(*content_);
+                }
+                else
+                {
+                    /* The reference count may have dropped to one in another thread which released its copy. */
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                }
+
+                return *content_;
+            }
+
+            /**
+             *  Getter for the shared pointer to the content which can be used by observers of the content.
+             *
+             *  @note As long as the returned pointer (or a copy of it) exists, modifying the current object triggers a copy of the content.
+             *
+             *  @return The shared pointer to the content.
+             */
+            const std::shared_ptr<T> & sharedContent(void) const HTD_NOEXCEPT
+            {
+                return content_;
+            }
+
+            /**
+             *  Check whether the content is shared with other copies of the object or with observers.
+             *
+             *  @note If the function returns false, the current object is the only owner of the content and no other
+             *  thread can obtain a new reference to it, hence the result is reliable even in case of concurrent access to
+             *  other objects which shared the content before.
+             *
+             *  @return True if the content is shared with other copies of the object or with observers, false otherwise.
+             */
+            bool isShared(void) const HTD_NOEXCEPT
+            {
+                return content_.use_count() > 1;
+            }
+
+        private:
+            /**
+             *  The content.
+             */
+            std::shared_ptr<T> content_;
+    };
+}
+
+#endif /* HTD_HTD_COPYONWRITE_HPP */
@@ -0,0 +1,155 @@
+/* 
+ * File:   DecompositionCache.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_DECOMPOSITIONCACHE_HPP
+#define HTD_HTD_DECOMPOSITIONCACHE_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/IMultiHypergraph.hpp>
+#include <htd/IPreprocessedGraph.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Persistent, content-addressed store for preprocessing results and elimination orderings.
+     *
+     *  The entries of the cache are identified by the key returned by computeKey(), a hash of the vertex set and the
+     *  hyperedges of the input graph. Each entry is stored as a text file within the directory of the cache:
+     *      - <key>.<configuration>.preprocessed holds the preprocessed graph computed for the given preprocessor configuration.
+     *      - <key>.ordering holds the best elimination ordering found so far together with its maximum bag size.
+     *
+     *  Files are replaced atomically, hence several processes (or several library instances) may share the same directory.
+     *  Entries which cannot be read or which are inconsistent are ignored.
+     *
+     *  @note Two graphs obtain the same key only if they share the same vertex identifiers, i.e., isomorphic graphs with
+     *  different vertex labels are treated as different graphs.
+     */
+    class DecompositionCache
+    {
+        public:
+            /**
+             *  Constructor for a new decomposition cache.
+             *
+             *  @param[in] directory    The path of the directory in which the cache entries are stored. The directory must exist.
+             */
+            HTD_API DecompositionCache(const std::string & directory);
+
+            HTD_API virtual ~DecompositionCache();
+
+            /**
+             *  Getter for the path of the directory in which the cache entries are stored.
+             *
+             *  @return The path of the directory in which the cache entries are stored.
+             */
+            HTD_API const std::string & directory(void) const;
+
+            /**
+             *  Compute the key which identifies the entries of the given graph.
+             *
+             *  The key does not depend on the order in which vertices and hyperedges were added to the graph.
+             *
+             *  @param[in] graph    The input graph.
+             *
+             *  @return The key which identifies the entries of the given graph.
+             */
+            HTD_API static std::string computeKey(const htd::IMultiHypergraph & graph);
+
+            /**
+             *  Load the preprocessed graph stored for the given key and preprocessor configuration.
+             *
+             *  @param[in] key              The key of the input graph.
+             *  @param[in] configuration    The identifier of the preprocessor configuration.
+             *
+             *  @return The stored preprocessed graph or nullptr if no valid entry exists. The caller takes ownership of the result.
+             */
+            HTD_API htd::IPreprocessedGraph * loadPreprocessedGraph(const std::string & key, const std::string & configuration) const;
+
+            /**
+             *  Store a preprocessed graph for the given key and preprocessor configuration.
+             *
+             *  @param[in] key                  The key of the input graph.
+             *  @param[in] configuration        The identifier of the preprocessor configuration.
+             *  @param[in] preprocessedGraph    The preprocessed graph which shall be stored.
+             *
+             *  @return True if the entry was written successfully, false otherwise.
+             */
+            HTD_API bool storePreprocessedGraph(const std::string & key, const std::string & configuration, const htd::IPreprocessedGraph & preprocessedGraph) const;
+
+            /**
+             *  Load the best elimination ordering stored for the given key.
+             *
+             *  @param[in] key          The key of the input graph.
+             *  @param[out] ordering    The vector to which the stored ordering shall be written.
+             *  @param[out] maxBagSize  The maximum bag size of the decomposition induced by the stored ordering.
+             *
+             *  @return True if a valid entry exists, false otherwise. In the latter case, the output parameters are not modified.
+             */
+            HTD_API bool loadOrdering(const std::string & key, std::vector<htd::vertex_t> & ordering, std::size_t & maxBagSize) const;
+
+            /**
+             *  Load the best elimination ordering stored for the given key, but only if it was not claimed before via the same cache object.
+             *
+             *  Decomposition algorithms use this function to start from the stored ordering exactly once, all subsequent
+             *  requests for the same key within the same cache object fail so that repeated runs explore new orderings.
+             *
+             *  @param[in] key          The key of the input graph.
+             *  @param[out] ordering    The vector to which the stored ordering shall be written.
+             *  @param[out] maxBagSize  The maximum bag size of the decomposition induced by the stored ordering.
+             *
+             *  @return True if a valid entry exists and it was not claimed before, false otherwise.
+             */
+            HTD_API bool claimOrdering(const std::string & key, std::vector<htd::vertex_t> & ordering, std::size_t & maxBagSize) const;
+
+            /**
+             *  Store an elimination ordering for the given key in case that it is better than the stored one.
+             *
+             *  @param[in] key          The key of the input graph.
+             *  @param[in] ordering     The elimination ordering.
+             *  @param[in] maxBagSize   The maximum bag size of the decomposition induced by the ordering.
+             *
+             *  @return True if the ordering replaced the stored entry, false otherwise.
+             */
+            HTD_API bool storeOrdering(const std::string & key, const std::vector<htd::vertex_t> & ordering, std::size_t maxBagSize) const;
+
+        protected:
+            /**
+             *  Copy assignment operator for a decomposition cache.
+             *
+             *  @note This operator is protected to prevent assignments to an already initialized cache.
+             */
+            DecompositionCache & operator=(const DecompositionCache &) { return *this; }
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_DECOMPOSITIONCACHE_HPP */
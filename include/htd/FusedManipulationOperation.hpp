@@ -0,0 +1,146 @@
+/*
+ * File:   FusedManipulationOperation.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_FUSEDMANIPULATIONOPERATION_HPP
+#define HTD_HTD_FUSEDMANIPULATIONOPERATION_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/ITreeDecompositionManipulationOperation.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Implementation of a manipulation operation which applies a sequence of manipulation operations to a tree decomposition.
+     *
+     *  Consecutive operations which are local and which create or remove tree nodes are executed as stages of a single
+     *  post-order traversal of the decomposition: The nodes are processed in small batches and each batch passes through
+     *  all stages before the next batch is considered. Nodes created by a stage are handed to the subsequent stages of the
+     *  same batch. All other operations (non-local operations and operations which only add labels) are applied to the
+     *  whole decomposition at their position in the sequence.
+     */
+    class FusedManipulationOperation : public virtual htd::ITreeDecompositionManipulationOperation
+    {
+        public:
+            /**
+             *  Constructor for a new manipulation operation of type FusedManipulationOperation.
+             *
+             *  @param[in] manager  The management instance to which the new manipulation operation belongs.
+             */
+            HTD_API FusedManipulationOperation(const htd::LibraryInstance * const manager);
+
+            /**
+             *  Constructor for a new manipulation operation of type FusedManipulationOperation.
+             *
+             *  @note When calling this method the control over the memory regions of the manipulation operations is transferred to the
+             *  fused manipulation operation. Deleting a manipulation operation provided to this constructor outside the fused manipulation
+             *  operation or assigning the same manipulation operation multiple times will lead to undefined behavior.
+             *
+             *  @param[in] manager                  The management instance to which the new manipulation operation belongs.
+             *  @param[in] manipulationOperations   The manipulation operations which shall be applied. The manipulation operations are applied in the given order.
+             */
+            HTD_API FusedManipulationOperation(const htd::LibraryInstance * const manager, const std::vector<htd::ITreeDecompositionManipulationOperation *> & manipulationOperations);
+
+            HTD_API virtual ~FusedManipulationOperation();
+
+            HTD_API void apply(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition) const HTD_OVERRIDE;
+
+            HTD_API void apply(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition, const std::vector<htd::vertex_t> & relevantVertices, std::vector<htd::vertex_t> & createdVertices, std::vector<htd::vertex_t> & removedVertices) const HTD_OVERRIDE;
+
+            HTD_API void apply(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition, const std::vector<htd::ILabelingFunction *> & labelingFunctions) const HTD_OVERRIDE;
+
+            HTD_API void apply(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition, const std::vector<htd::vertex_t> & relevantVertices, const std::vector<htd::ILabelingFunction *> & labelingFunctions, std::vector<htd::vertex_t> & createdVertices, std::vector<htd::vertex_t> & removedVertices) const HTD_OVERRIDE;
+
+            HTD_API bool isLocalOperation(void) const HTD_OVERRIDE;
+
+            HTD_API bool createsTreeNodes(void) const HTD_OVERRIDE;
+
+            HTD_API bool removesTreeNodes(void) const HTD_OVERRIDE;
+
+            HTD_API bool modifiesBagContents(void) const HTD_OVERRIDE;
+
+            HTD_API bool createsSubsetMaximalBags(void) const HTD_OVERRIDE;
+
+            HTD_API bool createsLocationDependendLabels(void) const HTD_OVERRIDE;
+
+            /**
+             *  Add a new manipulation operation which shall be applied after the manipulation operations added so far.
+             *
+             *  @note When calling this method the control over the memory region of the manipulation operation is transferred to the fused
+             *  manipulation operation. Deleting the manipulation operation provided to this method outside the fused manipulation operation
+             *  or assigning the same manipulation operation multiple times will lead to undefined behavior.
+             *
+             *  @param[in] manipulationOperation    The manipulation operation which shall be applied.
+             */
+            HTD_API void addManipulationOperation(htd::ITreeDecompositionManipulationOperation * manipulationOperation);
+
+            /**
+             *  Add additional manipulation operations which shall be applied after the manipulation operations added so far. The manipulation operations are applied in the given order.
+             *
+             *  @note When calling this method the control over the memory regions of the manipulation operations is transferred to the
+             *  fused manipulation operation. Deleting a manipulation operation provided to this method outside the fused manipulation
+             *  operation or assigning the same manipulation operation multiple times will lead to undefined behavior.
+             *
+             *  @param[in] manipulationOperations   The manipulation operations which shall be applied.
+             */
+            HTD_API void addManipulationOperations(const std::vector<htd::ITreeDecompositionManipulationOperation *> & manipulationOperations);
+
+            /**
+             *  Getter for the number of passes over the decomposition which are performed when the manipulation operation is applied to a whole decomposition.
+             *
+             *  @note Each maximal sequence of fusable manipulation operations accounts for a single pass, each other manipulation operation for a pass on its own.
+             *
+             *  @return The number of passes over the decomposition which are performed when the manipulation operation is applied to a whole decomposition.
+             */
+            HTD_API std::size_t passCount(void) const;
+
+            HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            HTD_API FusedManipulationOperation * clone(void) const HTD_OVERRIDE;
+#else
+            /**
+             *  Create a deep copy of the current decomposition manipulation operation.
+             *
+             *  @return A new FusedManipulationOperation object identical to the current decomposition manipulation operation.
+             */
+            HTD_API FusedManipulationOperation * clone(void) const;
+
+            HTD_API htd::IDecompositionManipulationOperation * cloneDecompositionManipulationOperation(void) const HTD_OVERRIDE;
+
+            HTD_API htd::ITreeDecompositionManipulationOperation * cloneTreeDecompositionManipulationOperation(void) const HTD_OVERRIDE;
+#endif
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_FUSEDMANIPULATIONOPERATION_HPP */
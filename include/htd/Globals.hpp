@@ -32,6 +32,7 @@
 #include <htd/Vertex.hpp>
 
 #include <cstdlib>
+#include <cstdint>
 
 namespace htd
 {
@@ -39,6 +40,44 @@ namespace htd
      *  Datatype for indices.
      */
     typedef std::size_t index_t;
+
+    /**
+     *  Selector for the datatype of counters, edge indices and priorities within the internal data structures of algorithms.
+     *
+     *  @tparam Compact A boolean flag indicating whether the compact 32-bit datatype shall be selected.
+     */
+    template <bool Compact>
+    struct CountTypeSelector
+    {
+        /**
+         *  The selected datatype.
+         */
+        typedef std::size_t type;
+    };
+
+    /**
+     *  Selector for the datatype of counters, edge indices and priorities within the internal data structures of algorithms.
+     */
+    template <>
+    struct CountTypeSelector<true>
+    {
+        /**
+         *  The selected datatype.
+         */
+        typedef std::uint_least32_t type;
+    };
+
+#ifdef HTD_USE_COMPACT_INDICES
+    /**
+     *  Datatype for counters, edge indices and priorities within the internal data structures of algorithms.
+     */
+    typedef htd::CountTypeSelector<true>::type count_t;
+#else
+    /**
+     *  Datatype for counters, edge indices and priorities within the internal data structures of algorithms.
+     */
+    typedef htd::CountTypeSelector<false>::type count_t;
+#endif
 }
 
 #endif /* HTD_HTD_GLOBALS_HPP */
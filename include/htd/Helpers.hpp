@@ -43,9 +43,11 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <random>
 #include <set>
 #include <string>
 #include <tuple>
+#include <type_traits>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -325,18 +327,95 @@ namespace htd
         }
     }
 
-    template < typename T, typename Collection >
-    const T & selectRandomElement(const Collection & collection)
+    /**
+     *  Access the pseudo-random number generator of the calling thread.
+     *
+     *  Each thread owns a separate generator, hence randomized decisions of concurrent workers neither contend on a
+     *  global lock nor repeat each other. Unless seedRandomNumberGenerator() was called on the thread, the generator
+     *  is seeded with a value obtained from std::rand() at the start of each top-level call of a randomized algorithm
+     *  (see RandomNumberGeneratorScope), hence std::srand() keeps controlling the random decisions of the library.
+     *
+     *  @return The pseudo-random number generator of the calling thread.
+     */
+    HTD_API std::mt19937 & randomNumberGenerator(void);
+
+    /**
+     *  Seed the pseudo-random number generator of the calling thread.
+     *
+     *  @note After calling this function, the generator of the calling thread is no longer re-seeded from std::rand().
+     *
+     *  @param[in] seed The new seed of the pseudo-random number generator of the calling thread.
+     */
+    HTD_API void seedRandomNumberGenerator(unsigned int seed);
+
+    /**
+     *  Scope guard which marks a call of a randomized algorithm on the calling thread.
+     *
+     *  When the outermost scope of a thread is entered and seedRandomNumberGenerator() was not called on the thread,
+     *  the pseudo-random number generator of the thread is re-seeded with a value obtained from std::rand(). Thus,
+     *  calling std::srand() with the same seed before two runs of an algorithm leads to the same random decisions.
+     */
+    class RandomNumberGeneratorScope
+    {
+        public:
+            /**
+             *  Constructor for a new scope guard.
+             */
+            HTD_API RandomNumberGeneratorScope(void);
+
+            /**
+             *  Destructor of a scope guard.
+             */
+            HTD_API ~RandomNumberGeneratorScope();
+
+            /**
+             *  Copy constructor of a scope guard.
+             *
+             *  @note Scope guards are bound to the block in which they are created, hence they must not be copied.
+             */
+            RandomNumberGeneratorScope(const RandomNumberGeneratorScope &) = delete;
+
+            /**
+             *  Copy assignment operator of a scope guard.
+             *
+             *  @note Scope guards are bound to the block in which they are created, hence they must not be copied.
+             */
+            RandomNumberGeneratorScope & operator=(const RandomNumberGeneratorScope &) = delete;
+    };
+
+    /**
+     *  Select a random element of a non-empty collection.
+     *
+     *  @param[in] collection   The collection from which an element shall be selected.
+     *  @param[in] generator    The pseudo-random number generator which shall be used.
+     *
+     *  @return A reference to the selected element.
+     */
+    template < typename T, typename Collection, typename Generator >
+    const T & selectRandomElement(const Collection & collection, Generator & generator)
     {
+        HTD_ASSERT(collection.size() > 0)
+
         auto position = collection.begin();
 
-        /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-        // coverity[dont_call]
-        std::advance(position, std::rand() % collection.size());
+        std::advance(position, std::uniform_int_distribution<std::size_t>(0, collection.size() - 1)(generator));
 
         return *position;
     }
 
+    /**
+     *  Select a random element of a non-empty collection using the pseudo-random number generator of the calling thread.
+     *
+     *  @param[in] collection   The collection from which an element shall be selected.
+     *
+     *  @return A reference to the selected element.
+     */
+    template < typename T, typename Collection >
+    const T & selectRandomElement(const Collection & collection)
+    {
+        return selectRandomElement<T>(collection, htd::randomNumberGenerator());
+    }
+
     /**
      *  Check whether a collection is sorted in ascending order and free of duplicates.
      *
@@ -385,18 +464,84 @@ namespace htd
      *  @param[out] resultOnlySet2      The set of vertices which are found only in the second set, sorted in ascending order.
      *  @param[out] resultIntersection  The set of vertices which are found in both sets, sorted in ascending order.
      */
-    void decompose_sets(const std::vector<htd::vertex_t> & set1,
-                        const std::vector<htd::vertex_t> & set2,
-                        std::vector<htd::vertex_t> & resultOnlySet1,
-                        std::vector<htd::vertex_t> & resultOnlySet2,
-                        std::vector<htd::vertex_t> & resultIntersection) HTD_NOEXCEPT;
+    HTD_API void decompose_sets(const std::vector<htd::vertex_t> & set1,
+                                const std::vector<htd::vertex_t> & set2,
+                                std::vector<htd::vertex_t> & resultOnlySet1,
+                                std::vector<htd::vertex_t> & resultOnlySet2,
+                                std::vector<htd::vertex_t> & resultIntersection) HTD_NOEXCEPT;
 
     HTD_API std::pair<std::size_t, std::size_t> symmetric_difference_sizes(const std::vector<htd::vertex_t> & set1, const std::vector<htd::vertex_t> & set2);
 
+    /**
+     *  Compute the size of the intersection of two sets of vertices which are stored in contiguous memory.
+     *
+     *  Depending on the relative sizes of the sets, the computation either uses galloping search in the
+     *  larger set or a block-wise merge which compares whole blocks of vertices at once when SIMD
+     *  instructions are available on the target platform.
+     *
+     *  @param[in] first1   A pointer to the first vertex of the first set. The set must be sorted in ascending order and free of duplicates.
+     *  @param[in] last1    A pointer past the last vertex of the first set.
+     *  @param[in] first2   A pointer to the first vertex of the second set. The set must be sorted in ascending order and free of duplicates.
+     *  @param[in] last2    A pointer past the last vertex of the second set.
+     *
+     *  @return The size of the intersection of the two sets.
+     */
+    HTD_API std::size_t set_intersection_size(const htd::vertex_t * first1, const htd::vertex_t * last1,
+                                              const htd::vertex_t * first2, const htd::vertex_t * last2);
+
+    /**
+     *  Type trait indicating whether a given iterator type refers to vertices which are stored in contiguous memory.
+     */
+    template < typename Iterator >
+    struct is_contiguous_vertex_iterator : public std::integral_constant<bool, std::is_same<Iterator, std::vector<htd::vertex_t>::iterator>::value ||
+                                                                                std::is_same<Iterator, std::vector<htd::vertex_t>::const_iterator>::value ||
+                                                                                std::is_same<Iterator, htd::vertex_t *>::value ||
+                                                                                std::is_same<Iterator, const htd::vertex_t *>::value>
+    {
+
+    };
+
+    /**
+     *  Compute the size of the intersection of two sets of vertices which are stored in contiguous memory.
+     *
+     *  @param[in] first1   An iterator to the begin of the first set, sorted in ascending order and free of duplicates.
+     *  @param[in] last1    An iterator to the end of the first set.
+     *  @param[in] first2   An iterator to the begin of the second set, sorted in ascending order and free of duplicates.
+     *  @param[in] last2    An iterator to the end of the second set.
+     *
+     *  @return The size of the intersection of the two sets.
+     */
+    template < class InputIterator1,
+               class InputIterator2 >
+    std::size_t set_intersection_size(InputIterator1 first1, InputIterator1 last1,
+                                      InputIterator2 first2, InputIterator2 last2,
+                                      std::true_type)
+    {
+        if (first1 == last1 || first2 == last2)
+        {
+            return 0;
+        }
+
+        const htd::vertex_t * begin1 = &(*first1);
+        const htd::vertex_t * begin2 = &(*first2);
+
+        return htd::set_intersection_size(begin1, begin1 + std::distance(first1, last1), begin2, begin2 + std::distance(first2, last2));
+    }
+
     template < class InputIterator1,
                class InputIterator2 >
     std::size_t set_union_size(InputIterator1 first1, InputIterator1 last1,
-                               InputIterator2 first2, InputIterator2 last2)
+                               InputIterator2 first2, InputIterator2 last2,
+                               std::true_type)
+    {
+        return std::distance(first1, last1) + std::distance(first2, last2) - htd::set_intersection_size(first1, last1, first2, last2, std::true_type());
+    }
+
+    template < class InputIterator1,
+               class InputIterator2 >
+    std::size_t set_union_size(InputIterator1 first1, InputIterator1 last1,
+                               InputIterator2 first2, InputIterator2 last2,
+                               std::false_type)
     {
         std::size_t ret = 0;
         
@@ -430,11 +575,31 @@ namespace htd
         
         return ret + std::distance(first2, last2);
     }
-    
+
+    template < class InputIterator1,
+               class InputIterator2 >
+    std::size_t set_union_size(InputIterator1 first1, InputIterator1 last1,
+                               InputIterator2 first2, InputIterator2 last2)
+    {
+        return htd::set_union_size(first1, last1, first2, last2,
+                                   std::integral_constant<bool, htd::is_contiguous_vertex_iterator<InputIterator1>::value &&
+                                                                htd::is_contiguous_vertex_iterator<InputIterator2>::value>());
+    }
+
     template < class InputIterator1,
                class InputIterator2 >
     std::size_t set_difference_size(InputIterator1 first1, InputIterator1 last1,
-                                    InputIterator2 first2, InputIterator2 last2)
+                                    InputIterator2 first2, InputIterator2 last2,
+                                    std::true_type)
+    {
+        return std::distance(first1, last1) - htd::set_intersection_size(first1, last1, first2, last2, std::true_type());
+    }
+
+    template < class InputIterator1,
+               class InputIterator2 >
+    std::size_t set_difference_size(InputIterator1 first1, InputIterator1 last1,
+                                    InputIterator2 first2, InputIterator2 last2,
+                                    std::false_type)
     {
         std::size_t ret = 0;
 
@@ -460,10 +625,21 @@ namespace htd
         return ret + std::distance(first1, last1);
     }
 
+    template < class InputIterator1,
+               class InputIterator2 >
+    std::size_t set_difference_size(InputIterator1 first1, InputIterator1 last1,
+                                    InputIterator2 first2, InputIterator2 last2)
+    {
+        return htd::set_difference_size(first1, last1, first2, last2,
+                                        std::integral_constant<bool, htd::is_contiguous_vertex_iterator<InputIterator1>::value &&
+                                                                     htd::is_contiguous_vertex_iterator<InputIterator2>::value>());
+    }
+
     template < class InputIterator1,
                class InputIterator2 >
     std::size_t set_intersection_size(InputIterator1 first1, InputIterator1 last1,
-                                      InputIterator2 first2, InputIterator2 last2)
+                                      InputIterator2 first2, InputIterator2 last2,
+                                      std::false_type)
     {
         std::size_t ret = 0;
 
@@ -489,6 +665,16 @@ namespace htd
         return ret;
     }
 
+    template < class InputIterator1,
+               class InputIterator2 >
+    std::size_t set_intersection_size(InputIterator1 first1, InputIterator1 last1,
+                                      InputIterator2 first2, InputIterator2 last2)
+    {
+        return htd::set_intersection_size(first1, last1, first2, last2,
+                                          std::integral_constant<bool, htd::is_contiguous_vertex_iterator<InputIterator1>::value &&
+                                                                       htd::is_contiguous_vertex_iterator<InputIterator2>::value>());
+    }
+
     template < class InputIterator1,
                class InputIterator2 >
     bool has_non_empty_set_difference(InputIterator1 first1, InputIterator1 last1,
@@ -547,8 +733,8 @@ namespace htd
         return ret;
     }
 
-    template < typename T >
-    void inplace_merge(std::vector<T> & set1, const std::vector<T> & set2)
+    template < typename T, typename Allocator1, typename Allocator2 >
+    void inplace_merge(std::vector<T, Allocator1> & set1, const std::vector<T, Allocator2> & set2)
     {
         if (set2.size() <= 4)
         {
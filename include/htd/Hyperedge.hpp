@@ -35,6 +35,9 @@ namespace htd
 {
     /**
      *  Class for the efficient storage of hyperedges.
+     *
+     *  The elements are stored directly within the hyperedge. A second, sorted copy of the elements is only kept
+     *  for hyperedges whose elements are not already sorted in ascending order and free of duplicates.
      */
     class Hyperedge
     {
@@ -313,15 +316,26 @@ namespace htd
              */
             HTD_API bool operator!=(const std::vector<htd::vertex_t> & rhs) const;
 
+        private:
+            htd::id_t id_;
+
             /**
-             *  Forward declaration of internal class for storing the element information of a hyperedge.
+             *  The elements of the hyperedge in the order in which they were provided.
              */
-            class IElementInformation;
+            std::vector<htd::vertex_t> elements_;
 
-        private:
-            htd::id_t id_;
+            /**
+             *  The elements of the hyperedge in ascending order without duplicates.
+             *
+             *  @note The vector is only populated when the elements of the hyperedge are not already sorted and duplicate-free.
+             *  Otherwise, the sorted elements are identical to the elements and hence they are not stored a second time.
+             */
+            std::vector<htd::vertex_t> sortedElements_;
 
-            std::unique_ptr<IElementInformation> content_;
+            /**
+             *  Update the sorted elements of the hyperedge after the elements were changed.
+             */
+            void updateSortedElements(void);
     };
 }
 
@@ -116,6 +116,24 @@ namespace htd
 
             HTD_API void setComputeInducedEdgesEnabled(bool computeInducedEdgesEnabled) HTD_OVERRIDE;
 
+            /**
+             *  Getter for the number of threads which are used to compute the covering edges of the bags.
+             *
+             *  @return The number of threads which are used to compute the covering edges of the bags.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of threads which shall be used to compute the covering edges of the bags.
+             *
+             *  @note The covering edges of each bag are computed independently and each thread uses its own set-cover algorithm
+             *  obtained from the set-cover algorithm factory of the management instance. Hence, the resulting decomposition does
+             *  not depend on the number of threads.
+             *
+             *  @param[in] threadCount  The number of threads which shall be used to compute the covering edges of the bags. The value must be greater than zero.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
@@ -0,0 +1,64 @@
+/*
+ * File:   IBoundedTreeDecompositionFitnessFunction.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_IBOUNDEDTREEDECOMPOSITIONFITNESSFUNCTION_HPP
+#define HTD_HTD_IBOUNDEDTREEDECOMPOSITIONFITNESSFUNCTION_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/ITreeDecompositionFitnessFunction.hpp>
+
+namespace htd
+{
+    /**
+     * Interface for fitness functions which are able to bound the fitness value of a tree decomposition before it is post-processed.
+     *
+     * Algorithms like htd::IterativeImprovementTreeDecompositionAlgorithm use the bound to discard decompositions which cannot
+     * improve over the best decomposition found so far before the (potentially expensive) manipulation operations and labeling
+     * functions are applied.
+     */
+    class IBoundedTreeDecompositionFitnessFunction : public htd::ITreeDecompositionFitnessFunction
+    {
+        public:
+            virtual ~IBoundedTreeDecompositionFitnessFunction() = 0;
+
+            /**
+             *  Compute an upper bound for the fitness evaluation of a given tree decomposition.
+             *
+             *  The returned value must be greater than or equal to the fitness evaluation of each decomposition which can be obtained
+             *  from the given one by applying the manipulation operations and labeling functions of the algorithm using the fitness
+             *  function. For instance, a fitness function rating decompositions by their width may return the fitness evaluation of
+             *  the width of the given decomposition if none of the manipulation operations increases the maximum bag size.
+             *
+             *  @param[in] graph            The graph from which the decomposition was computed.
+             *  @param[in] decomposition    The tree decomposition before the manipulation operations and labeling functions are applied.
+             *
+             *  @return An upper bound for the fitness evaluation of the given tree decomposition.
+             */
+            virtual htd::FitnessEvaluation * fitnessBound(const htd::IMultiHypergraph & graph, const htd::ITreeDecomposition & decomposition) const = 0;
+    };
+
+    inline htd::IBoundedTreeDecompositionFitnessFunction::~IBoundedTreeDecompositionFitnessFunction() { }
+}
+
+#endif /* HTD_HTD_IBOUNDEDTREEDECOMPOSITIONFITNESSFUNCTION_HPP */
@@ -0,0 +1,80 @@
+/* 
+ * File:   IMemoryResource.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_IMEMORYRESOURCE_HPP
+#define HTD_HTD_IMEMORYRESOURCE_HPP
+
+#include <htd/Globals.hpp>
+
+#include <cstddef>
+
+namespace htd
+{
+    /**
+     *  Interface for classes which provide raw memory to the algorithms and data structures of a library instance.
+     */
+    class IMemoryResource
+    {
+        public:
+            /**
+             *  Destructor for a IMemoryResource object.
+             *
+             *  @note Depending on the implementation, the memory regions which were not yet deallocated are released when the memory resource is destroyed.
+             */
+            virtual ~IMemoryResource() = 0;
+
+            /**
+             *  Allocate a memory region of the given size.
+             *
+             *  @param[in] bytes        The size of the memory region in bytes.
+             *  @param[in] alignment    The alignment of the memory region. It must be a power of two not exceeding alignof(std::max_align_t).
+             *
+             *  @return A pointer to the allocated memory region.
+             *
+             *  @throws std::bad_alloc if the memory region cannot be allocated.
+             */
+            virtual void * allocate(std::size_t bytes, std::size_t alignment) = 0;
+
+            /**
+             *  Deallocate a memory region which was allocated by the memory resource.
+             *
+             *  @param[in] pointer      The pointer to the memory region.
+             *  @param[in] bytes        The size of the memory region in bytes, as provided to allocate().
+             *  @param[in] alignment    The alignment of the memory region, as provided to allocate().
+             */
+            virtual void deallocate(void * pointer, std::size_t bytes, std::size_t alignment) = 0;
+
+            /**
+             *  Check whether the memory resource can be used by multiple threads at the same time.
+             *
+             *  @return True if the memory resource can be used by multiple threads at the same time, false otherwise.
+             */
+            virtual bool isThreadSafe(void) const = 0;
+    };
+
+    inline htd::IMemoryResource::~IMemoryResource() { }
+}
+
+#endif /* HTD_HTD_IMEMORYRESOURCE_HPP */
@@ -0,0 +1,187 @@
+/* 
+ * File:   Instrumentation.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_INSTRUMENTATION_HPP
+#define HTD_HTD_INSTRUMENTATION_HPP
+
+#include <htd/Globals.hpp>
+
+#include <chrono>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Collection of the timing events and counters recorded by the algorithms of a library instance.
+     *
+     *  Algorithms record the sections of their computation via htd::ScopedTimer and report statistics like the number of
+     *  eliminated vertices via addCounter(). Both only happen if an instrumentation object is assigned to the library
+     *  instance via htd::LibraryInstance::setInstrumentation(), otherwise the recording code reduces to a null pointer check.
+     *
+     *  All recording functions are thread-safe.
+     */
+    class Instrumentation
+    {
+        public:
+            /**
+             *  A timed section of the computation.
+             */
+            struct Event
+            {
+                /**
+                 *  The name of the section.
+                 */
+                std::string name;
+
+                /**
+                 *  The category of the section (e.g., "preprocessing" or "ordering").
+                 */
+                std::string category;
+
+                /**
+                 *  The index of the thread which executed the section, in the order of the first recorded event of each thread.
+                 */
+                std::size_t thread;
+
+                /**
+                 *  The point in time, in microseconds since the creation of the instrumentation object, at which the section started.
+                 */
+                double start;
+
+                /**
+                 *  The duration of the section in microseconds.
+                 */
+                double duration;
+            };
+
+            /**
+             *  Constructor for a new, empty instrumentation object.
+             */
+            HTD_API Instrumentation(void);
+
+            HTD_API virtual ~Instrumentation();
+
+            /**
+             *  Record a timed section of the computation.
+             *
+             *  @param[in] name     The name of the section.
+             *  @param[in] category The category of the section.
+             *  @param[in] start    The point in time at which the section started.
+             *  @param[in] end      The point in time at which the section ended.
+             */
+            HTD_API void recordEvent(const std::string & name, const std::string & category, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end) const;
+
+            /**
+             *  Increase the counter with the given name.
+             *
+             *  @param[in] name     The name of the counter.
+             *  @param[in] value    The value which shall be added to the counter.
+             */
+            HTD_API void addCounter(const std::string & name, std::size_t value) const;
+
+            /**
+             *  Access the recorded events.
+             *
+             *  @return A copy of the recorded events in the order in which they ended.
+             */
+            HTD_API std::vector<htd::Instrumentation::Event> events(void) const;
+
+            /**
+             *  Access the counters.
+             *
+             *  @return The names and values of all counters sorted by name.
+             */
+            HTD_API std::vector<std::pair<std::string, std::size_t>> counters(void) const;
+
+            /**
+             *  Access the value of the counter with the given name.
+             *
+             *  @param[in] name The name of the counter.
+             *
+             *  @return The value of the counter with the given name or 0 if no such counter exists.
+             */
+            HTD_API std::size_t counter(const std::string & name) const;
+
+            /**
+             *  Add the events and counters of another instrumentation object.
+             *
+             *  The events of the other object are shifted to the time scale of the current object and they are
+             *  assigned to threads distinct from the threads of the current object.
+             *
+             *  @param[in] other    The instrumentation object whose data shall be added.
+             */
+            HTD_API void merge(const htd::Instrumentation & other);
+
+            /**
+             *  Remove all recorded events and counters.
+             */
+            HTD_API void clear(void);
+
+            /**
+             *  Write the recorded events and counters in the Chrome trace event format (JSON).
+             *
+             *  The output can be inspected with chrome://tracing or Perfetto. Counters are emitted as counter events at the end of the trace.
+             *
+             *  @param[in] stream   The output stream.
+             */
+            HTD_API void writeChromeTrace(std::ostream & stream) const;
+
+            /**
+             *  Write the recorded events and counters as CSV table with the columns type, name, category, thread, start_us, duration_us and value.
+             *
+             *  @param[in] stream   The output stream.
+             */
+            HTD_API void writeCsv(std::ostream & stream) const;
+
+            /**
+             *  Compute a readable name (e.g., "htd::CompressionOperation") for the given type.
+             *
+             *  @param[in] type The type information.
+             *
+             *  @return A readable name for the given type.
+             */
+            HTD_API static std::string typeName(const std::type_info & type);
+
+        protected:
+            /**
+             *  Copy assignment operator for an instrumentation object.
+             *
+             *  @note This operator is protected to prevent assignments to an already initialized instrumentation object.
+             */
+            Instrumentation & operator=(const Instrumentation &) { return *this; }
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_INSTRUMENTATION_HPP */
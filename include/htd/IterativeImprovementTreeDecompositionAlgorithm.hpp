@@ -45,6 +45,10 @@ namespace htd
      *
      *  Per default, the first decomposition is returned, i.e. only a single iteration is performed.
      *
+     *  If the fitness function implements the interface htd::IBoundedTreeDecompositionFitnessFunction, each
+     *  decomposition whose fitness bound does not exceed the fitness of the best decomposition found so far
+     *  is discarded before the manipulation operations and labeling functions are applied.
+     *
      *  @note The algorithm always returns a valid tree decomposition according to the provided base
      *  decomposition algorithm and the given manipulations (or nullptr) also if it was interrupted
      *  by a call to htd::LibraryInstance::terminate().
@@ -187,6 +191,23 @@ namespace htd
              */
             HTD_API void setNonImprovementLimit(std::size_t nonImprovementLimit);
 
+            /**
+             *  Getter for the number of threads which are used to perform the iterations.
+             *
+             *  @return The number of threads which are used to perform the iterations.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of threads which shall be used to perform the iterations.
+             *
+             *  @note Each additional thread operates on its own copies of the base decomposition algorithm, the fitness function,
+             *  the manipulation operations and the labeling functions. The progress callback is never invoked concurrently.
+             *
+             *  @param[in] threadCount  The number of threads which shall be used to perform the iterations. The value must be greater than zero.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
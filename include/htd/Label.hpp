@@ -31,6 +31,7 @@
 
 #include <memory>
 #include <stdexcept>
+#include <utility>
 
 namespace htd
 {
@@ -46,7 +47,7 @@ namespace htd
              *
              *  @param[in] value    The value of the label.
              */
-            Label(T value) : value_(std::make_shared<T>(value))
+            Label(T value) : value_(std::make_shared<T>(std::move(value)))
             {
 
             }
@@ -171,6 +171,21 @@ namespace htd
      */
     class GraphSeparatorAlgorithmFactory;
 
+    /**
+     *  Forward declaration of class htd::DecompositionCache.
+     */
+    class DecompositionCache;
+
+    /**
+     *  Forward declaration of class htd::Instrumentation.
+     */
+    class Instrumentation;
+
+    /**
+     *  Forward declaration of class htd::MemoryManager.
+     */
+    class MemoryManager;
+
     /**
      *  Central management class of a library instance.
      */
@@ -511,6 +526,62 @@ namespace htd
              */
             HTD_API const htd::GraphSeparatorAlgorithmFactory & graphSeparatorAlgorithmFactory(void) const;
 
+            /**
+             *  Access the persistent cache for preprocessing results and elimination orderings used by the algorithms of the library instance.
+             *
+             *  @return The decomposition cache of the library instance or nullptr if no cache is configured (default).
+             */
+            HTD_API const htd::DecompositionCache * decompositionCache(void) const;
+
+            /**
+             *  Set the persistent cache for preprocessing results and elimination orderings used by the algorithms of the library instance.
+             *
+             *  @note When calling this method the control over the memory region of the cache is transferred to the library instance.
+             *  Deleting the cache provided to this method outside the library instance will lead to undefined behavior.
+             *
+             *  @param[in] decompositionCache   The new decomposition cache or nullptr in order to disable caching.
+             */
+            HTD_API void setDecompositionCache(htd::DecompositionCache * decompositionCache);
+
+            /**
+             *  Access the instrumentation object which records timing events and counters of the algorithms of the library instance.
+             *
+             *  @return The instrumentation object of the library instance or nullptr if instrumentation is disabled (default).
+             */
+            HTD_API htd::Instrumentation * instrumentation(void);
+
+            /**
+             *  Access the instrumentation object which records timing events and counters of the algorithms of the library instance.
+             *
+             *  @return The instrumentation object of the library instance or nullptr if instrumentation is disabled (default).
+             */
+            HTD_API const htd::Instrumentation * instrumentation(void) const;
+
+            /**
+             *  Set the instrumentation object which records timing events and counters of the algorithms of the library instance.
+             *
+             *  @note When calling this method the control over the memory region of the instrumentation object is transferred to the
+             *  library instance. Deleting the instrumentation object provided to this method outside the library instance will lead
+             *  to undefined behavior.
+             *
+             *  @param[in] instrumentation  The new instrumentation object or nullptr in order to disable instrumentation.
+             */
+            HTD_API void setInstrumentation(htd::Instrumentation * instrumentation);
+
+            /**
+             *  Access the memory manager which provides the memory resources of the library instance and accounts for their allocations.
+             *
+             *  @return The memory manager of the library instance.
+             */
+            HTD_API htd::MemoryManager & memoryManager(void);
+
+            /**
+             *  Access the memory manager which provides the memory resources of the library instance and accounts for their allocations.
+             *
+             *  @return The memory manager of the library instance.
+             */
+            HTD_API const htd::MemoryManager & memoryManager(void) const;
+
         private:
             struct Implementation;
 
@@ -0,0 +1,165 @@
+/* 
+ * File:   LocalSearchOrderingAlgorithm.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_LOCALSEARCHORDERINGALGORITHM_HPP
+#define HTD_HTD_LOCALSEARCHORDERINGALGORITHM_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/IWidthLimitableOrderingAlgorithm.hpp>
+
+namespace htd
+{
+    /**
+     *  Implementation of the IWidthLimitableOrderingAlgorithm interface which improves the vertex elimination
+     *  ordering of a given ordering algorithm via simulated annealing.
+     *
+     *  Starting from the initial ordering, the algorithm repeatedly applies a random local move (swapping two
+     *  vertices, moving a block of consecutive vertices, or re-inserting a single vertex at a new position, where
+     *  the vertex is preferably one which induces a bag of maximum size) and evaluates the resulting ordering.
+     *  Orderings are rated primarily by the maximum bag size and secondarily by the number of fill edges. A move
+     *  leading to a worse rating is accepted with a probability which decreases with the temperature. The
+     *  temperature decreases linearly from the initial temperature to zero, hence the final steps of the search
+     *  perform an iterated local search which only accepts moves which do not worsen the rating.
+     *
+     *  The changes of each elimination step are recorded in a journal, so the state of the elimination process can be
+     *  moved to any position of the ordering by undoing or performing the steps in between. Hence, evaluating a move
+     *  only requires to re-eliminate the vertices from the first modified position and the evaluation is aborted as
+     *  soon as the move cannot be accepted any more.
+     *
+     *  In case that multiple threads are used, each thread performs an independent search starting from its own
+     *  initial ordering and the best ordering found by any of the threads is returned.
+     */
+    class LocalSearchOrderingAlgorithm : public virtual htd::IWidthLimitableOrderingAlgorithm
+    {
+        public:
+            /**
+             *  Constructor for a new ordering algorithm of type LocalSearchOrderingAlgorithm.
+             *
+             *  @param[in] manager   The management instance to which the new algorithm belongs.
+             */
+            HTD_API LocalSearchOrderingAlgorithm(const htd::LibraryInstance * const manager);
+
+            /**
+             *  Copy constructor for a htd::LocalSearchOrderingAlgorithm object.
+             *
+             *  @param[in] original The original htd::LocalSearchOrderingAlgorithm object.
+             */
+            HTD_API LocalSearchOrderingAlgorithm(const htd::LocalSearchOrderingAlgorithm & original);
+
+            HTD_API virtual ~LocalSearchOrderingAlgorithm();
+
+            HTD_API htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API htd::IWidthLimitedVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API htd::IWidthLimitedVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
+
+            /**
+             *  Set the ordering algorithm which shall be used to compute the initial vertex elimination ordering.
+             *
+             *  @param[in] algorithm    The ordering algorithm which shall be used to compute the initial vertex elimination ordering.
+             *
+             *  @note When calling this method the control over the memory region of the initial ordering algorithm is transferred to the
+             *  ordering algorithm. Deleting the ordering algorithm provided to this method outside the current ordering algorithm or
+             *  assigning the same ordering algorithm multiple times will lead to undefined behavior.
+             */
+            HTD_API void setOrderingAlgorithm(htd::IOrderingAlgorithm * algorithm);
+
+            /**
+             *  Getter for the number of local moves which are evaluated by each thread.
+             *
+             *  @return The number of local moves which are evaluated by each thread.
+             */
+            HTD_API std::size_t stepCount(void) const;
+
+            /**
+             *  Set the number of local moves which shall be evaluated by each thread.
+             *
+             *  @param[in] stepCount    The number of local moves which shall be evaluated by each thread.
+             */
+            HTD_API void setStepCount(std::size_t stepCount);
+
+            /**
+             *  Getter for the initial temperature of the simulated annealing process.
+             *
+             *  @return The initial temperature of the simulated annealing process.
+             */
+            HTD_API double initialTemperature(void) const;
+
+            /**
+             *  Set the initial temperature of the simulated annealing process.
+             *
+             *  @note A move increasing the maximum bag size by one is accepted with probability e^(-1/t) at temperature t. An initial
+             *  temperature of zero turns the algorithm into an iterated local search which only accepts moves which do not worsen the rating.
+             *
+             *  @param[in] initialTemperature   The initial temperature of the simulated annealing process. The value must not be negative.
+             */
+            HTD_API void setInitialTemperature(double initialTemperature);
+
+            /**
+             *  Getter for the number of threads which perform independent searches.
+             *
+             *  @return The number of threads which perform independent searches.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of threads which shall perform independent searches.
+             *
+             *  @param[in] threadCount  The number of threads which shall perform independent searches. The value must be greater than zero.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            HTD_API LocalSearchOrderingAlgorithm * clone(void) const HTD_OVERRIDE;
+#else
+            HTD_API LocalSearchOrderingAlgorithm * clone(void) const;
+
+            HTD_API htd::IOrderingAlgorithm * cloneOrderingAlgorithm(void) const HTD_OVERRIDE;
+
+            HTD_API htd::IWidthLimitableOrderingAlgorithm * cloneWidthLimitableOrderingAlgorithm(void) const HTD_OVERRIDE;
+#endif
+
+        protected:
+            /**
+             *  Copy assignment operator for an ordering algorithm.
+             *
+             *  @note This operator is protected to prevent assignments to an already initialized algorithm.
+             */
+            LocalSearchOrderingAlgorithm & operator=(const LocalSearchOrderingAlgorithm &) { return *this; }
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_LOCALSEARCHORDERINGALGORITHM_HPP */
@@ -0,0 +1,180 @@
+/* 
+ * File:   MemoryManager.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_MEMORYMANAGER_HPP
+#define HTD_HTD_MEMORYMANAGER_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/IMemoryResource.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Forward declaration of class htd::LibraryInstance.
+     */
+    class LibraryInstance;
+
+    /**
+     *  Class managing the memory resources of a library instance.
+     *
+     *  Each subsystem (e.g., "tree" for the nodes of trees and decompositions or "ordering" for the working data of
+     *  ordering algorithms) obtains its memory from a dedicated memory resource. The memory manager keeps track of the
+     *  number of bytes currently allocated (live bytes) and of the maximum number of bytes allocated at any point in
+     *  time (peak bytes), both per subsystem and in total.
+     *
+     *  When the total number of live bytes exceeds the memory limit, the library instance is terminated, i.e., the
+     *  algorithms stop as soon as possible and return the best result found so far. The allocation which exceeds the
+     *  limit is still served.
+     *
+     *  @note Only the allocations performed via the memory resources of the memory manager are accounted for.
+     */
+    class MemoryManager
+    {
+        public:
+            /**
+             *  Constructor for a new memory manager.
+             *
+             *  By default, the subsystem "tree" uses a htd::PoolMemoryResource and all other subsystems use the global operators new and delete.
+             *
+             *  @param[in] manager  The management instance which shall be terminated when the memory limit is exceeded.
+             */
+            HTD_API MemoryManager(htd::LibraryInstance * const manager);
+
+            /**
+             *  Copy constructor for a memory manager.
+             *
+             *  @param[in] original The original memory manager which shall be copied.
+             */
+            HTD_API MemoryManager(const MemoryManager & original) = delete;
+
+            /**
+             *  Copy assignment operator for a memory manager.
+             *
+             *  @param[in] original The original memory manager which shall be copied.
+             */
+            HTD_API MemoryManager & operator=(const MemoryManager & original) = delete;
+
+            HTD_API virtual ~MemoryManager();
+
+            /**
+             *  Access the memory resource of the given subsystem.
+             *
+             *  The returned memory resource accounts for all allocations and deallocations and it can be used by multiple
+             *  threads at the same time. It stays valid as long as it is referenced, even if the memory manager is destroyed
+             *  in the meantime. Hence, data structures can safely release their memory after the library instance is gone.
+             *
+             *  @param[in] subsystem    The name of the subsystem.
+             *
+             *  @return The memory resource of the given subsystem.
+             */
+            HTD_API std::shared_ptr<htd::IMemoryResource> resource(const std::string & subsystem) const;
+
+            /**
+             *  Set the memory resource which shall be used by the given subsystem.
+             *
+             *  @note When calling this method the control over the memory region of the memory resource is transferred to
+             *  the memory manager. The memory resource of a subsystem can only be replaced while no memory regions of the
+             *  subsystem are allocated. Allocations which are requested by other threads in the meantime wait until the
+             *  memory resource is replaced.
+             *
+             *  @param[in] subsystem    The name of the subsystem.
+             *  @param[in] resource     The new memory resource of the subsystem (nullptr for the global operators new and delete).
+             *
+             *  @throws std::logic_error If memory regions of the subsystem are still allocated. The given memory resource is deleted in this case.
+             */
+            HTD_API void setResource(const std::string & subsystem, htd::IMemoryResource * resource);
+
+            /**
+             *  Getter for the names of all subsystems which were accessed so far, sorted in ascending order.
+             *
+             *  @return The names of all subsystems which were accessed so far.
+             */
+            HTD_API std::vector<std::string> subsystems(void) const;
+
+            /**
+             *  Getter for the number of bytes currently allocated by all subsystems.
+             *
+             *  @return The number of bytes currently allocated by all subsystems.
+             */
+            HTD_API std::size_t liveBytes(void) const;
+
+            /**
+             *  Getter for the number of bytes currently allocated by the given subsystem.
+             *
+             *  @param[in] subsystem    The name of the subsystem.
+             *
+             *  @return The number of bytes currently allocated by the given subsystem.
+             */
+            HTD_API std::size_t liveBytes(const std::string & subsystem) const;
+
+            /**
+             *  Getter for the maximum number of bytes allocated by all subsystems at the same time.
+             *
+             *  @return The maximum number of bytes allocated by all subsystems at the same time.
+             */
+            HTD_API std::size_t peakBytes(void) const;
+
+            /**
+             *  Getter for the maximum number of bytes allocated by the given subsystem at the same time.
+             *
+             *  @param[in] subsystem    The name of the subsystem.
+             *
+             *  @return The maximum number of bytes allocated by the given subsystem at the same time.
+             */
+            HTD_API std::size_t peakBytes(const std::string & subsystem) const;
+
+            /**
+             *  Getter for the memory limit.
+             *
+             *  @return The maximum number of live bytes before the library instance is terminated. The value (std::size_t)-1 indicates that there is no limit.
+             */
+            HTD_API std::size_t memoryLimit(void) const;
+
+            /**
+             *  Set the memory limit.
+             *
+             *  @param[in] memoryLimit  The maximum number of live bytes before the library instance is terminated. The value (std::size_t)-1 indicates that there is no limit.
+             */
+            HTD_API void setMemoryLimit(std::size_t memoryLimit);
+
+            /**
+             *  Check whether the memory limit was exceeded.
+             *
+             *  @return True if the memory limit was exceeded at any point in time, false otherwise.
+             */
+            HTD_API bool isMemoryLimitExceeded(void) const;
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_MEMORYMANAGER_HPP */
@@ -0,0 +1,140 @@
+/* 
+ * File:   MemoryResourceAllocator.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_MEMORYRESOURCEALLOCATOR_HPP
+#define HTD_HTD_MEMORYRESOURCEALLOCATOR_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/IMemoryResource.hpp>
+
+#include <cstddef>
+
+namespace htd
+{
+    /**
+     *  Allocator which allows standard containers to obtain their memory from a memory resource.
+     *
+     *  @note The memory resource must outlive all containers using an allocator referring to it.
+     */
+    template <typename T>
+    class MemoryResourceAllocator
+    {
+        public:
+            /**
+             *  The type of the allocated elements.
+             */
+            typedef T value_type;
+
+            /**
+             *  Constructor for a new allocator.
+             *
+             *  @param[in] resource The memory resource from which the memory shall be obtained.
+             */
+            MemoryResourceAllocator(htd::IMemoryResource * resource) HTD_NOEXCEPT : resource_(resource)
+            {
+                HTD_ASSERT(resource != nullptr)
+            }
+
+            /**
+             *  Copy constructor for an allocator of a different element type.
+             *
+             *  @param[in] original The original allocator.
+             */
+            template <typename U>
+            MemoryResourceAllocator(const MemoryResourceAllocator<U> & original) HTD_NOEXCEPT : resource_(original.resource())
+            {
+
+            }
+
+            /**
+             *  Allocate memory for the given number of elements.
+             *
+             *  @param[in] count    The number of elements.
+             *
+             *  @return A pointer to the allocated memory.
+             */
+            T * allocate(std::size_t count)
+            {
+                return static_cast<T *>(resource_->allocate(count * sizeof(T), alignof(T)));
+            }
+
+            /**
+             *  Deallocate memory which was allocated by an equal allocator.
+             *
+             *  @param[in] pointer  The pointer to the allocated memory.
+             *  @param[in] count    The number of elements, as provided to allocate().
+             */
+            void deallocate(T * pointer, std::size_t count)
+            {
+                resource_->deallocate(pointer, count * sizeof(T), alignof(T));
+            }
+
+            /**
+             *  Getter for the memory resource from which the memory is obtained.
+             *
+             *  @return The memory resource from which the memory is obtained.
+             */
+            htd::IMemoryResource * resource(void) const HTD_NOEXCEPT
+            {
+                return resource_;
+            }
+
+        private:
+            /**
+             *  The memory resource from which the memory is obtained.
+             */
+            htd::IMemoryResource * resource_;
+    };
+
+    /**
+     *  Equality operator for allocators.
+     *
+     *  @param[in] lhs  The left-hand side of the comparison.
+     *  @param[in] rhs  The right-hand side of the comparison.
+     *
+     *  @return True if both allocators refer to the same memory resource, false otherwise.
+     */
+    template <typename T, typename U>
+    bool operator==(const htd::MemoryResourceAllocator<T> & lhs, const htd::MemoryResourceAllocator<U> & rhs) HTD_NOEXCEPT
+    {
+        return lhs.resource() == rhs.resource();
+    }
+
+    /**
+     *  Inequality operator for allocators.
+     *
+     *  @param[in] lhs  The left-hand side of the comparison.
+     *  @param[in] rhs  The right-hand side of the comparison.
+     *
+     *  @return True if the allocators refer to different memory resources, false otherwise.
+     */
+    template <typename T, typename U>
+    bool operator!=(const htd::MemoryResourceAllocator<T> & lhs, const htd::MemoryResourceAllocator<U> & rhs) HTD_NOEXCEPT
+    {
+        return lhs.resource() != rhs.resource();
+    }
+}
+
+#endif /* HTD_HTD_MEMORYRESOURCEALLOCATOR_HPP */
@@ -0,0 +1,100 @@
+/* 
+ * File:   MonotonicMemoryResource.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_MONOTONICMEMORYRESOURCE_HPP
+#define HTD_HTD_MONOTONICMEMORYRESOURCE_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/IMemoryResource.hpp>
+
+#include <memory>
+
+namespace htd
+{
+    /**
+     *  Memory resource which serves allocations by advancing a pointer within large chunks of memory (arena allocation).
+     *
+     *  Deallocating a memory region has no effect, all chunks are released at once when release() is called or when the
+     *  memory resource is destroyed. Hence, the memory resource is suitable for short-lived scratch data, e.g., the data
+     *  structures of a single iteration of an algorithm.
+     *
+     *  @note The memory resource is not thread-safe.
+     */
+    class MonotonicMemoryResource : public htd::IMemoryResource
+    {
+        public:
+            /**
+             *  Constructor for a new memory resource of type MonotonicMemoryResource.
+             *
+             *  @param[in] upstream     The memory resource from which the chunks are obtained (nullptr for the global operators new and delete).
+             *                          The upstream memory resource must outlive the new memory resource.
+             *  @param[in] chunkSize    The size of the first chunk in bytes. Each subsequent chunk is twice as large as its predecessor.
+             */
+            HTD_API MonotonicMemoryResource(htd::IMemoryResource * upstream = nullptr, std::size_t chunkSize = 4096);
+
+            /**
+             *  Copy constructor for a memory resource of type MonotonicMemoryResource.
+             *
+             *  @param[in] original The original memory resource which shall be copied.
+             */
+            HTD_API MonotonicMemoryResource(const MonotonicMemoryResource & original) = delete;
+
+            /**
+             *  Copy assignment operator for a memory resource of type MonotonicMemoryResource.
+             *
+             *  @param[in] original The original memory resource which shall be copied.
+             */
+            HTD_API MonotonicMemoryResource & operator=(const MonotonicMemoryResource & original) = delete;
+
+            HTD_API virtual ~MonotonicMemoryResource();
+
+            HTD_API void * allocate(std::size_t bytes, std::size_t alignment) HTD_OVERRIDE;
+
+            HTD_API void deallocate(void * pointer, std::size_t bytes, std::size_t alignment) HTD_OVERRIDE;
+
+            HTD_API bool isThreadSafe(void) const HTD_OVERRIDE;
+
+            /**
+             *  Release all chunks to the upstream memory resource.
+             *
+             *  @note All memory regions allocated by the memory resource become invalid. The size of the next chunk is reset to the initial chunk size.
+             */
+            HTD_API void release(void);
+
+            /**
+             *  Getter for the total size of the chunks currently held by the memory resource.
+             *
+             *  @return The total size of the chunks currently held by the memory resource in bytes.
+             */
+            HTD_API std::size_t reservedBytes(void) const;
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_MONOTONICMEMORYRESOURCE_HPP */
@@ -158,7 +158,7 @@ namespace htd
              *
              *  @return The name associated with the given vertex.
              */
-            const VertexNameType & vertexName(htd::vertex_t vertex) const
+            typename htd::BidirectionalGraphNaming<VertexNameType, EdgeNameType>::vertex_name_reference vertexName(htd::vertex_t vertex) const
             {
                 HTD_ASSERT(names_.isNamedVertex(vertex))
 
@@ -172,7 +172,7 @@ namespace htd
              *
              *  @return The name associated with the given edge.
              */
-            const EdgeNameType & edgeName(htd::id_t edgeId) const
+            typename htd::BidirectionalGraphNaming<VertexNameType, EdgeNameType>::edge_name_reference edgeName(htd::id_t edgeId) const
             {
                 HTD_ASSERT(names_.isNamedEdge(edgeId))
 
@@ -158,7 +158,7 @@ namespace htd
              *
              *  @return The name associated with the given vertex.
              */
-            const VertexNameType & vertexName(htd::vertex_t vertex) const
+            typename htd::BidirectionalGraphNaming<VertexNameType, EdgeNameType>::vertex_name_reference vertexName(htd::vertex_t vertex) const
             {
                 HTD_ASSERT(names_.isNamedVertex(vertex))
 
@@ -172,7 +172,7 @@ namespace htd
              *
              *  @return The name associated with the given edge.
              */
-            const EdgeNameType & edgeName(htd::id_t edgeId) const
+            typename htd::BidirectionalGraphNaming<VertexNameType, EdgeNameType>::edge_name_reference edgeName(htd::id_t edgeId) const
             {
                 HTD_ASSERT(names_.isNamedEdge(edgeId))
 
@@ -676,7 +676,9 @@ namespace htd
              */
             htd::id_t addEdge(const VertexNameType & vertexName1, const VertexNameType & vertexName2)
             {
-                return base_->addEdge(addVertices(std::vector<VertexNameType> { vertexName1, vertexName2 }));
+                htd::vertex_t vertex1 = addVertex(vertexName1);
+
+                return base_->addEdge(vertex1, addVertex(vertexName2));
             }
 
             /**
@@ -690,7 +692,9 @@ namespace htd
              */
             htd::id_t addEdge(const VertexNameType & vertexName1, const VertexNameType & vertexName2, const EdgeNameType & name)
             {
-                htd::id_t edgeId = base_->addEdge(addVertices(std::vector<VertexNameType> { vertexName1, vertexName2 }));
+                htd::vertex_t vertex1 = addVertex(vertexName1);
+
+                htd::id_t edgeId = base_->addEdge(vertex1, addVertex(vertexName2));
 
                 setEdgeName(edgeId, name);
 
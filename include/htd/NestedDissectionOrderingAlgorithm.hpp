@@ -0,0 +1,140 @@
+/* 
+ * File:   NestedDissectionOrderingAlgorithm.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_NESTEDDISSECTIONORDERINGALGORITHM_HPP
+#define HTD_HTD_NESTEDDISSECTIONORDERINGALGORITHM_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/IOrderingAlgorithm.hpp>
+
+namespace htd
+{
+    /**
+     *  Implementation of the IOrderingAlgorithm interface based on multilevel nested dissection.
+     *
+     *  The algorithm splits the remaining vertices of the preprocessed graph into its connected components and
+     *  each component which is too large to be ordered directly is split into two parts via a small separating
+     *  vertex set. The parts are ordered recursively and the vertices of the separator are appended afterwards.
+     *
+     *  The separator is computed in a multilevel fashion: The graph is coarsened by contracting a heavy-edge
+     *  matching until it is small, the coarsest graph is bisected via greedy graph growing and the bisection is
+     *  projected back to the original graph while it is refined by Fiduccia-Mattheyses passes on each level. The
+     *  cut edges of the final bisection are turned into a minimum vertex separator via König's theorem, which is
+     *  refined further by moving separator vertices into one of the parts whenever this shrinks the separator.
+     *
+     *  Parts which have at most the configured leaf size are ordered by the leaf ordering algorithm (min-fill by
+     *  default). In case that multiple threads are used, the recursion branches on the topmost levels are processed
+     *  in parallel.
+     */
+    class NestedDissectionOrderingAlgorithm : public virtual htd::IOrderingAlgorithm
+    {
+        public:
+            /**
+             *  Constructor for a new ordering algorithm of type NestedDissectionOrderingAlgorithm.
+             *
+             *  @param[in] manager   The management instance to which the new algorithm belongs.
+             */
+            HTD_API NestedDissectionOrderingAlgorithm(const htd::LibraryInstance * const manager);
+
+            /**
+             *  Copy constructor for a htd::NestedDissectionOrderingAlgorithm object.
+             *
+             *  @param[in] original The original htd::NestedDissectionOrderingAlgorithm object.
+             */
+            HTD_API NestedDissectionOrderingAlgorithm(const htd::NestedDissectionOrderingAlgorithm & original);
+
+            HTD_API virtual ~NestedDissectionOrderingAlgorithm();
+
+            HTD_API htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
+
+            /**
+             *  Set the ordering algorithm which shall be used to order the parts of the graph which are not split any further.
+             *
+             *  @param[in] algorithm    The ordering algorithm which shall be used to order the parts of the graph which are not split any further.
+             *
+             *  @note When calling this method the control over the memory region of the leaf ordering algorithm is transferred to the
+             *  ordering algorithm. Deleting the ordering algorithm provided to this method outside the current ordering algorithm or
+             *  assigning the same ordering algorithm multiple times will lead to undefined behavior.
+             */
+            HTD_API void setLeafOrderingAlgorithm(htd::IOrderingAlgorithm * algorithm);
+
+            /**
+             *  Getter for the maximum number of vertices of a part of the graph which is not split any further.
+             *
+             *  @return The maximum number of vertices of a part of the graph which is not split any further.
+             */
+            HTD_API std::size_t leafSize(void) const;
+
+            /**
+             *  Set the maximum number of vertices of a part of the graph which shall not be split any further.
+             *
+             *  @param[in] leafSize The maximum number of vertices of a part of the graph which shall not be split any further. The value must be greater than zero.
+             */
+            HTD_API void setLeafSize(std::size_t leafSize);
+
+            /**
+             *  Getter for the number of threads which process recursion branches in parallel.
+             *
+             *  @return The number of threads which process recursion branches in parallel.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of threads which shall process recursion branches in parallel.
+             *
+             *  @param[in] threadCount  The number of threads which shall process recursion branches in parallel. The value must be greater than zero.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            HTD_API NestedDissectionOrderingAlgorithm * clone(void) const HTD_OVERRIDE;
+#else
+            HTD_API NestedDissectionOrderingAlgorithm * clone(void) const;
+
+            HTD_API htd::IOrderingAlgorithm * cloneOrderingAlgorithm(void) const HTD_OVERRIDE;
+#endif
+
+        protected:
+            /**
+             *  Copy assignment operator for an ordering algorithm.
+             *
+             *  @note This operator is protected to prevent assignments to an already initialized algorithm.
+             */
+            NestedDissectionOrderingAlgorithm & operator=(const NestedDissectionOrderingAlgorithm &) { return *this; }
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_NESTEDDISSECTIONORDERINGALGORITHM_HPP */
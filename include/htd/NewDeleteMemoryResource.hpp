@@ -0,0 +1,62 @@
+/* 
+ * File:   NewDeleteMemoryResource.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_NEWDELETEMEMORYRESOURCE_HPP
+#define HTD_HTD_NEWDELETEMEMORYRESOURCE_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/IMemoryResource.hpp>
+
+namespace htd
+{
+    /**
+     *  Memory resource which forwards all requests to the global operators new and delete.
+     */
+    class NewDeleteMemoryResource : public htd::IMemoryResource
+    {
+        public:
+            /**
+             *  Constructor for a new memory resource of type NewDeleteMemoryResource.
+             */
+            HTD_API NewDeleteMemoryResource(void);
+
+            HTD_API virtual ~NewDeleteMemoryResource();
+
+            HTD_API void * allocate(std::size_t bytes, std::size_t alignment) HTD_OVERRIDE;
+
+            HTD_API void deallocate(void * pointer, std::size_t bytes, std::size_t alignment) HTD_OVERRIDE;
+
+            HTD_API bool isThreadSafe(void) const HTD_OVERRIDE;
+
+            /**
+             *  Access the shared instance of the memory resource.
+             *
+             *  @return The shared instance of the memory resource.
+             */
+            HTD_API static htd::NewDeleteMemoryResource & instance(void);
+    };
+}
+
+#endif /* HTD_HTD_NEWDELETEMEMORYRESOURCE_HPP */
@@ -0,0 +1,95 @@
+/* 
+ * File:   PoolMemoryResource.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_POOLMEMORYRESOURCE_HPP
+#define HTD_HTD_POOLMEMORYRESOURCE_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/IMemoryResource.hpp>
+
+#include <memory>
+
+namespace htd
+{
+    /**
+     *  Memory resource which serves small allocations from pools of fixed-size blocks.
+     *
+     *  Each request is rounded up to a multiple of alignof(std::max_align_t) and served by the pool of the corresponding
+     *  block size. Deallocated blocks are kept in a free list of their pool and reused by subsequent allocations of the
+     *  same size class. Requests larger than the maximum block size are forwarded to the upstream memory resource. The
+     *  chunks of the pools are released when the memory resource is destroyed.
+     *
+     *  @note The memory resource is not thread-safe.
+     */
+    class PoolMemoryResource : public htd::IMemoryResource
+    {
+        public:
+            /**
+             *  Constructor for a new memory resource of type PoolMemoryResource.
+             *
+             *  @param[in] upstream         The memory resource from which the chunks are obtained (nullptr for the global operators new and delete).
+             *                              The upstream memory resource must outlive the new memory resource.
+             *  @param[in] maxBlockSize     The size of the largest block in bytes which is served from a pool.
+             *  @param[in] blocksPerChunk   The number of blocks which are obtained from the upstream memory resource at once.
+             */
+            HTD_API PoolMemoryResource(htd::IMemoryResource * upstream = nullptr, std::size_t maxBlockSize = 256, std::size_t blocksPerChunk = 64);
+
+            /**
+             *  Copy constructor for a memory resource of type PoolMemoryResource.
+             *
+             *  @param[in] original The original memory resource which shall be copied.
+             */
+            HTD_API PoolMemoryResource(const PoolMemoryResource & original) = delete;
+
+            /**
+             *  Copy assignment operator for a memory resource of type PoolMemoryResource.
+             *
+             *  @param[in] original The original memory resource which shall be copied.
+             */
+            HTD_API PoolMemoryResource & operator=(const PoolMemoryResource & original) = delete;
+
+            HTD_API virtual ~PoolMemoryResource();
+
+            HTD_API void * allocate(std::size_t bytes, std::size_t alignment) HTD_OVERRIDE;
+
+            HTD_API void deallocate(void * pointer, std::size_t bytes, std::size_t alignment) HTD_OVERRIDE;
+
+            HTD_API bool isThreadSafe(void) const HTD_OVERRIDE;
+
+            /**
+             *  Getter for the total size of the chunks currently held by the memory resource.
+             *
+             *  @return The total size of the chunks currently held by the memory resource in bytes.
+             */
+            HTD_API std::size_t reservedBytes(void) const;
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_POOLMEMORYRESOURCE_HPP */
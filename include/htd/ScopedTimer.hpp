@@ -0,0 +1,112 @@
+/* 
+ * File:   ScopedTimer.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_SCOPEDTIMER_HPP
+#define HTD_HTD_SCOPEDTIMER_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/Instrumentation.hpp>
+#include <htd/LibraryInstance.hpp>
+
+#include <chrono>
+#include <string>
+#include <typeinfo>
+
+namespace htd
+{
+    /**
+     *  Timer which records the section of the computation between its construction and its destruction as event of the
+     *  instrumentation object of a library instance.
+     *
+     *  In case that no instrumentation object is assigned to the library instance, the timer does not access the clock.
+     */
+    class ScopedTimer
+    {
+        public:
+            /**
+             *  Constructor for a new timer.
+             *
+             *  @param[in] manager  The management instance whose instrumentation object shall record the event.
+             *  @param[in] name     The name of the timed section.
+             *  @param[in] category The category of the timed section.
+             */
+            HTD_API ScopedTimer(const htd::LibraryInstance * const manager, const char * name, const char * category);
+
+            /**
+             *  Constructor for a new timer which is named after the given type, e.g., the type of an algorithm or an operation.
+             *
+             *  @param[in] manager  The management instance whose instrumentation object shall record the event.
+             *  @param[in] type     The type after which the timed section shall be named.
+             *  @param[in] category The category of the timed section.
+             */
+            HTD_API ScopedTimer(const htd::LibraryInstance * const manager, const std::type_info & type, const char * category);
+
+            /**
+             *  Copy constructor for a timer.
+             *
+             *  @param[in] original The original timer which shall be copied.
+             */
+            HTD_API ScopedTimer(const ScopedTimer & original) = delete;
+
+            /**
+             *  Copy assignment operator for a timer.
+             *
+             *  @param[in] original The original timer which shall be copied.
+             */
+            HTD_API ScopedTimer & operator=(const ScopedTimer & original) = delete;
+
+            HTD_API virtual ~ScopedTimer();
+
+            /**
+             *  Getter for the instrumentation object which records the event.
+             *
+             *  @return The instrumentation object which records the event or nullptr if instrumentation is disabled.
+             */
+            HTD_API const htd::Instrumentation * instrumentation(void) const HTD_NOEXCEPT;
+
+        private:
+            /**
+             *  The instrumentation object which records the event (nullptr if instrumentation is disabled).
+             */
+            const htd::Instrumentation * instrumentation_;
+
+            /**
+             *  The name of the timed section.
+             */
+            std::string name_;
+
+            /**
+             *  The category of the timed section.
+             */
+            const char * category_;
+
+            /**
+             *  The point in time at which the timer was constructed.
+             */
+            std::chrono::steady_clock::time_point start_;
+    };
+}
+
+#endif /* HTD_HTD_SCOPEDTIMER_HPP */
@@ -0,0 +1,97 @@
+/* 
+ * File:   ScopedWorkspace.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_SCOPEDWORKSPACE_HPP
+#define HTD_HTD_SCOPEDWORKSPACE_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/Workspace.hpp>
+
+namespace htd
+{
+    /**
+     *  Handle which checks out a workspace from the pool of the calling thread on construction and returns it on destruction.
+     *
+     *  Nested handles (e.g., a graph traversal invoked from within a connected component algorithm) obtain distinct workspaces.
+     */
+    class ScopedWorkspace
+    {
+        public:
+            /**
+             *  Constructor for a new workspace handle.
+             */
+            ScopedWorkspace(void) : workspace_(htd::Workspace::acquire())
+            {
+
+            }
+
+            /**
+             *  Copy constructor for a workspace handle.
+             *
+             *  @param[in] original The original workspace handle which shall be copied.
+             */
+            ScopedWorkspace(const ScopedWorkspace & original) = delete;
+
+            /**
+             *  Copy assignment operator for a workspace handle.
+             *
+             *  @param[in] original The original workspace handle which shall be copied.
+             */
+            ScopedWorkspace & operator=(const ScopedWorkspace & original) = delete;
+
+            ~ScopedWorkspace()
+            {
+                htd::Workspace::release(workspace_);
+            }
+
+            /**
+             *  Access the workspace held by the handle.
+             *
+             *  @return A reference to the workspace held by the handle.
+             */
+            htd::Workspace & operator*(void) const HTD_NOEXCEPT
+            {
+                return *workspace_;
+            }
+
+            /**
+             *  Access the workspace held by the handle.
+             *
+             *  @return A pointer to the workspace held by the handle.
+             */
+            htd::Workspace * operator->(void) const HTD_NOEXCEPT
+            {
+                return workspace_;
+            }
+
+        private:
+            /**
+             *  The workspace held by the handle.
+             */
+            htd::Workspace * workspace_;
+    };
+}
+
+#endif /* HTD_HTD_SCOPEDWORKSPACE_HPP */
@@ -0,0 +1,307 @@
+/*
+ * File:   StringReference.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_STRINGREFERENCE_HPP
+#define HTD_HTD_STRINGREFERENCE_HPP
+
+#include <htd/Globals.hpp>
+
+#include <cstring>
+#include <functional>
+#include <ostream>
+#include <string>
+
+namespace htd
+{
+    /**
+     *  Immutable reference to a sequence of characters owned by another object.
+     *
+     *  A string reference consists of a pointer to the first character and the number of characters, the sequence
+     *  is not null-terminated. It stays valid as long as the owner of the characters keeps them alive, e.g., the
+     *  names interned in a htd::SymbolTable<std::string> are handed out as string references.
+     */
+    class StringReference
+    {
+        public:
+            /**
+             *  The value type of the string reference.
+             */
+            typedef char value_type;
+
+            /**
+             *  The type of the iterators of the string reference.
+             */
+            typedef const char * const_iterator;
+
+            /**
+             *  Constructor for a string reference which does not refer to any characters.
+             */
+            StringReference(void) HTD_NOEXCEPT : data_(nullptr), size_(0)
+            {
+
+            }
+
+            /**
+             *  Constructor for a string reference.
+             *
+             *  @param[in] data The pointer to the first character of the sequence.
+             *  @param[in] size The number of characters of the sequence.
+             */
+            StringReference(const char * data, std::size_t size) HTD_NOEXCEPT : data_(data), size_(size)
+            {
+
+            }
+
+            /**
+             *  Constructor for a string reference to the characters of a null-terminated string.
+             *
+             *  @param[in] string   The null-terminated string.
+             */
+            StringReference(const char * string) HTD_NOEXCEPT : data_(string), size_(std::strlen(string))
+            {
+
+            }
+
+            /**
+             *  Constructor for a string reference to the characters of a std::string.
+             *
+             *  @param[in] string   The string. The reference is invalidated when the string is modified or destroyed.
+             */
+            StringReference(const std::string & string) HTD_NOEXCEPT : data_(string.data()), size_(string.size())
+            {
+
+            }
+
+            /**
+             *  Getter for the pointer to the first character of the sequence.
+             *
+             *  @return The pointer to the first character of the sequence.
+             */
+            const char * data(void) const HTD_NOEXCEPT
+            {
+                return data_;
+            }
+
+            /**
+             *  Getter for the number of characters of the sequence.
+             *
+             *  @return The number of characters of the sequence.
+             */
+            std::size_t size(void) const HTD_NOEXCEPT
+            {
+                return size_;
+            }
+
+            /**
+             *  Getter for the number of characters of the sequence.
+             *
+             *  @return The number of characters of the sequence.
+             */
+            std::size_t length(void) const HTD_NOEXCEPT
+            {
+                return size_;
+            }
+
+            /**
+             *  Check whether the sequence is empty.
+             *
+             *  @return True if the sequence is empty, false otherwise.
+             */
+            bool empty(void) const HTD_NOEXCEPT
+            {
+                return size_ == 0;
+            }
+
+            /**
+             *  Getter for the iterator to the first character of the sequence.
+             *
+             *  @return An iterator to the first character of the sequence.
+             */
+            const_iterator begin(void) const HTD_NOEXCEPT
+            {
+                return data_;
+            }
+
+            /**
+             *  Getter for the iterator to the end of the sequence.
+             *
+             *  @return An iterator to the end of the sequence.
+             */
+            const_iterator end(void) const HTD_NOEXCEPT
+            {
+                return data_ + size_;
+            }
+
+            /**
+             *  Access the character at the specific position.
+             *
+             *  @param[in] index    The position of the character.
+             *
+             *  @return The character at the specific position.
+             */
+            char operator[](std::size_t index) const HTD_NOEXCEPT
+            {
+                return data_[index];
+            }
+
+            /**
+             *  Create a std::string holding a copy of the referenced characters.
+             *
+             *  @return A std::string holding a copy of the referenced characters.
+             */
+            std::string str(void) const
+            {
+                return std::string(data_, size_);
+            }
+
+            /**
+             *  Conversion operator which creates a std::string holding a copy of the referenced characters.
+             */
+            operator std::string(void) const
+            {
+                return str();
+            }
+
+            /**
+             *  Compare the referenced characters lexicographically with the characters of another string reference.
+             *
+             *  @param[in] other    The other string reference.
+             *
+             *  @return A negative value, zero or a positive value if the current sequence is less than, equal to or greater than the other sequence.
+             */
+            int compare(const StringReference & other) const HTD_NOEXCEPT
+            {
+                std::size_t commonSize = size_ < other.size_ ? size_ : other.size_;
+
+                int ret = commonSize > 0 ? std::memcmp(data_, other.data_, commonSize) : 0;
+
+                if (ret == 0 && size_ != other.size_)
+                {
+                    ret = size_ < other.size_ ? -1 : 1;
+                }
+
+                return ret;
+            }
+
+        private:
+            /**
+             *  The pointer to the first character of the sequence.
+             */
+            const char * data_;
+
+            /**
+             *  The number of characters of the sequence.
+             */
+            std::size_t size_;
+    };
+
+    /**
+     *  Equality operator for string references.
+     *
+     *  @param[in] lhs  The first string reference.
+     *  @param[in] rhs  The second string reference.
+     *
+     *  @return True if both string references refer to equal sequences of characters, false otherwise.
+     */
+    inline bool operator==(const htd::StringReference & lhs, const htd::StringReference & rhs) HTD_NOEXCEPT
+    {
+        return lhs.size() == rhs.size() && (lhs.size() == 0 || std::memcmp(lhs.data(), rhs.data(), lhs.size()) == 0);
+    }
+
+    /**
+     *  Inequality operator for string references.
+     *
+     *  @param[in] lhs  The first string reference.
+     *  @param[in] rhs  The second string reference.
+     *
+     *  @return True if the string references refer to different sequences of characters, false otherwise.
+     */
+    inline bool operator!=(const htd::StringReference & lhs, const htd::StringReference & rhs) HTD_NOEXCEPT
+    {
+        return !(lhs == rhs);
+    }
+
+    /**
+     *  Less-than operator for string references.
+     *
+     *  @param[in] lhs  The first string reference.
+     *  @param[in] rhs  The second string reference.
+     *
+     *  @return True if the first sequence of characters is lexicographically less than the second one, false otherwise.
+     */
+    inline bool operator<(const htd::StringReference & lhs, const htd::StringReference & rhs) HTD_NOEXCEPT
+    {
+        return lhs.compare(rhs) < 0;
+    }
+
+    /**
+     *  Write the referenced characters to an output stream.
+     *
+     *  @param[in] stream       The output stream.
+     *  @param[in] reference    The string reference.
+     *
+     *  @return The output stream.
+     */
+    inline std::ostream & operator<<(std::ostream & stream, const htd::StringReference & reference)
+    {
+        return stream.write(reference.data(), (std::streamsize)reference.size());
+    }
+}
+
+namespace std
+{
+    /**
+     *  Implementation of std::hash for htd::StringReference.
+     */
+    template < >
+    struct hash<htd::StringReference>
+    {
+        public:
+            /**
+             *  Compute the hash code of a given htd::StringReference.
+             *
+             *  The hash code is the FNV-1a hash of the referenced characters.
+             *
+             *  @param[in] data The htd::StringReference which's hash code shall be returned.
+             *
+             *  @return The hash code of the given htd::StringReference.
+             */
+            std::size_t operator()(const htd::StringReference & data) const HTD_NOEXCEPT
+            {
+                std::size_t ret = (std::size_t)14695981039346656037ULL;
+
+                for (char character : data)
+                {
+                    ret ^= (std::size_t)(unsigned char)character;
+
+                    ret *= (std::size_t)1099511628211ULL;
+                }
+
+                return ret;
+            }
+    };
+}
+
+#endif /* HTD_HTD_STRINGREFERENCE_HPP */
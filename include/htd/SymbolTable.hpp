@@ -0,0 +1,750 @@
+/*
+ * File:   SymbolTable.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_SYMBOLTABLE_HPP
+#define HTD_HTD_SYMBOLTABLE_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/StringReference.hpp>
+
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Symbol table which interns symbols and associates each of them with a dense, non-zero identifier.
+     *
+     *  Each distinct symbol is stored exactly once, as an element of a std::deque. Symbols are handed
+     *  out via stable pointers (handles) which remain valid until the symbol is released or the symbol
+     *  table is destroyed. Lookups by identifier are plain vector accesses, lookups by value need a
+     *  single hash map probe which does not copy the queried symbol.
+     *
+     *  @note The deque only groups the symbol objects themselves into blocks. Any memory owned by a
+     *  symbol is allocated by the symbol as usual. Names of type std::string are therefore handled by
+     *  a specialization of the symbol table which stores their characters in a contiguous arena.
+     */
+    template <typename SymbolType, typename HashFunction = std::hash<SymbolType>, typename EqualityFunction = std::equal_to<SymbolType>>
+    class SymbolTable
+    {
+        public:
+            /**
+             *  The type of the references to the symbols stored in the symbol table.
+             */
+            typedef const SymbolType & const_reference;
+
+            /**
+             *  Constructor for a new, empty symbol table.
+             */
+            SymbolTable(void) : storage_(), freeSlots_(), symbols_(), reverseMap_()
+            {
+
+            }
+
+            /**
+             *  Copy constructor for a symbol table.
+             *
+             *  @param[in] original  The original symbol table.
+             */
+            SymbolTable(const SymbolTable<SymbolType, HashFunction, EqualityFunction> & original) : storage_(), freeSlots_(), symbols_(), reverseMap_()
+            {
+                copyFrom(original);
+            }
+
+            /**
+             *  Destructor of a symbol table.
+             */
+            virtual ~SymbolTable()
+            {
+
+            }
+
+            /**
+             *  Copy assignment operator for a symbol table.
+             *
+             *  @param[in] original  The original symbol table.
+             *
+             *  @return A reference to the modified symbol table.
+             */
+            SymbolTable<SymbolType, HashFunction, EqualityFunction> & operator=(const SymbolTable<SymbolType, HashFunction, EqualityFunction> & original)
+            {
+                if (this != &original)
+                {
+                    clear();
+
+                    copyFrom(original);
+                }
+
+                return *this;
+            }
+
+            /**
+             *  Getter for the number of symbols stored in the symbol table.
+             *
+             *  @return The number of symbols stored in the symbol table.
+             */
+            std::size_t size(void) const
+            {
+                return reverseMap_.size();
+            }
+
+            /**
+             *  Check whether a symbol is associated with the given identifier.
+             *
+             *  @param[in] identifier   The identifier.
+             *
+             *  @return True if a symbol is associated with the given identifier, false otherwise.
+             */
+            bool contains(htd::id_t identifier) const
+            {
+                return identifier < symbols_.size() && symbols_[identifier] != nullptr;
+            }
+
+            /**
+             *  Check whether the given symbol is stored in the symbol table.
+             *
+             *  @param[in] symbol   The symbol.
+             *
+             *  @return True if the given symbol is stored in the symbol table, false otherwise.
+             */
+            bool containsSymbol(const SymbolType & symbol) const
+            {
+                return reverseMap_.count(&symbol) > 0;
+            }
+
+            /**
+             *  Access the symbol associated with the given identifier.
+             *
+             *  @param[in] identifier   The identifier.
+             *
+             *  @throws std::out_of_range   If no symbol is associated with the given identifier.
+             *
+             *  @return The symbol associated with the given identifier.
+             */
+            const SymbolType & symbol(htd::id_t identifier) const
+            {
+                if (!contains(identifier))
+                {
+                    throw std::out_of_range("const SymbolType & htd::SymbolTable<SymbolType, HashFunction, EqualityFunction>::symbol(htd::id_t) const");
+                }
+
+                return *(symbols_[identifier]);
+            }
+
+            /**
+             *  Access the identifier associated with the given symbol.
+             *
+             *  @param[in] symbol   The symbol.
+             *
+             *  @throws std::out_of_range   If the given symbol is not stored in the symbol table.
+             *
+             *  @return The identifier associated with the given symbol.
+             */
+            htd::id_t identifier(const SymbolType & symbol) const
+            {
+                return reverseMap_.at(&symbol);
+            }
+
+            /**
+             *  Find the identifier associated with the given symbol.
+             *
+             *  @param[in] symbol   The symbol.
+             *  @param[out] result  The identifier associated with the given symbol, if any.
+             *
+             *  @return True if the given symbol is stored in the symbol table, false otherwise.
+             */
+            bool find(const SymbolType & symbol, htd::id_t & result) const
+            {
+                auto position = reverseMap_.find(&symbol);
+
+                if (position != reverseMap_.end())
+                {
+                    result = position->second;
+
+                    return true;
+                }
+
+                return false;
+            }
+
+            /**
+             *  Associate the given identifier with the given symbol.
+             *
+             *  If the identifier is already associated with a different symbol, the old association is released.
+             *
+             *  @param[in] identifier   The identifier.
+             *  @param[in] symbol       The symbol. The symbol must not be associated with another identifier.
+             */
+            void assign(htd::id_t identifier, const SymbolType & symbol)
+            {
+                if (contains(identifier))
+                {
+                    if (EqualityFunction()(*(symbols_[identifier]), symbol))
+                    {
+                        return;
+                    }
+
+                    release(identifier);
+                }
+
+                HTD_ASSERT(reverseMap_.count(&symbol) == 0)
+
+                SymbolType * handle = allocate(symbol);
+
+                if (identifier >= symbols_.size())
+                {
+                    symbols_.resize(identifier + 1, nullptr);
+                }
+
+                symbols_[identifier] = handle;
+
+                reverseMap_.emplace(handle, identifier);
+            }
+
+            /**
+             *  Release the symbol associated with the given identifier.
+             *
+             *  The storage occupied by the symbol is reused by subsequently assigned symbols. If no symbol
+             *  is associated with the given identifier, the symbol table remains unchanged.
+             *
+             *  @param[in] identifier   The identifier.
+             */
+            void release(htd::id_t identifier)
+            {
+                if (contains(identifier))
+                {
+                    SymbolType * handle = symbols_[identifier];
+
+                    reverseMap_.erase(handle);
+
+                    symbols_[identifier] = nullptr;
+
+                    freeSlots_.push_back(handle);
+                }
+            }
+
+            /**
+             *  Remove all symbols from the symbol table.
+             */
+            void clear(void)
+            {
+                reverseMap_.clear();
+
+                symbols_.clear();
+
+                freeSlots_.clear();
+
+                storage_.clear();
+            }
+
+            /**
+             *  Call the given function for each pair of identifier and symbol stored in the symbol table.
+             *
+             *  The pairs are visited in ascending order of their identifiers.
+             *
+             *  @param[in] function The function which shall be called for each pair of identifier and symbol.
+             */
+            void forEach(const std::function<void(htd::id_t, const SymbolType &)> & function) const
+            {
+                for (htd::id_t identifier = 0; identifier < symbols_.size(); ++identifier)
+                {
+                    if (symbols_[identifier] != nullptr)
+                    {
+                        function(identifier, *(symbols_[identifier]));
+                    }
+                }
+            }
+
+        private:
+            /**
+             *  Hash function for symbol handles which hashes the referenced symbol.
+             */
+            struct HandleHashFunction
+            {
+                std::size_t operator()(const SymbolType * handle) const
+                {
+                    return HashFunction()(*handle);
+                }
+            };
+
+            /**
+             *  Equality function for symbol handles which compares the referenced symbols.
+             */
+            struct HandleEqualityFunction
+            {
+                bool operator()(const SymbolType * handle1, const SymbolType * handle2) const
+                {
+                    return EqualityFunction()(*handle1, *handle2);
+                }
+            };
+
+            /**
+             *  The storage of the symbols. A deque never relocates its elements on growth.
+             */
+            std::deque<SymbolType> storage_;
+
+            /**
+             *  The slots of released symbols which can be reused.
+             */
+            std::vector<SymbolType *> freeSlots_;
+
+            /**
+             *  The symbols, indexed by their identifiers.
+             */
+            std::vector<SymbolType *> symbols_;
+
+            /**
+             *  The map from symbols to their identifiers.
+             */
+            std::unordered_map<const SymbolType *, htd::id_t, HandleHashFunction, HandleEqualityFunction> reverseMap_;
+
+            /**
+             *  Store a copy of the given symbol.
+             *
+             *  @param[in] symbol   The symbol.
+             *
+             *  @return The handle of the stored symbol.
+             */
+            SymbolType * allocate(const SymbolType & symbol)
+            {
+                if (freeSlots_.empty())
+                {
+                    storage_.push_back(symbol);
+
+                    return &(storage_.back());
+                }
+
+                SymbolType * ret = freeSlots_.back();
+
+                freeSlots_.pop_back();
+
+                *ret = symbol;
+
+                return ret;
+            }
+
+            /**
+             *  Copy all symbols of the given symbol table into the current one.
+             *
+             *  @param[in] original  The original symbol table.
+             */
+            void copyFrom(const SymbolTable<SymbolType, HashFunction, EqualityFunction> & original)
+            {
+                symbols_.resize(original.symbols_.size(), nullptr);
+
+                reverseMap_.reserve(original.reverseMap_.size());
+
+                for (htd::id_t identifier = 0; identifier < original.symbols_.size(); ++identifier)
+                {
+                    if (original.symbols_[identifier] != nullptr)
+                    {
+                        storage_.push_back(*(original.symbols_[identifier]));
+
+                        symbols_[identifier] = &(storage_.back());
+
+                        reverseMap_.emplace(symbols_[identifier], identifier);
+                    }
+                }
+            }
+    };
+    /**
+     *  Symbol table which interns strings and associates each of them with a dense, non-zero identifier.
+     *
+     *  The characters of all strings are stored back-to-back in a chunked character arena, hence interning
+     *  a name costs one allocation per arena chunk instead of one or more allocations per name. Symbols are
+     *  handed out as htd::StringReference handles (pointer and length) which remain valid until the symbol
+     *  is released or the symbol table is cleared or destroyed. The characters of released symbols are
+     *  reclaimed when the symbol table is cleared.
+     */
+    template < >
+    class SymbolTable<std::string, std::hash<std::string>, std::equal_to<std::string>>
+    {
+        public:
+            /**
+             *  The type of the references to the symbols stored in the symbol table.
+             */
+            typedef htd::StringReference const_reference;
+
+            /**
+             *  Constructor for a new, empty symbol table.
+             */
+            SymbolTable(void) : chunks_(), position_(nullptr), remainingCapacity_(0), symbols_(), reverseMap_()
+            {
+
+            }
+
+            /**
+             *  Copy constructor for a symbol table.
+             *
+             *  The characters of the symbols are packed into a single arena chunk of the new symbol table.
+             *
+             *  @param[in] original  The original symbol table.
+             */
+            SymbolTable(const SymbolTable<std::string, std::hash<std::string>, std::equal_to<std::string>> & original) : chunks_(), position_(nullptr), remainingCapacity_(0), symbols_(), reverseMap_()
+            {
+                copyFrom(original);
+            }
+
+            /**
+             *  Destructor of a symbol table.
+             */
+            virtual ~SymbolTable()
+            {
+
+            }
+
+            /**
+             *  Copy assignment operator for a symbol table.
+             *
+             *  @param[in] original  The original symbol table.
+             *
+             *  @return A reference to the modified symbol table.
+             */
+            SymbolTable<std::string, std::hash<std::string>, std::equal_to<std::string>> & operator=(const SymbolTable<std::string, std::hash<std::string>, std::equal_to<std::string>> & original)
+            {
+                if (this != &original)
+                {
+                    clear();
+
+                    copyFrom(original);
+                }
+
+                return *this;
+            }
+
+            /**
+             *  Getter for the number of symbols stored in the symbol table.
+             *
+             *  @return The number of symbols stored in the symbol table.
+             */
+            std::size_t size(void) const
+            {
+                return reverseMap_.size();
+            }
+
+            /**
+             *  Check whether a symbol is associated with the given identifier.
+             *
+             *  @param[in] identifier   The identifier.
+             *
+             *  @return True if a symbol is associated with the given identifier, false otherwise.
+             */
+            bool contains(htd::id_t identifier) const
+            {
+                return identifier < symbols_.size() && symbols_[identifier].data() != nullptr;
+            }
+
+            /**
+             *  Check whether the given symbol is stored in the symbol table.
+             *
+             *  @param[in] symbol   The symbol.
+             *
+             *  @return True if the given symbol is stored in the symbol table, false otherwise.
+             */
+            bool containsSymbol(const htd::StringReference & symbol) const
+            {
+                return reverseMap_.count(symbol) > 0;
+            }
+
+            /**
+             *  Access the symbol associated with the given identifier.
+             *
+             *  @param[in] identifier   The identifier.
+             *
+             *  @throws std::out_of_range   If no symbol is associated with the given identifier.
+             *
+             *  @return A handle referring to the characters of the symbol associated with the given identifier.
+             */
+            htd::StringReference symbol(htd::id_t identifier) const
+            {
+                if (!contains(identifier))
+                {
+                    throw std::out_of_range("htd::StringReference htd::SymbolTable<std::string>::symbol(htd::id_t) const");
+                }
+
+                return symbols_[identifier];
+            }
+
+            /**
+             *  Access the identifier associated with the given symbol.
+             *
+             *  @param[in] symbol   The symbol.
+             *
+             *  @throws std::out_of_range   If the given symbol is not stored in the symbol table.
+             *
+             *  @return The identifier associated with the given symbol.
+             */
+            htd::id_t identifier(const htd::StringReference & symbol) const
+            {
+                return reverseMap_.at(symbol);
+            }
+
+            /**
+             *  Find the identifier associated with the given symbol.
+             *
+             *  @param[in] symbol   The symbol.
+             *  @param[out] result  The identifier associated with the given symbol, if any.
+             *
+             *  @return True if the given symbol is stored in the symbol table, false otherwise.
+             */
+            bool find(const htd::StringReference & symbol, htd::id_t & result) const
+            {
+                auto position = reverseMap_.find(symbol);
+
+                if (position != reverseMap_.end())
+                {
+                    result = position->second;
+
+                    return true;
+                }
+
+                return false;
+            }
+
+            /**
+             *  Associate the given identifier with the given symbol.
+             *
+             *  If the identifier is already associated with a different symbol, the old association is released.
+             *
+             *  @param[in] identifier   The identifier.
+             *  @param[in] symbol       The symbol. The symbol must not be associated with another identifier.
+             */
+            void assign(htd::id_t identifier, const htd::StringReference & symbol)
+            {
+                if (contains(identifier))
+                {
+                    if (symbols_[identifier] == symbol)
+                    {
+                        return;
+                    }
+
+                    release(identifier);
+                }
+
+                HTD_ASSERT(reverseMap_.count(symbol) == 0)
+
+                htd::StringReference handle(allocate(symbol), symbol.size());
+
+                if (identifier >= symbols_.size())
+                {
+                    symbols_.resize(identifier + 1);
+                }
+
+                symbols_[identifier] = handle;
+
+                reverseMap_.emplace(handle, identifier);
+            }
+
+            /**
+             *  Release the symbol associated with the given identifier.
+             *
+             *  If no symbol is associated with the given identifier, the symbol table remains unchanged.
+             *
+             *  @param[in] identifier   The identifier.
+             */
+            void release(htd::id_t identifier)
+            {
+                if (contains(identifier))
+                {
+                    reverseMap_.erase(symbols_[identifier]);
+
+                    symbols_[identifier] = htd::StringReference();
+                }
+            }
+
+            /**
+             *  Remove all symbols from the symbol table.
+             */
+            void clear(void)
+            {
+                reverseMap_.clear();
+
+                symbols_.clear();
+
+                chunks_.clear();
+
+                position_ = nullptr;
+
+                remainingCapacity_ = 0;
+            }
+
+            /**
+             *  Call the given function for each pair of identifier and symbol stored in the symbol table.
+             *
+             *  The pairs are visited in ascending order of their identifiers.
+             *
+             *  @param[in] function The function which shall be called for each pair of identifier and symbol.
+             */
+            void forEach(const std::function<void(htd::id_t, const htd::StringReference &)> & function) const
+            {
+                for (htd::id_t identifier = 0; identifier < symbols_.size(); ++identifier)
+                {
+                    if (symbols_[identifier].data() != nullptr)
+                    {
+                        function(identifier, symbols_[identifier]);
+                    }
+                }
+            }
+
+        private:
+            /**
+             *  The default capacity of an arena chunk in bytes.
+             */
+            static const std::size_t CHUNK_CAPACITY = 65536;
+
+            /**
+             *  The chunks of the character arena. Chunks are never relocated or resized.
+             */
+            std::vector<std::unique_ptr<char[]>> chunks_;
+
+            /**
+             *  The position of the next free character in the current arena chunk.
+             */
+            char * position_;
+
+            /**
+             *  The number of free characters in the current arena chunk.
+             */
+            std::size_t remainingCapacity_;
+
+            /**
+             *  The symbols, indexed by their identifiers. Unassigned identifiers hold a null handle.
+             */
+            std::vector<htd::StringReference> symbols_;
+
+            /**
+             *  The map from symbols to their identifiers.
+             */
+            std::unordered_map<htd::StringReference, htd::id_t> reverseMap_;
+
+            /**
+             *  Store a copy of the characters of the given symbol in the arena.
+             *
+             *  @param[in] symbol   The symbol.
+             *
+             *  @return The pointer to the stored characters. The pointer is non-null even for empty symbols.
+             */
+            const char * allocate(const htd::StringReference & symbol)
+            {
+                std::size_t size = symbol.size();
+
+                if (size == 0)
+                {
+                    return "";
+                }
+
+                if (size > remainingCapacity_)
+                {
+                    if (size > CHUNK_CAPACITY / 4)
+                    {
+                        chunks_.emplace_back(new char[size]);
+
+                        std::memcpy(chunks_.back().get(), symbol.data(), size);
+
+                        return chunks_.back().get();
+                    }
+
+                    chunks_.emplace_back(new char[CHUNK_CAPACITY]);
+
+                    position_ = chunks_.back().get();
+
+                    remainingCapacity_ = CHUNK_CAPACITY;
+                }
+
+                char * ret = position_;
+
+                std::memcpy(ret, symbol.data(), size);
+
+                position_ += size;
+
+                remainingCapacity_ -= size;
+
+                return ret;
+            }
+
+            /**
+             *  Copy all symbols of the given symbol table into the current one.
+             *
+             *  @param[in] original  The original symbol table.
+             */
+            void copyFrom(const SymbolTable<std::string, std::hash<std::string>, std::equal_to<std::string>> & original)
+            {
+                std::size_t totalSize = 0;
+
+                for (const htd::StringReference & symbol : original.symbols_)
+                {
+                    totalSize += symbol.size();
+                }
+
+                if (totalSize > 0)
+                {
+                    chunks_.emplace_back(new char[totalSize]);
+
+                    position_ = chunks_.back().get();
+
+                    remainingCapacity_ = totalSize;
+                }
+
+                symbols_.resize(original.symbols_.size());
+
+                reverseMap_.reserve(original.reverseMap_.size());
+
+                for (htd::id_t identifier = 0; identifier < original.symbols_.size(); ++identifier)
+                {
+                    const htd::StringReference & symbol = original.symbols_[identifier];
+
+                    if (symbol.data() != nullptr)
+                    {
+                        std::size_t size = symbol.size();
+
+                        const char * data = "";
+
+                        if (size > 0)
+                        {
+                            std::memcpy(position_, symbol.data(), size);
+
+                            data = position_;
+
+                            position_ += size;
+
+                            remainingCapacity_ -= size;
+                        }
+
+                        symbols_[identifier] = htd::StringReference(data, size);
+
+                        reverseMap_.emplace(symbols_[identifier], identifier);
+                    }
+                }
+            }
+    };
+}
+
+#endif /* HTD_HTD_SYMBOLTABLE_HPP */
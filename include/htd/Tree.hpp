@@ -160,6 +160,17 @@ namespace htd
 
             HTD_API htd::vertex_t childAtPosition(htd::vertex_t vertex, htd::index_t index) const HTD_OVERRIDE;
 
+            /**
+             *  Access the container which stores the children of the given vertex.
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @note The returned reference reflects later modifications of the children of the given vertex and it becomes invalid as soon as the vertex is removed.
+             *
+             *  @return The container which stores the children of the given vertex, in the same order as reported by childAtPosition().
+             */
+            HTD_API const std::vector<htd::vertex_t> & childContainer(htd::vertex_t vertex) const;
+
             HTD_API bool isChild(htd::vertex_t vertex, htd::vertex_t child) const HTD_OVERRIDE;
 
             HTD_API std::size_t height(void) const HTD_OVERRIDE;
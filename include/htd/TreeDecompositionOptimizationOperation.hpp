@@ -133,6 +133,24 @@ namespace htd
              */
             HTD_API void setVertexSelectionStrategy(htd::IVertexSelectionStrategy * strategy);
 
+            /**
+             *  Getter for the number of threads which are used to evaluate the candidate roots.
+             *
+             *  @return The number of threads which are used to evaluate the candidate roots.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of threads which shall be used to evaluate the candidate roots.
+             *
+             *  @note Each additional thread operates on its own copies of the decomposition, the fitness function, the manipulation
+             *  operations and the labeling functions. The optimal root and hence the resulting decomposition do not depend on the
+             *  number of threads.
+             *
+             *  @param[in] threadCount  The number of threads which shall be used to evaluate the candidate roots. The value must be greater than zero.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
@@ -0,0 +1,362 @@
+/*
+ * File:   TreeTraversal.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_TREETRAVERSAL_HPP
+#define HTD_HTD_TREETRAVERSAL_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/ITree.hpp>
+#include <htd/Tree.hpp>
+
+#include <tuple>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Collection of templated tree traversals which accept arbitrary callables.
+     *
+     *  In contrast to the implementations of htd::ITreeTraversal, the target function is not wrapped into a std::function
+     *  and hence it can be inlined into the traversal loop. For instances of htd::Tree and its subclasses (like
+     *  htd::TreeDecomposition), the children of each node are read directly from the underlying container instead
+     *  of via virtual calls.
+     *
+     *  The target function is called with the following parameters:
+     *      -# The current vertex.
+     *      -# The parent of the current vertex in the traversal process (htd::Vertex::UNKNOWN for the starting vertex).
+     *      -# The distance between the current vertex and the starting vertex of the traversal.
+     *
+     *  The visiting order of preOrder() and postOrder() is identical to the one of htd::PreOrderTreeTraversal and
+     *  htd::PostOrderTreeTraversal, respectively. Like the latter, postOrder() allows the target function to remove
+     *  the vertex it is called for.
+     */
+    class TreeTraversal
+    {
+        public:
+            /**
+             *  Traverse the given tree in pre-order, starting from its root.
+             *
+             *  @param[in] tree             The tree which shall be traversed.
+             *  @param[in] targetFunction   The function which will be called for each vertex found during the traversal.
+             */
+            template <typename Function>
+            static void preOrder(const htd::ITree & tree, Function && targetFunction)
+            {
+                if (tree.vertexCount() > 0)
+                {
+                    preOrder(tree, targetFunction, tree.root());
+                }
+            }
+
+            /**
+             *  Traverse the subtree rooted at the given vertex in pre-order.
+             *
+             *  @param[in] tree             The tree which shall be traversed.
+             *  @param[in] targetFunction   The function which will be called for each vertex found during the traversal.
+             *  @param[in] startingVertex   The vertex from which the traversal will be started.
+             */
+            template <typename Function>
+            static void preOrder(const htd::ITree & tree, Function && targetFunction, htd::vertex_t startingVertex)
+            {
+                const htd::Tree * concreteTree = asTree(tree);
+
+                if (concreteTree != nullptr)
+                {
+                    traversePreOrder(ContainerAccess(*concreteTree), targetFunction, startingVertex);
+                }
+                else
+                {
+                    traversePreOrder(InterfaceAccess(tree), targetFunction, startingVertex);
+                }
+            }
+
+            /**
+             *  Traverse the given tree in post-order, starting from its root.
+             *
+             *  @param[in] tree             The tree which shall be traversed.
+             *  @param[in] targetFunction   The function which will be called for each vertex found during the traversal.
+             */
+            template <typename Function>
+            static void postOrder(const htd::ITree & tree, Function && targetFunction)
+            {
+                if (tree.vertexCount() > 0)
+                {
+                    postOrder(tree, targetFunction, tree.root());
+                }
+            }
+
+            /**
+             *  Traverse the subtree rooted at the given vertex in post-order.
+             *
+             *  @param[in] tree             The tree which shall be traversed.
+             *  @param[in] targetFunction   The function which will be called for each vertex found during the traversal.
+             *  @param[in] startingVertex   The vertex from which the traversal will be started.
+             */
+            template <typename Function>
+            static void postOrder(const htd::ITree & tree, Function && targetFunction, htd::vertex_t startingVertex)
+            {
+                const htd::Tree * concreteTree = asTree(tree);
+
+                if (concreteTree != nullptr)
+                {
+                    traversePostOrder(ContainerAccess(*concreteTree), targetFunction, startingVertex);
+                }
+                else
+                {
+                    traversePostOrder(InterfaceAccess(tree), targetFunction, startingVertex);
+                }
+            }
+
+            /**
+             *  Traverse the given tree in level-order (breadth-first), starting from its root.
+             *
+             *  @param[in] tree             The tree which shall be traversed.
+             *  @param[in] targetFunction   The function which will be called for each vertex found during the traversal.
+             */
+            template <typename Function>
+            static void levelOrder(const htd::ITree & tree, Function && targetFunction)
+            {
+                if (tree.vertexCount() > 0)
+                {
+                    levelOrder(tree, targetFunction, tree.root());
+                }
+            }
+
+            /**
+             *  Traverse the subtree rooted at the given vertex in level-order (breadth-first).
+             *
+             *  @param[in] tree             The tree which shall be traversed.
+             *  @param[in] targetFunction   The function which will be called for each vertex found during the traversal.
+             *  @param[in] startingVertex   The vertex from which the traversal will be started.
+             */
+            template <typename Function>
+            static void levelOrder(const htd::ITree & tree, Function && targetFunction, htd::vertex_t startingVertex)
+            {
+                const htd::Tree * concreteTree = asTree(tree);
+
+                if (concreteTree != nullptr)
+                {
+                    traverseLevelOrder(ContainerAccess(*concreteTree), targetFunction, startingVertex);
+                }
+                else
+                {
+                    traverseLevelOrder(InterfaceAccess(tree), targetFunction, startingVertex);
+                }
+            }
+
+        private:
+            /**
+             *  Determine whether the given tree is an instance of htd::Tree.
+             *
+             *  @param[in] tree The tree.
+             *
+             *  @return A pointer to the given tree if it is an instance of htd::Tree, nullptr otherwise.
+             */
+            HTD_API static const htd::Tree * asTree(const htd::ITree & tree);
+
+            /**
+             *  Access to the children of a tree via the virtual functions of htd::ITree.
+             */
+            class InterfaceAccess
+            {
+                public:
+                    /**
+                     *  The type of the handle representing the children of a vertex.
+                     */
+                    typedef htd::vertex_t Handle;
+
+                    InterfaceAccess(const htd::ITree & tree) : tree_(tree)
+                    {
+
+                    }
+
+                    Handle handle(htd::vertex_t vertex) const
+                    {
+                        return vertex;
+                    }
+
+                    std::size_t childCount(Handle handle) const
+                    {
+                        return tree_.childCount(handle);
+                    }
+
+                    htd::vertex_t childAtPosition(Handle handle, htd::index_t index) const
+                    {
+                        return tree_.childAtPosition(handle, index);
+                    }
+
+                private:
+                    const htd::ITree & tree_;
+            };
+
+            /**
+             *  Direct access to the children containers of a tree of type htd::Tree.
+             */
+            class ContainerAccess
+            {
+                public:
+                    /**
+                     *  The type of the handle representing the children of a vertex.
+                     */
+                    typedef const std::vector<htd::vertex_t> * Handle;
+
+                    ContainerAccess(const htd::Tree & tree) : tree_(tree)
+                    {
+
+                    }
+
+                    Handle handle(htd::vertex_t vertex) const
+                    {
+                        return &(tree_.childContainer(vertex));
+                    }
+
+                    std::size_t childCount(Handle handle) const
+                    {
+                        return handle->size();
+                    }
+
+                    htd::vertex_t childAtPosition(Handle handle, htd::index_t index) const
+                    {
+                        return (*handle)[index];
+                    }
+
+                private:
+                    const htd::Tree & tree_;
+            };
+
+            template <typename Access, typename Function>
+            static void traversePreOrder(const Access & access, Function & targetFunction, htd::vertex_t startingVertex)
+            {
+                HTD_ASSERT(startingVertex != htd::Vertex::UNKNOWN)
+
+                /* Each stack entry holds a vertex, the handle of its children and the position of the next child to visit. */
+                std::vector<std::tuple<htd::vertex_t, typename Access::Handle, htd::index_t>> stack;
+
+                targetFunction(startingVertex, htd::Vertex::UNKNOWN, 0);
+
+                stack.emplace_back(startingVertex, access.handle(startingVertex), 0);
+
+                while (!stack.empty())
+                {
+                    std::tuple<htd::vertex_t, typename Access::Handle, htd::index_t> & top = stack.back();
+
+                    if (std::get<2>(top) < access.childCount(std::get<1>(top)))
+                    {
+                        htd::vertex_t parent = std::get<0>(top);
+
+                        htd::vertex_t child = access.childAtPosition(std::get<1>(top), std::get<2>(top));
+
+                        ++std::get<2>(top);
+
+                        targetFunction(child, parent, stack.size());
+
+                        stack.emplace_back(child, access.handle(child), 0);
+                    }
+                    else
+                    {
+                        stack.pop_back();
+                    }
+                }
+            }
+
+            template <typename Access, typename Function>
+            static void traversePostOrder(const Access & access, Function & targetFunction, htd::vertex_t startingVertex)
+            {
+                HTD_ASSERT(startingVertex != htd::Vertex::UNKNOWN)
+
+                /*
+                 * Each stack entry holds a vertex, the handle of its children and the number of children which are not yet visited.
+                 * The children are visited from the last to the first one, hence removing a visited child does not affect the
+                 * positions of the remaining ones.
+                 */
+                std::vector<std::tuple<htd::vertex_t, typename Access::Handle, htd::index_t>> stack;
+
+                typename Access::Handle startingHandle = access.handle(startingVertex);
+
+                stack.emplace_back(startingVertex, startingHandle, access.childCount(startingHandle));
+
+                while (!stack.empty())
+                {
+                    std::tuple<htd::vertex_t, typename Access::Handle, htd::index_t> & top = stack.back();
+
+                    if (std::get<2>(top) > 0)
+                    {
+                        --std::get<2>(top);
+
+                        htd::vertex_t child = access.childAtPosition(std::get<1>(top), std::get<2>(top));
+
+                        typename Access::Handle childHandle = access.handle(child);
+
+                        stack.emplace_back(child, childHandle, access.childCount(childHandle));
+                    }
+                    else
+                    {
+                        htd::vertex_t vertex = std::get<0>(top);
+
+                        stack.pop_back();
+
+                        if (stack.empty())
+                        {
+                            targetFunction(vertex, htd::Vertex::UNKNOWN, 0);
+                        }
+                        else
+                        {
+                            targetFunction(vertex, std::get<0>(stack.back()), stack.size());
+                        }
+                    }
+                }
+            }
+
+            template <typename Access, typename Function>
+            static void traverseLevelOrder(const Access & access, Function & targetFunction, htd::vertex_t startingVertex)
+            {
+                HTD_ASSERT(startingVertex != htd::Vertex::UNKNOWN)
+
+                /* Each queue entry holds a vertex, its parent and its distance to the starting vertex. */
+                std::vector<std::tuple<htd::vertex_t, htd::vertex_t, std::size_t>> queue;
+
+                queue.emplace_back(startingVertex, htd::Vertex::UNKNOWN, 0);
+
+                for (htd::index_t index = 0; index < queue.size(); ++index)
+                {
+                    htd::vertex_t vertex = std::get<0>(queue[index]);
+
+                    std::size_t distance = std::get<2>(queue[index]);
+
+                    targetFunction(vertex, std::get<1>(queue[index]), distance);
+
+                    typename Access::Handle handle = access.handle(vertex);
+
+                    std::size_t childCount = access.childCount(handle);
+
+                    for (htd::index_t childIndex = 0; childIndex < childCount; ++childIndex)
+                    {
+                        queue.emplace_back(access.childAtPosition(handle, childIndex), vertex, distance + 1);
+                    }
+                }
+            }
+    };
+}
+
+#endif /* HTD_HTD_TREETRAVERSAL_HPP */
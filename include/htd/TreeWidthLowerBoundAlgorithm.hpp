@@ -0,0 +1,193 @@
+/*
+ * File:   TreeWidthLowerBoundAlgorithm.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_TREEWIDTHLOWERBOUNDALGORITHM_HPP
+#define HTD_HTD_TREEWIDTHLOWERBOUNDALGORITHM_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/IMultiHypergraph.hpp>
+#include <htd/IPreprocessedGraph.hpp>
+#include <htd/LibraryInstance.hpp>
+
+namespace htd
+{
+    /**
+     *  Algorithm for computing lower bounds for the treewidth of a graph.
+     *
+     *  The algorithm operates on the remaining vertices of the preprocessed graph and combines the following bounds:
+     *      - Minor-min-width: Repeatedly contract a vertex of minimum degree into its neighbor of minimum degree.
+     *      - MMD+ (least-c): Repeatedly contract a vertex of minimum degree into the neighbor with which it shares the least common neighbors.
+     *      - Improved graph: Raise the bound by one as long as the (k+1)-common-neighbor improvement of the graph, where k is the
+     *        current bound, has a contraction bound greater than k.
+     *
+     *  The result is never lower than the bound htd::IPreprocessedGraph::minTreeWidth() provided by the preprocessed graph.
+     *
+     *  @note In case that the algorithm is interrupted by a call to htd::LibraryInstance::terminate(), the bound found so far is returned.
+     */
+    class TreeWidthLowerBoundAlgorithm
+    {
+        public:
+            /**
+             *  Constructor for a new lower bound algorithm of type TreeWidthLowerBoundAlgorithm.
+             *
+             *  @param[in] manager   The management instance to which the new algorithm belongs.
+             */
+            HTD_API TreeWidthLowerBoundAlgorithm(const htd::LibraryInstance * const manager);
+
+            /**
+             *  Copy constructor for a lower bound algorithm of type TreeWidthLowerBoundAlgorithm.
+             *
+             *  @param[in] original  The original lower bound algorithm.
+             */
+            HTD_API TreeWidthLowerBoundAlgorithm(const TreeWidthLowerBoundAlgorithm & original);
+
+            HTD_API virtual ~TreeWidthLowerBoundAlgorithm();
+
+            /**
+             *  Compute a lower bound for the treewidth of the given graph.
+             *
+             *  @param[in] graph    The input graph.
+             *
+             *  @return A lower bound for the treewidth of the given graph.
+             */
+            HTD_API std::size_t computeLowerBound(const htd::IMultiHypergraph & graph) const;
+
+            /**
+             *  Compute a lower bound for the treewidth of the given graph.
+             *
+             *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+             *
+             *  @return A lower bound for the treewidth of the given graph.
+             */
+            HTD_API std::size_t computeLowerBound(const htd::IPreprocessedGraph & preprocessedGraph) const;
+
+            /**
+             *  Compute a lower bound for the treewidth of the given graph.
+             *
+             *  @note The computation stops as soon as the lower bound reaches the provided upper bound. This allows to check
+             *  whether a known decomposition is optimal without spending time on further improvements of the bound.
+             *
+             *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+             *  @param[in] upperBound           An upper bound for the treewidth of the given graph, e.g., the width of a known decomposition.
+             *
+             *  @return A lower bound for the treewidth of the given graph.
+             */
+            HTD_API std::size_t computeLowerBound(const htd::IPreprocessedGraph & preprocessedGraph, std::size_t upperBound) const;
+
+            /**
+             *  Check whether a decomposition of the given maximum bag size is optimal, i.e., whether its width matches the lower bound for the treewidth.
+             *
+             *  The lower bound is computed lazily on the first call and cached in the given variable, hence repeated checks with
+             *  decreasing bag sizes only pay for the (early-terminating) lower bound computation once.
+             *
+             *  @param[in] manager              The management instance to which the lower bound algorithm shall belong.
+             *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+             *  @param[in] maxBagSize           The maximum bag size of the decomposition, e.g., the best decomposition found so far.
+             *  @param[in,out] lowerBound       The lower bound for the treewidth of the input graph or (std::size_t)-1 if it was not computed yet.
+             *
+             *  @return True if a decomposition of the given maximum bag size is optimal, false otherwise.
+             */
+            HTD_API static bool isOptimal(const htd::LibraryInstance * const manager, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t & lowerBound);
+
+            /**
+             *  Check whether the minor-min-width bound (contraction into the neighbor of minimum degree) shall be computed.
+             *
+             *  @return A boolean flag indicating whether the minor-min-width bound shall be computed.
+             */
+            HTD_API bool isMinorMinWidthEnabled(void) const;
+
+            /**
+             *  Set whether the minor-min-width bound (contraction into the neighbor of minimum degree) shall be computed.
+             *
+             *  @param[in] minorMinWidthEnabled A boolean flag indicating whether the minor-min-width bound shall be computed.
+             */
+            HTD_API void setMinorMinWidthEnabled(bool minorMinWidthEnabled);
+
+            /**
+             *  Check whether the MMD+ bound (contraction into the neighbor with the least common neighbors) shall be computed.
+             *
+             *  @return A boolean flag indicating whether the MMD+ bound shall be computed.
+             */
+            HTD_API bool isLeastCommonNeighborContractionEnabled(void) const;
+
+            /**
+             *  Set whether the MMD+ bound (contraction into the neighbor with the least common neighbors) shall be computed.
+             *
+             *  @param[in] leastCommonNeighborContractionEnabled    A boolean flag indicating whether the MMD+ bound shall be computed.
+             */
+            HTD_API void setLeastCommonNeighborContractionEnabled(bool leastCommonNeighborContractionEnabled);
+
+            /**
+             *  Check whether the contraction bounds shall be improved further based on improved graphs.
+             *
+             *  @return A boolean flag indicating whether the contraction bounds shall be improved further based on improved graphs.
+             */
+            HTD_API bool isImprovedGraphEnabled(void) const;
+
+            /**
+             *  Set whether the contraction bounds shall be improved further based on improved graphs.
+             *
+             *  @note The improvement step has no effect in case that neither the minor-min-width bound nor the MMD+ bound is enabled.
+             *
+             *  @param[in] improvedGraphEnabled A boolean flag indicating whether the contraction bounds shall be improved further based on improved graphs.
+             */
+            HTD_API void setImprovedGraphEnabled(bool improvedGraphEnabled);
+
+            /**
+             *  Getter for the associated management class.
+             *
+             *  @return The associated management class.
+             */
+            HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT;
+
+            /**
+             *  Set a new management class for the library object.
+             *
+             *  @param[in] manager   The new management class for the library object.
+             */
+            HTD_API void setManagementInstance(const htd::LibraryInstance * const manager);
+
+            /**
+             *  Create a deep copy of the current lower bound algorithm.
+             *
+             *  @return A new TreeWidthLowerBoundAlgorithm object identical to the current lower bound algorithm.
+             */
+            HTD_API TreeWidthLowerBoundAlgorithm * clone(void) const;
+
+        protected:
+            /**
+             *  Copy assignment operator for a lower bound algorithm.
+             *
+             *  @note This operator is protected to prevent assignments to an already initialized algorithm.
+             */
+            TreeWidthLowerBoundAlgorithm & operator=(const TreeWidthLowerBoundAlgorithm &) { return *this; }
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_TREEWIDTHLOWERBOUNDALGORITHM_HPP */
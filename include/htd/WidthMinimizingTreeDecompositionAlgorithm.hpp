@@ -251,6 +251,22 @@ namespace htd
              */
             HTD_API void setNonImprovementLimit(std::size_t nonImprovementLimit);
 
+            /**
+             *  Check whether the algorithm shall terminate as soon as the width of the best decomposition found so far matches the lower bound for the treewidth of the input graph.
+             *
+             *  @note The lower bound is computed via htd::TreeWidthLowerBoundAlgorithm before the second decomposition is computed, hence it does not cause any overhead if only a single iteration is performed.
+             *
+             *  @return A boolean flag indicating whether the algorithm shall terminate as soon as the width of the best decomposition found so far matches the lower bound for the treewidth of the input graph.
+             */
+            HTD_API bool isLowerBoundTerminationEnabled(void) const;
+
+            /**
+             *  Set whether the algorithm shall terminate as soon as the width of the best decomposition found so far matches the lower bound for the treewidth of the input graph.
+             *
+             *  @param[in] lowerBoundTerminationEnabled A boolean flag indicating whether the algorithm shall terminate as soon as the width of the best decomposition found so far matches the lower bound for the treewidth of the input graph.
+             */
+            HTD_API void setLowerBoundTerminationEnabled(bool lowerBoundTerminationEnabled);
+
             /**
              *  Check whether the computed decompositions shall contain only subset-maximal bags.
              *
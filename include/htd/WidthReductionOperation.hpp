@@ -97,6 +97,24 @@ namespace htd
              */
             HTD_API void setGraphSeparatorAlgorithm(htd::IGraphSeparatorAlgorithm * algorithm);
 
+            /**
+             *  Getter for the number of threads which are used to analyze the bags of the decomposition.
+             *
+             *  @return The number of threads which are used to analyze the bags of the decomposition.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of threads which shall be used to analyze the bags of the decomposition.
+             *
+             *  @note The separators of all candidate bags of a round are computed concurrently before the decomposition is updated,
+             *  each thread using its own copies of the separator and connected component algorithms. Hence, the resulting decomposition
+             *  does not depend on the number of threads.
+             *
+             *  @param[in] threadCount  The number of threads which shall be used to analyze the bags of the decomposition. The value must be greater than zero.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
             HTD_API WidthReductionOperation * clone(void) const HTD_OVERRIDE;
 #else
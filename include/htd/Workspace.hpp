@@ -0,0 +1,301 @@
+/* 
+ * File:   Workspace.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_WORKSPACE_HPP
+#define HTD_HTD_WORKSPACE_HPP
+
+#include <htd/Globals.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Scratch memory for graph algorithms which can be reused across calls to avoid repeated allocations.
+     *
+     *  A workspace provides a set of visit marks indexed by vertex and an arbitrary number of typed buffers. The visit marks are
+     *  implemented as epoch stamps, hence starting a new visit via beginVisit() takes constant time regardless of the number of
+     *  vertices marked before. The buffers keep their capacity (and their contents) between uses, so algorithms are expected to
+     *  clear or assign them before use.
+     *
+     *  Workspaces are not thread-safe. Algorithms obtain them via htd::ScopedWorkspace which checks out a workspace from a pool
+     *  private to the calling thread and returns it to the pool afterwards. Workspaces which retain more than a fixed amount of
+     *  memory are destroyed on return instead, hence a single large computation does not pin its scratch memory for the lifetime
+     *  of the thread.
+     */
+    class Workspace
+    {
+        public:
+            /**
+             *  Constructor for a new, empty workspace.
+             */
+            HTD_API Workspace(void);
+
+            /**
+             *  Copy constructor for a workspace.
+             *
+             *  @param[in] original The original workspace which shall be copied.
+             */
+            HTD_API Workspace(const Workspace & original) = delete;
+
+            /**
+             *  Copy assignment operator for a workspace.
+             *
+             *  @param[in] original The original workspace which shall be copied.
+             */
+            HTD_API Workspace & operator=(const Workspace & original) = delete;
+
+            HTD_API virtual ~Workspace();
+
+            /**
+             *  Start a new visit, i.e., mark all vertices as unvisited.
+             *
+             *  @param[in] vertexBound  An upper bound (exclusive) for the identifiers of the vertices which will be visited. The bound is
+             *                          only a hint to avoid repeated growth of the visit marks, larger vertices are supported as well.
+             */
+            void beginVisit(std::size_t vertexBound = 0)
+            {
+                if (stamps_.size() < vertexBound)
+                {
+                    stamps_.resize(vertexBound, 0);
+                }
+
+                ++epoch_;
+
+                if (epoch_ == 0)
+                {
+                    std::fill(stamps_.begin(), stamps_.end(), 0);
+
+                    epoch_ = 1;
+                }
+            }
+
+            /**
+             *  Check whether the given vertex was already visited since the last call of beginVisit().
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @return True if the given vertex was already visited, false otherwise.
+             */
+            bool isVisited(htd::vertex_t vertex) const
+            {
+                return vertex < stamps_.size() && stamps_[vertex] == epoch_;
+            }
+
+            /**
+             *  Mark the given vertex as visited.
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @return True if the given vertex was not visited before, false otherwise.
+             */
+            bool visit(htd::vertex_t vertex)
+            {
+                if (vertex >= stamps_.size())
+                {
+                    stamps_.resize(vertex + 1, 0);
+                }
+
+                bool ret = stamps_[vertex] != epoch_;
+
+                stamps_[vertex] = epoch_;
+
+                return ret;
+            }
+
+            /**
+             *  Access a reusable buffer of the workspace.
+             *
+             *  @note The buffer is created on first access. Afterwards, it keeps its contents and its capacity until the workspace is destroyed.
+             *
+             *  @param[in] slot The slot of the buffer. Different slots provide independent buffers of the same type.
+             *
+             *  @return A reference to the buffer of the given type and slot.
+             */
+            template <typename T>
+            std::vector<T> & buffer(htd::index_t slot = 0)
+            {
+                std::unique_ptr<BufferBase> & entry = buffers_[std::make_pair(std::type_index(typeid(T)), slot)];
+
+                if (!entry)
+                {
+                    entry.reset(new Buffer<T>());
+                }
+
+                return static_cast<Buffer<T> &>(*entry).content;
+            }
+
+            /**
+             *  Getter for the number of bytes retained by the visit marks and the buffers of the workspace.
+             *
+             *  Buffers of vectors account for the capacity of the inner vectors as well.
+             *
+             *  @return The number of bytes retained by the visit marks and the buffers of the workspace.
+             */
+            HTD_API std::size_t retainedBytes(void) const;
+
+            /**
+             *  Getter for the number of buffers created in the workspace.
+             *
+             *  @return The number of buffers created in the workspace.
+             */
+            std::size_t bufferCount(void) const
+            {
+                return buffers_.size();
+            }
+
+            /**
+             *  Check out a workspace from the pool of the calling thread. If the pool is empty, a new workspace is created.
+             *
+             *  @note Each workspace obtained via this method must be returned via release() by the same thread.
+             *
+             *  @return A workspace which is exclusively used by the caller until it is released.
+             */
+            HTD_API static Workspace * acquire(void);
+
+            /**
+             *  Return a workspace to the pool of the calling thread.
+             *
+             *  If the workspace retains more than maximumPooledBytes() bytes, it is destroyed instead.
+             *
+             *  @param[in] workspace    The workspace obtained via acquire().
+             */
+            HTD_API static void release(Workspace * workspace);
+
+            /**
+             *  Getter for the maximum number of bytes which a workspace may retain in order to be kept in the pool.
+             *
+             *  @return The maximum number of bytes which a workspace may retain in order to be kept in the pool.
+             */
+            HTD_API static std::size_t maximumPooledBytes(void);
+
+            /**
+             *  Destroy all workspaces which are currently in the pool of the calling thread.
+             *
+             *  This allows to free the scratch memory of a thread after a large computation. Workspaces which are currently checked out are not affected.
+             */
+            HTD_API static void releaseIdleWorkspaces(void);
+
+            /**
+             *  Getter for the number of workspaces which are currently in the pool of the calling thread.
+             *
+             *  @return The number of workspaces which are currently in the pool of the calling thread.
+             */
+            HTD_API static std::size_t idleWorkspaceCount(void);
+
+        private:
+            /**
+             *  Common base class of the typed buffers.
+             */
+            struct BufferBase
+            {
+                virtual ~BufferBase()
+                {
+
+                }
+
+                /**
+                 *  Getter for the number of bytes retained by the buffer.
+                 *
+                 *  @return The number of bytes retained by the buffer.
+                 */
+                virtual std::size_t retainedBytes(void) const = 0;
+            };
+
+            /**
+             *  Buffer holding elements of a specific type.
+             */
+            template <typename T>
+            struct Buffer : public BufferBase
+            {
+                /**
+                 *  The content of the buffer.
+                 */
+                std::vector<T> content;
+
+                std::size_t retainedBytes(void) const HTD_OVERRIDE
+                {
+                    return Workspace::retainedBytes(content);
+                }
+            };
+
+            /**
+             *  Compute the number of bytes retained by the given vector.
+             *
+             *  @param[in] vector   The vector.
+             *
+             *  @return The number of bytes retained by the given vector.
+             */
+            template <typename T>
+            static std::size_t retainedBytes(const std::vector<T> & vector)
+            {
+                return vector.capacity() * sizeof(T);
+            }
+
+            /**
+             *  Compute the number of bytes retained by the given vector of vectors, including the capacity of the inner vectors.
+             *
+             *  @param[in] vector   The vector of vectors.
+             *
+             *  @return The number of bytes retained by the given vector of vectors.
+             */
+            template <typename T>
+            static std::size_t retainedBytes(const std::vector<std::vector<T>> & vector)
+            {
+                std::size_t ret = vector.capacity() * sizeof(std::vector<T>);
+
+                for (const std::vector<T> & element : vector)
+                {
+                    ret += retainedBytes(element);
+                }
+
+                return ret;
+            }
+
+            /**
+             *  The visit stamps of the vertices.
+             */
+            std::vector<std::uint32_t> stamps_;
+
+            /**
+             *  The current visit epoch.
+             */
+            std::uint32_t epoch_;
+
+            /**
+             *  The buffers of the workspace, indexed by element type and slot.
+             */
+            std::map<std::pair<std::type_index, htd::index_t>, std::unique_ptr<BufferBase>> buffers_;
+    };
+}
+
+#endif /* HTD_HTD_WORKSPACE_HPP */
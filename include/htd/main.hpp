@@ -32,6 +32,7 @@
 #include <htd/Algorithm.hpp>
 #include <htd/AssemblyInfo.hpp>
 #include <htd/BiconnectedComponentAlgorithm.hpp>
+#include <htd/BitsetSetCover.hpp>
 #include <htd/BidirectionalGraphNaming.hpp>
 #include <htd/BreadthFirstGraphTraversal.hpp>
 #include <htd/BucketEliminationGraphDecompositionAlgorithm.hpp>
@@ -39,6 +40,7 @@
 #include <htd/CliqueMinimalSeparatorAlgorithm.hpp>
 #include <htd/Collection.hpp>
 #include <htd/CombinedWidthMinimizingTreeDecompositionAlgorithm.hpp>
+#include <htd/CompressedSparseRowGraph.hpp>
 #include <htd/CompressionOperation.hpp>
 #include <htd/ConnectedComponentAlgorithmFactory.hpp>
 #include <htd/ConstCollection.hpp>
@@ -46,6 +48,8 @@
 #include <htd/ConstIterator.hpp>
 #include <htd/ConstIteratorWrapper.hpp>
 #include <htd/ConstPointerIteratorWrapper.hpp>
+#include <htd/CopyOnWrite.hpp>
+#include <htd/DecompositionCache.hpp>
 #include <htd/DepthFirstConnectedComponentAlgorithm.hpp>
 #include <htd/DepthFirstGraphTraversal.hpp>
 #include <htd/DinitzMaxFlowAlgorithm.hpp>
@@ -59,6 +63,7 @@
 #include <htd/FilteredHyperedgeCollection.hpp>
 #include <htd/FitnessEvaluation.hpp>
 #include <htd/FlowNetworkStructure.hpp>
+#include <htd/FusedManipulationOperation.hpp>
 #include <htd/Globals.hpp>
 #include <htd/GraphDecompositionAlgorithmFactory.hpp>
 #include <htd/GraphDecompositionFactory.hpp>
@@ -83,6 +88,7 @@
 #include <htd/HypertreeDecompositionFactory.hpp>
 #include <htd/HypertreeDecomposition.hpp>
 #include <htd/IBiconnectedComponentAlgorithm.hpp>
+#include <htd/IBoundedTreeDecompositionFitnessFunction.hpp>
 #include <htd/IConnectedComponentAlgorithm.hpp>
 #include <htd/ICustomizedTreeDecompositionAlgorithm.hpp>
 #include <htd/IDecompositionManipulationOperation.hpp>
@@ -117,6 +123,7 @@
 #include <htd/ILabelingCollection.hpp>
 #include <htd/ILabelingFunction.hpp>
 #include <htd/IMaxFlowAlgorithm.hpp>
+#include <htd/IMemoryResource.hpp>
 #include <htd/IMultiGraph.hpp>
 #include <htd/IMultiHypergraph.hpp>
 #include <htd/IMutableDirectedGraph.hpp>
@@ -140,6 +147,7 @@
 #include <htd/IMutableTreeDecomposition.hpp>
 #include <htd/IMutableTree.hpp>
 #include <htd/InducedSubgraphLabelingOperation.hpp>
+#include <htd/Instrumentation.hpp>
 #include <htd/IOrderingAlgorithm.hpp>
 #include <htd/IPathDecompositionAlgorithm.hpp>
 #include <htd/IPathDecomposition.hpp>
@@ -191,10 +199,14 @@
 #include <htd/LimitChildCountOperation.hpp>
 #include <htd/LimitMaximumForgottenVertexCountOperation.hpp>
 #include <htd/LimitMaximumIntroducedVertexCountOperation.hpp>
+#include <htd/LocalSearchOrderingAlgorithm.hpp>
 #include <htd/MaximumCardinalitySearchOrderingAlgorithm.hpp>
+#include <htd/MemoryManager.hpp>
+#include <htd/MemoryResourceAllocator.hpp>
 #include <htd/MinDegreeOrderingAlgorithm.hpp>
 #include <htd/MinFillOrderingAlgorithm.hpp>
 #include <htd/MinimumSeparatorAlgorithm.hpp>
+#include <htd/MonotonicMemoryResource.hpp>
 #include <htd/MultiGraphFactory.hpp>
 #include <htd/MultiGraph.hpp>
 #include <htd/MultiHypergraphFactory.hpp>
@@ -209,12 +221,15 @@
 #include <htd/NamedTree.hpp>
 #include <htd/NamedVertexHyperedge.hpp>
 #include <htd/NaturalOrderingAlgorithm.hpp>
+#include <htd/NestedDissectionOrderingAlgorithm.hpp>
+#include <htd/NewDeleteMemoryResource.hpp>
 #include <htd/NormalizationOperation.hpp>
 #include <htd/OrderingAlgorithmFactory.hpp>
 #include <htd/PathDecompositionAlgorithmFactory.hpp>
 #include <htd/PathDecompositionFactory.hpp>
 #include <htd/PathDecomposition.hpp>
 #include <htd/Path.hpp>
+#include <htd/PoolMemoryResource.hpp>
 #include <htd/PostOrderTreeTraversal.hpp>
 #include <htd/PostProcessingPathDecompositionAlgorithm.hpp>
 #include <htd/PreOrderTreeTraversal.hpp>
@@ -223,19 +238,25 @@
 #include <htd/PriorityQueue.hpp>
 #include <htd/RandomOrderingAlgorithm.hpp>
 #include <htd/RandomVertexSelectionStrategy.hpp>
+#include <htd/ScopedTimer.hpp>
+#include <htd/ScopedWorkspace.hpp>
 #include <htd/SemiNormalizationOperation.hpp>
 #include <htd/SeparatorBasedTreeDecompositionAlgorithm.hpp>
 #include <htd/SetCoverAlgorithmFactory.hpp>
 #include <htd/SetCoverAlgorithm.hpp>
 #include <htd/SingleNeighborVertexSelectionStrategy.hpp>
 #include <htd/State.hpp>
+#include <htd/StringReference.hpp>
 #include <htd/StronglyConnectedComponentAlgorithmFactory.hpp>
+#include <htd/SymbolTable.hpp>
 #include <htd/TarjanStronglyConnectedComponentAlgorithm.hpp>
 #include <htd/TreeDecompositionAlgorithmFactory.hpp>
 #include <htd/TreeDecompositionFactory.hpp>
 #include <htd/TreeDecomposition.hpp>
 #include <htd/TreeDecompositionOptimizationOperation.hpp>
 #include <htd/TreeDecompositionVerifier.hpp>
+#include <htd/TreeTraversal.hpp>
+#include <htd/TreeWidthLowerBoundAlgorithm.hpp>
 #include <htd/Tree.hpp>
 #include <htd/TriangulationMinimizationOrderingAlgorithm.hpp>
 #include <htd/TrivialTreeDecompositionAlgorithm.hpp>
@@ -247,5 +268,6 @@
 #include <htd/WeakNormalizationOperation.hpp>
 #include <htd/WidthMinimizingTreeDecompositionAlgorithm.hpp>
 #include <htd/WidthReductionOperation.hpp>
+#include <htd/Workspace.hpp>
 
 #endif /* HTD_HTD_MAIN_HPP */
@@ -28,8 +28,10 @@
 #include <htd/AdaptiveWidthMinimizingTreeDecompositionAlgorithm.hpp>
 #include <htd/BucketEliminationTreeDecompositionAlgorithm.hpp>
 
+#include <htd/Helpers.hpp>
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
+#include <htd/TreeWidthLowerBoundAlgorithm.hpp>
 
 #include <cstdarg>
 
@@ -44,7 +46,7 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  @param[in] manager  The management instance to which the current object instance belongs.
      */
     Implementation(const htd::LibraryInstance * const manager)
-        : managementInstance_(manager), algorithms_(), filters_(), decisionRounds_(1), iterationCount_(1), nonImprovementLimit_(-1), computeInducedEdges_(true)
+        : managementInstance_(manager), algorithms_(), filters_(), decisionRounds_(1), iterationCount_(1), nonImprovementLimit_(-1), computeInducedEdges_(true), lowerBoundTerminationEnabled_(true)
     {
 
     }
@@ -54,7 +56,7 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *
      *  @param[in] original The original implementation details structure.
      */
-    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithms_(), filters_(original.filters_), decisionRounds_(original.decisionRounds_), iterationCount_(original.iterationCount_), nonImprovementLimit_(original.nonImprovementLimit_), computeInducedEdges_(original.computeInducedEdges_)
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithms_(), filters_(original.filters_), decisionRounds_(original.decisionRounds_), iterationCount_(original.iterationCount_), nonImprovementLimit_(original.nonImprovementLimit_), computeInducedEdges_(original.computeInducedEdges_), lowerBoundTerminationEnabled_(original.lowerBoundTerminationEnabled_)
     {
         for (const htd::ITreeDecompositionAlgorithm * algorithm : original.algorithms_)
         {
@@ -105,6 +107,21 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
      */
     bool computeInducedEdges_;
 
+    /**
+     *  A boolean flag indicating whether the algorithm shall terminate as soon as the width of the best decomposition matches the lower bound for the treewidth.
+     */
+    bool lowerBoundTerminationEnabled_;
+
+    /**
+     *  Check whether a decomposition of the given maximum bag size is optimal. Always false if lower bound termination is disabled.
+     *
+     *  @see htd::TreeWidthLowerBoundAlgorithm::isOptimal()
+     */
+    bool isOptimal(const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t & lowerBound) const
+    {
+        return lowerBoundTerminationEnabled_ && htd::TreeWidthLowerBoundAlgorithm::isOptimal(managementInstance_, preprocessedGraph, maxBagSize, lowerBound);
+    }
+
     /**
      *  Compute a decomposition of the given graph and apply the given manipulation operations to it.
      *
@@ -114,6 +131,7 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  @param[in] manipulationOperations   The manipulation operations which shall be applied.
      *  @param[in] progressCallback         A callback function which is invoked for each new decomposition.
      *  @param[in] maxBagSize               The upper bound for the maximum bag size of the computed decomposition.
+     *  @param[in,out] lowerBound           The lower bound for the treewidth of the input graph or (std::size_t)-1 if it was not computed yet.
      *
      *  @note The maximum bag size of the computed decomposition must be less than or equal to the provided upper bound.
      *
@@ -129,7 +147,7 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
                                                            const htd::IMultiHypergraph & graph,
                                                            const htd::IPreprocessedGraph & preprocessedGraph,
                                                            const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
-                                                           const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const;
+                                                           const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize, std::size_t & lowerBound) const;
 
     /**
      *  Compute a decomposition of the given graph and apply the given manipulation operations to it.
@@ -140,6 +158,7 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  @param[in] manipulationOperations   The manipulation operations which shall be applied.
      *  @param[in] progressCallback         A callback function which is invoked for each new decomposition.
      *  @param[in] maxBagSize               The upper bound for the maximum bag size of the computed decomposition.
+     *  @param[in,out] lowerBound           The lower bound for the treewidth of the input graph or (std::size_t)-1 if it was not computed yet.
      *
      *  @note The maximum bag size of the computed decomposition must be less than or equal to the provided upper bound.
      *
@@ -155,7 +174,7 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
                                                            const htd::IMultiHypergraph & graph,
                                                            const htd::IPreprocessedGraph & preprocessedGraph,
                                                            const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
-                                                           const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const;
+                                                           const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize, std::size_t & lowerBound) const;
 };
 
 htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::AdaptiveWidthMinimizingTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -214,6 +233,8 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
                                                                                                        const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
                                                                                                        const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback) const
 {
+    htd::RandomNumberGeneratorScope randomNumberGeneratorScope;
+
     htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
 
     htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
@@ -274,6 +295,8 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
                                                                                                                const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
                                                                                                                const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const
 {
+    htd::RandomNumberGeneratorScope randomNumberGeneratorScope;
+
     htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
 
     htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
@@ -310,6 +333,8 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
                                                                                                                const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
                                                                                                                const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const
 {
+    htd::RandomNumberGeneratorScope randomNumberGeneratorScope;
+
     std::size_t bestMaxBagSize = maxBagSize;
 
     if (bestMaxBagSize != (std::size_t)-1)
@@ -326,6 +351,8 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
 
     std::unordered_set<htd::index_t> disqualifiedAlgorithms;
 
+    std::size_t lowerBound = (std::size_t)-1;
+
     for (const std::pair<std::function<bool(const htd::IMultiHypergraph &, const htd::IPreprocessedGraph &)>, htd::index_t> & filter : implementation_->filters_)
     {
         if (!filter.first(graph, preprocessedGraph))
@@ -338,7 +365,7 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
     {
         htd::index_t algorithmIndex = 0;
 
-        for (auto it = implementation_->algorithms_.begin(); it != implementation_->algorithms_.end() && !managementInstance.isTerminated(); ++it)
+        for (auto it = implementation_->algorithms_.begin(); it != implementation_->algorithms_.end() && !managementInstance.isTerminated() && (ret == nullptr || !implementation_->isOptimal(preprocessedGraph, bestMaxBagSize, lowerBound)); ++it)
         {
             if (disqualifiedAlgorithms.count(algorithmIndex) == 0)
             {
@@ -422,6 +449,16 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
         }
     }
 
+    if (ret != nullptr && implementation_->isOptimal(preprocessedGraph, bestMaxBagSize, lowerBound))
+    {
+        for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+        {
+            delete operation;
+        }
+
+        return ret;
+    }
+
     std::size_t optimum = (std::size_t)-1;
 
     std::vector<htd::index_t> pool;
@@ -452,7 +489,7 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
 
     if (bucketEliminationTreeDecompositionAlgorithm != nullptr)
     {
-        htd::ITreeDecomposition * currentDecomposition = implementation_->computeImprovedDecomposition(*bucketEliminationTreeDecompositionAlgorithm, graph, preprocessedGraph, manipulationOperations, progressCallback, bestMaxBagSize - 1);
+        htd::ITreeDecomposition * currentDecomposition = implementation_->computeImprovedDecomposition(*bucketEliminationTreeDecompositionAlgorithm, graph, preprocessedGraph, manipulationOperations, progressCallback, bestMaxBagSize - 1, lowerBound);
 
         if (currentDecomposition != nullptr)
         {
@@ -467,7 +504,7 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
     }
     else
     {
-        htd::ITreeDecomposition * currentDecomposition = implementation_->computeImprovedDecomposition(*selectedAlgorithm, graph, preprocessedGraph, manipulationOperations, progressCallback, bestMaxBagSize - 1);
+        htd::ITreeDecomposition * currentDecomposition = implementation_->computeImprovedDecomposition(*selectedAlgorithm, graph, preprocessedGraph, manipulationOperations, progressCallback, bestMaxBagSize - 1, lowerBound);
 
         if (currentDecomposition != nullptr)
         {
@@ -640,6 +677,16 @@ void htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::setNonImprovementLi
     implementation_->nonImprovementLimit_ = nonImprovementLimit;
 }
 
+bool htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::isLowerBoundTerminationEnabled(void) const
+{
+    return implementation_->lowerBoundTerminationEnabled_;
+}
+
+void htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::setLowerBoundTerminationEnabled(bool lowerBoundTerminationEnabled)
+{
+    implementation_->lowerBoundTerminationEnabled_ = lowerBoundTerminationEnabled;
+}
+
 std::size_t htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::decisionRounds(void) const
 {
     return implementation_->decisionRounds_;
@@ -659,7 +706,7 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
                                                                                                                                const htd::IMultiHypergraph & graph,
                                                                                                                                const htd::IPreprocessedGraph & preprocessedGraph,
                                                                                                                                const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
-                                                                                                                               const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const
+                                                                                                                               const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize, std::size_t & lowerBound) const
 {
     std::size_t bestMaxBagSize = maxBagSize + 1;
 
@@ -669,7 +716,7 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
 
     std::size_t nonImprovementCount = 0;
 
-    while (remainingIterations > 0 && !managementInstance_->isTerminated())
+    while (remainingIterations > 0 && !managementInstance_->isTerminated() && (ret == nullptr || !isOptimal(preprocessedGraph, bestMaxBagSize, lowerBound)))
     {
         std::vector<htd::IDecompositionManipulationOperation *> clonedManipulationOperations;
 
@@ -751,7 +798,7 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
                                                                                                                                const htd::IMultiHypergraph & graph,
                                                                                                                                const htd::IPreprocessedGraph & preprocessedGraph,
                                                                                                                                const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
-                                                                                                                               const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const
+                                                                                                                               const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize, std::size_t & lowerBound) const
 {
     std::size_t bestMaxBagSize = maxBagSize + 1;
 
@@ -759,7 +806,7 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
 
     std::size_t remainingIterations = iterationCount_;
 
-    while (remainingIterations > 0 && !managementInstance_->isTerminated())
+    while (remainingIterations > 0 && !managementInstance_->isTerminated() && (ret == nullptr || !isOptimal(preprocessedGraph, bestMaxBagSize, lowerBound)))
     {
         std::vector<htd::IDecompositionManipulationOperation *> clonedManipulationOperations;
 
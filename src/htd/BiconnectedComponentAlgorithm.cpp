@@ -28,10 +28,11 @@
 #include <htd/Globals.hpp>
 #include <htd/Helpers.hpp>
 #include <htd/BiconnectedComponentAlgorithm.hpp>
+#include <htd/ScopedWorkspace.hpp>
 
 #include <algorithm>
-#include <stack>
 #include <stdexcept>
+#include <tuple>
 
 /**
  *  Private implementation details of class htd::BiconnectedComponentAlgorithm.
@@ -53,6 +54,19 @@ struct htd::BiconnectedComponentAlgorithm::Implementation
 
     }
 
+    /**
+     *  Add the vertices of a biconnected component to the given target vector.
+     *
+     *  @param[in] component    The endpoints of the edges of the biconnected component. The vector is sorted and duplicates are removed.
+     *  @param[out] target      The target vector to which the sorted, duplicate-free component shall be appended.
+     */
+    static void addComponent(std::vector<htd::vertex_t> & component, std::vector<std::vector<htd::vertex_t>> & target)
+    {
+        std::sort(component.begin(), component.end());
+
+        target.emplace_back(component.begin(), std::unique(component.begin(), component.end()));
+    }
+
     /**
      *  The management instance to which the current object instance belongs.
      */
@@ -75,7 +89,7 @@ void htd::BiconnectedComponentAlgorithm::determineComponents(const htd::IGraphSt
 
     if (!vertexCollection.empty())
     {
-        std::unordered_set<htd::vertex_t> unvisitedVertices(vertexCollection.begin(), vertexCollection.end());
+        htd::ScopedWorkspace workspace;
 
         const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
@@ -83,31 +97,43 @@ void htd::BiconnectedComponentAlgorithm::determineComponents(const htd::IGraphSt
 
         htd::vertex_t initialSize = graph.vertexAtPosition(graph.vertexCount() - 1) + 1;
 
-        std::vector<std::size_t> low(initialSize);
+        std::vector<std::size_t> & low = workspace->buffer<std::size_t>(0);
+
+        std::vector<std::size_t> & discovery = workspace->buffer<std::size_t>(1);
+
+        std::vector<htd::vertex_t> & parent = workspace->buffer<htd::vertex_t>(0);
+
+        std::vector<htd::vertex_t> & component = workspace->buffer<htd::vertex_t>(1);
+
+        std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges = workspace->buffer<std::pair<htd::vertex_t, htd::vertex_t>>();
+
+        std::vector<std::tuple<htd::vertex_t, htd::index_t, std::size_t>> & stack = workspace->buffer<std::tuple<htd::vertex_t, htd::index_t, std::size_t>>();
+
+        low.assign(initialSize, 0);
 
-        std::vector<std::size_t> discovery(initialSize);
+        discovery.assign(initialSize, 0);
 
-        std::vector<htd::vertex_t> parent(initialSize, htd::Vertex::UNKNOWN - 1);
+        parent.assign(initialSize, htd::Vertex::UNKNOWN - 1);
 
-        std::deque<std::pair<htd::vertex_t, htd::vertex_t>> edges;
+        edges.clear();
 
-        std::stack<std::tuple<htd::vertex_t, htd::index_t, std::size_t>> stack;
+        stack.clear();
 
         std::size_t oldArticulationPointCount = articulationPoints.size();
 
-        while (!unvisitedVertices.empty() && !managementInstance.isTerminated())
+        for (auto it = vertexCollection.begin(); it != vertexCollection.end() && !managementInstance.isTerminated(); ++it)
         {
-            htd::vertex_t vertex = *(unvisitedVertices.begin());
+            htd::vertex_t vertex = *it;
 
             if (discovery[vertex] == 0)
             {
                 time = 1;
 
-                stack.emplace(vertex, 0, 0);
+                stack.emplace_back(vertex, 0, 0);
 
                 while (!stack.empty())
                 {
-                    htd::vertex_t current = std::get<0>(stack.top());
+                    htd::vertex_t current = std::get<0>(stack.back());
 
                     if (discovery[current] == 0)
                     {
@@ -115,28 +141,26 @@ void htd::BiconnectedComponentAlgorithm::determineComponents(const htd::IGraphSt
 
                         discovery[current] = time;
 
-                        unvisitedVertices.erase(current);
-
                         ++time;
                     }
 
-                    htd::index_t index = std::get<1>(stack.top());
+                    htd::index_t index = std::get<1>(stack.back());
 
                     if (index < graph.neighborCount(current))
                     {
                         htd::vertex_t neighbor = graph.neighborAtPosition(current, index);
 
-                        std::get<1>(stack.top())++;
+                        std::get<1>(stack.back())++;
 
                         if (discovery[neighbor] == 0)
                         {
-                            std::get<2>(stack.top())++;
+                            std::get<2>(stack.back())++;
 
                             parent[neighbor] = current;
 
                             edges.emplace_back(current, neighbor);
 
-                            stack.emplace(neighbor, 0, 0);
+                            stack.emplace_back(neighbor, 0, 0);
                         }
                         else if (neighbor != parent[current] && discovery[neighbor] < low[current])
                         {
@@ -147,65 +171,61 @@ void htd::BiconnectedComponentAlgorithm::determineComponents(const htd::IGraphSt
                     }
                     else
                     {
-                        stack.pop();
+                        stack.pop_back();
 
                         if (!stack.empty())
                         {
-                            current = std::get<0>(stack.top());
+                            current = std::get<0>(stack.back());
 
-                            std::size_t children = std::get<2>(stack.top());
+                            std::size_t children = std::get<2>(stack.back());
 
-                            htd::vertex_t neighbor = graph.neighborAtPosition(current, std::get<1>(stack.top()) - 1);
+                            htd::vertex_t neighbor = graph.neighborAtPosition(current, std::get<1>(stack.back()) - 1);
 
                             low[current] = std::min(low[current], low[neighbor]);
 
                             if ((discovery[current] == 1 && children > 1) || (discovery[current] > 1 && low[neighbor] >= discovery[current]))
                             {
-                                std::unordered_set<htd::vertex_t> component;
+                                component.clear();
 
                                 while (edges.back().first != current || edges.back().second != neighbor)
                                 {
-                                    component.insert(edges.back().first);
-                                    component.insert(edges.back().second);
+                                    component.push_back(edges.back().first);
+                                    component.push_back(edges.back().second);
 
                                     edges.pop_back();
                                 }
 
-                                component.insert(edges.back().first);
-                                component.insert(edges.back().second);
+                                component.push_back(edges.back().first);
+                                component.push_back(edges.back().second);
 
                                 edges.pop_back();
 
-                                target.emplace_back(component.begin(), component.end());
-
-                                std::sort(target.back().begin(), target.back().end());
+                                Implementation::addComponent(component, target);
 
                                 articulationPoints.push_back(current);
                             }
                         }
                     }
                 }
-            }
 
-            std::unordered_set<htd::vertex_t> component;
+                component.clear();
 
-            while (edges.size() > 0)
-            {
-                component.insert(edges.back().first);
-                component.insert(edges.back().second);
-
-                edges.pop_back();
-            }
+                while (edges.size() > 0)
+                {
+                    component.push_back(edges.back().first);
+                    component.push_back(edges.back().second);
 
-            if (!component.empty())
-            {
-                target.emplace_back(component.begin(), component.end());
+                    edges.pop_back();
+                }
 
-                std::sort(target.back().begin(), target.back().end());
+                if (!component.empty())
+                {
+                    Implementation::addComponent(component, target);
+                }
             }
-
-            std::sort(articulationPoints.begin() + oldArticulationPointCount, articulationPoints.end());
         }
+
+        std::sort(articulationPoints.begin() + oldArticulationPointCount, articulationPoints.end());
     }
 }
 
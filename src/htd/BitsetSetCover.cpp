@@ -0,0 +1,514 @@
+/* 
+ * File:   BitsetSetCover.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_BITSETSETCOVER_CPP
+#define HTD_HTD_BITSETSETCOVER_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/BitsetSetCover.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <queue>
+#include <utility>
+
+/**
+ *  The number of elements stored in a single word of a bitset.
+ */
+static const std::size_t WORD_SIZE = 64;
+
+/**
+ *  Count the number of bits set in the given word.
+ *
+ *  @param[in] word The word.
+ *
+ *  @return The number of bits set in the given word.
+ */
+static inline std::size_t popcount(std::uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>(__builtin_popcountll(word));
+#else
+    word = word - ((word >> 1) & 0x5555555555555555ULL);
+    word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+    word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+
+    return static_cast<std::size_t>((word * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+/**
+ *  Private implementation details of class htd::BitsetSetCover.
+ */
+struct htd::BitsetSetCover::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] elements     The set of elements which must be covered.
+     *  @param[in] containers   The collection of containers which are available for covering the given elements.
+     */
+    template <typename ContainerCollection>
+    Implementation(const std::vector<htd::id_t> & elements, const ContainerCollection & containers) : elementCount_(elements.size()), wordCount_((elements.size() + WORD_SIZE - 1) / WORD_SIZE), bits_(), indices_()
+    {
+        std::vector<std::uint64_t> bitset(wordCount_);
+
+        htd::index_t index = 0;
+
+        for (const std::vector<htd::id_t> & container : containers)
+        {
+            std::fill(bitset.begin(), bitset.end(), 0);
+
+            bool relevant = false;
+
+            auto it1 = elements.begin();
+            auto it2 = container.begin();
+
+            while (it1 != elements.end() && it2 != container.end())
+            {
+                if (*it1 < *it2)
+                {
+                    ++it1;
+                }
+                else if (*it2 < *it1)
+                {
+                    ++it2;
+                }
+                else
+                {
+                    std::size_t position = static_cast<std::size_t>(it1 - elements.begin());
+
+                    bitset[position / WORD_SIZE] |= std::uint64_t(1) << (position % WORD_SIZE);
+
+                    relevant = true;
+
+                    ++it1;
+                    ++it2;
+                }
+            }
+
+            if (relevant)
+            {
+                bits_.insert(bits_.end(), bitset.begin(), bitset.end());
+
+                indices_.push_back(index);
+            }
+
+            ++index;
+        }
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  The number of elements which must be covered.
+     */
+    std::size_t elementCount_;
+
+    /**
+     *  The number of words of each bitset.
+     */
+    std::size_t wordCount_;
+
+    /**
+     *  The bitsets of the relevant containers, stored consecutively.
+     */
+    std::vector<std::uint64_t> bits_;
+
+    /**
+     *  The original indices of the relevant containers in ascending order.
+     */
+    std::vector<htd::index_t> indices_;
+
+    /**
+     *  Access the bitset of the relevant container at the given position.
+     *
+     *  @param[in] position The position of the relevant container.
+     *
+     *  @return A pointer to the first word of the bitset of the relevant container at the given position.
+     */
+    const std::uint64_t * bitset(std::size_t position) const
+    {
+        return bits_.data() + position * wordCount_;
+    }
+
+    /**
+     *  Create a bitset containing all elements which must be covered.
+     *
+     *  @return A bitset containing all elements which must be covered.
+     */
+    std::vector<std::uint64_t> universe(void) const
+    {
+        std::vector<std::uint64_t> ret(wordCount_, ~std::uint64_t(0));
+
+        if (elementCount_ % WORD_SIZE != 0)
+        {
+            ret.back() = (std::uint64_t(1) << (elementCount_ % WORD_SIZE)) - 1;
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Compute the number of elements of the given bitset which are covered by the relevant container at the given position.
+     *
+     *  @param[in] position The position of the relevant container.
+     *  @param[in] elements The bitset of elements.
+     *
+     *  @return The number of elements of the given bitset which are covered by the relevant container at the given position.
+     */
+    std::size_t coverage(std::size_t position, const std::vector<std::uint64_t> & elements) const
+    {
+        std::size_t ret = 0;
+
+        const std::uint64_t * container = bitset(position);
+
+        for (std::size_t word = 0; word < wordCount_; ++word)
+        {
+            ret += popcount(container[word] & elements[word]);
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Remove the elements covered by the relevant container at the given position from the given bitset.
+     *
+     *  @param[in] position     The position of the relevant container.
+     *  @param[in,out] elements The bitset of elements.
+     */
+    void cover(std::size_t position, std::vector<std::uint64_t> & elements) const
+    {
+        const std::uint64_t * container = bitset(position);
+
+        for (std::size_t word = 0; word < wordCount_; ++word)
+        {
+            elements[word] &= ~container[word];
+        }
+    }
+
+    /**
+     *  Check whether the given bitset is empty.
+     *
+     *  @param[in] elements The bitset of elements.
+     *
+     *  @return True if the given bitset is empty, false otherwise.
+     */
+    bool isEmpty(const std::vector<std::uint64_t> & elements) const
+    {
+        return std::all_of(elements.begin(), elements.end(), [](std::uint64_t word) { return word == 0; });
+    }
+
+    /**
+     *  Compute a set cover via the lazy greedy heuristic.
+     *
+     *  @param[out] result  The positions of the selected relevant containers in the order of their selection.
+     *
+     *  @return True if all elements could be covered, false otherwise.
+     */
+    bool computeGreedyCover(std::vector<std::size_t> & result) const
+    {
+        typedef std::pair<std::size_t, std::size_t> Candidate;
+
+        auto compare = [](const Candidate & candidate1, const Candidate & candidate2)
+        {
+            return candidate1.first < candidate2.first || (candidate1.first == candidate2.first && candidate1.second > candidate2.second);
+        };
+
+        std::priority_queue<Candidate, std::vector<Candidate>, decltype(compare)> queue(compare);
+
+        std::vector<std::uint64_t> remainder = universe();
+
+        for (std::size_t position = 0; position < indices_.size(); ++position)
+        {
+            queue.emplace(coverage(position, remainder), position);
+        }
+
+        while (!queue.empty() && !isEmpty(remainder))
+        {
+            Candidate candidate = queue.top();
+
+            queue.pop();
+
+            candidate.first = coverage(candidate.second, remainder);
+
+            if (candidate.first > 0)
+            {
+                if (queue.empty() || !compare(candidate, queue.top()))
+                {
+                    result.push_back(candidate.second);
+
+                    cover(candidate.second, remainder);
+                }
+                else
+                {
+                    queue.push(candidate);
+                }
+            }
+        }
+
+        return isEmpty(remainder);
+    }
+
+    /**
+     *  Recursively search for a set cover which is smaller than the best one found so far.
+     *
+     *  @param[in] remainder        The bitset of elements which still need to be covered.
+     *  @param[in] candidates       The positions of the relevant containers covering each of the elements.
+     *  @param[in] maximumCoverage  The maximum number of elements covered by a single relevant container.
+     *  @param[in,out] selection    The positions of the relevant containers selected so far.
+     *  @param[in,out] best         The smallest set cover found so far.
+     */
+    void search(const std::vector<std::uint64_t> & remainder, const std::vector<std::vector<std::size_t>> & candidates, std::size_t maximumCoverage, std::vector<std::size_t> & selection, std::vector<std::size_t> & best) const
+    {
+        std::size_t remainingElements = 0;
+
+        std::size_t branchingElement = 0;
+
+        std::size_t branchingFactor = (std::size_t)-1;
+
+        for (std::size_t word = 0; word < wordCount_; ++word)
+        {
+            std::uint64_t value = remainder[word];
+
+            remainingElements += popcount(value);
+
+            while (value != 0)
+            {
+                std::size_t element = word * WORD_SIZE + static_cast<std::size_t>(popcount((value & (~value + 1)) - 1));
+
+                if (candidates[element].size() < branchingFactor)
+                {
+                    branchingFactor = candidates[element].size();
+
+                    branchingElement = element;
+                }
+
+                value &= value - 1;
+            }
+        }
+
+        if (remainingElements == 0)
+        {
+            if (selection.size() < best.size())
+            {
+                best = selection;
+            }
+
+            return;
+        }
+
+        if (selection.size() + (remainingElements + maximumCoverage - 1) / maximumCoverage >= best.size())
+        {
+            return;
+        }
+
+        std::vector<std::pair<std::size_t, std::size_t>> branches;
+
+        for (std::size_t position : candidates[branchingElement])
+        {
+            branches.emplace_back(coverage(position, remainder), position);
+        }
+
+        std::sort(branches.begin(), branches.end(), [](const std::pair<std::size_t, std::size_t> & branch1, const std::pair<std::size_t, std::size_t> & branch2)
+        {
+            return branch1.first > branch2.first || (branch1.first == branch2.first && branch1.second < branch2.second);
+        });
+
+        std::vector<std::uint64_t> newRemainder(wordCount_);
+
+        for (const std::pair<std::size_t, std::size_t> & branch : branches)
+        {
+            if (selection.size() + 1 >= best.size())
+            {
+                return;
+            }
+
+            newRemainder = remainder;
+
+            cover(branch.second, newRemainder);
+
+            selection.push_back(branch.second);
+
+            search(newRemainder, candidates, maximumCoverage, selection, best);
+
+            selection.pop_back();
+        }
+    }
+
+    /**
+     *  Compute a set cover of minimum cardinality.
+     *
+     *  @param[out] result  The positions of the selected relevant containers.
+     *
+     *  @return True if all elements could be covered, false otherwise.
+     */
+    bool computeMinimumCover(std::vector<std::size_t> & result) const
+    {
+        if (!computeGreedyCover(result))
+        {
+            return false;
+        }
+
+        if (result.size() <= 1)
+        {
+            return true;
+        }
+
+        std::vector<std::size_t> relevantContainers;
+
+        for (std::size_t position = 0; position < indices_.size(); ++position)
+        {
+            const std::uint64_t * container = bitset(position);
+
+            bool dominated = false;
+
+            for (std::size_t otherPosition = 0; !dominated && otherPosition < indices_.size(); ++otherPosition)
+            {
+                if (otherPosition != position)
+                {
+                    const std::uint64_t * otherContainer = bitset(otherPosition);
+
+                    bool subset = true;
+
+                    bool equal = true;
+
+                    for (std::size_t word = 0; subset && word < wordCount_; ++word)
+                    {
+                        subset = (container[word] & ~otherContainer[word]) == 0;
+
+                        equal = equal && container[word] == otherContainer[word];
+                    }
+
+                    dominated = subset && (!equal || otherPosition < position);
+                }
+            }
+
+            if (!dominated)
+            {
+                relevantContainers.push_back(position);
+            }
+        }
+
+        std::vector<std::vector<std::size_t>> candidates(elementCount_);
+
+        std::vector<std::uint64_t> remainder = universe();
+
+        std::size_t maximumCoverage = 0;
+
+        for (std::size_t position : relevantContainers)
+        {
+            const std::uint64_t * container = bitset(position);
+
+            for (std::size_t word = 0; word < wordCount_; ++word)
+            {
+                std::uint64_t value = container[word];
+
+                while (value != 0)
+                {
+                    candidates[word * WORD_SIZE + popcount((value & (~value + 1)) - 1)].push_back(position);
+
+                    value &= value - 1;
+                }
+            }
+
+            maximumCoverage = std::max(maximumCoverage, coverage(position, remainder));
+        }
+
+        std::vector<std::size_t> selection;
+
+        search(remainder, candidates, maximumCoverage, selection, result);
+
+        return true;
+    }
+
+    /**
+     *  Append the original indices of the relevant containers at the given positions to the target vector.
+     *
+     *  @param[in] positions    The positions of the relevant containers.
+     *  @param[out] target      The target vector to which the original indices shall be appended in ascending order.
+     */
+    void copyIndicesTo(std::vector<std::size_t> & positions, std::vector<htd::index_t> & target) const
+    {
+        std::sort(positions.begin(), positions.end());
+
+        for (std::size_t position : positions)
+        {
+            target.push_back(indices_[position]);
+        }
+    }
+};
+
+htd::BitsetSetCover::BitsetSetCover(const std::vector<htd::id_t> & elements, const std::vector<std::vector<htd::id_t>> & containers) : implementation_(new Implementation(elements, containers))
+{
+
+}
+
+htd::BitsetSetCover::BitsetSetCover(const htd::ConstCollection<htd::id_t> & elements, const htd::ConstCollection<std::vector<htd::id_t>> & containers) : implementation_(new Implementation(std::vector<htd::id_t>(elements.begin(), elements.end()), containers))
+{
+
+}
+
+htd::BitsetSetCover::~BitsetSetCover()
+{
+
+}
+
+bool htd::BitsetSetCover::isCoverable(void) const
+{
+    std::vector<std::uint64_t> remainder = implementation_->universe();
+
+    for (std::size_t position = 0; position < implementation_->indices_.size(); ++position)
+    {
+        implementation_->cover(position, remainder);
+    }
+
+    return implementation_->isEmpty(remainder);
+}
+
+void htd::BitsetSetCover::computeGreedyCover(std::vector<htd::index_t> & target) const
+{
+    std::vector<std::size_t> result;
+
+    if (implementation_->elementCount_ > 0 && implementation_->computeGreedyCover(result))
+    {
+        implementation_->copyIndicesTo(result, target);
+    }
+}
+
+void htd::BitsetSetCover::computeMinimumCover(std::vector<htd::index_t> & target) const
+{
+    std::vector<std::size_t> result;
+
+    if (implementation_->elementCount_ > 0 && implementation_->computeMinimumCover(result))
+    {
+        implementation_->copyIndicesTo(result, target);
+    }
+}
+
+#endif /* HTD_HTD_BITSETSETCOVER_CPP */
@@ -28,6 +28,9 @@
 #include <htd/Globals.hpp>
 #include <htd/Helpers.hpp>
 #include <htd/BucketEliminationGraphDecompositionAlgorithm.hpp>
+#include <htd/CompressedSparseRowGraph.hpp>
+#include <htd/ScopedTimer.hpp>
+#include <htd/DecompositionCache.hpp>
 #include <htd/ILabelingFunction.hpp>
 #include <htd/OrderingAlgorithmFactory.hpp>
 #include <htd/GraphDecompositionFactory.hpp>
@@ -38,9 +41,12 @@
 #include <algorithm>
 #include <cstdarg>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <stack>
+#include <stdexcept>
 #include <tuple>
+#include <typeinfo>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -137,7 +143,7 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
      *
      *  @return The vertex which is ranked first in the vertex elimination ordering.
      */
-    htd::vertex_t getMinimumVertex(const std::vector<htd::vertex_t> & vertices, const std::vector<htd::vertex_t> & ordering, const std::vector<htd::index_t> & vertexIndices) const;
+    htd::vertex_t getMinimumVertex(const std::vector<htd::vertex_t> & vertices, const std::vector<htd::vertex_t> & ordering, const std::vector<htd::count_t> & vertexIndices) const;
 
     /**
      *  Get the vertex which is ranked first in the vertex elimination ordering.
@@ -149,7 +155,72 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
      *
      *  @return The vertex which is ranked first in the vertex elimination ordering.
      */
-    htd::vertex_t getMinimumVertex(const std::vector<htd::vertex_t> & vertices, const std::vector<htd::vertex_t> & ordering, const std::vector<htd::index_t> & vertexIndices, htd::vertex_t excludedVertex) const;
+    htd::vertex_t getMinimumVertex(const std::vector<htd::vertex_t> & vertices, const std::vector<htd::vertex_t> & ordering, const std::vector<htd::count_t> & vertexIndices, htd::vertex_t excludedVertex) const;
+
+    /**
+     *  Check whether the given ordering is a permutation of the vertices of the given graph.
+     *
+     *  @param[in] graph    The input graph.
+     *  @param[in] ordering The vertex elimination ordering, e.g., as read from the decomposition cache.
+     *
+     *  @return True if each vertex of the graph occurs exactly once in the given ordering and no other vertex occurs in it, false otherwise.
+     */
+    static bool isPermutationOfVertices(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering)
+    {
+        std::size_t size = graph.vertexCount();
+
+        bool ret = ordering.size() == size;
+
+        if (ret && size > 0)
+        {
+            std::vector<bool> contained(graph.vertexAtPosition(size - 1) + 1, false);
+
+            for (auto it = ordering.begin(); ret && it != ordering.end(); ++it)
+            {
+                htd::vertex_t vertex = *it;
+
+                ret = graph.isVertex(vertex) && !contained[vertex];
+
+                if (ret)
+                {
+                    contained[vertex] = true;
+                }
+            }
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Access the sorted elements of the next hyperedge of the input graph.
+     *
+     *  For graphs of type htd::CompressedSparseRowGraph, the elements are read directly from the arrays of the graph so that the
+     *  elimination process does not require the hyperedges of the graph to be materialized.
+     *
+     *  @param[in] compressedGraph  The input graph if it is of type htd::CompressedSparseRowGraph, nullptr otherwise.
+     *  @param[in] index            The position of the hyperedge.
+     *  @param[in,out] position     The iterator pointing to the hyperedge if compressedGraph is nullptr. The iterator is advanced to the next hyperedge.
+     *  @param[in,out] buffer       The buffer receiving the elements of the hyperedge if compressedGraph is not nullptr.
+     *
+     *  @return The sorted elements of the hyperedge.
+     */
+    static const std::vector<htd::vertex_t> & nextHyperedgeElements(const htd::CompressedSparseRowGraph * compressedGraph, htd::index_t index, htd::ConstIterator<htd::Hyperedge> & position, std::vector<htd::vertex_t> & buffer)
+    {
+        if (compressedGraph != nullptr)
+        {
+            buffer.clear();
+
+            compressedGraph->copyHyperedgeElementsTo(index, buffer);
+
+            return buffer;
+        }
+
+        const std::vector<htd::vertex_t> & ret = position->sortedElements();
+
+        ++position;
+
+        return ret;
+    }
 
     /**
      *  Compress the given decomposition by retaining only subset-maximal bags.
@@ -168,7 +239,7 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
                                std::unordered_set<htd::vertex_t> & unvisitedVertices,
                                std::vector<htd::vertex_t> & relevantVertices,
                                std::vector<std::vector<htd::index_t>> & inducedEdges,
-                               std::vector<htd::index_t> & edgeTarget) const;
+                               std::vector<htd::vertex_t> & edgeTarget) const;
 
     /**
      *  Compress the given decomposition by retaining only subset-maximal bags.
@@ -190,7 +261,7 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
                                std::vector<std::vector<htd::vertex_t>> & bagContent,
                                std::vector<htd::vertex_t> & relevantVertices,
                                std::vector<std::vector<htd::index_t>> & inducedEdges,
-                               std::vector<htd::index_t> & edgeTarget) const;
+                               std::vector<htd::vertex_t> & edgeTarget) const;
 
     /**
      *  Update the given decomposition by performing pre-order traversal.
@@ -415,11 +486,15 @@ std::pair<htd::IGraphDecomposition *, std::size_t> htd::BucketEliminationGraphDe
 
         for (const auto & operation : implementation_->postProcessingOperations_)
         {
+            htd::ScopedTimer timer(implementation_->managementInstance_, typeid(*operation), "manipulation");
+
             operation->apply(graph, *decomposition);
         }
 
         for (const auto & operation : postProcessingOperations)
         {
+            htd::ScopedTimer timer(implementation_->managementInstance_, typeid(*operation), "manipulation");
+
             operation->apply(graph, *decomposition);
         }
 
@@ -651,7 +726,37 @@ std::pair<htd::IMutableGraphDecomposition *, std::size_t> htd::BucketElimination
 
     std::size_t iterations = 0;
 
-    if (widthLimitableAlgorithm == nullptr)
+    const htd::DecompositionCache * cache = managementInstance_->decompositionCache();
+
+    std::string cacheKey;
+
+    if (cache != nullptr)
+    {
+        cacheKey = htd::DecompositionCache::computeKey(graph);
+
+        std::vector<htd::vertex_t> cachedOrdering;
+
+        std::size_t cachedMaxBagSize = 0;
+
+        /* The stored ordering is used only once per cache object, repeated calls (e.g., during iterative improvement) compute new orderings. */
+        if (cache->claimOrdering(cacheKey, cachedOrdering, cachedMaxBagSize) && cachedMaxBagSize <= maxBagSize && Implementation::isPermutationOfVertices(graph, cachedOrdering))
+        {
+            ret = computeMutableDecomposition(graph, cachedOrdering);
+
+            HTD_ASSERT(ret != nullptr)
+
+            if (ret->maximumBagSize() > maxBagSize)
+            {
+                delete ret;
+
+                ret = nullptr;
+            }
+
+            ++iterations;
+        }
+    }
+
+    if (ret == nullptr && widthLimitableAlgorithm == nullptr)
     {
         htd::IVertexOrdering * ordering = nullptr;
 
@@ -673,6 +778,10 @@ std::pair<htd::IMutableGraphDecomposition *, std::size_t> htd::BucketElimination
 
                         ret = nullptr;
                     }
+                    else if (cache != nullptr && !managementInstance_->isTerminated())
+                    {
+                        cache->storeOrdering(cacheKey, ordering->sequence(), ret->maximumBagSize());
+                    }
                 }
 
                 delete ordering;
@@ -682,7 +791,7 @@ std::pair<htd::IMutableGraphDecomposition *, std::size_t> htd::BucketElimination
         }
         while (ret == nullptr && iterations < maxIterationCount && !managementInstance_->isTerminated());
     }
-    else
+    else if (ret == nullptr)
     {
         htd::IWidthLimitedVertexOrdering * ordering = widthLimitableAlgorithm->computeOrdering(graph, preprocessedGraph, maxBagSize, maxIterationCount);
 
@@ -691,6 +800,11 @@ std::pair<htd::IMutableGraphDecomposition *, std::size_t> htd::BucketElimination
             if (ordering->sequence().size() == graph.vertexCount())
             {
                 ret = computeMutableDecomposition(graph, ordering->sequence());
+
+                if (cache != nullptr && !managementInstance_->isTerminated())
+                {
+                    cache->storeOrdering(cacheKey, ordering->sequence(), ret->maximumBagSize());
+                }
             }
 
             iterations += ordering->requiredIterations();
@@ -706,19 +820,27 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
 {
     const htd::LibraryInstance & managementInstance = *managementInstance_;
 
+    htd::ScopedTimer timer(managementInstance_, "Bucket elimination", "decomposition");
+
     htd::IMutableGraphDecomposition * ret = managementInstance.graphDecompositionFactory().createInstance();
 
     std::size_t size = graph.vertexCount();
 
     HTD_ASSERT(ordering.size() == size)
 
+    /* The positions within the ordering are stored as htd::count_t and the maximum value of htd::count_t marks a missing position. */
+    if (size >= (std::size_t)std::numeric_limits<htd::count_t>::max())
+    {
+        throw std::length_error("htd::BucketEliminationGraphDecompositionAlgorithm: The number of vertices exceeds the range of htd::count_t.");
+    }
+
     if (size > 0)
     {
         if (!managementInstance.isTerminated())
         {
             htd::vertex_t lastVertex = graph.vertexAtPosition(size - 1);
 
-            std::vector<htd::index_t> indices(lastVertex + 1);
+            std::vector<htd::count_t> indices(lastVertex + 1);
 
             std::vector<std::vector<htd::vertex_t>> buckets(lastVertex + 1);
 
@@ -726,7 +848,7 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
 
             std::vector<std::vector<htd::index_t>> inducedEdges(lastVertex + 1);
 
-            std::vector<htd::index_t> edgeTarget(graph.edgeCount());
+            std::vector<htd::vertex_t> edgeTarget(graph.edgeCount());
 
             std::vector<htd::vertex_t> relevantVertices;
 
@@ -741,13 +863,17 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
 
             std::size_t edgeCount = graph.edgeCount();
 
-            const htd::ConstCollection<htd::Hyperedge> & hyperedges = graph.hyperedges();
+            const htd::CompressedSparseRowGraph * compressedGraph = dynamic_cast<const htd::CompressedSparseRowGraph *>(&graph);
 
-            auto hyperedgePosition = hyperedges.begin();
+            const htd::ConstCollection<htd::Hyperedge> & hyperedges = compressedGraph == nullptr ? graph.hyperedges() : htd::ConstCollection<htd::Hyperedge>();
+
+            htd::ConstIterator<htd::Hyperedge> hyperedgePosition = hyperedges.begin();
+
+            std::vector<htd::vertex_t> hyperedgeElements;
 
             for (htd::index_t index = 0; index < edgeCount && !managementInstance.isTerminated(); ++index)
             {
-                const std::vector<htd::vertex_t> & elements = hyperedgePosition->sortedElements();
+                const std::vector<htd::vertex_t> & elements = nextHyperedgeElements(compressedGraph, index, hyperedgePosition, hyperedgeElements);
 
                 switch (elements.size())
                 {
@@ -812,8 +938,6 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
                         break;
                     }
                 }
-
-                ++hyperedgePosition;
             }
 
             for (auto it = ordering.begin(); it != ordering.end() && !managementInstance.isTerminated(); ++it)
@@ -889,7 +1013,7 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
 
                 for (index = 0; index < edgeCount && !managementInstance.isTerminated(); ++index)
                 {
-                    const std::vector<htd::vertex_t> & edgeElements = hyperedgePosition->sortedElements();
+                    const std::vector<htd::vertex_t> & edgeElements = nextHyperedgeElements(compressedGraph, index, hyperedgePosition, hyperedgeElements);
 
                     if (edgeElements.size() == 2)
                     {
@@ -899,8 +1023,6 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
                     {
                         distributeEdge(index, edgeElements, edgeTarget[index], buckets, neighbors, inducedEdges, lastAssignedEdge, originStack);
                     }
-
-                    ++hyperedgePosition;
                 }
             }
 
@@ -951,9 +1073,9 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
     return ret;
 }
 
-htd::vertex_t htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::getMinimumVertex(const std::vector<htd::vertex_t> & vertices, const std::vector<htd::vertex_t> & ordering, const std::vector<htd::index_t> & vertexIndices) const
+htd::vertex_t htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::getMinimumVertex(const std::vector<htd::vertex_t> & vertices, const std::vector<htd::vertex_t> & ordering, const std::vector<htd::count_t> & vertexIndices) const
 {
-    std::size_t minimum = (std::size_t)-1;
+    htd::count_t minimum = std::numeric_limits<htd::count_t>::max();
 
     for (htd::vertex_t vertex : vertices)
     {
@@ -965,9 +1087,9 @@ htd::vertex_t htd::BucketEliminationGraphDecompositionAlgorithm::Implementation:
     return ordering[minimum];
 }
 
-htd::vertex_t htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::getMinimumVertex(const std::vector<htd::vertex_t> & vertices, const std::vector<htd::vertex_t> & ordering, const std::vector<htd::index_t> & vertexIndices, htd::vertex_t excludedVertex) const
+htd::vertex_t htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::getMinimumVertex(const std::vector<htd::vertex_t> & vertices, const std::vector<htd::vertex_t> & ordering, const std::vector<htd::count_t> & vertexIndices, htd::vertex_t excludedVertex) const
 {
-    std::size_t minimum = (std::size_t)-1;
+    htd::count_t minimum = std::numeric_limits<htd::count_t>::max();
 
     for (htd::vertex_t vertex : vertices)
     {
@@ -988,7 +1110,7 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::compress
                                                                                               std::unordered_set<htd::vertex_t> & unvisitedVertices,
                                                                                               std::vector<htd::vertex_t> & relevantVertices,
                                                                                               std::vector<std::vector<htd::index_t>> & inducedEdges,
-                                                                                              std::vector<htd::index_t> & edgeTarget) const
+                                                                                              std::vector<htd::vertex_t> & edgeTarget) const
 {
     htd::vertex_t lastNode = htd::Vertex::UNKNOWN;
 
@@ -1132,7 +1254,7 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::compress
                                                                                               std::vector<std::vector<htd::vertex_t>> & bagContent,
                                                                                               std::vector<htd::vertex_t> & relevantVertices,
                                                                                               std::vector<std::vector<htd::index_t>> & inducedEdges,
-                                                                                              std::vector<htd::index_t> & edgeTarget) const
+                                                                                              std::vector<htd::vertex_t> & edgeTarget) const
 {
     int result = is_maximal(bagContent[vertex], bagContent[parent]);
 
@@ -1346,7 +1468,7 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::updateDe
         {
             if (currentIndex == 0)
             {
-                htd::vertex_t decompositionVertex = decomposition.addVertex(std::vector<htd::vertex_t>(bagContent[currentNode]), graph.hyperedgesAtPositions(inducedEdges[currentNode]));
+                htd::vertex_t decompositionVertex = decomposition.addVertex(std::move(bagContent[currentNode]), graph.hyperedgesAtPositions(std::move(inducedEdges[currentNode])));
 
                 decompositionVertices.emplace(currentNode, decompositionVertex);
 
@@ -29,6 +29,7 @@
 #include <htd/Helpers.hpp>
 
 #include <htd/BucketEliminationTreeDecompositionAlgorithm.hpp>
+#include <htd/ScopedTimer.hpp>
 #include <htd/BucketEliminationGraphDecompositionAlgorithm.hpp>
 #include <htd/ConnectedComponentAlgorithmFactory.hpp>
 #include <htd/GraphDecompositionFactory.hpp>
@@ -44,6 +45,7 @@
 #include <algorithm>
 #include <cstdarg>
 #include <memory>
+#include <typeinfo>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -174,6 +176,8 @@ std::pair<htd::ITreeDecomposition *, std::size_t> htd::BucketEliminationTreeDeco
 
 std::pair<htd::ITreeDecomposition *, std::size_t> htd::BucketEliminationTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations, std::size_t maxBagSize, std::size_t maxIterationCount) const
 {
+    htd::RandomNumberGeneratorScope randomNumberGeneratorScope;
+
     htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
 
     htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
@@ -204,6 +208,8 @@ std::pair<htd::ITreeDecomposition *, std::size_t> htd::BucketEliminationTreeDeco
 
 std::pair<htd::ITreeDecomposition *, std::size_t> htd::BucketEliminationTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations, std::size_t maxBagSize, std::size_t maxIterationCount) const
 {
+    htd::RandomNumberGeneratorScope randomNumberGeneratorScope;
+
     std::pair<htd::IMutableTreeDecomposition *, std::size_t> ret = implementation_->computeMutableDecomposition(graph, preprocessedGraph, maxBagSize, maxIterationCount);
 
     htd::IMutableTreeDecomposition * decomposition = ret.first;
@@ -233,11 +239,15 @@ std::pair<htd::ITreeDecomposition *, std::size_t> htd::BucketEliminationTreeDeco
 
         for (const htd::ITreeDecompositionManipulationOperation * operation : implementation_->postProcessingOperations_)
         {
+            htd::ScopedTimer timer(implementation_->managementInstance_, typeid(*operation), "manipulation");
+
             operation->apply(graph, *decomposition);
         }
 
         for (htd::ITreeDecompositionManipulationOperation * operation : postProcessingOperations)
         {
+            htd::ScopedTimer timer(implementation_->managementInstance_, typeid(*operation), "manipulation");
+
             operation->apply(graph, *decomposition);
         }
 
@@ -453,13 +463,9 @@ std::pair<htd::IMutableTreeDecomposition *, std::size_t> htd::BucketEliminationT
                             const std::vector<htd::vertex_t> & component1 = components[index];
                             const std::vector<htd::vertex_t> & component2 = components[index + 1];
 
-                            /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-                            // coverity[dont_call]
-                            htd::vertex_t vertex1 = component1[std::rand() % component1.size()];
+                            htd::vertex_t vertex1 = htd::selectRandomElement<htd::vertex_t>(component1);
 
-                            /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-                            // coverity[dont_call]
-                            htd::vertex_t vertex2 = component2[std::rand() % component2.size()];
+                            htd::vertex_t vertex2 = htd::selectRandomElement<htd::vertex_t>(component2);
 
                             mutableGraphDecomposition.addEdge(vertex1, vertex2);
                         }
@@ -472,9 +478,7 @@ std::pair<htd::IMutableTreeDecomposition *, std::size_t> htd::BucketEliminationT
 
                 htd::BreadthFirstGraphTraversal graphTraversal(managementInstance_);
 
-                /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-                // coverity[dont_call]
-                graphTraversal.traverse(*(graphDecomposition.first), graphDecomposition.first->vertexAtPosition(std::rand() % graphDecomposition.first->vertexCount()), [&](htd::vertex_t vertex, htd::vertex_t predecessor, std::size_t distanceFromStartingVertex)
+                graphTraversal.traverse(*(graphDecomposition.first), graphDecomposition.first->vertexAtPosition(std::uniform_int_distribution<htd::index_t>(0, graphDecomposition.first->vertexCount() - 1)(htd::randomNumberGenerator())), [&](htd::vertex_t vertex, htd::vertex_t predecessor, std::size_t distanceFromStartingVertex)
                 {
                     HTD_UNUSED(distanceFromStartingVertex)
 
@@ -785,6 +785,8 @@ htd::CliqueMinimalSeparatorAlgorithm::~CliqueMinimalSeparatorAlgorithm(void)
 
 std::vector<htd::vertex_t> * htd::CliqueMinimalSeparatorAlgorithm::computeSeparator(const htd::IGraphStructure & graph) const
 {
+    htd::RandomNumberGeneratorScope randomNumberGeneratorScope;
+
     std::size_t size = graph.vertexCount();
 
     std::vector<htd::vertex_t> * ret = new std::vector<htd::vertex_t>();
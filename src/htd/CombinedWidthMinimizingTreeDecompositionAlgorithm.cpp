@@ -30,6 +30,7 @@
 
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
+#include <htd/TreeWidthLowerBoundAlgorithm.hpp>
 
 #include <cstdarg>
 
@@ -44,7 +45,7 @@ struct htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  @param[in] manager  The management instance to which the current object instance belongs.
      */
     Implementation(const htd::LibraryInstance * const manager)
-        : managementInstance_(manager), algorithms_(), computeInducedEdges_(true)
+        : managementInstance_(manager), algorithms_(), computeInducedEdges_(true), lowerBoundTerminationEnabled_(true)
     {
 
     }
@@ -54,7 +55,7 @@ struct htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *
      *  @param[in] original The original implementation details structure.
      */
-    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithms_(), computeInducedEdges_(original.computeInducedEdges_)
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithms_(), computeInducedEdges_(original.computeInducedEdges_), lowerBoundTerminationEnabled_(original.lowerBoundTerminationEnabled_)
     {
         for (const htd::ITreeDecompositionAlgorithm * algorithm : original.algorithms_)
         {
@@ -84,6 +85,21 @@ struct htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  A boolean flag indicating whether the hyperedges induced by a respective bag shall be computed.
      */
     bool computeInducedEdges_;
+
+    /**
+     *  A boolean flag indicating whether the algorithm shall terminate as soon as the width of the best decomposition matches the lower bound for the treewidth.
+     */
+    bool lowerBoundTerminationEnabled_;
+
+    /**
+     *  Check whether a decomposition of the given maximum bag size is optimal. Always false if lower bound termination is disabled.
+     *
+     *  @see htd::TreeWidthLowerBoundAlgorithm::isOptimal()
+     */
+    bool isOptimal(const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t & lowerBound) const
+    {
+        return lowerBoundTerminationEnabled_ && htd::TreeWidthLowerBoundAlgorithm::isOptimal(managementInstance_, preprocessedGraph, maxBagSize, lowerBound);
+    }
 };
 
 htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::CombinedWidthMinimizingTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -233,7 +249,9 @@ htd::ITreeDecomposition * htd::CombinedWidthMinimizingTreeDecompositionAlgorithm
 
     htd::ITreeDecomposition * ret = nullptr;
 
-    for (auto it = implementation_->algorithms_.begin(); it != implementation_->algorithms_.end() && !managementInstance.isTerminated(); ++it)
+    std::size_t lowerBound = (std::size_t)-1;
+
+    for (auto it = implementation_->algorithms_.begin(); it != implementation_->algorithms_.end() && !managementInstance.isTerminated() && (ret == nullptr || !implementation_->isOptimal(preprocessedGraph, bestMaxBagSize, lowerBound)); ++it)
     {
         std::vector<htd::IDecompositionManipulationOperation *> clonedManipulationOperations;
 
@@ -439,6 +457,16 @@ void htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::setComputeInducedEd
     }
 }
 
+bool htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::isLowerBoundTerminationEnabled(void) const
+{
+    return implementation_->lowerBoundTerminationEnabled_;
+}
+
+void htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::setLowerBoundTerminationEnabled(bool lowerBoundTerminationEnabled)
+{
+    implementation_->lowerBoundTerminationEnabled_ = lowerBoundTerminationEnabled;
+}
+
 const htd::LibraryInstance * htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::managementInstance(void) const HTD_NOEXCEPT
 {
     return implementation_->managementInstance_;
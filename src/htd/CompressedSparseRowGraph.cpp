@@ -0,0 +1,1108 @@
+/* 
+ * File:   CompressedSparseRowGraph.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_COMPRESSEDSPARSEROWGRAPH_CPP
+#define HTD_HTD_COMPRESSEDSPARSEROWGRAPH_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/CompressedSparseRowGraph.hpp>
+#include <htd/IHyperedgeCollection.hpp>
+#include <htd/ScopedWorkspace.hpp>
+#include <htd/VectorAdapter.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+
+namespace
+{
+    /**
+     *  Hyperedges of a graph in CSR format which are created individually on first access.
+     *
+     *  The store is shared by a graph, its clones and the hyperedge collections handed out by them. Hence, the collections remain
+     *  valid after the graph itself is destroyed as long as the arrays provided by the caller are valid.
+     */
+    class CompressedSparseRowHyperedgeStore
+    {
+        public:
+            /**
+             *  Constructor for a hyperedge store.
+             *
+             *  @param[in] vertexCount          The number of vertices of the graph.
+             *  @param[in] offsets              The offsets of the neighborhoods within the adjacency array.
+             *  @param[in] adjacency            The concatenated neighborhoods of the vertices.
+             *  @param[in] hyperedgeCount       The number of hyperedges of the graph (ignored if no hyperedges are given).
+             *  @param[in] hyperedgeOffsets     The offsets of the hyperedges or nullptr if the edges shall be derived from the adjacency arrays.
+             *  @param[in] hyperedgeElements    The concatenated elements of the hyperedges or nullptr if the edges shall be derived from the adjacency arrays.
+             */
+            CompressedSparseRowHyperedgeStore(std::size_t vertexCount, const std::size_t * offsets, const htd::vertex_t * adjacency, std::size_t hyperedgeCount, const std::size_t * hyperedgeOffsets, const htd::vertex_t * hyperedgeElements)
+                : vertexCount_(vertexCount), offsets_(offsets), adjacency_(adjacency), hyperedgeCount_(hyperedgeCount), hyperedgeOffsets_(hyperedgeOffsets), hyperedgeElements_(hyperedgeElements), edgeOffsets_(), slotsFlag_(), slots_()
+            {
+                if (hyperedgeOffsets_ == nullptr)
+                {
+                    /* Each edge {u, v} with u < v is assigned to u, hence the edges of u start after the ones of all smaller vertices. */
+                    edgeOffsets_.resize(vertexCount_ + 1, 0);
+
+                    for (htd::index_t index = 0; index < vertexCount_; ++index)
+                    {
+                        htd::vertex_t vertex = static_cast<htd::vertex_t>(index) + htd::Vertex::FIRST;
+
+                        const htd::vertex_t * last = adjacency_ + offsets_[index + 1];
+
+                        edgeOffsets_[index + 1] = edgeOffsets_[index] + static_cast<std::size_t>(last - std::upper_bound(adjacency_ + offsets_[index], last, vertex));
+                    }
+
+                    hyperedgeCount_ = edgeOffsets_[vertexCount_];
+                }
+            }
+
+            ~CompressedSparseRowHyperedgeStore()
+            {
+                if (slots_ != nullptr)
+                {
+                    for (htd::index_t index = 0; index < hyperedgeCount_; ++index)
+                    {
+                        delete slots_[index].load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            CompressedSparseRowHyperedgeStore(const CompressedSparseRowHyperedgeStore &) = delete;
+
+            CompressedSparseRowHyperedgeStore & operator=(const CompressedSparseRowHyperedgeStore &) = delete;
+
+            /**
+             *  Getter for the number of hyperedges.
+             *
+             *  @return The number of hyperedges.
+             */
+            std::size_t size(void) const
+            {
+                return hyperedgeCount_;
+            }
+
+            /**
+             *  Getter for the position of the first derived edge of each vertex.
+             *
+             *  @return The position of the first derived edge of each vertex, the vector is empty if the hyperedges were given explicitly.
+             */
+            const std::vector<std::size_t> & edgeOffsets(void) const
+            {
+                return edgeOffsets_;
+            }
+
+            /**
+             *  Copy the elements of the hyperedge at the given position to the end of the target vector.
+             *
+             *  @param[in] index    The position of the hyperedge.
+             *  @param[out] target  The target vector.
+             */
+            void copyElementsTo(htd::index_t index, std::vector<htd::vertex_t> & target) const
+            {
+                HTD_ASSERT(index < hyperedgeCount_)
+
+                if (hyperedgeOffsets_ != nullptr)
+                {
+                    target.insert(target.end(), hyperedgeElements_ + hyperedgeOffsets_[index], hyperedgeElements_ + hyperedgeOffsets_[index + 1]);
+                }
+                else
+                {
+                    htd::index_t vertexIndex = static_cast<htd::index_t>(std::upper_bound(edgeOffsets_.begin(), edgeOffsets_.end(), index) - edgeOffsets_.begin()) - 1;
+
+                    htd::vertex_t vertex = static_cast<htd::vertex_t>(vertexIndex) + htd::Vertex::FIRST;
+
+                    const htd::vertex_t * position = std::upper_bound(adjacency_ + offsets_[vertexIndex], adjacency_ + offsets_[vertexIndex + 1], vertex);
+
+                    target.push_back(vertex);
+                    target.push_back(position[index - edgeOffsets_[vertexIndex]]);
+                }
+            }
+
+            /**
+             *  Access the hyperedge at the given position. The hyperedge is created on first access.
+             *
+             *  @note The function may be called concurrently by different threads. The returned reference remains valid as long as the store exists.
+             *
+             *  @param[in] index    The position of the hyperedge.
+             *
+             *  @return The hyperedge at the given position.
+             */
+            const htd::Hyperedge & at(htd::index_t index) const
+            {
+                HTD_ASSERT(index < hyperedgeCount_)
+
+                std::call_once(slotsFlag_, [&]()
+                {
+                    slots_.reset(new std::atomic<htd::Hyperedge *>[hyperedgeCount_]);
+
+                    for (htd::index_t position = 0; position < hyperedgeCount_; ++position)
+                    {
+                        slots_[position].store(nullptr, std::memory_order_relaxed);
+                    }
+                });
+
+                htd::Hyperedge * ret = slots_[index].load(std::memory_order_acquire);
+
+                if (ret == nullptr)
+                {
+                    std::vector<htd::vertex_t> elements;
+
+                    copyElementsTo(index, elements);
+
+                    htd::Hyperedge * hyperedge = new htd::Hyperedge(static_cast<htd::id_t>(index) + htd::Id::FIRST, std::move(elements));
+
+                    /* If another thread created the hyperedge in the meantime, its instance is used instead. */
+                    if (slots_[index].compare_exchange_strong(ret, hyperedge, std::memory_order_acq_rel, std::memory_order_acquire))
+                    {
+                        ret = hyperedge;
+                    }
+                    else
+                    {
+                        delete hyperedge;
+                    }
+                }
+
+                return *ret;
+            }
+
+        private:
+            std::size_t vertexCount_;
+
+            const std::size_t * offsets_;
+
+            const htd::vertex_t * adjacency_;
+
+            std::size_t hyperedgeCount_;
+
+            const std::size_t * hyperedgeOffsets_;
+
+            const htd::vertex_t * hyperedgeElements_;
+
+            std::vector<std::size_t> edgeOffsets_;
+
+            mutable std::once_flag slotsFlag_;
+
+            /**
+             *  The hyperedges which were accessed so far, indexed by their position (nullptr for hyperedges which were not accessed yet).
+             */
+            mutable std::unique_ptr<std::atomic<htd::Hyperedge *>[]> slots_;
+    };
+
+    /**
+     *  Forward iterator over the hyperedges of a hyperedge store.
+     */
+    class CompressedSparseRowHyperedgeIterator
+    {
+        public:
+            typedef std::ptrdiff_t difference_type;
+
+            typedef htd::Hyperedge value_type;
+
+            typedef const htd::Hyperedge & reference;
+
+            typedef const htd::Hyperedge * pointer;
+
+            typedef std::forward_iterator_tag iterator_category;
+
+            CompressedSparseRowHyperedgeIterator(const CompressedSparseRowHyperedgeStore * store, htd::index_t position) : store_(store), position_(position)
+            {
+
+            }
+
+            CompressedSparseRowHyperedgeIterator & operator++(void)
+            {
+                ++position_;
+
+                return *this;
+            }
+
+            const htd::Hyperedge & operator*(void) const
+            {
+                return store_->at(position_);
+            }
+
+            const htd::Hyperedge * operator->(void) const
+            {
+                return &(store_->at(position_));
+            }
+
+            bool operator==(const CompressedSparseRowHyperedgeIterator & rhs) const
+            {
+                return position_ == rhs.position_ && store_ == rhs.store_;
+            }
+
+            bool operator!=(const CompressedSparseRowHyperedgeIterator & rhs) const
+            {
+                return !(*this == rhs);
+            }
+
+        private:
+            const CompressedSparseRowHyperedgeStore * store_;
+
+            htd::index_t position_;
+    };
+
+    /**
+     *  Hyperedge collection which provides access to the hyperedges of a hyperedge store.
+     */
+    class CompressedSparseRowHyperedgeCollection : public htd::IHyperedgeCollection
+    {
+        public:
+            CompressedSparseRowHyperedgeCollection(const std::shared_ptr<const CompressedSparseRowHyperedgeStore> & store) : store_(store)
+            {
+
+            }
+
+            virtual ~CompressedSparseRowHyperedgeCollection()
+            {
+
+            }
+
+            bool empty(void) const HTD_OVERRIDE
+            {
+                return store_->size() == 0;
+            }
+
+            std::size_t size(void) const HTD_OVERRIDE
+            {
+                return store_->size();
+            }
+
+            const htd::Hyperedge & at(htd::index_t index) const HTD_OVERRIDE
+            {
+                if (index >= store_->size())
+                {
+                    throw std::out_of_range("const htd::Hyperedge & CompressedSparseRowHyperedgeCollection::at(htd::index_t) const");
+                }
+
+                return store_->at(index);
+            }
+
+            htd::ConstIterator<htd::Hyperedge> begin(void) const HTD_OVERRIDE
+            {
+                return htd::ConstIterator<htd::Hyperedge>(CompressedSparseRowHyperedgeIterator(store_.get(), 0));
+            }
+
+            htd::ConstIterator<htd::Hyperedge> end(void) const HTD_OVERRIDE
+            {
+                return htd::ConstIterator<htd::Hyperedge>(CompressedSparseRowHyperedgeIterator(store_.get(), store_->size()));
+            }
+
+            const htd::Hyperedge & operator[](htd::index_t index) const HTD_OVERRIDE
+            {
+                return store_->at(index);
+            }
+
+            bool operator==(const htd::IHyperedgeCollection & rhs) const HTD_OVERRIDE
+            {
+                return rhs.size() == size() && htd::equal(rhs.begin(), rhs.end(), begin(), end());
+            }
+
+            bool operator!=(const htd::IHyperedgeCollection & rhs) const HTD_OVERRIDE
+            {
+                return !(*this == rhs);
+            }
+
+            CompressedSparseRowHyperedgeCollection * clone(void) const HTD_OVERRIDE
+            {
+                return new CompressedSparseRowHyperedgeCollection(store_);
+            }
+
+        private:
+            std::shared_ptr<const CompressedSparseRowHyperedgeStore> store_;
+    };
+}
+
+/**
+ *  Private implementation details of class htd::CompressedSparseRowGraph.
+ */
+struct htd::CompressedSparseRowGraph::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager              The management instance to which the current object instance belongs.
+     *  @param[in] vertexCount          The number of vertices of the graph.
+     *  @param[in] offsets              The offsets of the neighborhoods within the adjacency array.
+     *  @param[in] adjacency            The concatenated neighborhoods of the vertices.
+     *  @param[in] hyperedgeCount       The number of hyperedges of the graph (ignored if no hyperedges are given).
+     *  @param[in] hyperedgeOffsets     The offsets of the hyperedges within the array of hyperedge elements or nullptr if the edges shall be derived from the adjacency arrays.
+     *  @param[in] hyperedgeElements    The concatenated elements of the hyperedges or nullptr if the edges shall be derived from the adjacency arrays.
+     */
+    Implementation(const htd::LibraryInstance * const manager, std::size_t vertexCount, const std::size_t * offsets, const htd::vertex_t * adjacency, std::size_t hyperedgeCount, const std::size_t * hyperedgeOffsets, const htd::vertex_t * hyperedgeElements)
+        : managementInstance_(manager),
+          vertexCount_(vertexCount),
+          offsets_(offsets),
+          adjacency_(adjacency),
+          hyperedgeCount_(hyperedgeCount),
+          hyperedgeOffsets_(hyperedgeOffsets),
+          hyperedgeElements_(hyperedgeElements),
+          verticesFlag_(),
+          vertices_(),
+          incidentEdgesFlag_(),
+          incidentEdges_(),
+          hyperedgeStore_()
+    {
+        if (!isValid())
+        {
+            throw std::invalid_argument("htd::CompressedSparseRowGraph: The given arrays do not represent a valid graph in CSR format.");
+        }
+
+        hyperedgeStore_ = std::make_shared<const CompressedSparseRowHyperedgeStore>(vertexCount, offsets, adjacency, hyperedgeCount, hyperedgeOffsets, hyperedgeElements);
+
+        hyperedgeCount_ = hyperedgeStore_->size();
+    }
+
+    /**
+     *  Copy constructor for the implementation details structure.
+     *
+     *  @note The vertex and incidence vectors are not copied, they are re-created on demand. The hyperedges are shared with the original graph.
+     *
+     *  @param[in] original  The original implementation details structure.
+     */
+    Implementation(const Implementation & original)
+        : managementInstance_(original.managementInstance_),
+          vertexCount_(original.vertexCount_),
+          offsets_(original.offsets_),
+          adjacency_(original.adjacency_),
+          hyperedgeCount_(original.hyperedgeCount_),
+          hyperedgeOffsets_(original.hyperedgeOffsets_),
+          hyperedgeElements_(original.hyperedgeElements_),
+          verticesFlag_(),
+          vertices_(),
+          incidentEdgesFlag_(),
+          incidentEdges_(),
+          hyperedgeStore_(original.hyperedgeStore_)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  Getter for the vertex at the given zero-based index.
+     *
+     *  @param[in] index    The index of the vertex.
+     *
+     *  @return The vertex at the given zero-based index.
+     */
+    static htd::vertex_t vertexAtIndex(htd::index_t index)
+    {
+        return static_cast<htd::vertex_t>(index) + htd::Vertex::FIRST;
+    }
+
+    /**
+     *  Getter for the pointer to the first neighbor of a vertex.
+     *
+     *  @param[in] vertex   The vertex.
+     *
+     *  @return The pointer to the first neighbor of the given vertex.
+     */
+    const htd::vertex_t * neighborhoodBegin(htd::vertex_t vertex) const
+    {
+        return adjacency_ + offsets_[vertex - htd::Vertex::FIRST];
+    }
+
+    /**
+     *  Getter for the pointer behind the last neighbor of a vertex.
+     *
+     *  @param[in] vertex   The vertex.
+     *
+     *  @return The pointer behind the last neighbor of the given vertex.
+     */
+    const htd::vertex_t * neighborhoodEnd(htd::vertex_t vertex) const
+    {
+        return adjacency_ + offsets_[vertex - htd::Vertex::FIRST + 1];
+    }
+
+    /**
+     *  Copy the elements of the hyperedge at the given position to the end of the target vector.
+     *
+     *  @param[in] index    The position of the hyperedge.
+     *  @param[out] target  The target vector.
+     */
+    void copyHyperedgeElementsTo(htd::index_t index, std::vector<htd::vertex_t> & target) const
+    {
+        hyperedgeStore_->copyElementsTo(index, target);
+    }
+
+    /**
+     *  Determine the IDs of all hyperedges whose elements are identical to the given sequence of vertices.
+     *
+     *  @param[in] elements The pointer to the first element of the sequence.
+     *  @param[in] size     The number of elements of the sequence.
+     *  @param[out] target  The target vector to which the IDs of the matching hyperedges shall be appended.
+     */
+    void findHyperedges(const htd::vertex_t * elements, std::size_t size, std::vector<htd::id_t> & target) const
+    {
+        if (hyperedgeOffsets_ != nullptr)
+        {
+            if (size == 0)
+            {
+                for (htd::index_t index = 0; index < hyperedgeCount_; ++index)
+                {
+                    if (hyperedgeOffsets_[index] == hyperedgeOffsets_[index + 1])
+                    {
+                        target.push_back(static_cast<htd::id_t>(index) + htd::Id::FIRST);
+                    }
+                }
+            }
+            else if (isVertex(elements[0]))
+            {
+                for (htd::index_t index : incidentEdges()[elements[0] - htd::Vertex::FIRST])
+                {
+                    const htd::vertex_t * first = hyperedgeElements_ + hyperedgeOffsets_[index];
+                    const htd::vertex_t * last = hyperedgeElements_ + hyperedgeOffsets_[index + 1];
+
+                    if (static_cast<std::size_t>(last - first) == size && std::equal(first, last, elements))
+                    {
+                        target.push_back(static_cast<htd::id_t>(index) + htd::Id::FIRST);
+                    }
+                }
+            }
+        }
+        else if (size == 2 && elements[0] < elements[1] && isVertex(elements[0]) && isVertex(elements[1]))
+        {
+            htd::vertex_t vertex = elements[0];
+
+            const htd::vertex_t * first = std::upper_bound(neighborhoodBegin(vertex), neighborhoodEnd(vertex), vertex);
+
+            const htd::vertex_t * position = std::lower_bound(first, neighborhoodEnd(vertex), elements[1]);
+
+            if (position != neighborhoodEnd(vertex) && *position == elements[1])
+            {
+                target.push_back(static_cast<htd::id_t>(hyperedgeStore_->edgeOffsets()[vertex - htd::Vertex::FIRST] + static_cast<std::size_t>(position - first)) + htd::Id::FIRST);
+            }
+        }
+    }
+
+    /**
+     *  Check whether the given vertex belongs to the graph.
+     *
+     *  @param[in] vertex   The vertex.
+     *
+     *  @return True if the given vertex belongs to the graph, false otherwise.
+     */
+    bool isVertex(htd::vertex_t vertex) const
+    {
+        return vertex >= htd::Vertex::FIRST && vertex - htd::Vertex::FIRST < vertexCount_;
+    }
+
+    /**
+     *  Check whether the arrays provided by the caller fulfill the requirements of the graph.
+     *
+     *  The offsets are checked before any neighborhood or hyperedge is accessed, hence the check itself does not access memory
+     *  outside of the arrays as long as the offset arrays contain the required number of elements.
+     *
+     *  @note The check takes O(m log d) time where m is the size of the adjacency array and d is the maximum degree. Whether the
+     *  adjacency arrays represent the primal graph of explicitly given hyperedges is not checked.
+     *
+     *  @return True if the arrays provided by the caller fulfill the requirements of the graph, false otherwise.
+     */
+    bool isValid(void) const
+    {
+        bool ret = offsets_ != nullptr && vertexCount_ < (std::size_t)std::numeric_limits<htd::vertex_t>::max() && (hyperedgeOffsets_ != nullptr || hyperedgeElements_ == nullptr);
+
+        for (htd::index_t index = 0; ret && index < vertexCount_; ++index)
+        {
+            ret = offsets_[index] <= offsets_[index + 1];
+        }
+
+        ret = ret && (adjacency_ != nullptr || offsets_[0] == offsets_[vertexCount_]);
+
+        for (htd::index_t index = 0; ret && index < vertexCount_; ++index)
+        {
+            htd::vertex_t vertex = vertexAtIndex(index);
+
+            const htd::vertex_t * first = neighborhoodBegin(vertex);
+            const htd::vertex_t * last = neighborhoodEnd(vertex);
+
+            ret = std::adjacent_find(first, last, std::greater_equal<htd::vertex_t>()) == last && std::all_of(first, last, [&](htd::vertex_t neighbor) { return neighbor != vertex && isVertex(neighbor); });
+        }
+
+        for (htd::index_t index = 0; ret && index < vertexCount_; ++index)
+        {
+            htd::vertex_t vertex = vertexAtIndex(index);
+
+            const htd::vertex_t * last = neighborhoodEnd(vertex);
+
+            for (const htd::vertex_t * it = neighborhoodBegin(vertex); ret && it != last; ++it)
+            {
+                ret = std::binary_search(neighborhoodBegin(*it), neighborhoodEnd(*it), vertex);
+            }
+        }
+
+        for (htd::index_t index = 0; ret && hyperedgeOffsets_ != nullptr && index < hyperedgeCount_; ++index)
+        {
+            ret = hyperedgeOffsets_[index] <= hyperedgeOffsets_[index + 1];
+        }
+
+        ret = ret && (hyperedgeOffsets_ == nullptr || hyperedgeElements_ != nullptr || hyperedgeOffsets_[0] == hyperedgeOffsets_[hyperedgeCount_]);
+
+        for (htd::index_t index = 0; ret && hyperedgeOffsets_ != nullptr && index < hyperedgeCount_; ++index)
+        {
+            const htd::vertex_t * first = hyperedgeElements_ + hyperedgeOffsets_[index];
+            const htd::vertex_t * last = hyperedgeElements_ + hyperedgeOffsets_[index + 1];
+
+            ret = std::adjacent_find(first, last, std::greater_equal<htd::vertex_t>()) == last && std::all_of(first, last, [&](htd::vertex_t element) { return isVertex(element); });
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Getter for the sorted vector of all vertices of the graph. The vector is created on first use.
+     *
+     *  @return The sorted vector of all vertices of the graph.
+     */
+    const std::vector<htd::vertex_t> & vertices(void) const
+    {
+        std::call_once(verticesFlag_, [&]()
+        {
+            vertices_.resize(vertexCount_);
+
+            std::iota(vertices_.begin(), vertices_.end(), htd::Vertex::FIRST);
+        });
+
+        return vertices_;
+    }
+
+    /**
+     *  Getter for the positions of the hyperedges containing each vertex. The information is created on first use.
+     *
+     *  @return The positions of the hyperedges containing each vertex, indexed by the zero-based index of the vertex.
+     */
+    const std::vector<std::vector<htd::index_t>> & incidentEdges(void) const
+    {
+        std::call_once(incidentEdgesFlag_, [&]()
+        {
+            incidentEdges_.resize(vertexCount_);
+
+            std::vector<htd::vertex_t> elements;
+
+            for (htd::index_t index = 0; index < hyperedgeCount_; ++index)
+            {
+                elements.clear();
+
+                copyHyperedgeElementsTo(index, elements);
+
+                for (htd::vertex_t element : elements)
+                {
+                    incidentEdges_[element - htd::Vertex::FIRST].push_back(index);
+                }
+            }
+        });
+
+        return incidentEdges_;
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The number of vertices of the graph.
+     */
+    std::size_t vertexCount_;
+
+    /**
+     *  The offsets of the neighborhoods within the adjacency array.
+     */
+    const std::size_t * offsets_;
+
+    /**
+     *  The concatenated neighborhoods of the vertices.
+     */
+    const htd::vertex_t * adjacency_;
+
+    /**
+     *  The number of hyperedges of the graph.
+     */
+    std::size_t hyperedgeCount_;
+
+    /**
+     *  The offsets of the hyperedges within the array of hyperedge elements (nullptr if the edges are derived from the adjacency arrays).
+     */
+    const std::size_t * hyperedgeOffsets_;
+
+    /**
+     *  The concatenated elements of the hyperedges (nullptr if the edges are derived from the adjacency arrays).
+     */
+    const htd::vertex_t * hyperedgeElements_;
+
+    /**
+     *  The flag ensuring that the vector of vertices is created only once.
+     */
+    mutable std::once_flag verticesFlag_;
+
+    /**
+     *  The sorted vector of all vertices of the graph.
+     */
+    mutable std::vector<htd::vertex_t> vertices_;
+
+    /**
+     *  The flag ensuring that the incidence information is created only once.
+     */
+    mutable std::once_flag incidentEdgesFlag_;
+
+    /**
+     *  The positions of the hyperedges containing each vertex.
+     */
+    mutable std::vector<std::vector<htd::index_t>> incidentEdges_;
+
+    /**
+     *  The hyperedges of the graph which are created individually on first access.
+     */
+    std::shared_ptr<const CompressedSparseRowHyperedgeStore> hyperedgeStore_;
+};
+
+htd::CompressedSparseRowGraph::CompressedSparseRowGraph(const htd::LibraryInstance * const manager, std::size_t vertexCount, const std::size_t * offsets, const htd::vertex_t * adjacency) : implementation_(new Implementation(manager, vertexCount, offsets, adjacency, 0, nullptr, nullptr))
+{
+
+}
+
+htd::CompressedSparseRowGraph::CompressedSparseRowGraph(const htd::LibraryInstance * const manager, std::size_t vertexCount, const std::size_t * offsets, const htd::vertex_t * adjacency, std::size_t hyperedgeCount, const std::size_t * hyperedgeOffsets, const htd::vertex_t * hyperedgeElements) : implementation_(new Implementation(manager, vertexCount, offsets, adjacency, hyperedgeCount, hyperedgeOffsets, hyperedgeElements))
+{
+    if (hyperedgeOffsets == nullptr)
+    {
+        throw std::invalid_argument("htd::CompressedSparseRowGraph: The offsets of the hyperedges must not be nullptr.");
+    }
+}
+
+htd::CompressedSparseRowGraph::CompressedSparseRowGraph(const htd::CompressedSparseRowGraph & original) : implementation_(new Implementation(*(original.implementation_)))
+{
+
+}
+
+htd::CompressedSparseRowGraph::~CompressedSparseRowGraph()
+{
+
+}
+
+std::size_t htd::CompressedSparseRowGraph::vertexCount(void) const
+{
+    return implementation_->vertexCount_;
+}
+
+std::size_t htd::CompressedSparseRowGraph::edgeCount(void) const
+{
+    return implementation_->hyperedgeCount_;
+}
+
+std::size_t htd::CompressedSparseRowGraph::edgeCount(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    std::size_t ret = 0;
+
+    if (implementation_->hyperedgeOffsets_ != nullptr)
+    {
+        ret = implementation_->incidentEdges()[vertex - htd::Vertex::FIRST].size();
+    }
+    else
+    {
+        ret = neighborCount(vertex);
+    }
+
+    return ret;
+}
+
+bool htd::CompressedSparseRowGraph::isVertex(htd::vertex_t vertex) const
+{
+    return implementation_->isVertex(vertex);
+}
+
+bool htd::CompressedSparseRowGraph::isEdge(htd::id_t edgeId) const
+{
+    return edgeId >= htd::Id::FIRST && edgeId - htd::Id::FIRST < implementation_->hyperedgeCount_;
+}
+
+bool htd::CompressedSparseRowGraph::isEdge(htd::vertex_t vertex1, htd::vertex_t vertex2) const
+{
+    htd::vertex_t elements[] = { vertex1, vertex2 };
+
+    std::vector<htd::id_t> result;
+
+    implementation_->findHyperedges(elements, 2, result);
+
+    return !result.empty();
+}
+
+bool htd::CompressedSparseRowGraph::isEdge(const std::vector<htd::vertex_t> & elements) const
+{
+    std::vector<htd::id_t> result;
+
+    implementation_->findHyperedges(elements.data(), elements.size(), result);
+
+    return !result.empty();
+}
+
+bool htd::CompressedSparseRowGraph::isEdge(const htd::ConstCollection<htd::vertex_t> & elements) const
+{
+    return isEdge(std::vector<htd::vertex_t>(elements.begin(), elements.end()));
+}
+
+htd::ConstCollection<htd::id_t> htd::CompressedSparseRowGraph::associatedEdgeIds(htd::vertex_t vertex1, htd::vertex_t vertex2) const
+{
+    htd::VectorAdapter<htd::id_t> ret;
+
+    htd::vertex_t elements[] = { vertex1, vertex2 };
+
+    implementation_->findHyperedges(elements, 2, ret.container());
+
+    return htd::ConstCollection<htd::id_t>::getInstance(ret);
+}
+
+htd::ConstCollection<htd::id_t> htd::CompressedSparseRowGraph::associatedEdgeIds(const std::vector<htd::vertex_t> & elements) const
+{
+    htd::VectorAdapter<htd::id_t> ret;
+
+    implementation_->findHyperedges(elements.data(), elements.size(), ret.container());
+
+    return htd::ConstCollection<htd::id_t>::getInstance(ret);
+}
+
+htd::ConstCollection<htd::id_t> htd::CompressedSparseRowGraph::associatedEdgeIds(const htd::ConstCollection<htd::vertex_t> & elements) const
+{
+    return associatedEdgeIds(std::vector<htd::vertex_t>(elements.begin(), elements.end()));
+}
+
+htd::ConstCollection<htd::vertex_t> htd::CompressedSparseRowGraph::vertices(void) const
+{
+    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->vertices());
+}
+
+void htd::CompressedSparseRowGraph::copyVerticesTo(std::vector<htd::vertex_t> & target) const
+{
+    std::size_t oldSize = target.size();
+
+    target.resize(oldSize + implementation_->vertexCount_);
+
+    std::iota(target.begin() + oldSize, target.end(), htd::Vertex::FIRST);
+}
+
+htd::vertex_t htd::CompressedSparseRowGraph::vertexAtPosition(htd::index_t index) const
+{
+    HTD_ASSERT(index < implementation_->vertexCount_)
+
+    return Implementation::vertexAtIndex(index);
+}
+
+bool htd::CompressedSparseRowGraph::isConnected(void) const
+{
+    bool ret = true;
+
+    if (implementation_->vertexCount_ > 0)
+    {
+        htd::ScopedWorkspace workspace;
+
+        workspace->beginVisit(implementation_->vertexCount_ + htd::Vertex::FIRST);
+
+        std::vector<htd::vertex_t> & originStack = workspace->buffer<htd::vertex_t>();
+
+        std::size_t visitedVertexCount = 0;
+
+        originStack.clear();
+
+        originStack.push_back(htd::Vertex::FIRST);
+
+        while (!originStack.empty())
+        {
+            htd::vertex_t currentVertex = originStack.back();
+
+            originStack.pop_back();
+
+            if (workspace->visit(currentVertex))
+            {
+                ++visitedVertexCount;
+
+                for (const htd::vertex_t * it = implementation_->neighborhoodBegin(currentVertex); it != implementation_->neighborhoodEnd(currentVertex); ++it)
+                {
+                    if (!workspace->isVisited(*it))
+                    {
+                        originStack.push_back(*it);
+                    }
+                }
+            }
+        }
+
+        ret = visitedVertexCount == implementation_->vertexCount_;
+    }
+
+    return ret;
+}
+
+bool htd::CompressedSparseRowGraph::isConnected(htd::vertex_t vertex1, htd::vertex_t vertex2) const
+{
+    HTD_ASSERT(isVertex(vertex1) && isVertex(vertex2))
+
+    bool ret = false;
+
+    if (vertex1 == vertex2)
+    {
+        ret = true;
+    }
+    else
+    {
+        htd::ScopedWorkspace workspace;
+
+        workspace->beginVisit(implementation_->vertexCount_ + htd::Vertex::FIRST);
+
+        std::vector<htd::vertex_t> & reachableVertices = workspace->buffer<htd::vertex_t>();
+
+        reachableVertices.clear();
+
+        workspace->visit(vertex1);
+
+        reachableVertices.push_back(vertex1);
+
+        for (htd::index_t index = 0; !ret && index < reachableVertices.size(); ++index)
+        {
+            htd::vertex_t vertex = reachableVertices[index];
+
+            for (const htd::vertex_t * it = implementation_->neighborhoodBegin(vertex); !ret && it != implementation_->neighborhoodEnd(vertex); ++it)
+            {
+                htd::vertex_t neighbor = *it;
+
+                if (workspace->visit(neighbor))
+                {
+                    reachableVertices.push_back(neighbor);
+
+                    ret = neighbor == vertex2;
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+
+bool htd::CompressedSparseRowGraph::isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const
+{
+    HTD_ASSERT(isVertex(vertex) && isVertex(neighbor))
+
+    return vertex != neighbor && std::binary_search(implementation_->neighborhoodBegin(vertex), implementation_->neighborhoodEnd(vertex), neighbor);
+}
+
+std::size_t htd::CompressedSparseRowGraph::neighborCount(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return static_cast<std::size_t>(implementation_->neighborhoodEnd(vertex) - implementation_->neighborhoodBegin(vertex));
+}
+
+htd::ConstCollection<htd::vertex_t> htd::CompressedSparseRowGraph::neighbors(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->neighborhoodBegin(vertex), neighborCount(vertex));
+}
+
+void htd::CompressedSparseRowGraph::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    target.insert(target.end(), implementation_->neighborhoodBegin(vertex), implementation_->neighborhoodEnd(vertex));
+}
+
+htd::vertex_t htd::CompressedSparseRowGraph::neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const
+{
+    HTD_ASSERT(index < neighborCount(vertex))
+
+    return implementation_->neighborhoodBegin(vertex)[index];
+}
+
+std::size_t htd::CompressedSparseRowGraph::isolatedVertexCount(void) const
+{
+    std::size_t ret = 0;
+
+    for (htd::index_t index = 0; index < implementation_->vertexCount_; ++index)
+    {
+        if (implementation_->offsets_[index] == implementation_->offsets_[index + 1])
+        {
+            ++ret;
+        }
+    }
+
+    return ret;
+}
+
+htd::ConstCollection<htd::vertex_t> htd::CompressedSparseRowGraph::isolatedVertices(void) const
+{
+    htd::VectorAdapter<htd::vertex_t> ret;
+
+    auto & result = ret.container();
+
+    for (htd::index_t index = 0; index < implementation_->vertexCount_; ++index)
+    {
+        if (implementation_->offsets_[index] == implementation_->offsets_[index + 1])
+        {
+            result.push_back(Implementation::vertexAtIndex(index));
+        }
+    }
+
+    return htd::ConstCollection<htd::vertex_t>::getInstance(ret);
+}
+
+htd::vertex_t htd::CompressedSparseRowGraph::isolatedVertexAtPosition(htd::index_t index) const
+{
+    const htd::ConstCollection<htd::vertex_t> & isolatedVertexCollection = isolatedVertices();
+
+    HTD_ASSERT(index < isolatedVertexCollection.size())
+
+    htd::ConstIterator<htd::vertex_t> it = isolatedVertexCollection.begin();
+
+    std::advance(it, index);
+
+    return *it;
+}
+
+bool htd::CompressedSparseRowGraph::isIsolatedVertex(htd::vertex_t vertex) const
+{
+    return neighborCount(vertex) == 0;
+}
+
+htd::ConstCollection<htd::Hyperedge> htd::CompressedSparseRowGraph::hyperedges(void) const
+{
+    const CompressedSparseRowHyperedgeStore * store = implementation_->hyperedgeStore_.get();
+
+    return htd::ConstCollection<htd::Hyperedge>(htd::ConstIterator<htd::Hyperedge>(CompressedSparseRowHyperedgeIterator(store, 0)), htd::ConstIterator<htd::Hyperedge>(CompressedSparseRowHyperedgeIterator(store, store->size())));
+}
+
+htd::ConstCollection<htd::Hyperedge> htd::CompressedSparseRowGraph::hyperedges(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    htd::VectorAdapter<htd::Hyperedge> ret;
+
+    auto & result = ret.container();
+
+    for (htd::index_t index : implementation_->incidentEdges()[vertex - htd::Vertex::FIRST])
+    {
+        result.push_back(implementation_->hyperedgeStore_->at(index));
+    }
+
+    return htd::ConstCollection<htd::Hyperedge>::getInstance(ret);
+}
+
+const htd::Hyperedge & htd::CompressedSparseRowGraph::hyperedge(htd::id_t edgeId) const
+{
+    HTD_ASSERT(isEdge(edgeId))
+
+    return hyperedgeAtPosition(edgeId - htd::Id::FIRST);
+}
+
+const htd::Hyperedge & htd::CompressedSparseRowGraph::hyperedgeAtPosition(htd::index_t index) const
+{
+    HTD_ASSERT(index < implementation_->hyperedgeCount_)
+
+    return implementation_->hyperedgeStore_->at(index);
+}
+
+const htd::Hyperedge & htd::CompressedSparseRowGraph::hyperedgeAtPosition(htd::index_t index, htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    const std::vector<htd::index_t> & incidentEdges = implementation_->incidentEdges()[vertex - htd::Vertex::FIRST];
+
+    if (index >= incidentEdges.size())
+    {
+        throw std::out_of_range("const htd::Hyperedge & htd::CompressedSparseRowGraph::hyperedgeAtPosition(htd::index_t, htd::vertex_t) const");
+    }
+
+    return implementation_->hyperedgeStore_->at(incidentEdges[index]);
+}
+
+htd::FilteredHyperedgeCollection htd::CompressedSparseRowGraph::hyperedgesAtPositions(const std::vector<htd::index_t> & indices) const
+{
+    return hyperedgesAtPositions(std::vector<htd::index_t>(indices));
+}
+
+htd::FilteredHyperedgeCollection htd::CompressedSparseRowGraph::hyperedgesAtPositions(std::vector<htd::index_t> && indices) const
+{
+    /* The collection refers to the shared hyperedge store, hence only the hyperedges which are actually accessed are created. */
+    return htd::FilteredHyperedgeCollection(new CompressedSparseRowHyperedgeCollection(implementation_->hyperedgeStore_), std::move(indices));
+}
+
+const std::size_t * htd::CompressedSparseRowGraph::offsets(void) const HTD_NOEXCEPT
+{
+    return implementation_->offsets_;
+}
+
+const htd::vertex_t * htd::CompressedSparseRowGraph::adjacency(void) const HTD_NOEXCEPT
+{
+    return implementation_->adjacency_;
+}
+
+bool htd::CompressedSparseRowGraph::hasExplicitHyperedges(void) const HTD_NOEXCEPT
+{
+    return implementation_->hyperedgeOffsets_ != nullptr;
+}
+
+void htd::CompressedSparseRowGraph::copyHyperedgeElementsTo(htd::index_t index, std::vector<htd::vertex_t> & target) const
+{
+    implementation_->copyHyperedgeElementsTo(index, target);
+}
+
+const htd::LibraryInstance * htd::CompressedSparseRowGraph::managementInstance(void) const HTD_NOEXCEPT
+{
+    return implementation_->managementInstance_;
+}
+
+void htd::CompressedSparseRowGraph::setManagementInstance(const htd::LibraryInstance * const manager)
+{
+    HTD_ASSERT(manager != nullptr)
+
+    implementation_->managementInstance_ = manager;
+}
+
+htd::CompressedSparseRowGraph * htd::CompressedSparseRowGraph::clone(void) const
+{
+    return new htd::CompressedSparseRowGraph(*this);
+}
+
+#ifdef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+htd::IGraphStructure * htd::CompressedSparseRowGraph::cloneGraphStructure(void) const
+{
+    return clone();
+}
+
+htd::IMultiHypergraph * htd::CompressedSparseRowGraph::cloneMultiHypergraph(void) const
+{
+    return clone();
+}
+#endif
+
+#endif /* HTD_HTD_COMPRESSEDSPARSEROWGRAPH_CPP */
@@ -28,7 +28,7 @@
 #include <htd/Globals.hpp>
 #include <htd/Helpers.hpp>
 #include <htd/CompressionOperation.hpp>
-#include <htd/PostOrderTreeTraversal.hpp>
+#include <htd/TreeTraversal.hpp>
 
 #include <vector>
 
@@ -104,13 +104,11 @@ void htd::CompressionOperation::apply(const htd::IMultiHypergraph & graph, htd::
     HTD_UNUSED(graph)
     HTD_UNUSED(labelingFunctions)
 
-    htd::PostOrderTreeTraversal treeTraversal;
-
     std::vector<htd::vertex_t> vertices;
 
     vertices.reserve(decomposition.vertexCount());
 
-    treeTraversal.traverse(decomposition, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToSubtreeRoot)
+    htd::TreeTraversal::postOrder(decomposition, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToSubtreeRoot)
     {
         HTD_UNUSED(parent)
         HTD_UNUSED(distanceToSubtreeRoot)
@@ -232,13 +230,11 @@ void htd::CompressionOperation::apply(const htd::IMultiHypergraph & graph, htd::
     HTD_UNUSED(graph)
     HTD_UNUSED(labelingFunctions)
 
-    htd::PostOrderTreeTraversal treeTraversal;
-
     std::vector<htd::vertex_t> vertices;
 
     vertices.reserve(decomposition.vertexCount());
 
-    treeTraversal.traverse(decomposition, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToSubtreeRoot)
+    htd::TreeTraversal::postOrder(decomposition, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToSubtreeRoot)
     {
         HTD_UNUSED(parent)
         HTD_UNUSED(distanceToSubtreeRoot)
@@ -0,0 +1,514 @@
+/* 
+ * File:   DecompositionCache.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_DECOMPOSITIONCACHE_CPP
+#define HTD_HTD_DECOMPOSITIONCACHE_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/DecompositionCache.hpp>
+#include <htd/CompressedSparseRowGraph.hpp>
+#include <htd/PreprocessedGraph.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+/**
+ *  Private implementation details of class htd::DecompositionCache.
+ */
+struct htd::DecompositionCache::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] directory    The path of the directory in which the cache entries are stored.
+     */
+    Implementation(const std::string & directory) : directory_(directory), mutex_(), claimedKeys_(), bestMaxBagSizes_()
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  The path of the directory in which the cache entries are stored.
+     */
+    std::string directory_;
+
+    /**
+     *  The mutex guarding the set of claimed keys and the updates of the ordering entries.
+     */
+    std::mutex mutex_;
+
+    /**
+     *  The keys for which the stored ordering was already handed out by claimOrdering().
+     */
+    std::unordered_set<std::string> claimedKeys_;
+
+    /**
+     *  The smallest maximum bag size of the orderings which were stored or read via the cache object, for each key.
+     */
+    std::unordered_map<std::string, std::size_t> bestMaxBagSizes_;
+
+    /**
+     *  Mix the bits of the given value (finalizer of the SplitMix64 generator).
+     *
+     *  @param[in] value    The input value.
+     *
+     *  @return The mixed value.
+     */
+    static std::uint64_t mix(std::uint64_t value)
+    {
+        value += 0x9E3779B97F4A7C15ULL;
+
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+
+        return value ^ (value >> 31);
+    }
+
+    /**
+     *  Add the hash values of a hyperedge to the hash values of a graph.
+     *
+     *  @param[in] elements     The elements of the hyperedge sorted in ascending order without duplicates.
+     *  @param[in,out] hash1    The first half of the hash value of the graph.
+     *  @param[in,out] hash2    The second half of the hash value of the graph.
+     */
+    static void addHyperedgeHash(const std::vector<htd::vertex_t> & elements, std::uint64_t & hash1, std::uint64_t & hash2)
+    {
+        std::uint64_t edgeHash1 = mix(elements.size());
+
+        std::uint64_t edgeHash2 = edgeHash1 ^ 0xD6E8FEB86659FD93ULL;
+
+        for (htd::vertex_t vertex : elements)
+        {
+            edgeHash1 = mix(edgeHash1 ^ vertex);
+
+            edgeHash2 = mix(edgeHash2 + vertex);
+        }
+
+        hash1 += edgeHash1;
+
+        hash2 += mix(edgeHash2);
+    }
+
+    /**
+     *  Compute the full path of the file with the given name.
+     *
+     *  @param[in] fileName The name of the file within the cache directory.
+     *
+     *  @return The full path of the file with the given name.
+     */
+    std::string path(const std::string & fileName) const
+    {
+        if (directory_.empty() || directory_.back() == '/' || directory_.back() == '\\')
+        {
+            return directory_ + fileName;
+        }
+
+        return directory_ + "/" + fileName;
+    }
+
+    /**
+     *  Replace the content of the given file atomically.
+     *
+     *  The content is written to a temporary file within the same directory which is then renamed to the target path.
+     *
+     *  @param[in] targetPath   The path of the file.
+     *  @param[in] content      The new content of the file.
+     *
+     *  @return True if the file was written successfully, false otherwise.
+     */
+    bool writeFile(const std::string & targetPath, const std::string & content) const
+    {
+        std::random_device randomDevice;
+
+        std::string temporaryPath = targetPath + ".tmp" + std::to_string(randomDevice());
+
+        bool ret = false;
+
+        {
+            std::ofstream stream(temporaryPath, std::ios::out | std::ios::trunc);
+
+            stream << content;
+
+            stream.flush();
+
+            ret = stream.good();
+        }
+
+        if (ret)
+        {
+            ret = std::rename(temporaryPath.c_str(), targetPath.c_str()) == 0;
+
+            /* Some platforms do not allow renaming a file to the path of an existing one. */
+            if (!ret)
+            {
+                std::remove(targetPath.c_str());
+
+                ret = std::rename(temporaryPath.c_str(), targetPath.c_str()) == 0;
+            }
+        }
+
+        if (!ret)
+        {
+            std::remove(temporaryPath.c_str());
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Read the ordering entry stored for the given key.
+     *
+     *  @param[in] key          The key of the input graph.
+     *  @param[out] ordering    The vector to which the stored ordering shall be written.
+     *  @param[out] maxBagSize  The maximum bag size of the decomposition induced by the stored ordering.
+     *
+     *  @return True if a valid entry exists, false otherwise.
+     */
+    bool readOrdering(const std::string & key, std::vector<htd::vertex_t> & ordering, std::size_t & maxBagSize) const
+    {
+        std::ifstream stream(path(key + ".ordering"));
+
+        std::string format;
+
+        std::size_t version = 0;
+
+        std::size_t size = 0;
+
+        std::size_t bagSize = 0;
+
+        bool ret = static_cast<bool>(stream >> format >> version >> size >> bagSize) && format == "htd-ordering" && version == 1;
+
+        std::vector<htd::vertex_t> sequence;
+
+        if (ret)
+        {
+            sequence.reserve(size);
+
+            for (htd::index_t index = 0; ret && index < size; ++index)
+            {
+                htd::vertex_t vertex = htd::Vertex::UNKNOWN;
+
+                ret = static_cast<bool>(stream >> vertex) && vertex != htd::Vertex::UNKNOWN;
+
+                sequence.push_back(vertex);
+            }
+        }
+
+        if (ret)
+        {
+            ordering = std::move(sequence);
+
+            maxBagSize = bagSize;
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Read a vector of vertices which is preceded by its size from the given stream.
+     *
+     *  @param[in] stream       The input stream.
+     *  @param[in] upperBound   The exclusive upper bound for the values of the vertices.
+     *  @param[out] target      The vector to which the vertices shall be appended.
+     *
+     *  @return True if the vector was read successfully and all values are less than the given upper bound, false otherwise.
+     */
+    static bool readVertices(std::istream & stream, std::size_t upperBound, std::vector<htd::vertex_t> & target)
+    {
+        std::size_t size = 0;
+
+        bool ret = static_cast<bool>(stream >> size) && size <= upperBound;
+
+        if (ret)
+        {
+            target.reserve(size);
+
+            for (htd::index_t index = 0; ret && index < size; ++index)
+            {
+                htd::vertex_t vertex = 0;
+
+                ret = static_cast<bool>(stream >> vertex) && vertex < upperBound;
+
+                target.push_back(vertex);
+            }
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Write a vector of vertices preceded by its size to the given stream.
+     *
+     *  @param[in] stream   The output stream.
+     *  @param[in] vertices The vertices which shall be written.
+     */
+    static void writeVertices(std::ostream & stream, const std::vector<htd::vertex_t> & vertices)
+    {
+        stream << vertices.size();
+
+        for (htd::vertex_t vertex : vertices)
+        {
+            stream << ' ' << vertex;
+        }
+
+        stream << '\n';
+    }
+};
+
+htd::DecompositionCache::DecompositionCache(const std::string & directory) : implementation_(new Implementation(directory))
+{
+
+}
+
+htd::DecompositionCache::~DecompositionCache()
+{
+
+}
+
+const std::string & htd::DecompositionCache::directory(void) const
+{
+    return implementation_->directory_;
+}
+
+std::string htd::DecompositionCache::computeKey(const htd::IMultiHypergraph & graph)
+{
+    /* Both halves of the key are sums over the vertices and hyperedges, hence they do not depend on the order of insertion. */
+    std::uint64_t hash1 = Implementation::mix(graph.vertexCount());
+
+    std::uint64_t hash2 = Implementation::mix(graph.edgeCount() ^ 0x5851F42D4C957F2DULL);
+
+    for (htd::vertex_t vertex : graph.vertices())
+    {
+        hash1 += Implementation::mix(vertex);
+
+        hash2 += Implementation::mix(Implementation::mix(vertex) ^ 0x2545F4914F6CDD1DULL);
+    }
+
+    const htd::CompressedSparseRowGraph * compressedGraph = dynamic_cast<const htd::CompressedSparseRowGraph *>(&graph);
+
+    if (compressedGraph != nullptr)
+    {
+        /* The hyperedges of a graph in CSR format are read directly from its arrays to avoid materializing them. */
+        std::vector<htd::vertex_t> elements;
+
+        for (htd::index_t index = 0; index < compressedGraph->edgeCount(); ++index)
+        {
+            elements.clear();
+
+            compressedGraph->copyHyperedgeElementsTo(index, elements);
+
+            Implementation::addHyperedgeHash(elements, hash1, hash2);
+        }
+    }
+    else
+    {
+        for (const htd::Hyperedge & hyperedge : graph.hyperedges())
+        {
+            Implementation::addHyperedgeHash(hyperedge.sortedElements(), hash1, hash2);
+        }
+    }
+
+    std::ostringstream stream;
+
+    stream << std::hex << std::setfill('0') << std::setw(16) << Implementation::mix(hash1) << std::setw(16) << Implementation::mix(hash2);
+
+    return stream.str();
+}
+
+htd::IPreprocessedGraph * htd::DecompositionCache::loadPreprocessedGraph(const std::string & key, const std::string & configuration) const
+{
+    htd::IPreprocessedGraph * ret = nullptr;
+
+    std::ifstream stream(implementation_->path(key + "." + configuration + ".preprocessed"));
+
+    std::string format;
+
+    std::size_t version = 0;
+
+    std::size_t size = 0;
+
+    std::size_t inputGraphEdgeCount = 0;
+
+    std::size_t minTreeWidth = 0;
+
+    bool ok = static_cast<bool>(stream >> format >> version >> size >> inputGraphEdgeCount >> minTreeWidth) && format == "htd-preprocessed" && version == 1;
+
+    std::vector<htd::vertex_t> vertexNames;
+
+    std::vector<htd::vertex_t> eliminationSequence;
+
+    std::vector<htd::vertex_t> remainingVertices;
+
+    std::vector<std::vector<htd::vertex_t>> neighborhood;
+
+    if (ok)
+    {
+        vertexNames.reserve(size);
+
+        for (htd::index_t index = 0; ok && index < size; ++index)
+        {
+            htd::vertex_t vertex = htd::Vertex::UNKNOWN;
+
+            ok = static_cast<bool>(stream >> vertex) && vertex != htd::Vertex::UNKNOWN;
+
+            vertexNames.push_back(vertex);
+        }
+    }
+
+    if (ok)
+    {
+        ok = Implementation::readVertices(stream, std::numeric_limits<htd::vertex_t>::max(), eliminationSequence) &&
+             Implementation::readVertices(stream, size, remainingVertices) &&
+             eliminationSequence.size() + remainingVertices.size() == size;
+    }
+
+    if (ok)
+    {
+        neighborhood.resize(size);
+
+        for (htd::index_t index = 0; ok && index < size; ++index)
+        {
+            ok = Implementation::readVertices(stream, size, neighborhood[index]);
+        }
+    }
+
+    if (ok)
+    {
+        ret = new htd::PreprocessedGraph(std::move(vertexNames), std::move(neighborhood), std::move(eliminationSequence), std::move(remainingVertices), inputGraphEdgeCount, minTreeWidth);
+    }
+
+    return ret;
+}
+
+bool htd::DecompositionCache::storePreprocessedGraph(const std::string & key, const std::string & configuration, const htd::IPreprocessedGraph & preprocessedGraph) const
+{
+    std::ostringstream stream;
+
+    const std::vector<htd::vertex_t> & vertexNames = preprocessedGraph.vertexNames();
+
+    stream << "htd-preprocessed 1\n" << vertexNames.size() << ' ' << preprocessedGraph.inputGraphEdgeCount() << ' ' << preprocessedGraph.minTreeWidth() << '\n';
+
+    for (htd::vertex_t vertex : vertexNames)
+    {
+        stream << vertex << ' ';
+    }
+
+    stream << '\n';
+
+    Implementation::writeVertices(stream, preprocessedGraph.eliminationSequence());
+
+    Implementation::writeVertices(stream, preprocessedGraph.remainingVertices());
+
+    for (const std::vector<htd::vertex_t> & currentNeighborhood : preprocessedGraph.neighborhood())
+    {
+        Implementation::writeVertices(stream, currentNeighborhood);
+    }
+
+    return implementation_->writeFile(implementation_->path(key + "." + configuration + ".preprocessed"), stream.str());
+}
+
+bool htd::DecompositionCache::loadOrdering(const std::string & key, std::vector<htd::vertex_t> & ordering, std::size_t & maxBagSize) const
+{
+    return implementation_->readOrdering(key, ordering, maxBagSize);
+}
+
+bool htd::DecompositionCache::claimOrdering(const std::string & key, std::vector<htd::vertex_t> & ordering, std::size_t & maxBagSize) const
+{
+    std::lock_guard<std::mutex> lock(implementation_->mutex_);
+
+    bool ret = implementation_->claimedKeys_.insert(key).second;
+
+    if (ret)
+    {
+        ret = implementation_->readOrdering(key, ordering, maxBagSize);
+    }
+
+    return ret;
+}
+
+bool htd::DecompositionCache::storeOrdering(const std::string & key, const std::vector<htd::vertex_t> & ordering, std::size_t maxBagSize) const
+{
+    std::lock_guard<std::mutex> lock(implementation_->mutex_);
+
+    auto position = implementation_->bestMaxBagSizes_.find(key);
+
+    bool ret = position == implementation_->bestMaxBagSizes_.end() || maxBagSize < position->second;
+
+    /* The entry may have been improved by another process in the meantime, hence the file is consulted before it is replaced. */
+    if (ret)
+    {
+        std::vector<htd::vertex_t> storedOrdering;
+
+        std::size_t storedMaxBagSize = (std::size_t)-1;
+
+        if (implementation_->readOrdering(key, storedOrdering, storedMaxBagSize))
+        {
+            implementation_->bestMaxBagSizes_[key] = storedMaxBagSize;
+
+            ret = maxBagSize < storedMaxBagSize;
+        }
+    }
+
+    if (ret)
+    {
+        std::ostringstream stream;
+
+        stream << "htd-ordering 1\n" << ordering.size() << ' ' << maxBagSize << '\n';
+
+        for (htd::vertex_t vertex : ordering)
+        {
+            stream << vertex << ' ';
+        }
+
+        stream << '\n';
+
+        ret = implementation_->writeFile(implementation_->path(key + ".ordering"), stream.str());
+
+        if (ret)
+        {
+            implementation_->bestMaxBagSizes_[key] = maxBagSize;
+        }
+    }
+
+    return ret;
+}
+
+#endif /* HTD_HTD_DECOMPOSITIONCACHE_CPP */
@@ -29,9 +29,9 @@
 #include <htd/Helpers.hpp>
 #include <htd/DepthFirstConnectedComponentAlgorithm.hpp>
 #include <htd/DepthFirstGraphTraversal.hpp>
+#include <htd/ScopedWorkspace.hpp>
 
 #include <algorithm>
-#include <stack>
 #include <stdexcept>
 
 /**
@@ -76,22 +76,27 @@ void htd::DepthFirstConnectedComponentAlgorithm::determineComponents(const htd::
 
     if (!vertexCollection.empty())
     {
-        std::unordered_set<htd::vertex_t> unvisitedVertices(vertexCollection.begin(), vertexCollection.end());
+        htd::ScopedWorkspace workspace;
+
+        workspace->beginVisit(graph.vertexAtPosition(graph.vertexCount() - 1) + 1);
 
         const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
-        while (!unvisitedVertices.empty() && !managementInstance.isTerminated())
+        for (auto it = vertexCollection.begin(); it != vertexCollection.end() && !managementInstance.isTerminated(); ++it)
         {
-            std::vector<htd::vertex_t> component;
+            if (!workspace->isVisited(*it))
+            {
+                std::vector<htd::vertex_t> component;
 
-            determineComponent(graph, *(unvisitedVertices.begin()), component);
+                determineComponent(graph, *it, component);
 
-            for (htd::vertex_t visitedVertex : component)
-            {
-                unvisitedVertices.erase(visitedVertex);
-            }
+                for (htd::vertex_t visitedVertex : component)
+                {
+                    workspace->visit(visitedVertex);
+                }
 
-            target.push_back(std::move(component));
+                target.push_back(std::move(component));
+            }
         }
     }
 }
@@ -28,11 +28,11 @@
 #include <htd/Globals.hpp>
 #include <htd/Helpers.hpp>
 #include <htd/DepthFirstGraphTraversal.hpp>
+#include <htd/ScopedWorkspace.hpp>
 
-#include <stack>
 #include <tuple>
 #include <stdexcept>
-#include <unordered_set>
+#include <vector>
 
 /**
  *  Private implementation details of class htd::DepthFirstGraphTraversal.
@@ -74,30 +74,33 @@ void htd::DepthFirstGraphTraversal::traverse(const htd::IGraphStructure & graph,
 {
     HTD_ASSERT(graph.isVertex(startingVertex))
 
-    std::deque<std::tuple<htd::vertex_t, htd::vertex_t, std::size_t>> originDeque;
+    htd::ScopedWorkspace workspace;
 
-    std::unordered_set<htd::vertex_t> visitedVertices;
+    workspace->beginVisit(graph.vertexAtPosition(graph.vertexCount() - 1) + 1);
+
+    /* Each queue entry holds a vertex, its parent and its distance to the starting vertex. */
+    std::vector<std::tuple<htd::vertex_t, htd::vertex_t, std::size_t>> & originQueue = workspace->buffer<std::tuple<htd::vertex_t, htd::vertex_t, std::size_t>>();
+
+    originQueue.clear();
 
     std::size_t currentDistance = 0;
     htd::vertex_t currentVertex = startingVertex;
 
-    originDeque.emplace_back(currentVertex, htd::Vertex::UNKNOWN, currentDistance);
+    originQueue.emplace_back(currentVertex, htd::Vertex::UNKNOWN, currentDistance);
 
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
-    while (!originDeque.empty() && !managementInstance.isTerminated())
+    for (htd::index_t head = 0; head < originQueue.size() && !managementInstance.isTerminated(); ++head)
     {
-        currentVertex = std::get<0>(originDeque.front());
+        currentVertex = std::get<0>(originQueue[head]);
 
-        if (visitedVertices.count(currentVertex) == 0)
+        if (!workspace->isVisited(currentVertex))
         {
-            currentDistance = std::get<2>(originDeque.front());
-
-            targetFunction(currentVertex, std::get<1>(originDeque.front()), currentDistance);
+            currentDistance = std::get<2>(originQueue[head]);
 
-            visitedVertices.insert(currentVertex);
+            targetFunction(currentVertex, std::get<1>(originQueue[head]), currentDistance);
 
-            originDeque.pop_front();
+            workspace->visit(currentVertex);
 
             const htd::ConstCollection<htd::vertex_t> & neighborCollection = graph.neighbors(currentVertex);
 
@@ -107,18 +110,14 @@ void htd::DepthFirstGraphTraversal::traverse(const htd::IGraphStructure & graph,
             {
                 htd::vertex_t neighbor = *it;
 
-                if (visitedVertices.count(neighbor) == 0)
+                if (!workspace->isVisited(neighbor))
                 {
-                    originDeque.emplace_back(neighbor, currentVertex, currentDistance + 1);
+                    originQueue.emplace_back(neighbor, currentVertex, currentDistance + 1);
                 }
 
                 ++it;
             }
         }
-        else
-        {
-            originDeque.pop_front();
-        }
     }
 }
 
@@ -165,6 +165,8 @@ htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::~EnhancedMaximumCardinal
 
 htd::IVertexOrdering * htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT
 {
+    htd::RandomNumberGeneratorScope randomNumberGeneratorScope;
+
     htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
 
     htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
@@ -179,6 +181,8 @@ htd::IVertexOrdering * htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::c
 
 htd::IVertexOrdering * htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT
 {
+    htd::RandomNumberGeneratorScope randomNumberGeneratorScope;
+
     HTD_UNUSED(graph)
 
     std::size_t size = preprocessedGraph.remainingVertices().size();
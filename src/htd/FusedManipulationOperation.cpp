@@ -0,0 +1,385 @@
+/*
+ * File:   FusedManipulationOperation.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_FUSEDMANIPULATIONOPERATION_CPP
+#define HTD_HTD_FUSEDMANIPULATIONOPERATION_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/FusedManipulationOperation.hpp>
+#include <htd/TreeTraversal.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <unordered_set>
+#include <vector>
+
+/**
+ *  Private implementation details of class htd::FusedManipulationOperation.
+ */
+struct htd::FusedManipulationOperation::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager   The management instance to which the current object instance belongs.
+     */
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), manipulationOperations_()
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+        for (htd::ITreeDecompositionManipulationOperation * operation : manipulationOperations_)
+        {
+            delete operation;
+        }
+    }
+
+    /**
+     *  The maximum number of decomposition nodes which pass through the stages of a fused traversal together.
+     */
+    static const std::size_t BATCH_SIZE = 64;
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The manipulation operations which shall be applied.
+     */
+    std::vector<htd::ITreeDecompositionManipulationOperation *> manipulationOperations_;
+
+    /**
+     *  Check whether the given manipulation operation can be executed as a stage of a fused traversal.
+     *
+     *  @param[in] manipulationOperation    The manipulation operation.
+     *
+     *  @return True if the given manipulation operation is local and creates or removes tree nodes, false otherwise.
+     */
+    bool isFusable(const htd::ITreeDecompositionManipulationOperation & manipulationOperation) const
+    {
+        return manipulationOperation.isLocalOperation() && (manipulationOperation.createsTreeNodes() || manipulationOperation.removesTreeNodes());
+    }
+
+    /**
+     *  Apply the given sequence of fusable manipulation operations to the decomposition within a single post-order traversal.
+     *
+     *  @param[in] graph                The graph from which the given decomposition was computed.
+     *  @param[in] decomposition        The decomposition which shall be modified.
+     *  @param[in] stages               The manipulation operations which shall be applied, in the order of their application.
+     *  @param[in] labelingFunctions    The labeling functions which are applied to the created nodes.
+     */
+    void applyFused(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition, const std::vector<const htd::ITreeDecompositionManipulationOperation *> & stages, const std::vector<htd::ILabelingFunction *> & labelingFunctions) const;
+
+    /**
+     *  Pass a batch of decomposition nodes through the given sequence of fusable manipulation operations.
+     *
+     *  @param[in] graph                The graph from which the given decomposition was computed.
+     *  @param[in] decomposition        The decomposition which shall be modified.
+     *  @param[in] batch                The decomposition nodes of the batch, in post-order.
+     *  @param[in] stages               The manipulation operations which shall be applied, in the order of their application.
+     *  @param[in] labelingFunctions    The labeling functions which are applied to the created nodes.
+     */
+    void processBatch(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition, const std::vector<htd::vertex_t> & batch, const std::vector<const htd::ITreeDecompositionManipulationOperation *> & stages, const std::vector<htd::ILabelingFunction *> & labelingFunctions) const;
+};
+
+const std::size_t htd::FusedManipulationOperation::Implementation::BATCH_SIZE;
+
+htd::FusedManipulationOperation::FusedManipulationOperation(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd::FusedManipulationOperation::FusedManipulationOperation(const htd::LibraryInstance * const manager, const std::vector<htd::ITreeDecompositionManipulationOperation *> & manipulationOperations) : implementation_(new Implementation(manager))
+{
+    addManipulationOperations(manipulationOperations);
+}
+
+htd::FusedManipulationOperation::~FusedManipulationOperation()
+{
+
+}
+
+void htd::FusedManipulationOperation::apply(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition) const
+{
+    apply(graph, decomposition, std::vector<htd::ILabelingFunction *>());
+}
+
+void htd::FusedManipulationOperation::apply(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition, const std::vector<htd::vertex_t> & relevantVertices, std::vector<htd::vertex_t> & createdVertices, std::vector<htd::vertex_t> & removedVertices) const
+{
+    apply(graph, decomposition, relevantVertices, std::vector<htd::ILabelingFunction *>(), createdVertices, removedVertices);
+}
+
+void htd::FusedManipulationOperation::apply(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition, const std::vector<htd::ILabelingFunction *> & labelingFunctions) const
+{
+    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+
+    std::vector<const htd::ITreeDecompositionManipulationOperation *> stages;
+
+    auto it = implementation_->manipulationOperations_.begin();
+
+    while (it != implementation_->manipulationOperations_.end() && !managementInstance.isTerminated())
+    {
+        stages.clear();
+
+        while (it != implementation_->manipulationOperations_.end() && implementation_->isFusable(**it))
+        {
+            stages.push_back(*it);
+
+            ++it;
+        }
+
+        if (stages.size() > 1)
+        {
+            implementation_->applyFused(graph, decomposition, stages, labelingFunctions);
+        }
+        else if (stages.size() == 1)
+        {
+            stages[0]->apply(graph, decomposition, labelingFunctions);
+        }
+        else
+        {
+            (*it)->apply(graph, decomposition, labelingFunctions);
+
+            ++it;
+        }
+    }
+}
+
+void htd::FusedManipulationOperation::apply(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition, const std::vector<htd::vertex_t> & relevantVertices, const std::vector<htd::ILabelingFunction *> & labelingFunctions, std::vector<htd::vertex_t> & createdVertices, std::vector<htd::vertex_t> & removedVertices) const
+{
+    std::vector<htd::vertex_t> newRelevantVertices(relevantVertices.begin(), relevantVertices.end());
+
+    for (const htd::ITreeDecompositionManipulationOperation * operation : implementation_->manipulationOperations_)
+    {
+        std::size_t oldCreatedVerticesCount = createdVertices.size();
+
+        newRelevantVertices.erase(std::remove_if(newRelevantVertices.begin(), newRelevantVertices.end(), [&](htd::vertex_t vertex) { return !decomposition.isVertex(vertex); }), newRelevantVertices.end());
+
+        operation->apply(graph, decomposition, newRelevantVertices, labelingFunctions, createdVertices, removedVertices);
+
+        newRelevantVertices.insert(newRelevantVertices.end(), createdVertices.begin() + oldCreatedVerticesCount, createdVertices.end());
+    }
+}
+
+void htd::FusedManipulationOperation::Implementation::applyFused(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition, const std::vector<const htd::ITreeDecompositionManipulationOperation *> & stages, const std::vector<htd::ILabelingFunction *> & labelingFunctions) const
+{
+    std::vector<htd::vertex_t> postOrder;
+
+    postOrder.reserve(decomposition.vertexCount());
+
+    htd::TreeTraversal::postOrder(decomposition, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToSubtreeRoot)
+    {
+        HTD_UNUSED(parent)
+        HTD_UNUSED(distanceToSubtreeRoot)
+
+        postOrder.push_back(vertex);
+    });
+
+    std::vector<htd::vertex_t> batch;
+
+    batch.reserve(BATCH_SIZE);
+
+    for (htd::index_t index = 0; index < postOrder.size() && !managementInstance_->isTerminated(); index += BATCH_SIZE)
+    {
+        batch.clear();
+
+        std::size_t end = std::min(index + BATCH_SIZE, postOrder.size());
+
+        /* Nodes which were removed by a stage of a previous batch are skipped. */
+        std::copy_if(postOrder.begin() + index, postOrder.begin() + end, std::back_inserter(batch), [&](htd::vertex_t vertex) { return decomposition.isVertex(vertex); });
+
+        if (!batch.empty())
+        {
+            processBatch(graph, decomposition, batch, stages, labelingFunctions);
+        }
+    }
+}
+
+void htd::FusedManipulationOperation::Implementation::processBatch(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition, const std::vector<htd::vertex_t> & batch, const std::vector<const htd::ITreeDecompositionManipulationOperation *> & stages, const std::vector<htd::ILabelingFunction *> & labelingFunctions) const
+{
+    std::vector<htd::vertex_t> relevantVertices(batch.begin(), batch.end());
+
+    std::vector<htd::vertex_t> createdVertices;
+    std::vector<htd::vertex_t> removedVertices;
+
+    std::vector<htd::vertex_t> children;
+
+    for (const htd::ITreeDecompositionManipulationOperation * stage : stages)
+    {
+        children.clear();
+
+        if (stage->removesTreeNodes())
+        {
+            for (htd::vertex_t vertex : relevantVertices)
+            {
+                decomposition.copyChildrenTo(vertex, children);
+            }
+        }
+
+        createdVertices.clear();
+        removedVertices.clear();
+
+        stage->apply(graph, decomposition, relevantVertices, labelingFunctions, createdVertices, removedVertices);
+
+        /*
+         *  When a stage removes a node, one of its neighbors takes over the remaining neighbors of the removed node. Such a
+         *  neighbor may be a child which has already passed through all stages, hence the children of the batch nodes are
+         *  handed to the remaining stages in this case.
+         */
+        if (!removedVertices.empty())
+        {
+            for (htd::vertex_t vertex : relevantVertices)
+            {
+                if (decomposition.isVertex(vertex))
+                {
+                    decomposition.copyChildrenTo(vertex, children);
+                }
+            }
+
+            relevantVertices.insert(relevantVertices.end(), children.begin(), children.end());
+        }
+
+        relevantVertices.insert(relevantVertices.end(), createdVertices.begin(), createdVertices.end());
+
+        std::unordered_set<htd::vertex_t> visitedVertices;
+
+        relevantVertices.erase(std::remove_if(relevantVertices.begin(), relevantVertices.end(), [&](htd::vertex_t vertex) { return !decomposition.isVertex(vertex) || !visitedVertices.insert(vertex).second; }), relevantVertices.end());
+    }
+}
+
+bool htd::FusedManipulationOperation::isLocalOperation(void) const
+{
+    return std::all_of(implementation_->manipulationOperations_.begin(), implementation_->manipulationOperations_.end(), [](const htd::ITreeDecompositionManipulationOperation * operation) { return operation->isLocalOperation(); });
+}
+
+bool htd::FusedManipulationOperation::createsTreeNodes(void) const
+{
+    return std::any_of(implementation_->manipulationOperations_.begin(), implementation_->manipulationOperations_.end(), [](const htd::ITreeDecompositionManipulationOperation * operation) { return operation->createsTreeNodes(); });
+}
+
+bool htd::FusedManipulationOperation::removesTreeNodes(void) const
+{
+    return std::any_of(implementation_->manipulationOperations_.begin(), implementation_->manipulationOperations_.end(), [](const htd::ITreeDecompositionManipulationOperation * operation) { return operation->removesTreeNodes(); });
+}
+
+bool htd::FusedManipulationOperation::modifiesBagContents(void) const
+{
+    return std::any_of(implementation_->manipulationOperations_.begin(), implementation_->manipulationOperations_.end(), [](const htd::ITreeDecompositionManipulationOperation * operation) { return operation->modifiesBagContents(); });
+}
+
+bool htd::FusedManipulationOperation::createsSubsetMaximalBags(void) const
+{
+    return std::any_of(implementation_->manipulationOperations_.begin(), implementation_->manipulationOperations_.end(), [](const htd::ITreeDecompositionManipulationOperation * operation) { return operation->createsSubsetMaximalBags(); });
+}
+
+bool htd::FusedManipulationOperation::createsLocationDependendLabels(void) const
+{
+    return std::any_of(implementation_->manipulationOperations_.begin(), implementation_->manipulationOperations_.end(), [](const htd::ITreeDecompositionManipulationOperation * operation) { return operation->createsLocationDependendLabels(); });
+}
+
+void htd::FusedManipulationOperation::addManipulationOperation(htd::ITreeDecompositionManipulationOperation * manipulationOperation)
+{
+    HTD_ASSERT(manipulationOperation != nullptr)
+
+    implementation_->manipulationOperations_.push_back(manipulationOperation);
+}
+
+void htd::FusedManipulationOperation::addManipulationOperations(const std::vector<htd::ITreeDecompositionManipulationOperation *> & manipulationOperations)
+{
+    for (htd::ITreeDecompositionManipulationOperation * manipulationOperation : manipulationOperations)
+    {
+        addManipulationOperation(manipulationOperation);
+    }
+}
+
+std::size_t htd::FusedManipulationOperation::passCount(void) const
+{
+    std::size_t ret = 0;
+
+    bool previousFusable = false;
+
+    for (const htd::ITreeDecompositionManipulationOperation * operation : implementation_->manipulationOperations_)
+    {
+        bool fusable = implementation_->isFusable(*operation);
+
+        if (!fusable || !previousFusable)
+        {
+            ++ret;
+        }
+
+        previousFusable = fusable;
+    }
+
+    return ret;
+}
+
+const htd::LibraryInstance * htd::FusedManipulationOperation::managementInstance(void) const HTD_NOEXCEPT
+{
+    return implementation_->managementInstance_;
+}
+
+void htd::FusedManipulationOperation::setManagementInstance(const htd::LibraryInstance * const manager)
+{
+    HTD_ASSERT(manager != nullptr)
+
+    implementation_->managementInstance_ = manager;
+
+    for (htd::ITreeDecompositionManipulationOperation * operation : implementation_->manipulationOperations_)
+    {
+        operation->setManagementInstance(manager);
+    }
+}
+
+htd::FusedManipulationOperation * htd::FusedManipulationOperation::clone(void) const
+{
+    htd::FusedManipulationOperation * ret = new htd::FusedManipulationOperation(implementation_->managementInstance_);
+
+    for (const htd::ITreeDecompositionManipulationOperation * operation : implementation_->manipulationOperations_)
+    {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+        ret->addManipulationOperation(operation->clone());
+#else
+        ret->addManipulationOperation(operation->cloneTreeDecompositionManipulationOperation());
+#endif
+    }
+
+    return ret;
+}
+
+#ifdef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+htd::IDecompositionManipulationOperation * htd::FusedManipulationOperation::cloneDecompositionManipulationOperation(void) const
+{
+    return clone();
+}
+
+htd::ITreeDecompositionManipulationOperation * htd::FusedManipulationOperation::cloneTreeDecompositionManipulationOperation(void) const
+{
+    return clone();
+}
+#endif
+
+#endif /* HTD_HTD_FUSEDMANIPULATIONOPERATION_CPP */
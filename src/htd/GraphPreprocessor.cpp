@@ -30,6 +30,11 @@
 
 #include <htd/GraphPreprocessor.hpp>
 
+#include <htd/DecompositionCache.hpp>
+#include <htd/Instrumentation.hpp>
+#include <htd/ScopedTimer.hpp>
+
+#include <htd/CompressedSparseRowGraph.hpp>
 #include <htd/PreprocessedGraph.hpp>
 #include <htd/BiconnectedComponentAlgorithm.hpp>
 #include <htd/MinFillOrderingAlgorithm.hpp>
@@ -414,6 +419,39 @@ struct htd::GraphPreprocessor::Implementation
      */
     htd::IWidthLimitableOrderingAlgorithm * orderingAlgorithm_;
 
+    /**
+     *  Add the number of vertices eliminated by a reduction rule to the counters of the instrumentation object recording the given timer.
+     *
+     *  @param[in] timer                The timer of the reduction rule.
+     *  @param[in] counterName          The name of the counter.
+     *  @param[in] initialOrderingSize  The length of the partial elimination ordering before the reduction rule was applied.
+     *  @param[in] finalOrderingSize    The length of the partial elimination ordering after the reduction rule was applied.
+     */
+    void addEliminatedVertexCount(const htd::ScopedTimer & timer, const char * counterName, std::size_t initialOrderingSize, std::size_t finalOrderingSize) const
+    {
+        if (timer.instrumentation() != nullptr)
+        {
+            timer.instrumentation()->addCounter(counterName, finalOrderingSize - initialOrderingSize);
+        }
+    }
+
+    /**
+     *  Compute the identifier of the preprocessor configuration under which the results are stored in the decomposition cache.
+     *
+     *  @return The identifier of the preprocessor configuration.
+     */
+    std::string cacheConfiguration(void) const
+    {
+        std::string ret("preprocessing-");
+
+        ret += applyPreprocessing1_ ? '1' : '0';
+        ret += applyPreprocessing2_ ? '1' : '0';
+        ret += applyPreprocessing3_ ? '1' : '0';
+        ret += applyPreprocessing4_ ? '1' : '0';
+
+        return ret;
+    }
+
     /**
      *  Structure representing the preprocessed input for the algorithm.
      *
@@ -456,7 +494,27 @@ struct htd::GraphPreprocessor::Implementation
         {
             std::size_t size = graph.vertexCount();
 
-            if (size > 0)
+            const htd::CompressedSparseRowGraph * compressedGraph = dynamic_cast<const htd::CompressedSparseRowGraph *>(&graph);
+
+            if (compressedGraph != nullptr)
+            {
+                /* The neighborhoods of a graph in CSR format are sorted and free of self-loops, hence they can be read directly. */
+                const std::size_t * offsets = compressedGraph->offsets();
+
+                const htd::vertex_t * adjacency = compressedGraph->adjacency();
+
+                for (htd::index_t index = 0; index < size; ++index)
+                {
+                    vertexNames.push_back(static_cast<htd::vertex_t>(index) + htd::Vertex::FIRST);
+
+                    std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[index];
+
+                    currentNeighborhood.resize(offsets[index + 1] - offsets[index]);
+
+                    std::transform(adjacency + offsets[index], adjacency + offsets[index + 1], currentNeighborhood.begin(), [](htd::vertex_t neighbor) { return neighbor - htd::Vertex::FIRST; });
+                }
+            }
+            else if (size > 0)
             {
                 if (graph.vertexAtPosition(size - 1) == static_cast<htd::vertex_t>(size))
                 {
@@ -757,19 +815,56 @@ htd::GraphPreprocessor::~GraphPreprocessor()
 
 htd::IPreprocessedGraph * htd::GraphPreprocessor::prepare(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT
 {
+    htd::RandomNumberGeneratorScope randomNumberGeneratorScope;
+
     htd::PreprocessedGraph * ret = nullptr;
 
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
+    htd::ScopedTimer timer(&managementInstance, "Preprocessing", "preprocessing");
+
+    bool preprocessingEnabled = implementation_->applyPreprocessing1_ || implementation_->applyPreprocessing2_ || implementation_->applyPreprocessing3_ || implementation_->applyPreprocessing4_;
+
+    const htd::DecompositionCache * cache = managementInstance.decompositionCache();
+
+    std::string cacheKey;
+
+    std::string cacheConfiguration;
+
+    /* Without any reduction rule, preparing the graph is cheaper than loading it from the cache. */
+    if (cache != nullptr && preprocessingEnabled)
+    {
+        cacheKey = htd::DecompositionCache::computeKey(graph);
+
+        cacheConfiguration = implementation_->cacheConfiguration();
+
+        htd::IPreprocessedGraph * cachedGraph = cache->loadPreprocessedGraph(cacheKey, cacheConfiguration);
+
+        if (cachedGraph != nullptr)
+        {
+            const std::vector<htd::vertex_t> & cachedVertexNames = cachedGraph->vertexNames();
+
+            const htd::ConstCollection<htd::vertex_t> & vertices = graph.vertices();
+
+            /* A stale or colliding cache entry must not be used for a graph with a different set of vertices. */
+            if (cachedVertexNames.size() == vertices.size() && htd::equal(cachedVertexNames.begin(), cachedVertexNames.end(), vertices.begin(), vertices.end()))
+            {
+                return cachedGraph;
+            }
+
+            delete cachedGraph;
+        }
+    }
+
     htd::GraphPreprocessor::Implementation::PreparedInput input(managementInstance, graph);
 
     std::size_t size = input.vertexNames.size();
 
-    std::vector<htd::vertex_t> vertexNames(input.vertexNames.begin(), input.vertexNames.end());
+    std::vector<htd::vertex_t> vertexNames(std::move(input.vertexNames));
 
-    std::vector<std::vector<htd::vertex_t>> neighborhood(input.neighborhood.begin(), input.neighborhood.end());
+    std::vector<std::vector<htd::vertex_t>> neighborhood(std::move(input.neighborhood));
 
-    if (implementation_->applyPreprocessing1_ || implementation_->applyPreprocessing2_ || implementation_->applyPreprocessing3_ || implementation_->applyPreprocessing4_)
+    if (preprocessingEnabled)
     {
         std::unordered_set<htd::vertex_t> vertices(size);
 
@@ -787,15 +882,25 @@ htd::IPreprocessedGraph * htd::GraphPreprocessor::prepare(const htd::IMultiHyper
             implementation_->assignVertexToGroup(vertex, verticesByDegree, neighborhood[vertex].size());
         }
 
-        while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
         {
+            htd::ScopedTimer ruleTimer(&managementInstance, "Preprocessing: Low-degree vertices", "preprocessing");
 
+            while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
+            {
+
+            }
+
+            implementation_->addEliminatedVertexCount(ruleTimer, "Preprocessing: Low-degree vertices (eliminated)", 0, ordering.size());
         }
 
         bool ok = false;
 
         if (!vertices.empty() && implementation_->applyPreprocessing2_)
         {
+            htd::ScopedTimer ruleTimer(&managementInstance, "Preprocessing: Path contraction", "preprocessing");
+
+            std::size_t eliminatedVertexCount = ordering.size();
+
             minTreeWidth = 2;
 
             while (implementation_->contractPaths(vertices, verticesByDegree, neighborhood, ordering))
@@ -810,10 +915,16 @@ htd::IPreprocessedGraph * htd::GraphPreprocessor::prepare(const htd::IMultiHyper
 
                 }
             }
+
+            implementation_->addEliminatedVertexCount(ruleTimer, "Preprocessing: Path contraction (eliminated)", eliminatedVertexCount, ordering.size());
         }
 
         if (!vertices.empty() && implementation_->applyPreprocessing3_)
         {
+            htd::ScopedTimer ruleTimer(&managementInstance, "Preprocessing: Triangle shrinking", "preprocessing");
+
+            std::size_t eliminatedVertexCount = ordering.size();
+
             minTreeWidth = 3;
 
             while (implementation_->shrinkTriangles(vertices, verticesByDegree, neighborhood, ordering))
@@ -833,10 +944,16 @@ htd::IPreprocessedGraph * htd::GraphPreprocessor::prepare(const htd::IMultiHyper
                     }
                 }
             }
+
+            implementation_->addEliminatedVertexCount(ruleTimer, "Preprocessing: Triangle shrinking (eliminated)", eliminatedVertexCount, ordering.size());
         }
 
         if (!vertices.empty() && implementation_->applyPreprocessing4_)
         {
+            htd::ScopedTimer ruleTimer(&managementInstance, "Preprocessing: Simplicial vertices", "preprocessing");
+
+            std::size_t eliminatedVertexCount = ordering.size();
+
             if (implementation_->eliminateSimplicialVertices(vertices, verticesByDegree, neighborhood, ordering, 64, minTreeWidth))
             {
                 while (implementation_->shrinkTriangles(vertices, verticesByDegree, neighborhood, ordering))
@@ -878,6 +995,8 @@ htd::IPreprocessedGraph * htd::GraphPreprocessor::prepare(const htd::IMultiHyper
                     }
                 }
             }
+
+            implementation_->addEliminatedVertexCount(ruleTimer, "Preprocessing: Simplicial vertices (eliminated)", eliminatedVertexCount, ordering.size());
         }
 
         for (htd::index_t index = 0; index < ordering.size(); ++index)
@@ -899,6 +1018,11 @@ htd::IPreprocessedGraph * htd::GraphPreprocessor::prepare(const htd::IMultiHyper
             //TODO
             //implementation_->applyCliqueSeparatorPreprocessing(*ret, vertices);
         }
+
+        if (!cacheKey.empty())
+        {
+            cache->storePreprocessedGraph(cacheKey, cacheConfiguration, *ret);
+        }
     }
     else
     {
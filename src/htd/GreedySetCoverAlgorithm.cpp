@@ -28,10 +28,9 @@
 #include <htd/Globals.hpp>
 #include <htd/Helpers.hpp>
 #include <htd/GreedySetCoverAlgorithm.hpp>
-#include <htd/VectorAdapter.hpp>
+#include <htd/BitsetSetCover.hpp>
 
-#include <algorithm>
-#include <numeric>
+#include <vector>
 
 /**
  *  Private implementation details of class htd::GreedySetCoverAlgorithm.
@@ -71,94 +70,16 @@ htd::GreedySetCoverAlgorithm::~GreedySetCoverAlgorithm()
 
 void htd::GreedySetCoverAlgorithm::computeSetCover(const std::vector<htd::id_t> & elements, const std::vector<std::vector<htd::id_t>> & containers, std::vector<htd::index_t> & target) const
 {
-    if (!elements.empty())
-    {
-        std::vector<htd::id_t> relevantElements(elements.begin(), elements.end());
-
-        std::vector<htd::id_t> newRelevantElements;
-
-        std::vector<htd::index_t> relevantContainers(containers.size());
-
-        std::vector<htd::index_t> newRelevantContainers;
-
-        std::vector<htd::index_t> irrelevantContainers;
-
-        std::vector<htd::index_t> result;
-
-        std::size_t bestOverlap = 1;
-
-        std::iota(relevantContainers.begin(), relevantContainers.end(), 0);
-
-        while (!relevantElements.empty() && bestOverlap > 0)
-        {
-            htd::index_t bestPosition = 0;
-
-            bestOverlap = 0;
-
-            for (htd::index_t containerIndex : relevantContainers)
-            {
-                const std::vector<htd::id_t> & container = containers[containerIndex];
-
-                std::size_t currentOverlap = htd::set_intersection_size(relevantElements.begin(), relevantElements.end(), container.begin(), container.end());
-
-                if (currentOverlap == 0)
-                {
-                    irrelevantContainers.push_back(containerIndex);
-                }
-                else if (currentOverlap > bestOverlap)
-                {
-                    bestOverlap = currentOverlap;
-
-                    bestPosition = containerIndex;
-                }
-            }
-
-            if (bestOverlap > 0)
-            {
-                result.push_back(bestPosition);
+    htd::BitsetSetCover setCover(elements, containers);
 
-                const std::vector<htd::id_t> & selectedContainer = containers[bestPosition];
-
-                newRelevantElements.clear();
-
-                htd::set_difference(relevantElements, selectedContainer, newRelevantElements);
-
-                std::swap(relevantElements, newRelevantElements);
-
-                if (irrelevantContainers.size() > 0)
-                {
-                    irrelevantContainers.insert(std::lower_bound(irrelevantContainers.begin(), irrelevantContainers.end(), bestPosition), bestPosition);
-
-                    std::set_difference(relevantContainers.begin(), relevantContainers.end(), irrelevantContainers.begin(), irrelevantContainers.end(), std::back_inserter(newRelevantContainers));
-
-                    relevantContainers.swap(newRelevantContainers);
-
-                    newRelevantContainers.clear();
-
-                    irrelevantContainers.clear();
-                }
-                else
-                {
-                    relevantContainers.erase(std::lower_bound(relevantContainers.begin(), relevantContainers.end(), bestPosition));
-                }
-            }
-        }
-
-        if (relevantElements.empty())
-        {
-            std::sort(result.begin(), result.end());
-
-            target.insert(target.end(), result.begin(), result.end());
-        }
-    }
+    setCover.computeGreedyCover(target);
 }
 
 void htd::GreedySetCoverAlgorithm::computeSetCover(const htd::ConstCollection<htd::id_t> & elements, const htd::ConstCollection<std::vector<htd::id_t>> & containers, std::vector<htd::index_t> & target) const
 {
-    if (!elements.empty())
-    {
-        computeSetCover(std::vector<htd::id_t>(elements.begin(), elements.end()), std::vector<std::vector<htd::id_t>>(containers.begin(), containers.end()), target);
-    }
+    htd::BitsetSetCover setCover(elements, containers);
+
+    setCover.computeGreedyCover(target);
 }
 
 const htd::LibraryInstance * htd::GreedySetCoverAlgorithm::managementInstance(void) const HTD_NOEXCEPT
@@ -27,239 +27,563 @@
 
 #include <htd/Helpers.hpp>
 
-htd::LibraryInstance * htd::createManagementInstance(htd::id_t id)
-{
-    htd::LibraryInstance * ret = new htd::LibraryInstance(id);
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
 
-    ret->initializeFactoryClasses(ret);
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HTD_USE_SSE2_SET_KERNELS
 
-    return ret;
-}
+#include <emmintrin.h>
+#endif
 
-void htd::print(bool input)
-{
-    print(input, std::cout);
-}
+/**
+ *  The minimum ratio between the sizes of two sets for which galloping search in the larger set is preferred over a merge.
+ */
+static const std::size_t GALLOPING_THRESHOLD = 32;
 
-void htd::print(bool input, std::ostream & stream)
+/**
+ *  The number of vertices which are compared at once by the block-wise merge.
+ */
+static const std::size_t BLOCK_SIZE = 4;
+
+/**
+ *  Find the first vertex in a sorted range which is not less than the given value by galloping from the begin of the range.
+ *
+ *  @param[in] first    A pointer to the first vertex of the range.
+ *  @param[in] last     A pointer past the last vertex of the range.
+ *  @param[in] value    The value which shall be searched.
+ *
+ *  @return A pointer to the first vertex in the range which is not less than the given value.
+ */
+static const htd::vertex_t * gallop(const htd::vertex_t * first, const htd::vertex_t * last, htd::vertex_t value)
 {
-    if (input)
+    if (first == last || !(*first < value))
     {
-        stream << "true";
+        return first;
     }
-    else
+
+    std::size_t size = static_cast<std::size_t>(last - first);
+
+    std::size_t lower = 0;
+
+    std::size_t step = 1;
+
+    while (lower + step < size && first[lower + step] < value)
     {
-        stream << "false";
+        lower += step;
+
+        step <<= 1;
     }
+
+    return std::lower_bound(first + lower + 1, first + std::min(lower + step, size), value);
 }
 
-template < >
-void htd::print<std::string>(const std::string & input)
+#ifdef HTD_USE_SSE2_SET_KERNELS
+/**
+ *  Check for each of the four vertices of the first block whether it occurs in the second block.
+ *
+ *  @param[in] block1   A pointer to the first vertex of the first block.
+ *  @param[in] block2   A pointer to the first vertex of the second block.
+ *
+ *  @return A bit mask in which bit i is set if and only if the i-th vertex of the first block occurs in the second block.
+ */
+static inline unsigned int matchBlocks(const htd::vertex_t * block1, const htd::vertex_t * block2)
 {
-    print(input, std::cout);
+    __m128i vertices1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block1));
+    __m128i vertices2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block2));
+
+    __m128i match0 = _mm_cmpeq_epi32(vertices1, vertices2);
+    __m128i match1 = _mm_cmpeq_epi32(vertices1, _mm_shuffle_epi32(vertices2, _MM_SHUFFLE(0, 3, 2, 1)));
+    __m128i match2 = _mm_cmpeq_epi32(vertices1, _mm_shuffle_epi32(vertices2, _MM_SHUFFLE(1, 0, 3, 2)));
+    __m128i match3 = _mm_cmpeq_epi32(vertices1, _mm_shuffle_epi32(vertices2, _MM_SHUFFLE(2, 1, 0, 3)));
+
+    return static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(_mm_or_si128(_mm_or_si128(match0, match1), _mm_or_si128(match2, match3)))));
 }
+#endif
 
-template < >
-void htd::print<std::string>(const std::string & input, std::ostream & stream)
+/**
+ *  Check whether the block-wise merge can be used for sets of the given vertex type on the target platform.
+ *
+ *  @return True if the block-wise merge can be used, false otherwise.
+ */
+static inline bool useBlockKernels(void)
 {
-    stream << "\"" << input << "\"";
+#ifdef HTD_USE_SSE2_SET_KERNELS
+    return sizeof(htd::vertex_t) == sizeof(std::uint32_t);
+#else
+    return false;
+#endif
 }
 
-void htd::print(const htd::Hyperedge & input)
+/**
+ *  Compute the size of the intersection of a small and a large set via galloping search in the large set.
+ */
+static std::size_t gallopingIntersectionSize(const htd::vertex_t * firstSmall, const htd::vertex_t * lastSmall,
+                                             const htd::vertex_t * firstLarge, const htd::vertex_t * lastLarge)
 {
-    print(input, std::cout);
+    std::size_t ret = 0;
+
+    for (; firstSmall != lastSmall && firstLarge != lastLarge; ++firstSmall)
+    {
+        firstLarge = gallop(firstLarge, lastLarge, *firstSmall);
+
+        if (firstLarge != lastLarge && *firstLarge == *firstSmall)
+        {
+            ++ret;
+
+            ++firstLarge;
+        }
+    }
+
+    return ret;
 }
 
-void htd::print(const htd::Hyperedge & input, std::ostream & stream)
+/**
+ *  Decompose a small and a large set via galloping search in the large set.
+ *
+ *  Each of the result vectors may be nullptr if the corresponding part of the decomposition is not required.
+ */
+static void gallopingDecompose(const htd::vertex_t * firstSmall, const htd::vertex_t * lastSmall,
+                               const htd::vertex_t * firstLarge, const htd::vertex_t * lastLarge,
+                               std::vector<htd::vertex_t> * resultOnlySmall,
+                               std::vector<htd::vertex_t> * resultOnlyLarge,
+                               std::vector<htd::vertex_t> * resultIntersection)
 {
-    stream << "Hyperedge " << input.id() << ": ";
+    for (; firstSmall != lastSmall; ++firstSmall)
+    {
+        const htd::vertex_t * position = gallop(firstLarge, lastLarge, *firstSmall);
 
-    htd::print(input.elements(), std::cout, false);
+        if (resultOnlyLarge != nullptr)
+        {
+            resultOnlyLarge->insert(resultOnlyLarge->end(), firstLarge, position);
+        }
+
+        firstLarge = position;
+
+        if (firstLarge != lastLarge && *firstLarge == *firstSmall)
+        {
+            if (resultIntersection != nullptr)
+            {
+                resultIntersection->push_back(*firstSmall);
+            }
+
+            ++firstLarge;
+        }
+        else if (resultOnlySmall != nullptr)
+        {
+            resultOnlySmall->push_back(*firstSmall);
+        }
+    }
+
+    if (resultOnlyLarge != nullptr)
+    {
+        resultOnlyLarge->insert(resultOnlyLarge->end(), firstLarge, lastLarge);
+    }
 }
 
-void htd::set_union(const std::vector<htd::vertex_t> & set1,
-                    const std::vector<htd::vertex_t> & set2,
-                    htd::vertex_t ignoredVertex,
-                    std::vector<htd::vertex_t> & result)
+/**
+ *  Decompose two sets into the vertices only in the first set, the vertices only in the second set and the vertices in both sets.
+ *
+ *  Each of the result vectors may be nullptr if the corresponding part of the decomposition is not required.
+ */
+static void decompose(const htd::vertex_t * first1, const htd::vertex_t * last1,
+                      const htd::vertex_t * first2, const htd::vertex_t * last2,
+                      std::vector<htd::vertex_t> * resultOnlySet1,
+                      std::vector<htd::vertex_t> * resultOnlySet2,
+                      std::vector<htd::vertex_t> * resultIntersection)
 {
-    auto first1 = set1.begin();
-    auto first2 = set2.begin();
+    std::size_t count1 = static_cast<std::size_t>(last1 - first1);
+    std::size_t count2 = static_cast<std::size_t>(last2 - first2);
 
-    auto last1 = set1.end();
-    auto last2 = set2.end();
+    if (count1 * GALLOPING_THRESHOLD <= count2)
+    {
+        gallopingDecompose(first1, last1, first2, last2, resultOnlySet1, resultOnlySet2, resultIntersection);
+
+        return;
+    }
+
+    if (count2 * GALLOPING_THRESHOLD <= count1)
+    {
+        gallopingDecompose(first2, last2, first1, last1, resultOnlySet2, resultOnlySet1, resultIntersection);
+
+        return;
+    }
+
+    /* Bit i of the masks is set if the i-th vertex of the current block was already found in the other set. */
+    unsigned int matches1 = 0;
+    unsigned int matches2 = 0;
+
+#ifdef HTD_USE_SSE2_SET_KERNELS
+    if (useBlockKernels())
+    {
+        const htd::vertex_t * blockEnd1 = first1 + (count1 - count1 % BLOCK_SIZE);
+        const htd::vertex_t * blockEnd2 = first2 + (count2 - count2 % BLOCK_SIZE);
+
+        while (first1 != blockEnd1 && first2 != blockEnd2)
+        {
+            matches1 |= matchBlocks(first1, first2);
+
+            if (resultOnlySet2 != nullptr)
+            {
+                matches2 |= matchBlocks(first2, first1);
+            }
+
+            htd::vertex_t maximum1 = first1[BLOCK_SIZE - 1];
+            htd::vertex_t maximum2 = first2[BLOCK_SIZE - 1];
+
+            if (maximum1 <= maximum2)
+            {
+                for (std::size_t index = 0; index < BLOCK_SIZE; ++index)
+                {
+                    if ((matches1 >> index) & 1)
+                    {
+                        if (resultIntersection != nullptr)
+                        {
+                            resultIntersection->push_back(first1[index]);
+                        }
+                    }
+                    else if (resultOnlySet1 != nullptr)
+                    {
+                        resultOnlySet1->push_back(first1[index]);
+                    }
+                }
+
+                first1 += BLOCK_SIZE;
+
+                matches1 = 0;
+            }
+
+            if (maximum2 <= maximum1)
+            {
+                if (resultOnlySet2 != nullptr)
+                {
+                    for (std::size_t index = 0; index < BLOCK_SIZE; ++index)
+                    {
+                        if (((matches2 >> index) & 1) == 0)
+                        {
+                            resultOnlySet2->push_back(first2[index]);
+                        }
+                    }
+                }
+
+                first2 += BLOCK_SIZE;
+
+                matches2 = 0;
+            }
+        }
+    }
+#endif
 
     while (first1 != last1 && first2 != last2)
     {
-        if (*first1 < *first2)
+        if (matches1 & 1)
         {
-            if (*first1 != ignoredVertex)
+            if (resultIntersection != nullptr)
             {
-                result.push_back(*first1);
+                resultIntersection->push_back(*first1);
+            }
+
+            ++first1;
+
+            matches1 >>= 1;
+        }
+        else if (matches2 & 1)
+        {
+            ++first2;
+
+            matches2 >>= 1;
+        }
+        else if (*first1 < *first2)
+        {
+            if (resultOnlySet1 != nullptr)
+            {
+                resultOnlySet1->push_back(*first1);
             }
 
             ++first1;
+
+            matches1 >>= 1;
         }
         else if (*first2 < *first1)
         {
-            if (*first2 != ignoredVertex)
+            if (resultOnlySet2 != nullptr)
             {
-                result.push_back(*first2);
+                resultOnlySet2->push_back(*first2);
             }
 
             ++first2;
+
+            matches2 >>= 1;
         }
         else
         {
-            if (*first1 != ignoredVertex)
+            if (resultIntersection != nullptr)
             {
-                result.push_back(*first1);
+                resultIntersection->push_back(*first1);
             }
 
             ++first1;
 
             //Skip common value in set 2.
             ++first2;
+
+            matches1 >>= 1;
+            matches2 >>= 1;
         }
     }
 
-    if (first1 != last1)
+    for (; first1 != last1; ++first1)
     {
-        if (*first1 <= ignoredVertex)
+        if (matches1 & 1)
         {
-            std::copy_if(first1, last1, std::back_inserter(result), [&](const htd::vertex_t vertex) { return vertex != ignoredVertex; });
+            if (resultIntersection != nullptr)
+            {
+                resultIntersection->push_back(*first1);
+            }
         }
-        else
+        else if (resultOnlySet1 != nullptr)
         {
-            result.insert(result.end(), first1, last1);
+            resultOnlySet1->push_back(*first1);
         }
+
+        matches1 >>= 1;
     }
-    else if (first2 != last2)
+
+    for (; first2 != last2; ++first2)
     {
-        if (*first2 <= ignoredVertex)
-        {
-            std::copy_if(first2, last2, std::back_inserter(result), [&](const htd::vertex_t vertex) { return vertex != ignoredVertex; });
-        }
-        else
+        if ((matches2 & 1) == 0 && resultOnlySet2 != nullptr)
         {
-            result.insert(result.end(), first2, last2);
+            resultOnlySet2->push_back(*first2);
         }
+
+        matches2 >>= 1;
     }
 }
 
-void htd::set_difference(const std::vector<htd::vertex_t> & set1,
-                         const std::vector<htd::vertex_t> & set2,
-                         std::vector<htd::vertex_t> & result)
+/**
+ *  Compute the size of the intersection of two sets.
+ */
+static std::size_t intersectionSize(const htd::vertex_t * first1, const htd::vertex_t * last1,
+                                    const htd::vertex_t * first2, const htd::vertex_t * last2)
 {
-    auto first1 = set1.begin();
-    auto first2 = set2.begin();
+    std::size_t count1 = static_cast<std::size_t>(last1 - first1);
+    std::size_t count2 = static_cast<std::size_t>(last2 - first2);
 
-    auto last1 = set1.end();
-    auto last2 = set2.end();
+    if (count1 * GALLOPING_THRESHOLD <= count2)
+    {
+        return gallopingIntersectionSize(first1, last1, first2, last2);
+    }
 
-    while (first1 != last1 && first2 != last2)
+    if (count2 * GALLOPING_THRESHOLD <= count1)
     {
-        if (*first1 < *first2)
+        return gallopingIntersectionSize(first2, last2, first1, last1);
+    }
+
+    std::size_t ret = 0;
+
+#ifdef HTD_USE_SSE2_SET_KERNELS
+    if (useBlockKernels())
+    {
+        static const unsigned char BIT_COUNT[16] = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 };
+
+        const htd::vertex_t * blockEnd1 = first1 + (count1 - count1 % BLOCK_SIZE);
+        const htd::vertex_t * blockEnd2 = first2 + (count2 - count2 % BLOCK_SIZE);
+
+        /* Each step advances at least one of the two blocks. As the sets are free of duplicates, a matched pair thus
+         * loses at least one of its vertices and cannot be counted again by the scalar merge of the remainder. */
+        while (first1 != blockEnd1 && first2 != blockEnd2)
         {
-            result.push_back(*first1);
+            ret += BIT_COUNT[matchBlocks(first1, first2)];
 
-            ++first1;
+            htd::vertex_t maximum1 = first1[BLOCK_SIZE - 1];
+            htd::vertex_t maximum2 = first2[BLOCK_SIZE - 1];
+
+            if (maximum1 <= maximum2)
+            {
+                first1 += BLOCK_SIZE;
+            }
+
+            if (maximum2 <= maximum1)
+            {
+                first2 += BLOCK_SIZE;
+            }
         }
-        else if (*first2 < *first1)
+    }
+#endif
+
+    while (first1 != last1 && first2 != last2)
+    {
+        if (*first1 < *first2)
         {
-            ++first2;
+            ++first1;
         }
         else
         {
-            ++first1;
+            if (*first1 == *first2)
+            {
+                ++ret;
+
+                ++first1;
+            }
 
-            //Skip common value in set 2.
             ++first2;
         }
     }
 
-    result.insert(result.end(), first1, last1);
+    return ret;
 }
 
-void htd::set_intersection(const std::vector<htd::vertex_t> & set1,
-                           const std::vector<htd::vertex_t> & set2,
-                           std::vector<htd::vertex_t> & result)
+htd::LibraryInstance * htd::createManagementInstance(htd::id_t id)
 {
-    auto first1 = set1.begin();
-    auto first2 = set2.begin();
+    htd::LibraryInstance * ret = new htd::LibraryInstance(id);
 
-    auto last1 = set1.end();
-    auto last2 = set2.end();
+    ret->initializeFactoryClasses(ret);
 
-    while (first1 != last1 && first2 != last2)
-    {
-        if (*first1 < *first2)
-        {
-            ++first1;
-        }
-        else if (*first2 < *first1)
-        {
-            ++first2;
-        }
-        else
-        {
-            result.push_back(*first1);
+    return ret;
+}
 
-            ++first1;
+/**
+ *  The pseudo-random number generator of a thread together with the information how it was seeded.
+ */
+struct ThreadLocalRandomNumberGenerator
+{
+    /**
+     *  The pseudo-random number generator of the thread.
+     */
+    std::mt19937 generator;
+
+    /**
+     *  A boolean flag indicating whether the generator was seeded already.
+     */
+    bool seeded = false;
+
+    /**
+     *  A boolean flag indicating whether the generator was seeded via htd::seedRandomNumberGenerator().
+     */
+    bool explicitlySeeded = false;
+
+    /**
+     *  The number of active instances of htd::RandomNumberGeneratorScope on the thread.
+     */
+    std::size_t scopeDepth = 0;
+};
+
+/**
+ *  Access the pseudo-random number generator of the calling thread without seeding it.
+ *
+ *  @return The pseudo-random number generator of the calling thread.
+ */
+static ThreadLocalRandomNumberGenerator & threadLocalRandomNumberGenerator(void)
+{
+    static thread_local ThreadLocalRandomNumberGenerator ret;
 
-            //Skip common value in set 2.
-            ++first2;
-        }
+    return ret;
+}
+
+/**
+ *  Seed the given pseudo-random number generator with a value obtained from std::rand().
+ *
+ *  @param[in,out] generator    The pseudo-random number generator which shall be seeded.
+ *  @param[in] offset           The value which shall be added to the value obtained from std::rand().
+ */
+static void seedFromStandardRandomNumberGenerator(ThreadLocalRandomNumberGenerator & generator, unsigned int offset)
+{
+    /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
+    // coverity[dont_call]
+    generator.generator.seed(static_cast<unsigned int>(std::rand()) + offset);
+
+    generator.seeded = true;
+}
+
+std::mt19937 & htd::randomNumberGenerator(void)
+{
+    ThreadLocalRandomNumberGenerator & ret = threadLocalRandomNumberGenerator();
+
+    if (!ret.seeded)
+    {
+        /* The state of std::rand() may be private to each thread, so the seeds of threads which are not seeded explicitly are distinguished by the order in which they are initialized. */
+        static std::atomic<unsigned int> initializationCount(0);
+
+        seedFromStandardRandomNumberGenerator(ret, 0x9E3779B9u * initializationCount.fetch_add(1, std::memory_order_relaxed));
     }
+
+    return ret.generator;
 }
 
-std::tuple<std::size_t, std::size_t, std::size_t> htd::analyze_sets(const std::vector<htd::vertex_t> & set1, const std::vector<htd::vertex_t> & set2)
+void htd::seedRandomNumberGenerator(unsigned int seed)
 {
-    auto first1 = set1.begin();
-    auto first2 = set2.begin();
+    ThreadLocalRandomNumberGenerator & generator = threadLocalRandomNumberGenerator();
 
-    auto last1 = set1.end();
-    auto last2 = set2.end();
+    generator.generator.seed(seed);
 
-    std::size_t onlySet1 = 0;
-    std::size_t onlySet2 = 0;
-    std::size_t overlap = 0;
+    generator.seeded = true;
 
-    while (first1 != last1 && first2 != last2)
+    generator.explicitlySeeded = true;
+}
+
+htd::RandomNumberGeneratorScope::RandomNumberGeneratorScope(void)
+{
+    ThreadLocalRandomNumberGenerator & generator = threadLocalRandomNumberGenerator();
+
+    if (generator.scopeDepth == 0 && !generator.explicitlySeeded)
     {
-        if (*first1 < *first2)
-        {
-            onlySet1++;
+        seedFromStandardRandomNumberGenerator(generator, 0);
+    }
 
-            ++first1;
-        }
-        else if (*first2 < *first1)
-        {
-            onlySet2++;
+    ++generator.scopeDepth;
+}
 
-            ++first2;
-        }
-        else
-        {
-            overlap++;
+htd::RandomNumberGeneratorScope::~RandomNumberGeneratorScope()
+{
+    --(threadLocalRandomNumberGenerator().scopeDepth);
+}
 
-            ++first1;
+void htd::print(bool input)
+{
+    print(input, std::cout);
+}
 
-            //Skip common value in set 2.
-            ++first2;
-        }
+void htd::print(bool input, std::ostream & stream)
+{
+    if (input)
+    {
+        stream << "true";
+    }
+    else
+    {
+        stream << "false";
     }
+}
+
+template < >
+void htd::print<std::string>(const std::string & input)
+{
+    print(input, std::cout);
+}
+
+template < >
+void htd::print<std::string>(const std::string & input, std::ostream & stream)
+{
+    stream << "\"" << input << "\"";
+}
+
+void htd::print(const htd::Hyperedge & input)
+{
+    print(input, std::cout);
+}
 
-    onlySet1 += std::distance(first1, last1);
-    onlySet2 += std::distance(first2, last2);
+void htd::print(const htd::Hyperedge & input, std::ostream & stream)
+{
+    stream << "Hyperedge " << input.id() << ": ";
 
-    return std::tuple<std::size_t, std::size_t, std::size_t>(onlySet1, overlap, onlySet2);
+    htd::print(input.elements(), std::cout, false);
 }
 
-void htd::decompose_sets(const std::vector<htd::vertex_t> & set1,
-                         const std::vector<htd::vertex_t> & set2,
-                         std::vector<htd::vertex_t> & resultOnlySet1,
-                         std::vector<htd::vertex_t> & resultOnlySet2,
-                         std::vector<htd::vertex_t> & resultIntersection) HTD_NOEXCEPT
+void htd::set_union(const std::vector<htd::vertex_t> & set1,
+                    const std::vector<htd::vertex_t> & set2,
+                    htd::vertex_t ignoredVertex,
+                    std::vector<htd::vertex_t> & result)
 {
     auto first1 = set1.begin();
     auto first2 = set2.begin();
@@ -271,19 +595,28 @@ void htd::decompose_sets(const std::vector<htd::vertex_t> & set1,
     {
         if (*first1 < *first2)
         {
-            resultOnlySet1.push_back(*first1);
+            if (*first1 != ignoredVertex)
+            {
+                result.push_back(*first1);
+            }
 
             ++first1;
         }
         else if (*first2 < *first1)
         {
-            resultOnlySet2.push_back(*first2);
+            if (*first2 != ignoredVertex)
+            {
+                result.push_back(*first2);
+            }
 
             ++first2;
         }
         else
         {
-            resultIntersection.push_back(*first1);
+            if (*first1 != ignoredVertex)
+            {
+                result.push_back(*first1);
+            }
 
             ++first1;
 
@@ -294,52 +627,69 @@ void htd::decompose_sets(const std::vector<htd::vertex_t> & set1,
 
     if (first1 != last1)
     {
-        resultOnlySet1.insert(resultOnlySet1.end(), first1, last1);
+        if (*first1 <= ignoredVertex)
+        {
+            std::copy_if(first1, last1, std::back_inserter(result), [&](const htd::vertex_t vertex) { return vertex != ignoredVertex; });
+        }
+        else
+        {
+            result.insert(result.end(), first1, last1);
+        }
     }
     else if (first2 != last2)
     {
-        resultOnlySet2.insert(resultOnlySet2.end(), first2, last2);
+        if (*first2 <= ignoredVertex)
+        {
+            std::copy_if(first2, last2, std::back_inserter(result), [&](const htd::vertex_t vertex) { return vertex != ignoredVertex; });
+        }
+        else
+        {
+            result.insert(result.end(), first2, last2);
+        }
     }
 }
 
-std::pair<std::size_t, std::size_t> htd::symmetric_difference_sizes(const std::vector<htd::vertex_t> & set1, const std::vector<htd::vertex_t> & set2)
+void htd::set_difference(const std::vector<htd::vertex_t> & set1,
+                         const std::vector<htd::vertex_t> & set2,
+                         std::vector<htd::vertex_t> & result)
 {
-    auto first1 = set1.begin();
-    auto first2 = set2.begin();
-
-    auto last1 = set1.end();
-    auto last2 = set2.end();
+    decompose(set1.data(), set1.data() + set1.size(), set2.data(), set2.data() + set2.size(), &result, nullptr, nullptr);
+}
 
-    std::size_t onlySet1 = 0;
-    std::size_t onlySet2 = 0;
+void htd::set_intersection(const std::vector<htd::vertex_t> & set1,
+                           const std::vector<htd::vertex_t> & set2,
+                           std::vector<htd::vertex_t> & result)
+{
+    decompose(set1.data(), set1.data() + set1.size(), set2.data(), set2.data() + set2.size(), nullptr, nullptr, &result);
+}
 
-    while (first1 != last1 && first2 != last2)
-    {
-        if (*first1 < *first2)
-        {
-            onlySet1++;
+std::tuple<std::size_t, std::size_t, std::size_t> htd::analyze_sets(const std::vector<htd::vertex_t> & set1, const std::vector<htd::vertex_t> & set2)
+{
+    std::size_t overlap = intersectionSize(set1.data(), set1.data() + set1.size(), set2.data(), set2.data() + set2.size());
 
-            ++first1;
-        }
-        else if (*first2 < *first1)
-        {
-            onlySet2++;
+    return std::tuple<std::size_t, std::size_t, std::size_t>(set1.size() - overlap, overlap, set2.size() - overlap);
+}
 
-            ++first2;
-        }
-        else
-        {
-            ++first1;
+void htd::decompose_sets(const std::vector<htd::vertex_t> & set1,
+                         const std::vector<htd::vertex_t> & set2,
+                         std::vector<htd::vertex_t> & resultOnlySet1,
+                         std::vector<htd::vertex_t> & resultOnlySet2,
+                         std::vector<htd::vertex_t> & resultIntersection) HTD_NOEXCEPT
+{
+    decompose(set1.data(), set1.data() + set1.size(), set2.data(), set2.data() + set2.size(), &resultOnlySet1, &resultOnlySet2, &resultIntersection);
+}
 
-            //Skip common value in set 2.
-            ++first2;
-        }
-    }
+std::pair<std::size_t, std::size_t> htd::symmetric_difference_sizes(const std::vector<htd::vertex_t> & set1, const std::vector<htd::vertex_t> & set2)
+{
+    std::size_t overlap = intersectionSize(set1.data(), set1.data() + set1.size(), set2.data(), set2.data() + set2.size());
 
-    onlySet1 += std::distance(first1, last1);
-    onlySet2 += std::distance(first2, last2);
+    return std::pair<std::size_t, std::size_t>(set1.size() - overlap, set2.size() - overlap);
+}
 
-    return std::pair<std::size_t, std::size_t>(onlySet1, onlySet2);
+std::size_t htd::set_intersection_size(const htd::vertex_t * first1, const htd::vertex_t * last1,
+                                       const htd::vertex_t * first2, const htd::vertex_t * last2)
+{
+    return intersectionSize(first1, last1, first2, last2);
 }
 
 std::vector<htd::vertex_t> * htd::computeJoinVertices(const htd::ITreeDecomposition & decomposition, htd::vertex_t vertex)
@@ -29,7 +29,7 @@
 #include <htd/Helpers.hpp>
 #include <htd/HypertreeDecomposition.hpp>
 #include <htd/TreeDecomposition.hpp>
-#include <htd/PostOrderTreeTraversal.hpp>
+#include <htd/TreeTraversal.hpp>
 
 #include <algorithm>
 #include <stdexcept>
@@ -92,9 +92,7 @@ void htd::HypertreeDecomposition::removeSubtree(htd::vertex_t subtreeRoot)
 {
     HTD_ASSERT(isVertex(subtreeRoot))
 
-    htd::PostOrderTreeTraversal treeTraversal;
-
-    treeTraversal.traverse(*this, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToSubtreeRoot)
+    htd::TreeTraversal::postOrder(*this, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToSubtreeRoot)
     {
         HTD_UNUSED(parent)
         HTD_UNUSED(distanceToSubtreeRoot)
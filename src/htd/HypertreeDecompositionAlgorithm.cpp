@@ -29,16 +29,19 @@
 #include <htd/Helpers.hpp>
 
 #include <htd/HypertreeDecompositionAlgorithm.hpp>
+#include <htd/ScopedTimer.hpp>
 #include <htd/TreeDecompositionAlgorithmFactory.hpp>
 #include <htd/IMutableHypertreeDecomposition.hpp>
 #include <htd/HypertreeDecompositionFactory.hpp>
 #include <htd/SetCoverAlgorithmFactory.hpp>
-#include <htd/PostOrderTreeTraversal.hpp>
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
 
+#include <algorithm>
 #include <cstdarg>
 #include <stdexcept>
+#include <thread>
+#include <typeinfo>
 #include <unordered_set>
 #include <vector>
 
@@ -52,7 +55,7 @@ struct htd::HypertreeDecompositionAlgorithm::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), labelingFunctions_(), postProcessingOperations_(), computeInducedEdges_(true)
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), labelingFunctions_(), postProcessingOperations_(), computeInducedEdges_(true), threadCount_(1)
     {
 
     }
@@ -90,6 +93,11 @@ struct htd::HypertreeDecompositionAlgorithm::Implementation
      */
     bool computeInducedEdges_;
 
+    /**
+     *  The number of threads which are used to compute the covering edges of the bags.
+     */
+    std::size_t threadCount_;
+
     /**
      *  Set the hyperedges covering the bags of the hypertree decomposition.
      *
@@ -180,11 +188,15 @@ htd::IHypertreeDecomposition * htd::HypertreeDecompositionAlgorithm::computeDeco
 
     for (const auto & operation : implementation_->postProcessingOperations_)
     {
+        htd::ScopedTimer timer(implementation_->managementInstance_, typeid(*operation), "manipulation");
+
         operation->apply(graph, *ret);
     }
 
     for (const auto & operation : postProcessingOperations)
     {
+        htd::ScopedTimer timer(implementation_->managementInstance_, typeid(*operation), "manipulation");
+
         operation->apply(graph, *ret);
     }
 
@@ -337,6 +349,18 @@ void htd::HypertreeDecompositionAlgorithm::setComputeInducedEdgesEnabled(bool co
     implementation_->computeInducedEdges_ = computeInducedEdgesEnabled;
 }
 
+std::size_t htd::HypertreeDecompositionAlgorithm::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::HypertreeDecompositionAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    HTD_ASSERT(threadCount > 0)
+
+    implementation_->threadCount_ = threadCount;
+}
+
 const htd::LibraryInstance * htd::HypertreeDecompositionAlgorithm::managementInstance(void) const HTD_NOEXCEPT
 {
     return implementation_->managementInstance_;
@@ -371,6 +395,8 @@ htd::HypertreeDecompositionAlgorithm * htd::HypertreeDecompositionAlgorithm::clo
 #endif
     }
 
+    ret->setThreadCount(implementation_->threadCount_);
+
     ret->setManagementInstance(managementInstance());
 
     return ret;
@@ -380,106 +406,156 @@ void htd::HypertreeDecompositionAlgorithm::Implementation::setCoveringEdges(cons
 {
     std::vector<htd::Hyperedge> relevantHyperedges;
 
-    std::vector<htd::Hyperedge> newRelevantHyperedges;
-
     std::vector<std::vector<htd::id_t>> relevantContainers;
 
-    std::vector<std::vector<htd::id_t>> newRelevantContainers;
+    std::size_t vertexBound = 0;
 
-    const htd::ConstCollection<htd::Hyperedge> & hyperedges = graph.hyperedges();
+    for (htd::vertex_t vertex : graph.vertices())
+    {
+        vertexBound = std::max(vertexBound, static_cast<std::size_t>(vertex) + 1);
+    }
 
-    std::size_t edgeCount = graph.edgeCount();
+    std::vector<htd::Hyperedge> hyperedges(graph.hyperedges().begin(), graph.hyperedges().end());
 
-    auto it1 = hyperedges.begin();
+    std::vector<std::vector<htd::index_t>> incidentHyperedges(vertexBound);
 
-    for (htd::index_t index1 = 0; index1 < edgeCount; ++index1)
+    for (htd::index_t index = 0; index < hyperedges.size(); ++index)
     {
-        const std::vector<htd::vertex_t> & elements1 = it1->sortedElements();
-
-        bool maximal = true;
+        for (htd::vertex_t vertex : hyperedges[index].sortedElements())
+        {
+            incidentHyperedges[vertex].push_back(index);
+        }
+    }
 
-        auto it2 = it1;
+    /* A hyperedge is relevant if it is not included in a hyperedge occurring later. Such hyperedges contain all vertices of the hyperedge, in particular its rarest one. */
+    for (htd::index_t index1 = 0; index1 < hyperedges.size(); ++index1)
+    {
+        const std::vector<htd::vertex_t> & elements1 = hyperedges[index1].sortedElements();
 
-        ++it2;
+        bool maximal = true;
 
-        for (htd::index_t index2 = index1 + 1; index2 < edgeCount; ++index2)
+        if (elements1.empty())
+        {
+            maximal = index1 + 1 == hyperedges.size();
+        }
+        else
         {
-            const std::vector<htd::vertex_t> & elements2 = it2->sortedElements();
+            htd::vertex_t rarestVertex = elements1[0];
 
-            if (std::includes(elements2.begin(), elements2.end(), elements1.begin(), elements1.end()))
+            for (htd::vertex_t vertex : elements1)
             {
-                maximal = false;
+                if (incidentHyperedges[vertex].size() < incidentHyperedges[rarestVertex].size())
+                {
+                    rarestVertex = vertex;
+                }
             }
 
-            ++it2;
+            const std::vector<htd::index_t> & candidates = incidentHyperedges[rarestVertex];
+
+            for (auto it = std::upper_bound(candidates.begin(), candidates.end(), index1); maximal && it != candidates.end(); ++it)
+            {
+                const std::vector<htd::vertex_t> & elements2 = hyperedges[*it].sortedElements();
+
+                maximal = !std::includes(elements2.begin(), elements2.end(), elements1.begin(), elements1.end());
+            }
         }
 
         if (maximal)
         {
-            relevantHyperedges.push_back(*it1);
+            relevantHyperedges.push_back(hyperedges[index1]);
 
             relevantContainers.push_back(elements1);
         }
+    }
 
-        ++it1;
+    std::vector<std::vector<htd::index_t>> relevantIncidentHyperedges(vertexBound);
+
+    for (htd::index_t index = 0; index < relevantContainers.size(); ++index)
+    {
+        for (htd::vertex_t vertex : relevantContainers[index])
+        {
+            relevantIncidentHyperedges[vertex].push_back(index);
+        }
     }
 
-    htd::ISetCoverAlgorithm * setCoverAlgorithm = managementInstance_->setCoverAlgorithmFactory().createInstance();
+    std::vector<htd::vertex_t> nodes(decomposition.vertices().begin(), decomposition.vertices().end());
 
-    htd::PostOrderTreeTraversal traversal;
+    std::vector<std::vector<htd::index_t>> selectedIndices(nodes.size());
 
-    std::vector<htd::vertex_t> forgottenVertices;
+    std::size_t workerCount = std::max(static_cast<std::size_t>(1), std::min(threadCount_, nodes.size()));
 
-    traversal.traverse(decomposition, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t depth)
+    /* Each bag is only confronted with the relevant hyperedges incident to its vertices, all other hyperedges cannot contribute to its cover. */
+    auto computeCovers = [&](std::size_t workerIndex)
     {
-        HTD_UNUSED(depth)
+        htd::ISetCoverAlgorithm * setCoverAlgorithm = managementInstance_->setCoverAlgorithmFactory().createInstance();
 
-        std::vector<htd::index_t> selectedIndices;
+        std::vector<htd::index_t> candidates;
 
-        setCoverAlgorithm->computeSetCover(decomposition.bagContent(vertex), relevantContainers, selectedIndices);
+        std::vector<std::vector<htd::id_t>> containers;
 
-        std::vector<htd::Hyperedge> selectedHyperedges;
-
-        for (htd::index_t selectedHyperedgeIndex : selectedIndices)
+        for (std::size_t index = workerIndex; index < nodes.size() && !managementInstance_->isTerminated(); index += workerCount)
         {
-            selectedHyperedges.push_back(relevantHyperedges.at(selectedHyperedgeIndex));
-        }
+            const std::vector<htd::vertex_t> & bag = decomposition.bagContent(nodes[index]);
 
-        decomposition.setCoveringEdges(vertex, selectedHyperedges);
+            candidates.clear();
 
-        if (parent != htd::Vertex::UNKNOWN)
-        {
-            std::size_t forgottenVertexCount = forgottenVertices.size();
+            for (htd::vertex_t vertex : bag)
+            {
+                if (vertex < vertexBound)
+                {
+                    candidates.insert(candidates.end(), relevantIncidentHyperedges[vertex].begin(), relevantIncidentHyperedges[vertex].end());
+                }
+            }
 
-            decomposition.copyForgottenVerticesTo(parent, forgottenVertices, vertex);
+            std::sort(candidates.begin(), candidates.end());
 
-            std::inplace_merge(forgottenVertices.begin(), forgottenVertices.begin() + forgottenVertexCount, forgottenVertices.end());
+            candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
 
-            if (forgottenVertices.size() > 0)
-            {
-                htd::index_t index = 0;
+            containers.clear();
 
-                for (std::vector<htd::id_t> & container : relevantContainers)
-                {
-                    if (!std::includes(forgottenVertices.begin(), forgottenVertices.end(), container.begin(), container.end()))
-                    {
-                        newRelevantContainers.push_back(std::move(container));
-                        newRelevantHyperedges.push_back(std::move(relevantHyperedges.at(index)));
-                    }
+            for (htd::index_t candidate : candidates)
+            {
+                containers.push_back(relevantContainers[candidate]);
+            }
 
-                    ++index;
-                }
+            std::vector<htd::index_t> & selection = selectedIndices[index];
 
-                relevantContainers.swap(newRelevantContainers);
-                relevantHyperedges.swap(newRelevantHyperedges);
+            setCoverAlgorithm->computeSetCover(bag, containers, selection);
 
-                newRelevantContainers.clear();
-                newRelevantHyperedges.clear();
+            for (htd::index_t & selectedIndex : selection)
+            {
+                selectedIndex = candidates[selectedIndex];
             }
         }
-    });
 
-    delete setCoverAlgorithm;
+        delete setCoverAlgorithm;
+    };
+
+    std::vector<std::thread> threads;
+
+    for (std::size_t workerIndex = 1; workerIndex < workerCount; ++workerIndex)
+    {
+        threads.emplace_back(computeCovers, workerIndex);
+    }
+
+    computeCovers(0);
+
+    for (std::thread & thread : threads)
+    {
+        thread.join();
+    }
+
+    for (htd::index_t index = 0; index < nodes.size(); ++index)
+    {
+        std::vector<htd::Hyperedge> selectedHyperedges;
+
+        for (htd::index_t selectedHyperedgeIndex : selectedIndices[index])
+        {
+            selectedHyperedges.push_back(relevantHyperedges.at(selectedHyperedgeIndex));
+        }
+
+        decomposition.setCoveringEdges(nodes[index], selectedHyperedges);
+    }
 }
 
 #endif /* HTD_HTD_HYPERTREEDECOMPOSITIONALGORITHM_CPP */
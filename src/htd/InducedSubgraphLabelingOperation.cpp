@@ -28,10 +28,13 @@
 #include <htd/Globals.hpp>
 #include <htd/Helpers.hpp>
 #include <htd/InducedSubgraphLabelingOperation.hpp>
-#include <htd/PostOrderTreeTraversal.hpp>
+#include <htd/TreeTraversal.hpp>
 
 #include <algorithm>
+#include <functional>
+#include <iterator>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 /**
@@ -58,152 +61,216 @@ struct htd::InducedSubgraphLabelingOperation::Implementation
      *  The management instance to which the current object instance belongs.
      */
     const htd::LibraryInstance * managementInstance_;
-};
-
-htd::InducedSubgraphLabelingOperation::InducedSubgraphLabelingOperation(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
-{
-
-}
 
-htd::InducedSubgraphLabelingOperation::~InducedSubgraphLabelingOperation()
-{
+    /**
+     *  Compute the induced subgraph of each bag of the given decomposition.
+     *
+     *  The label of a node consists of the labels of its children, restricted to the hyperedges which are not
+     *  affected by forgotten vertices, and the hyperedges incident to the vertices introduced with respect to
+     *  the child with the fewest introduced vertices. Hence, each node only touches the hyperedges of its
+     *  children and the hyperedges incident to its introduced vertices instead of all hyperedges of the graph.
+     *
+     *  @note The root node additionally receives all hyperedges which are not contained in any bag.
+     *
+     *  @param[in] graph            The graph which is decomposed by the given decomposition.
+     *  @param[in] decomposition    The decomposition.
+     *  @param[in] labelFunction    The function which is called for each node in post-order together with its induced hyperedges, ordered as in the graph.
+     */
+    void computeInducedHyperedges(const htd::IMultiHypergraph & graph, const htd::ITreeDecomposition & decomposition, const std::function<void(htd::vertex_t, std::vector<htd::Hyperedge> &&)> & labelFunction) const
+    {
+        std::vector<htd::Hyperedge> hyperedges;
 
-}
+        std::vector<htd::index_t> emptyHyperedges;
 
-void htd::InducedSubgraphLabelingOperation::apply(const htd::IMultiHypergraph & graph, htd::IMutablePathDecomposition & decomposition) const
-{
-    apply(graph, decomposition, std::vector<htd::ILabelingFunction *>());
-}
+        std::vector<std::vector<htd::index_t>> incidentHyperedges;
 
-void htd::InducedSubgraphLabelingOperation::apply(const htd::IMultiHypergraph & graph, htd::IMutablePathDecomposition & decomposition, const std::vector<htd::vertex_t> & relevantVertices, std::vector<htd::vertex_t> & createdVertices, std::vector<htd::vertex_t> & removedVertices) const
-{
-    apply(graph, decomposition, relevantVertices, std::vector<htd::ILabelingFunction *>(), createdVertices, removedVertices);
-}
-
-void htd::InducedSubgraphLabelingOperation::apply(const htd::IMultiHypergraph & graph, htd::IMutablePathDecomposition & decomposition, const std::vector<htd::ILabelingFunction *> & labelingFunctions) const
-{
-    HTD_UNUSED(labelingFunctions)
+        for (const htd::Hyperedge & hyperedge : graph.hyperedges())
+        {
+            htd::index_t index = hyperedges.size();
 
-    htd::index_t index = 0;
+            hyperedges.push_back(hyperedge);
 
-    std::unordered_map<htd::id_t, htd::index_t> hyperedgeIndices;
+            const std::vector<htd::vertex_t> & elements = hyperedge.sortedElements();
 
-    std::vector<htd::Hyperedge> hyperedges;
+            if (elements.empty())
+            {
+                emptyHyperedges.push_back(index);
+            }
+            else if (elements.back() >= incidentHyperedges.size())
+            {
+                incidentHyperedges.resize(elements.back() + 1);
+            }
 
-    for (const htd::Hyperedge & hyperedge : graph.hyperedges())
-    {
-        hyperedgeIndices[hyperedge.id()] = index;
+            for (htd::vertex_t vertex : elements)
+            {
+                incidentHyperedges[vertex].push_back(index);
+            }
+        }
 
-        hyperedges.push_back(hyperedge);
+        std::size_t currentStamp = 0;
 
-        ++index;
-    }
+        std::vector<std::size_t> vertexStamp(incidentHyperedges.size(), 0);
 
-    std::vector<htd::state_t> hyperedgeState(hyperedges.size(), 1);
-    std::vector<htd::state_t> childHyperedgeState(hyperedges.size(), 1);
+        std::vector<std::size_t> hyperedgeStamp(hyperedges.size(), 0);
 
-    htd::PostOrderTreeTraversal treeTraversal;
+        std::vector<bool> covered(hyperedges.size(), false);
 
-    treeTraversal.traverse(decomposition, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToSubtreeRoot)
-    {
-        HTD_UNUSED(parent)
-        HTD_UNUSED(distanceToSubtreeRoot)
+        std::unordered_map<htd::vertex_t, std::vector<htd::index_t>> pendingLabels;
 
-        std::vector<htd::Hyperedge> label;
+        std::vector<htd::vertex_t> introducedVertices;
 
-        const std::vector<htd::vertex_t> & bag = decomposition.bagContent(vertex);
+        htd::TreeTraversal::postOrder(decomposition, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToSubtreeRoot)
+        {
+            HTD_UNUSED(parent)
+            HTD_UNUSED(distanceToSubtreeRoot)
 
-        bool edgeIntroductionCheckNeeded = false;
+            ++currentStamp;
 
-        std::fill(childHyperedgeState.begin(), childHyperedgeState.end(), 1);
+            const std::vector<htd::vertex_t> & bag = decomposition.bagContent(vertex);
 
-        if (decomposition.childCount(vertex) > 0)
-        {
-            for (htd::vertex_t child : decomposition.children(vertex))
+            for (htd::vertex_t bagVertex : bag)
             {
-                std::vector<htd::vertex_t> forgottenVertices;
+                if (bagVertex < vertexStamp.size())
+                {
+                    vertexStamp[bagVertex] = currentStamp;
+                }
+            }
 
-                decomposition.copyForgottenVerticesTo(vertex, forgottenVertices, child);
+            std::vector<htd::index_t> label;
 
-                for (const htd::Hyperedge & hyperedge : htd::accessLabel<std::vector<htd::Hyperedge>>(decomposition.vertexLabel(htd::InducedSubgraphLabelingOperation::INDUCED_SUBGRAPH_LABEL_IDENTIFIER, child)))
+            auto consider = [&](htd::index_t index)
+            {
+                if (hyperedgeStamp[index] != currentStamp)
                 {
-                    index = hyperedgeIndices[hyperedge.id()];
+                    hyperedgeStamp[index] = currentStamp;
+
+                    const std::vector<htd::vertex_t> & elements = hyperedges[index].sortedElements();
 
-                    if (childHyperedgeState[index] == 1)
+                    if (std::all_of(elements.begin(), elements.end(), [&](htd::vertex_t element) { return vertexStamp[element] == currentStamp; }))
                     {
-                        if (forgottenVertices.size() > 0 && htd::has_non_empty_set_intersection(hyperedges[index].sortedElements().begin(), hyperedges[index].sortedElements().end(), forgottenVertices.begin(), forgottenVertices.end()))
-                        {
-                            hyperedgeState[index] = 3;
-
-                            childHyperedgeState[index] = 3;
-                        }
-                        else
-                        {
-                            childHyperedgeState[index] = 2;
-                        }
+                        label.push_back(index);
                     }
                 }
+            };
 
-                edgeIntroductionCheckNeeded = edgeIntroductionCheckNeeded || decomposition.introducedVertexCount(vertex, child) > 0;
-            }
-        }
-        else
-        {
-            edgeIntroductionCheckNeeded = true;
-        }
+            const std::vector<htd::vertex_t> * introducedVertexSource = &bag;
 
-        if (!decomposition.isRoot(vertex))
-        {
-            index = 0;
+            introducedVertices.clear();
 
-            for (const htd::Hyperedge & hyperedge : hyperedges)
+            if (decomposition.childCount(vertex) > 0)
             {
-                if (hyperedgeState[index] == 1)
+                std::size_t minimumIntroducedVertexCount = bag.size() + 1;
+
+                for (htd::vertex_t child : decomposition.children(vertex))
                 {
-                    if (childHyperedgeState[index] == 2)
+                    const std::vector<htd::vertex_t> & childBag = decomposition.bagContent(child);
+
+                    std::size_t introducedVertexCount = htd::set_difference_size(bag.begin(), bag.end(), childBag.begin(), childBag.end());
+
+                    if (introducedVertexCount < minimumIntroducedVertexCount)
                     {
-                        label.push_back(hyperedge);
+                        minimumIntroducedVertexCount = introducedVertexCount;
+
+                        introducedVertices.clear();
+
+                        std::set_difference(bag.begin(), bag.end(), childBag.begin(), childBag.end(), std::back_inserter(introducedVertices));
                     }
-                    else if (edgeIntroductionCheckNeeded && std::includes(bag.begin(), bag.end(), hyperedge.sortedElements().begin(), hyperedge.sortedElements().end()))
-                    {
-                        label.push_back(hyperedge);
 
-                        hyperedgeState[index] = 2;
+                    std::vector<htd::index_t> & childLabel = pendingLabels[child];
+
+                    for (htd::index_t index : childLabel)
+                    {
+                        consider(index);
                     }
+
+                    pendingLabels.erase(child);
                 }
-                else if (hyperedgeState[index] == 2)
+
+                introducedVertexSource = &introducedVertices;
+            }
+            else
+            {
+                for (htd::index_t index : emptyHyperedges)
                 {
-                    if (childHyperedgeState[index] == 2)
-                    {
-                        label.push_back(hyperedge);
-                    }
-                    else if (edgeIntroductionCheckNeeded && std::includes(bag.begin(), bag.end(), hyperedge.sortedElements().begin(), hyperedge.sortedElements().end()))
+                    consider(index);
+                }
+            }
+
+            for (htd::vertex_t introducedVertex : *introducedVertexSource)
+            {
+                if (introducedVertex < incidentHyperedges.size())
+                {
+                    for (htd::index_t index : incidentHyperedges[introducedVertex])
                     {
-                        label.push_back(hyperedge);
+                        consider(index);
                     }
                 }
+            }
 
-                ++index;
+            for (htd::index_t index : label)
+            {
+                covered[index] = true;
             }
-        }
-        else
-        {
-            index = 0;
 
-            for (const htd::Hyperedge & hyperedge : hyperedges)
+            if (decomposition.isRoot(vertex))
             {
-                if (hyperedgeState[index] < 3)
+                for (htd::index_t index = 0; index < hyperedges.size(); ++index)
                 {
-                    label.push_back(hyperedge);
+                    if (!covered[index])
+                    {
+                        label.push_back(index);
+                    }
                 }
+            }
+
+            std::sort(label.begin(), label.end());
+
+            std::vector<htd::Hyperedge> inducedHyperedges;
 
-                hyperedgeState[index] = 3;
+            inducedHyperedges.reserve(label.size());
 
-                ++index;
+            for (htd::index_t index : label)
+            {
+                inducedHyperedges.push_back(hyperedges[index]);
             }
-        }
 
-        decomposition.setVertexLabel(htd::InducedSubgraphLabelingOperation::INDUCED_SUBGRAPH_LABEL_IDENTIFIER, vertex, new htd::Label<std::vector<htd::Hyperedge>>(label));
+            if (!decomposition.isRoot(vertex))
+            {
+                pendingLabels[vertex] = std::move(label);
+            }
+
+            labelFunction(vertex, std::move(inducedHyperedges));
+        });
+    }
+};
+
+htd::InducedSubgraphLabelingOperation::InducedSubgraphLabelingOperation(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd::InducedSubgraphLabelingOperation::~InducedSubgraphLabelingOperation()
+{
+
+}
+
+void htd::InducedSubgraphLabelingOperation::apply(const htd::IMultiHypergraph & graph, htd::IMutablePathDecomposition & decomposition) const
+{
+    apply(graph, decomposition, std::vector<htd::ILabelingFunction *>());
+}
+
+void htd::InducedSubgraphLabelingOperation::apply(const htd::IMultiHypergraph & graph, htd::IMutablePathDecomposition & decomposition, const std::vector<htd::vertex_t> & relevantVertices, std::vector<htd::vertex_t> & createdVertices, std::vector<htd::vertex_t> & removedVertices) const
+{
+    apply(graph, decomposition, relevantVertices, std::vector<htd::ILabelingFunction *>(), createdVertices, removedVertices);
+}
+
+void htd::InducedSubgraphLabelingOperation::apply(const htd::IMultiHypergraph & graph, htd::IMutablePathDecomposition & decomposition, const std::vector<htd::ILabelingFunction *> & labelingFunctions) const
+{
+    HTD_UNUSED(labelingFunctions)
+
+    implementation_->computeInducedHyperedges(graph, decomposition, [&](htd::vertex_t vertex, std::vector<htd::Hyperedge> && label)
+    {
+        decomposition.setVertexLabel(htd::InducedSubgraphLabelingOperation::INDUCED_SUBGRAPH_LABEL_IDENTIFIER, vertex, new htd::Label<std::vector<htd::Hyperedge>>(std::move(label)));
     });
 }
 
@@ -230,126 +297,9 @@ void htd::InducedSubgraphLabelingOperation::apply(const htd::IMultiHypergraph &
 {
     HTD_UNUSED(labelingFunctions)
 
-    htd::index_t index = 0;
-
-    std::unordered_map<htd::id_t, htd::index_t> hyperedgeIndices;
-
-    std::vector<htd::Hyperedge> hyperedges;
-
-    for (const htd::Hyperedge & hyperedge : graph.hyperedges())
+    implementation_->computeInducedHyperedges(graph, decomposition, [&](htd::vertex_t vertex, std::vector<htd::Hyperedge> && label)
     {
-        hyperedgeIndices[hyperedge.id()] = index;
-
-        hyperedges.push_back(hyperedge);
-
-        ++index;
-    }
-
-    std::vector<htd::state_t> hyperedgeState(hyperedges.size(), 1);
-    std::vector<htd::state_t> childHyperedgeState(hyperedges.size(), 1);
-
-    htd::PostOrderTreeTraversal treeTraversal;
-
-    treeTraversal.traverse(decomposition, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToSubtreeRoot)
-    {
-        HTD_UNUSED(parent)
-        HTD_UNUSED(distanceToSubtreeRoot)
-
-        std::vector<htd::Hyperedge> label;
-
-        const std::vector<htd::vertex_t> & bag = decomposition.bagContent(vertex);
-
-        bool edgeIntroductionCheckNeeded = false;
-
-        std::fill(childHyperedgeState.begin(), childHyperedgeState.end(), 1);
-
-        if (decomposition.childCount(vertex) > 0)
-        {
-            for (htd::vertex_t child : decomposition.children(vertex))
-            {
-                std::vector<htd::vertex_t> forgottenVertices;
-
-                decomposition.copyForgottenVerticesTo(vertex, forgottenVertices, child);
-
-                for (const htd::Hyperedge & hyperedge : htd::accessLabel<std::vector<htd::Hyperedge>>(decomposition.vertexLabel(htd::InducedSubgraphLabelingOperation::INDUCED_SUBGRAPH_LABEL_IDENTIFIER, child)))
-                {
-                    index = hyperedgeIndices[hyperedge.id()];
-
-                    if (childHyperedgeState[index] == 1)
-                    {
-                        if (forgottenVertices.size() > 0 && htd::has_non_empty_set_intersection(hyperedges[index].sortedElements().begin(), hyperedges[index].sortedElements().end(), forgottenVertices.begin(), forgottenVertices.end()))
-                        {
-                            hyperedgeState[index] = 3;
-
-                            childHyperedgeState[index] = 3;
-                        }
-                        else
-                        {
-                            childHyperedgeState[index] = 2;
-                        }
-                    }
-                }
-
-                edgeIntroductionCheckNeeded = edgeIntroductionCheckNeeded || decomposition.introducedVertexCount(vertex, child) > 0;
-            }
-        }
-        else
-        {
-            edgeIntroductionCheckNeeded = true;
-        }
-
-        if (!decomposition.isRoot(vertex))
-        {
-            index = 0;
-
-            for (const htd::Hyperedge & hyperedge : hyperedges)
-            {
-                if (hyperedgeState[index] == 1)
-                {
-                    if (childHyperedgeState[index] == 2)
-                    {
-                        label.push_back(hyperedge);
-                    }
-                    else if (edgeIntroductionCheckNeeded && std::includes(bag.begin(), bag.end(), hyperedge.sortedElements().begin(), hyperedge.sortedElements().end()))
-                    {
-                        label.push_back(hyperedge);
-
-                        hyperedgeState[index] = 2;
-                    }
-                }
-                else if (hyperedgeState[index] == 2)
-                {
-                    if (childHyperedgeState[index] == 2)
-                    {
-                        label.push_back(hyperedge);
-                    }
-                    else if (edgeIntroductionCheckNeeded && std::includes(bag.begin(), bag.end(), hyperedge.sortedElements().begin(), hyperedge.sortedElements().end()))
-                    {
-                        label.push_back(hyperedge);
-                    }
-                }
-
-                ++index;
-            }
-        }
-        else
-        {
-            index = 0;
-
-            for (const htd::Hyperedge & hyperedge : hyperedges)
-            {
-                if (hyperedgeState[index] < 3)
-                {
-                    label.push_back(hyperedge);
-                }
-
-                hyperedgeState[index] = 3;
-
-                ++index;
-            }
-        }
-
-        decomposition.setVertexLabel(htd::InducedSubgraphLabelingOperation::INDUCED_SUBGRAPH_LABEL_IDENTIFIER, vertex, new htd::Label<std::vector<htd::Hyperedge>>(label));
+        decomposition.setVertexLabel(htd::InducedSubgraphLabelingOperation::INDUCED_SUBGRAPH_LABEL_IDENTIFIER, vertex, new htd::Label<std::vector<htd::Hyperedge>>(std::move(label)));
     });
 }
 
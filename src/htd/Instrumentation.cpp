@@ -0,0 +1,420 @@
+/* 
+ * File:   Instrumentation.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_INSTRUMENTATION_CPP
+#define HTD_HTD_INSTRUMENTATION_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/Instrumentation.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+/**
+ *  Private implementation details of class htd::Instrumentation.
+ */
+struct htd::Instrumentation::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     */
+    Implementation(void) : epoch_(std::chrono::steady_clock::now()), mutex_(), events_(), counters_(), threadIndices_(), threadCount_(0)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  The point in time at which the instrumentation object was created.
+     */
+    std::chrono::steady_clock::time_point epoch_;
+
+    /**
+     *  The mutex guarding the recorded data.
+     */
+    std::mutex mutex_;
+
+    /**
+     *  The recorded events.
+     */
+    std::vector<htd::Instrumentation::Event> events_;
+
+    /**
+     *  The counters, sorted by name.
+     */
+    std::map<std::string, std::size_t> counters_;
+
+    /**
+     *  The index assigned to each thread which recorded an event.
+     */
+    std::unordered_map<std::thread::id, std::size_t> threadIndices_;
+
+    /**
+     *  The number of thread indices which are in use.
+     */
+    std::size_t threadCount_;
+
+    /**
+     *  Convert the given duration to microseconds.
+     *
+     *  @param[in] duration The duration.
+     *
+     *  @return The given duration in microseconds.
+     */
+    static double microseconds(std::chrono::steady_clock::duration duration)
+    {
+        return std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(duration).count();
+    }
+
+    /**
+     *  Write the given string as JSON string literal.
+     *
+     *  @param[in] stream   The output stream.
+     *  @param[in] value    The string which shall be written.
+     */
+    static void writeJsonString(std::ostream & stream, const std::string & value)
+    {
+        stream << '"';
+
+        for (char character : value)
+        {
+            if (character == '"' || character == '\\')
+            {
+                stream << '\\' << character;
+            }
+            else if (static_cast<unsigned char>(character) < 0x20)
+            {
+                stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(character) << std::dec << std::setfill(' ');
+            }
+            else
+            {
+                stream << character;
+            }
+        }
+
+        stream << '"';
+    }
+
+    /**
+     *  Write the given string as CSV field, quoting it if necessary.
+     *
+     *  @param[in] stream   The output stream.
+     *  @param[in] value    The string which shall be written.
+     */
+    static void writeCsvField(std::ostream & stream, const std::string & value)
+    {
+        if (value.find_first_of(",\"\r\n") != std::string::npos)
+        {
+            stream << '"';
+
+            for (char character : value)
+            {
+                if (character == '"')
+                {
+                    stream << '"';
+                }
+
+                stream << character;
+            }
+
+            stream << '"';
+        }
+        else
+        {
+            stream << value;
+        }
+    }
+};
+
+htd::Instrumentation::Instrumentation(void) : implementation_(new Implementation())
+{
+
+}
+
+htd::Instrumentation::~Instrumentation()
+{
+
+}
+
+void htd::Instrumentation::recordEvent(const std::string & name, const std::string & category, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end) const
+{
+    std::lock_guard<std::mutex> lock(implementation_->mutex_);
+
+    auto position = implementation_->threadIndices_.find(std::this_thread::get_id());
+
+    if (position == implementation_->threadIndices_.end())
+    {
+        position = implementation_->threadIndices_.emplace(std::this_thread::get_id(), implementation_->threadCount_).first;
+
+        ++(implementation_->threadCount_);
+    }
+
+    htd::Instrumentation::Event event;
+
+    event.name = name;
+    event.category = category;
+    event.thread = position->second;
+    event.start = Implementation::microseconds(start - implementation_->epoch_);
+    event.duration = Implementation::microseconds(end - start);
+
+    implementation_->events_.push_back(std::move(event));
+}
+
+void htd::Instrumentation::addCounter(const std::string & name, std::size_t value) const
+{
+    std::lock_guard<std::mutex> lock(implementation_->mutex_);
+
+    implementation_->counters_[name] += value;
+}
+
+std::vector<htd::Instrumentation::Event> htd::Instrumentation::events(void) const
+{
+    std::lock_guard<std::mutex> lock(implementation_->mutex_);
+
+    return implementation_->events_;
+}
+
+std::vector<std::pair<std::string, std::size_t>> htd::Instrumentation::counters(void) const
+{
+    std::lock_guard<std::mutex> lock(implementation_->mutex_);
+
+    return std::vector<std::pair<std::string, std::size_t>>(implementation_->counters_.begin(), implementation_->counters_.end());
+}
+
+std::size_t htd::Instrumentation::counter(const std::string & name) const
+{
+    std::lock_guard<std::mutex> lock(implementation_->mutex_);
+
+    auto position = implementation_->counters_.find(name);
+
+    return position != implementation_->counters_.end() ? position->second : 0;
+}
+
+void htd::Instrumentation::merge(const htd::Instrumentation & other)
+{
+    HTD_ASSERT(&other != this)
+
+    std::vector<htd::Instrumentation::Event> otherEvents = other.events();
+
+    std::vector<std::pair<std::string, std::size_t>> otherCounters = other.counters();
+
+    std::size_t otherThreadCount = 0;
+
+    {
+        std::lock_guard<std::mutex> otherLock(other.implementation_->mutex_);
+
+        otherThreadCount = other.implementation_->threadCount_;
+    }
+
+    std::lock_guard<std::mutex> lock(implementation_->mutex_);
+
+    double offset = Implementation::microseconds(other.implementation_->epoch_ - implementation_->epoch_);
+
+    for (htd::Instrumentation::Event & event : otherEvents)
+    {
+        event.start += offset;
+        event.thread += implementation_->threadCount_;
+
+        implementation_->events_.push_back(std::move(event));
+    }
+
+    implementation_->threadCount_ += otherThreadCount;
+
+    for (const std::pair<std::string, std::size_t> & counter : otherCounters)
+    {
+        implementation_->counters_[counter.first] += counter.second;
+    }
+}
+
+void htd::Instrumentation::clear(void)
+{
+    std::lock_guard<std::mutex> lock(implementation_->mutex_);
+
+    implementation_->events_.clear();
+
+    implementation_->counters_.clear();
+}
+
+void htd::Instrumentation::writeChromeTrace(std::ostream & stream) const
+{
+    std::vector<htd::Instrumentation::Event> recordedEvents = events();
+
+    std::vector<std::pair<std::string, std::size_t>> recordedCounters = counters();
+
+    double end = 0;
+
+    std::ios::fmtflags oldflags(stream.flags());
+
+    stream << std::fixed << std::setprecision(3);
+
+    stream << "{\"traceEvents\":[";
+
+    bool first = true;
+
+    for (const htd::Instrumentation::Event & event : recordedEvents)
+    {
+        stream << (first ? "\n" : ",\n") << "{\"name\":";
+
+        Implementation::writeJsonString(stream, event.name);
+
+        stream << ",\"cat\":";
+
+        Implementation::writeJsonString(stream, event.category);
+
+        stream << ",\"ph\":\"X\",\"ts\":" << event.start << ",\"dur\":" << event.duration << ",\"pid\":1,\"tid\":" << event.thread << "}";
+
+        end = std::max(end, event.start + event.duration);
+
+        first = false;
+    }
+
+    for (const std::pair<std::string, std::size_t> & counter : recordedCounters)
+    {
+        stream << (first ? "\n" : ",\n") << "{\"name\":";
+
+        Implementation::writeJsonString(stream, counter.first);
+
+        stream << ",\"cat\":\"counter\",\"ph\":\"C\",\"ts\":" << end << ",\"pid\":1,\"tid\":0,\"args\":{\"value\":" << counter.second << "}}";
+
+        first = false;
+    }
+
+    stream << "\n],\"displayTimeUnit\":\"ms\"}" << std::endl;
+
+    stream.flags(oldflags);
+}
+
+void htd::Instrumentation::writeCsv(std::ostream & stream) const
+{
+    std::vector<htd::Instrumentation::Event> recordedEvents = events();
+
+    std::vector<std::pair<std::string, std::size_t>> recordedCounters = counters();
+
+    std::ios::fmtflags oldflags(stream.flags());
+
+    stream << std::fixed << std::setprecision(3);
+
+    stream << "type,name,category,thread,start_us,duration_us,value\n";
+
+    for (const htd::Instrumentation::Event & event : recordedEvents)
+    {
+        stream << "event,";
+
+        Implementation::writeCsvField(stream, event.name);
+
+        stream << ',';
+
+        Implementation::writeCsvField(stream, event.category);
+
+        stream << ',' << event.thread << ',' << event.start << ',' << event.duration << ",\n";
+    }
+
+    for (const std::pair<std::string, std::size_t> & counter : recordedCounters)
+    {
+        stream << "counter,";
+
+        Implementation::writeCsvField(stream, counter.first);
+
+        stream << ",counter,,,," << counter.second << '\n';
+    }
+
+    stream.flush();
+
+    stream.flags(oldflags);
+}
+
+std::string htd::Instrumentation::typeName(const std::type_info & type)
+{
+    std::string name(type.name());
+
+    std::string ret;
+
+    /* Names in the Itanium C++ ABI (GCC, Clang) are mangled: 'N' <length> <identifier> ... 'E' or <length> <identifier>. */
+    if (!name.empty() && (name[0] == 'N' || std::isdigit(static_cast<unsigned char>(name[0]))))
+    {
+        std::size_t position = name[0] == 'N' ? 1 : 0;
+
+        bool valid = true;
+
+        while (valid && position < name.size() && std::isdigit(static_cast<unsigned char>(name[position])))
+        {
+            std::size_t length = 0;
+
+            while (position < name.size() && std::isdigit(static_cast<unsigned char>(name[position])))
+            {
+                length = length * 10 + static_cast<std::size_t>(name[position] - '0');
+
+                ++position;
+            }
+
+            valid = position + length <= name.size();
+
+            if (valid)
+            {
+                if (!ret.empty())
+                {
+                    ret += "::";
+                }
+
+                ret += name.substr(position, length);
+
+                position += length;
+            }
+        }
+
+        if (!valid || ret.empty())
+        {
+            ret = name;
+        }
+    }
+    else
+    {
+        /* MSVC names are readable already, apart from the leading keyword. */
+        ret = name;
+
+        if (ret.compare(0, 6, "class ") == 0)
+        {
+            ret.erase(0, 6);
+        }
+        else if (ret.compare(0, 7, "struct ") == 0)
+        {
+            ret.erase(0, 7);
+        }
+    }
+
+    return ret;
+}
+
+#endif /* HTD_HTD_INSTRUMENTATION_CPP */
@@ -28,9 +28,16 @@
 #include <htd/IterativeImprovementTreeDecompositionAlgorithm.hpp>
 
 #include <htd/GraphPreprocessorFactory.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/IBoundedTreeDecompositionFitnessFunction.hpp>
 #include <htd/IGraphPreprocessor.hpp>
+#include <htd/ScopedTimer.hpp>
 
+#include <algorithm>
 #include <cstdarg>
+#include <mutex>
+#include <thread>
+#include <typeinfo>
 
 /**
  *  Private implementation details of class htd::IterativeImprovementTreeDecompositionAlgorithm.
@@ -45,7 +52,7 @@ struct htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation
      *  @param[in] fitnessFunction  The fitness function which will be used to evaluate the constructed tree decompositions.
      */
     Implementation(const htd::LibraryInstance * const manager, htd::ITreeDecompositionAlgorithm * algorithm, htd::ITreeDecompositionFitnessFunction * fitnessFunction)
-        : managementInstance_(manager), iterationCount_(1), nonImprovementLimit_(-1), algorithm_(algorithm), fitnessFunction_(fitnessFunction), labelingFunctions_(), postProcessingOperations_()
+        : managementInstance_(manager), iterationCount_(1), nonImprovementLimit_(-1), threadCount_(1), algorithm_(algorithm), fitnessFunction_(fitnessFunction), labelingFunctions_(), postProcessingOperations_()
     {
 
     }
@@ -82,6 +89,11 @@ struct htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation
      */
     std::size_t nonImprovementLimit_;
 
+    /**
+     *  The number of threads which shall be used to perform the iterations.
+     */
+    std::size_t threadCount_;
+
     /**
      *  The decomposition algorithm which will be called repeatedly.
      */
@@ -110,6 +122,88 @@ struct htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation
      *  @return A mutable tree decompostion of the given graph.
      */
     htd::IMutableTreeDecomposition * computeMutableDecomposition(const htd::IMultiHypergraph & graph) const;
+
+    /**
+     *  Structure holding the resources which are used by a single thread performing iterations.
+     */
+    struct WorkerContext
+    {
+        /**
+         *  Constructor for a worker context.
+         *
+         *  @param[in] algorithm                The decomposition algorithm which is used by the thread.
+         *  @param[in] fitnessFunction          The fitness function which is used by the thread.
+         *  @param[in] manipulationOperations   The manipulation operations which are applied by the thread.
+         *  @param[in] labelingFunctions        The labeling functions which are applied by the thread.
+         *  @param[in] ownsResources            A boolean flag indicating whether the given resources shall be deleted together with the context.
+         */
+        WorkerContext(htd::ITreeDecompositionAlgorithm * algorithm, htd::ITreeDecompositionFitnessFunction * fitnessFunction, const std::vector<htd::ITreeDecompositionManipulationOperation *> & manipulationOperations, const std::vector<htd::ILabelingFunction *> & labelingFunctions, bool ownsResources)
+            : algorithm_(algorithm), fitnessFunction_(fitnessFunction), boundedFitnessFunction_(dynamic_cast<htd::IBoundedTreeDecompositionFitnessFunction *>(fitnessFunction)), manipulationOperations_(manipulationOperations), labelingFunctions_(labelingFunctions), ownsResources_(ownsResources)
+        {
+
+        }
+
+        ~WorkerContext()
+        {
+            if (ownsResources_)
+            {
+                delete algorithm_;
+
+                delete fitnessFunction_;
+
+                for (htd::ITreeDecompositionManipulationOperation * operation : manipulationOperations_)
+                {
+                    delete operation;
+                }
+
+                for (htd::ILabelingFunction * labelingFunction : labelingFunctions_)
+                {
+                    delete labelingFunction;
+                }
+            }
+        }
+
+        /**
+         *  The decomposition algorithm which is used by the thread.
+         */
+        htd::ITreeDecompositionAlgorithm * algorithm_;
+
+        /**
+         *  The fitness function which is used by the thread.
+         */
+        htd::ITreeDecompositionFitnessFunction * fitnessFunction_;
+
+        /**
+         *  The fitness function which is used by the thread if it is able to bound fitness evaluations, nullptr otherwise.
+         */
+        htd::IBoundedTreeDecompositionFitnessFunction * boundedFitnessFunction_;
+
+        /**
+         *  The manipulation operations which are applied by the thread.
+         */
+        std::vector<htd::ITreeDecompositionManipulationOperation *> manipulationOperations_;
+
+        /**
+         *  The labeling functions which are applied by the thread.
+         */
+        std::vector<htd::ILabelingFunction *> labelingFunctions_;
+
+        /**
+         *  A boolean flag indicating whether the resources shall be deleted together with the context.
+         */
+        bool ownsResources_;
+    };
+
+    /**
+     *  Create the contexts of the threads which perform the iterations.
+     *
+     *  The first context shares the resources of the given primary context, all further contexts hold private copies of them.
+     *
+     *  @param[in] primaryContext   The context of the calling thread.
+     *
+     *  @return The contexts of the threads which perform the iterations.
+     */
+    std::vector<std::unique_ptr<WorkerContext>> createWorkerContexts(const WorkerContext & primaryContext) const;
 };
 
 htd::IterativeImprovementTreeDecompositionAlgorithm::IterativeImprovementTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager, htd::ITreeDecompositionAlgorithm * algorithm, htd::ITreeDecompositionFitnessFunction * fitnessFunction) : implementation_(new Implementation(manager, algorithm, fitnessFunction))
@@ -150,6 +244,8 @@ htd::ITreeDecomposition * htd::IterativeImprovementTreeDecompositionAlgorithm::c
                                                                                                     const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
                                                                                                     const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback) const
 {
+    htd::RandomNumberGeneratorScope randomNumberGeneratorScope;
+
     htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
 
     htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
@@ -186,6 +282,8 @@ htd::ITreeDecomposition * htd::IterativeImprovementTreeDecompositionAlgorithm::c
                                                                                                     const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
                                                                                                     const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback) const
 {
+    htd::RandomNumberGeneratorScope randomNumberGeneratorScope;
+
     std::vector<htd::ILabelingFunction *> labelingFunctions;
 
     std::vector<htd::ITreeDecompositionManipulationOperation *> postProcessingOperations;
@@ -207,106 +305,155 @@ htd::ITreeDecomposition * htd::IterativeImprovementTreeDecompositionAlgorithm::c
         }
     }
 
+    labelingFunctions.insert(labelingFunctions.begin(), implementation_->labelingFunctions_.begin(), implementation_->labelingFunctions_.end());
+
+    postProcessingOperations.insert(postProcessingOperations.begin(), implementation_->postProcessingOperations_.begin(), implementation_->postProcessingOperations_.end());
+
     htd::ITreeDecomposition * ret = nullptr;
 
     htd::FitnessEvaluation * bestEvaluation = nullptr;
 
     std::size_t nonImprovementCount = 0;
 
+    htd::index_t iteration = 0;
+
+    std::mutex mutex;
+
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
-    for (htd::index_t iteration = 0; (iteration == 0 || implementation_->iterationCount_ == 0 || iteration < implementation_->iterationCount_) && nonImprovementCount <= implementation_->nonImprovementLimit_ && !managementInstance.isTerminated(); ++iteration)
+    Implementation::WorkerContext primaryContext(implementation_->algorithm_, implementation_->fitnessFunction_, postProcessingOperations, labelingFunctions, false);
+
+    std::vector<std::unique_ptr<Implementation::WorkerContext>> workerContexts = implementation_->createWorkerContexts(primaryContext);
+
+    auto work = [&](Implementation::WorkerContext & context)
     {
-        htd::IMutableTreeDecomposition * currentDecomposition = dynamic_cast<htd::IMutableTreeDecomposition *>(implementation_->algorithm_->computeDecomposition(graph, preprocessedGraph));
+        std::unique_lock<std::mutex> lock(mutex);
 
-        if (currentDecomposition != nullptr)
+        while ((iteration == 0 || implementation_->iterationCount_ == 0 || iteration < implementation_->iterationCount_) && nonImprovementCount <= implementation_->nonImprovementLimit_ && !managementInstance.isTerminated())
         {
-            for (const htd::ITreeDecompositionManipulationOperation * operation : implementation_->postProcessingOperations_)
-            {
-                operation->apply(graph, *currentDecomposition);
-            }
+            ++iteration;
 
-            for (htd::ITreeDecompositionManipulationOperation * operation : postProcessingOperations)
-            {
-                operation->apply(graph, *currentDecomposition);
-            }
+            lock.unlock();
+
+            htd::IMutableTreeDecomposition * currentDecomposition = dynamic_cast<htd::IMutableTreeDecomposition *>(context.algorithm_->computeDecomposition(graph, preprocessedGraph));
 
-            for (const htd::ILabelingFunction * labelingFunction : implementation_->labelingFunctions_)
+            if (currentDecomposition != nullptr && context.boundedFitnessFunction_ != nullptr && !managementInstance.isTerminated())
             {
-                for (htd::vertex_t vertex : currentDecomposition->vertices())
-                {
-                    htd::ILabelCollection * labelCollection = currentDecomposition->labelings().exportVertexLabelCollection(vertex);
+                htd::FitnessEvaluation * currentBound = context.boundedFitnessFunction_->fitnessBound(graph, *currentDecomposition);
+
+                lock.lock();
 
-                    htd::ILabel * newLabel = labelingFunction->computeLabel(currentDecomposition->bagContent(vertex), *labelCollection);
+                bool pruned = bestEvaluation != nullptr && !(*currentBound > *bestEvaluation);
 
-                    delete labelCollection;
+                lock.unlock();
 
-                    currentDecomposition->setVertexLabel(labelingFunction->name(), vertex, newLabel);
+                delete currentBound;
+
+                if (pruned)
+                {
+                    delete currentDecomposition;
+
+                    currentDecomposition = nullptr;
                 }
             }
 
-            for (htd::ILabelingFunction * labelingFunction : labelingFunctions)
+            if (currentDecomposition != nullptr)
             {
-                for (htd::vertex_t vertex : currentDecomposition->vertices())
+                for (const htd::ITreeDecompositionManipulationOperation * operation : context.manipulationOperations_)
                 {
-                    htd::ILabelCollection * labelCollection = currentDecomposition->labelings().exportVertexLabelCollection(vertex);
+                    htd::ScopedTimer timer(&managementInstance, typeid(*operation), "manipulation");
 
-                    htd::ILabel * newLabel = labelingFunction->computeLabel(currentDecomposition->bagContent(vertex), *labelCollection);
+                    operation->apply(graph, *currentDecomposition);
+                }
 
-                    delete labelCollection;
+                for (const htd::ILabelingFunction * labelingFunction : context.labelingFunctions_)
+                {
+                    for (htd::vertex_t vertex : currentDecomposition->vertices())
+                    {
+                        htd::ILabelCollection * labelCollection = currentDecomposition->labelings().exportVertexLabelCollection(vertex);
 
-                    currentDecomposition->setVertexLabel(labelingFunction->name(), vertex, newLabel);
-                }
-            }
+                        htd::ILabel * newLabel = labelingFunction->computeLabel(currentDecomposition->bagContent(vertex), *labelCollection);
 
-            if (!managementInstance.isTerminated())
-            {
-                htd::FitnessEvaluation * currentEvaluation = implementation_->fitnessFunction_->fitness(graph, *currentDecomposition);
+                        delete labelCollection;
+
+                        currentDecomposition->setVertexLabel(labelingFunction->name(), vertex, newLabel);
+                    }
+                }
 
                 if (!managementInstance.isTerminated())
                 {
-                    progressCallback(graph, *currentDecomposition, *currentEvaluation);
+                    htd::FitnessEvaluation * currentEvaluation = context.fitnessFunction_->fitness(graph, *currentDecomposition);
+
+                    lock.lock();
 
-                    if (iteration == 0 || *currentEvaluation > *bestEvaluation)
+                    if (!managementInstance.isTerminated())
                     {
-                        if (iteration > 0)
+                        progressCallback(graph, *currentDecomposition, *currentEvaluation);
+
+                        if (bestEvaluation == nullptr || *currentEvaluation > *bestEvaluation)
                         {
                             delete ret;
 
                             delete bestEvaluation;
-                        }
 
-                        ret = currentDecomposition;
+                            ret = currentDecomposition;
+
+                            bestEvaluation = currentEvaluation;
+
+                            nonImprovementCount = 0;
+                        }
+                        else
+                        {
+                            delete currentDecomposition;
 
-                        bestEvaluation = currentEvaluation;
+                            delete currentEvaluation;
 
-                        nonImprovementCount = 0;
+                            ++nonImprovementCount;
+                        }
                     }
                     else
                     {
                         delete currentDecomposition;
 
                         delete currentEvaluation;
-
-                        ++nonImprovementCount;
                     }
                 }
                 else
                 {
                     delete currentDecomposition;
 
-                    delete currentEvaluation;
+                    lock.lock();
                 }
             }
             else
             {
-                delete currentDecomposition;
+                lock.lock();
+
+                ++nonImprovementCount;
             }
         }
-        else
+    };
+
+    std::vector<std::thread> threads;
+
+    for (htd::index_t workerIndex = 1; workerIndex < workerContexts.size(); ++workerIndex)
+    {
+        unsigned int seed = static_cast<unsigned int>(htd::randomNumberGenerator()());
+
+        threads.emplace_back([&work, &workerContexts, workerIndex, seed]()
         {
-            ++nonImprovementCount;
-        }
+            /* Each worker draws its random choices from a private generator which is seeded by the calling thread. */
+            htd::seedRandomNumberGenerator(seed);
+
+            work(*(workerContexts[workerIndex]));
+        });
+    }
+
+    work(*(workerContexts[0]));
+
+    for (std::thread & thread : threads)
+    {
+        thread.join();
     }
 
     for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
@@ -437,6 +584,18 @@ void htd::IterativeImprovementTreeDecompositionAlgorithm::setNonImprovementLimit
     implementation_->nonImprovementLimit_ = nonImprovementLimit;
 }
 
+std::size_t htd::IterativeImprovementTreeDecompositionAlgorithm::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::IterativeImprovementTreeDecompositionAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    HTD_ASSERT(threadCount > 0)
+
+    implementation_->threadCount_ = threadCount;
+}
+
 const htd::LibraryInstance * htd::IterativeImprovementTreeDecompositionAlgorithm::managementInstance(void) const HTD_NOEXCEPT
 {
     return implementation_->managementInstance_;
@@ -473,6 +632,50 @@ htd::IterativeImprovementTreeDecompositionAlgorithm * htd::IterativeImprovementT
 
     ret->setIterationCount(implementation_->iterationCount_);
     ret->setNonImprovementLimit(implementation_->nonImprovementLimit_);
+    ret->setThreadCount(implementation_->threadCount_);
+
+    return ret;
+}
+
+std::vector<std::unique_ptr<htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation::WorkerContext>> htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation::createWorkerContexts(const WorkerContext & primaryContext) const
+{
+    std::vector<std::unique_ptr<WorkerContext>> ret;
+
+    ret.emplace_back(new WorkerContext(primaryContext.algorithm_, primaryContext.fitnessFunction_, primaryContext.manipulationOperations_, primaryContext.labelingFunctions_, false));
+
+    std::size_t workerCount = threadCount_;
+
+    if (iterationCount_ > 0)
+    {
+        workerCount = std::min(workerCount, iterationCount_);
+    }
+
+    for (std::size_t index = 1; index < workerCount; ++index)
+    {
+        std::vector<htd::ITreeDecompositionManipulationOperation *> manipulationOperations;
+
+        for (const htd::ITreeDecompositionManipulationOperation * operation : primaryContext.manipulationOperations_)
+        {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            manipulationOperations.push_back(operation->clone());
+#else
+            manipulationOperations.push_back(operation->cloneTreeDecompositionManipulationOperation());
+#endif
+        }
+
+        std::vector<htd::ILabelingFunction *> labelingFunctions;
+
+        for (const htd::ILabelingFunction * labelingFunction : primaryContext.labelingFunctions_)
+        {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            labelingFunctions.push_back(labelingFunction->clone());
+#else
+            labelingFunctions.push_back(labelingFunction->cloneLabelingFunction());
+#endif
+        }
+
+        ret.emplace_back(new WorkerContext(primaryContext.algorithm_->clone(), primaryContext.fitnessFunction_->clone(), manipulationOperations, labelingFunctions, true));
+    }
 
     return ret;
 }
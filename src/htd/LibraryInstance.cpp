@@ -55,7 +55,11 @@
 #include <htd/TreeDecompositionFactory.hpp>
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/GraphSeparatorAlgorithmFactory.hpp>
+#include <htd/DecompositionCache.hpp>
+#include <htd/Instrumentation.hpp>
+#include <htd/MemoryManager.hpp>
 
+#include <atomic>
 #include <csignal>
 
 /**
@@ -130,8 +134,10 @@ struct htd::LibraryInstance::Implementation
 
     /**
      *  A boolean flag indicating whether the current management instance was terminated.
+     *
+     *  The flag is atomic because algorithms may poll it from several worker threads.
      */
-    bool terminated_;
+    std::atomic<bool> terminated_;
 
     /**
      *  The factory class for the default implementation of the htd::IConnectedComponentAlgorithm interface.
@@ -272,11 +278,26 @@ struct htd::LibraryInstance::Implementation
      *  The factory class for the default implementation of the htd::IGraphSeparatorAlgorithm interface.
      */
     std::unique_ptr<htd::GraphSeparatorAlgorithmFactory> graphSeparatorAlgorithmFactory_;
+
+    /**
+     *  The persistent cache for preprocessing results and elimination orderings (nullptr if caching is disabled).
+     */
+    std::unique_ptr<htd::DecompositionCache> decompositionCache_;
+
+    /**
+     *  The instrumentation object recording timing events and counters (nullptr if instrumentation is disabled).
+     */
+    std::unique_ptr<htd::Instrumentation> instrumentation_;
+
+    /**
+     *  The memory manager providing the memory resources of the library instance.
+     */
+    std::unique_ptr<htd::MemoryManager> memoryManager_;
 };
 
 htd::LibraryInstance::LibraryInstance(htd::id_t id) : implementation_(new Implementation(id))
 {
-
+    implementation_->memoryManager_.reset(new htd::MemoryManager(this));
 }
 
 htd::LibraryInstance::~LibraryInstance()
@@ -589,4 +610,39 @@ const htd::GraphSeparatorAlgorithmFactory & htd::LibraryInstance::graphSeparator
     return *(implementation_->graphSeparatorAlgorithmFactory_);
 }
 
+const htd::DecompositionCache * htd::LibraryInstance::decompositionCache(void) const
+{
+    return implementation_->decompositionCache_.get();
+}
+
+void htd::LibraryInstance::setDecompositionCache(htd::DecompositionCache * decompositionCache)
+{
+    implementation_->decompositionCache_.reset(decompositionCache);
+}
+
+htd::Instrumentation * htd::LibraryInstance::instrumentation(void)
+{
+    return implementation_->instrumentation_.get();
+}
+
+const htd::Instrumentation * htd::LibraryInstance::instrumentation(void) const
+{
+    return implementation_->instrumentation_.get();
+}
+
+void htd::LibraryInstance::setInstrumentation(htd::Instrumentation * instrumentation)
+{
+    implementation_->instrumentation_.reset(instrumentation);
+}
+
+htd::MemoryManager & htd::LibraryInstance::memoryManager(void)
+{
+    return *(implementation_->memoryManager_);
+}
+
+const htd::MemoryManager & htd::LibraryInstance::memoryManager(void) const
+{
+    return *(implementation_->memoryManager_);
+}
+
 #endif /* HTD_HTD_LIBRARYINSTANCE_CPP */
@@ -0,0 +1,972 @@
+/* 
+ * File:   LocalSearchOrderingAlgorithm.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_LOCALSEARCHORDERINGALGORITHM_CPP
+#define HTD_HTD_LOCALSEARCHORDERINGALGORITHM_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/LocalSearchOrderingAlgorithm.hpp>
+#include <htd/DecompositionCache.hpp>
+#include <htd/GraphPreprocessorFactory.hpp>
+#include <htd/IGraphPreprocessor.hpp>
+#include <htd/OrderingAlgorithmFactory.hpp>
+#include <htd/VertexOrdering.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <thread>
+#include <unordered_map>
+
+/**
+ *  Private implementation details of class htd::LocalSearchOrderingAlgorithm.
+ */
+struct htd::LocalSearchOrderingAlgorithm::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager   The management instance to which the current object instance belongs.
+     */
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), orderingAlgorithm_(manager->orderingAlgorithmFactory().createInstance()), stepCount_(1000), initialTemperature_(0.5), threadCount_(1)
+    {
+
+    }
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+    /**
+     *  Copy constructor for the implementation details structure.
+     *
+     *  @param[in] original The original implementation details structure.
+     */
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), orderingAlgorithm_(original.orderingAlgorithm_->clone()), stepCount_(original.stepCount_), initialTemperature_(original.initialTemperature_), threadCount_(original.threadCount_)
+    {
+
+    }
+#else
+    /**
+     *  Copy constructor for the implementation details structure.
+     *
+     *  @param[in] original The original implementation details structure.
+     */
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), orderingAlgorithm_(original.orderingAlgorithm_->cloneOrderingAlgorithm()), stepCount_(original.stepCount_), initialTemperature_(original.initialTemperature_), threadCount_(original.threadCount_)
+    {
+
+    }
+#endif
+
+    virtual ~Implementation()
+    {
+        delete orderingAlgorithm_;
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The ordering algorithm which shall be used to compute the initial vertex elimination ordering.
+     */
+    htd::IOrderingAlgorithm * orderingAlgorithm_;
+
+    /**
+     *  The number of local moves which are evaluated by each thread.
+     */
+    std::size_t stepCount_;
+
+    /**
+     *  The initial temperature of the simulated annealing process.
+     */
+    double initialTemperature_;
+
+    /**
+     *  The number of threads which perform independent searches.
+     */
+    std::size_t threadCount_;
+
+    /**
+     *  Internal data structure representing a single simulated annealing process operating on the remaining vertices of a preprocessed graph.
+     */
+    class Search
+    {
+        public:
+            /**
+             *  Constructor for a simulated annealing process.
+             *
+             *  @param[in] manager      The management instance to which the current object instance belongs.
+             *  @param[in] neighborhood The neighborhood of each vertex of the preprocessed graph. The neighborhood of each remaining vertex must contain the vertex itself.
+             *  @param[in] ordering     The initial ordering of the remaining vertices.
+             *  @param[in] seed         The seed of the random number generator of the process.
+             */
+            Search(const htd::LibraryInstance * const manager, const std::vector<std::vector<htd::vertex_t>> & neighborhood, std::vector<htd::vertex_t> && ordering, unsigned int seed)
+                : managementInstance_(manager), ordering_(std::move(ordering)), candidate_(ordering_),
+                  bagSizes_(ordering_.size()), candidateBagSizes_(ordering_.size()),
+                  maxBagSizes_(ordering_.size() + 1), candidateMaxBagSizes_(ordering_.size() + 1),
+                  fillCounts_(ordering_.size() + 1), candidateFillCounts_(ordering_.size() + 1),
+                  state_(neighborhood), statePosition_(0), journal_(),
+                  savedNeighborhoods_(neighborhood.size()), savedVertices_(), saveEpochs_(neighborhood.size(), 0), epoch_(0), difference_(), criticalPositions_(), fillScale_(1.0), generator_(seed), bestOrdering_(), bestMaxBagSize_(0), bestFillCount_(0)
+            {
+                if (!ordering_.empty())
+                {
+                    evaluate(0, std::numeric_limits<double>::infinity());
+
+                    accept(0);
+
+                    fillScale_ = (double)(fillCounts_[ordering_.size()]) + 1.0;
+                }
+            }
+
+            /**
+             *  Perform the simulated annealing process.
+             *
+             *  @param[in] stepCount            The number of local moves which shall be evaluated.
+             *  @param[in] initialTemperature   The initial temperature of the simulated annealing process.
+             *  @param[in] lowerBound           A lower bound for the maximum bag size. The process stops as soon as an ordering reaching the bound is found.
+             */
+            void run(std::size_t stepCount, double initialTemperature, std::size_t lowerBound)
+            {
+                std::size_t size = ordering_.size();
+
+                std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+                for (std::size_t step = 0; size > 1 && step < stepCount && bestMaxBagSize_ > lowerBound && !managementInstance_->isTerminated(); ++step)
+                {
+                    double temperature = initialTemperature * (double)(stepCount - step - 1) / (double)stepCount;
+
+                    double threshold = rating(maxBagSizes_[size], fillCounts_[size]);
+
+                    if (temperature > 0)
+                    {
+                        threshold -= temperature * std::log(1.0 - distribution(generator_));
+                    }
+
+                    std::copy(ordering_.begin(), ordering_.end(), candidate_.begin());
+
+                    htd::index_t firstPosition = proposeMove();
+
+                    if (evaluate(firstPosition, threshold))
+                    {
+                        accept(firstPosition);
+                    }
+                }
+            }
+
+            /**
+             *  Getter for the best ordering found so far.
+             *
+             *  @return The best ordering found so far.
+             */
+            const std::vector<htd::vertex_t> & bestOrdering(void) const
+            {
+                return bestOrdering_;
+            }
+
+            /**
+             *  Getter for the maximum bag size induced by the best ordering found so far.
+             *
+             *  @return The maximum bag size induced by the best ordering found so far.
+             */
+            std::size_t bestMaxBagSize(void) const
+            {
+                return bestMaxBagSize_;
+            }
+
+            /**
+             *  Getter for the number of fill edges, counted once per endpoint, induced by the best ordering found so far.
+             *
+             *  @return The number of fill edges, counted once per endpoint, induced by the best ordering found so far.
+             */
+            std::size_t bestFillCount(void) const
+            {
+                return bestFillCount_;
+            }
+
+        private:
+            /**
+             *  The maximum number of consecutive vertices which are moved by a single block move.
+             */
+            static const std::size_t MAXIMUM_BLOCK_LENGTH = 8;
+
+            /**
+             *  The management instance to which the current object instance belongs.
+             */
+            const htd::LibraryInstance * managementInstance_;
+
+            /**
+             *  The current ordering.
+             */
+            std::vector<htd::vertex_t> ordering_;
+
+            /**
+             *  The ordering which is currently evaluated.
+             */
+            std::vector<htd::vertex_t> candidate_;
+
+            /**
+             *  The size of the bag induced by the vertex at each position of the current ordering.
+             */
+            std::vector<std::size_t> bagSizes_;
+
+            /**
+             *  The size of the bag induced by the vertex at each position of the evaluated ordering.
+             */
+            std::vector<std::size_t> candidateBagSizes_;
+
+            /**
+             *  The maximum size of the bags induced by the vertices before each position of the current ordering.
+             */
+            std::vector<std::size_t> maxBagSizes_;
+
+            /**
+             *  The maximum size of the bags induced by the vertices before each position of the evaluated ordering.
+             */
+            std::vector<std::size_t> candidateMaxBagSizes_;
+
+            /**
+             *  The number of fill edges induced by the vertices before each position of the current ordering.
+             */
+            std::vector<std::size_t> fillCounts_;
+
+            /**
+             *  The number of fill edges induced by the vertices before each position of the evaluated ordering.
+             */
+            std::vector<std::size_t> candidateFillCounts_;
+
+            /**
+             *  The state of the elimination process. Outside of an evaluation, it is the state of the current ordering before position statePosition_.
+             */
+            std::vector<std::vector<htd::vertex_t>> state_;
+
+            /**
+             *  The position of the current ordering up to which the vertices are eliminated in state_.
+             */
+            htd::index_t statePosition_;
+
+            /**
+             *  The changes applied to state_ by each elimination, which allow to undo the eliminations in reverse order.
+             *
+             *  For each elimination, the journal contains the fill vertices added to the neighborhood of each neighbor followed by their
+             *  number, then the neighborhood of the eliminated vertex followed by its size and finally the eliminated vertex itself.
+             */
+            std::vector<htd::vertex_t> journal_;
+
+            /**
+             *  The neighborhoods of the vertices in savedVertices_ as they were before the evaluation of the candidate ordering.
+             */
+            std::vector<std::vector<htd::vertex_t>> savedNeighborhoods_;
+
+            /**
+             *  The vertices whose neighborhood was modified during the evaluation of the candidate ordering.
+             */
+            std::vector<htd::vertex_t> savedVertices_;
+
+            /**
+             *  The evaluation during which the neighborhood of each vertex was saved most recently.
+             */
+            std::vector<std::size_t> saveEpochs_;
+
+            /**
+             *  The number of evaluations performed so far.
+             */
+            std::size_t epoch_;
+
+            /**
+             *  Buffer for the fill edges created during the elimination of a vertex.
+             */
+            std::vector<htd::vertex_t> difference_;
+
+            /**
+             *  Buffer for the positions of the current ordering which induce a bag of maximum size.
+             */
+            std::vector<htd::index_t> criticalPositions_;
+
+            /**
+             *  The scale of the fill count within the rating of an ordering.
+             */
+            double fillScale_;
+
+            /**
+             *  The random number generator of the process.
+             */
+            std::mt19937 generator_;
+
+            /**
+             *  The best ordering found so far.
+             */
+            std::vector<htd::vertex_t> bestOrdering_;
+
+            /**
+             *  The maximum bag size induced by the best ordering found so far.
+             */
+            std::size_t bestMaxBagSize_;
+
+            /**
+             *  The number of fill edges induced by the best ordering found so far.
+             */
+            std::size_t bestFillCount_;
+
+            /**
+             *  Compute the rating of an ordering. Smaller ratings are better.
+             *
+             *  The rating is dominated by the maximum bag size, the fill count only contributes a value in [0, 1).
+             *
+             *  @param[in] maxBagSize   The maximum bag size induced by the ordering.
+             *  @param[in] fillCount    The number of fill edges induced by the ordering.
+             *
+             *  @return The rating of the ordering.
+             */
+            double rating(std::size_t maxBagSize, std::size_t fillCount) const
+            {
+                return (double)maxBagSize + (double)fillCount / ((double)fillCount + fillScale_);
+            }
+
+            /**
+             *  Apply a random local move to the candidate ordering.
+             *
+             *  @return The first position of the candidate ordering which was affected by the move.
+             */
+            htd::index_t proposeMove(void)
+            {
+                htd::index_t ret = 0;
+
+                std::size_t size = candidate_.size();
+
+                std::size_t moveType = generator_() % 4;
+
+                if (moveType == 0)
+                {
+                    htd::index_t position1 = generator_() % size;
+                    htd::index_t position2 = generator_() % (size - 1);
+
+                    if (position2 >= position1)
+                    {
+                        ++position2;
+                    }
+
+                    std::swap(candidate_[position1], candidate_[position2]);
+
+                    ret = std::min(position1, position2);
+                }
+                else
+                {
+                    std::size_t length = 1;
+
+                    if (moveType == 1)
+                    {
+                        length += generator_() % std::min(size - 1, (std::size_t)MAXIMUM_BLOCK_LENGTH);
+                    }
+
+                    htd::index_t source = generator_() % (size - length + 1);
+
+                    if (moveType == 3)
+                    {
+                        criticalPositions_.clear();
+
+                        for (htd::index_t position = 0; position < size; ++position)
+                        {
+                            if (bagSizes_[position] == maxBagSizes_[size])
+                            {
+                                criticalPositions_.push_back(position);
+                            }
+                        }
+
+                        source = criticalPositions_[generator_() % criticalPositions_.size()];
+                    }
+
+                    htd::index_t target = generator_() % (size - length);
+
+                    if (target >= source)
+                    {
+                        ++target;
+
+                        std::rotate(candidate_.begin() + source, candidate_.begin() + source + length, candidate_.begin() + target + length);
+
+                        ret = source;
+                    }
+                    else
+                    {
+                        std::rotate(candidate_.begin() + target, candidate_.begin() + source, candidate_.begin() + source + length);
+
+                        ret = target;
+                    }
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Eliminate a vertex from the current state of the elimination process.
+             *
+             *  @param[in] vertex       The vertex which shall be eliminated.
+             *  @param[in,out] fillCount The number of fill edges, which is increased by the number of fill edges created by the elimination.
+             *  @param[in] journaled    A boolean flag whether the changes shall be recorded in the journal. Otherwise, the modified neighborhoods are saved so that the evaluation of the candidate ordering can be discarded as a whole.
+             *
+             *  @return The size of the bag induced by the eliminated vertex.
+             */
+            std::size_t eliminate(htd::vertex_t vertex, std::size_t & fillCount, bool journaled)
+            {
+                if (!journaled)
+                {
+                    saveNeighborhood(vertex);
+                }
+
+                std::vector<htd::vertex_t> & selectedNeighborhood = state_[vertex];
+
+                std::size_t ret = selectedNeighborhood.size();
+
+                selectedNeighborhood.erase(std::lower_bound(selectedNeighborhood.begin(), selectedNeighborhood.end(), vertex));
+
+                for (htd::vertex_t neighbor : selectedNeighborhood)
+                {
+                    if (!journaled)
+                    {
+                        saveNeighborhood(neighbor);
+                    }
+
+                    std::vector<htd::vertex_t> & currentNeighborhood = state_[neighbor];
+
+                    /* Because 'neighbor' is a neighbor of 'vertex', std::lower_bound will always find 'vertex' in 'currentNeighborhood'. */
+                    // coverity[use_iterator]
+                    currentNeighborhood.erase(std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), vertex));
+
+                    std::set_difference(selectedNeighborhood.begin(), selectedNeighborhood.end(),
+                                        currentNeighborhood.begin(), currentNeighborhood.end(),
+                                        std::back_inserter(difference_));
+
+                    if (journaled)
+                    {
+                        journal_.insert(journal_.end(), difference_.begin(), difference_.end());
+
+                        journal_.push_back(static_cast<htd::vertex_t>(difference_.size()));
+                    }
+
+                    if (!difference_.empty())
+                    {
+                        fillCount += difference_.size();
+
+                        htd::inplace_merge(currentNeighborhood, difference_);
+
+                        difference_.clear();
+                    }
+                }
+
+                if (journaled)
+                {
+                    journal_.insert(journal_.end(), selectedNeighborhood.begin(), selectedNeighborhood.end());
+
+                    journal_.push_back(static_cast<htd::vertex_t>(selectedNeighborhood.size()));
+
+                    journal_.push_back(vertex);
+                }
+
+                selectedNeighborhood.clear();
+
+                return ret;
+            }
+
+            /**
+             *  Undo the last elimination recorded in the journal.
+             */
+            void undoElimination(void)
+            {
+                htd::vertex_t vertex = journal_.back();
+
+                journal_.pop_back();
+
+                std::size_t neighborCount = journal_.back();
+
+                journal_.pop_back();
+
+                std::vector<htd::vertex_t> & selectedNeighborhood = state_[vertex];
+
+                selectedNeighborhood.assign(journal_.end() - neighborCount, journal_.end());
+
+                journal_.resize(journal_.size() - neighborCount);
+
+                for (auto it = selectedNeighborhood.rbegin(); it != selectedNeighborhood.rend(); ++it)
+                {
+                    std::vector<htd::vertex_t> & currentNeighborhood = state_[*it];
+
+                    std::size_t fillVertexCount = journal_.back();
+
+                    journal_.pop_back();
+
+                    if (fillVertexCount > 0)
+                    {
+                        auto fillVertex = journal_.end() - fillVertexCount;
+
+                        auto output = std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), *fillVertex);
+
+                        for (auto input = output; input != currentNeighborhood.end(); ++input)
+                        {
+                            if (fillVertex != journal_.end() && *input == *fillVertex)
+                            {
+                                ++fillVertex;
+                            }
+                            else
+                            {
+                                *output = *input;
+
+                                ++output;
+                            }
+                        }
+
+                        currentNeighborhood.erase(output, currentNeighborhood.end());
+
+                        journal_.resize(journal_.size() - fillVertexCount);
+                    }
+
+                    currentNeighborhood.insert(std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), vertex), vertex);
+                }
+
+                selectedNeighborhood.insert(std::lower_bound(selectedNeighborhood.begin(), selectedNeighborhood.end(), vertex), vertex);
+            }
+
+            /**
+             *  Bring the state of the elimination process to the given position of the current ordering.
+             *
+             *  Only the eliminations between the previous and the requested position are undone or performed, hence the cost
+             *  of the restore depends on the distance between both positions and not on the size of the graph.
+             *
+             *  @param[in] position The position of the current ordering before which all vertices shall be eliminated.
+             */
+            void restoreState(htd::index_t position)
+            {
+                while (statePosition_ > position)
+                {
+                    undoElimination();
+
+                    --statePosition_;
+                }
+
+                std::size_t fillCount = 0;
+
+                while (statePosition_ < position)
+                {
+                    eliminate(ordering_[statePosition_], fillCount, true);
+
+                    ++statePosition_;
+                }
+            }
+
+            /**
+             *  Save the neighborhood of a vertex unless it was already saved during the current evaluation.
+             *
+             *  @param[in] vertex   The vertex whose neighborhood is about to be modified.
+             */
+            void saveNeighborhood(htd::vertex_t vertex)
+            {
+                if (saveEpochs_[vertex] != epoch_)
+                {
+                    saveEpochs_[vertex] = epoch_;
+
+                    savedNeighborhoods_[vertex].assign(state_[vertex].begin(), state_[vertex].end());
+
+                    savedVertices_.push_back(vertex);
+                }
+            }
+
+            /**
+             *  Discard the eliminations performed during the evaluation of the candidate ordering by swapping back the saved neighborhoods.
+             */
+            void discardEvaluation(void)
+            {
+                for (htd::vertex_t vertex : savedVertices_)
+                {
+                    state_[vertex].swap(savedNeighborhoods_[vertex]);
+                }
+
+                savedVertices_.clear();
+            }
+
+            /**
+             *  Evaluate the candidate ordering.
+             *
+             *  The elimination process is resumed from the state of the current ordering at the first affected position and it
+             *  is aborted as soon as the rating of the eliminated prefix exceeds the given threshold. Afterwards, the modified
+             *  neighborhoods are swapped back, hence the state of the current ordering at the first affected position is kept.
+             *
+             *  @param[in] firstPosition    The first position of the candidate ordering which differs from the current ordering.
+             *  @param[in] threshold        The maximum rating of the candidate ordering for which it is accepted.
+             *
+             *  @return True if the rating of the candidate ordering does not exceed the given threshold, false otherwise.
+             */
+            bool evaluate(htd::index_t firstPosition, double threshold)
+            {
+                bool ret = true;
+
+                std::size_t size = candidate_.size();
+
+                restoreState(firstPosition);
+
+                ++epoch_;
+
+                htd::index_t position = firstPosition;
+
+                std::size_t maxBagSize = maxBagSizes_[position];
+
+                std::size_t fillCount = fillCounts_[position];
+
+                while (position < size && ret)
+                {
+                    candidateMaxBagSizes_[position] = maxBagSize;
+
+                    candidateFillCounts_[position] = fillCount;
+
+                    std::size_t bagSize = eliminate(candidate_[position], fillCount, false);
+
+                    candidateBagSizes_[position] = bagSize;
+
+                    if (bagSize > maxBagSize)
+                    {
+                        maxBagSize = bagSize;
+                    }
+
+                    ret = rating(maxBagSize, fillCount) <= threshold;
+
+                    ++position;
+                }
+
+                candidateMaxBagSizes_[size] = maxBagSize;
+
+                candidateFillCounts_[size] = fillCount;
+
+                discardEvaluation();
+
+                return ret;
+            }
+
+            /**
+             *  Replace the current ordering by the evaluated candidate ordering.
+             *
+             *  @param[in] firstPosition    The first position of the candidate ordering which differs from the current ordering.
+             */
+            void accept(htd::index_t firstPosition)
+            {
+                std::size_t size = candidate_.size();
+
+                std::copy(candidate_.begin() + firstPosition, candidate_.end(), ordering_.begin() + firstPosition);
+
+                std::copy(candidateBagSizes_.begin() + firstPosition, candidateBagSizes_.end(), bagSizes_.begin() + firstPosition);
+
+                std::copy(candidateMaxBagSizes_.begin() + firstPosition, candidateMaxBagSizes_.end(), maxBagSizes_.begin() + firstPosition);
+
+                std::copy(candidateFillCounts_.begin() + firstPosition, candidateFillCounts_.end(), fillCounts_.begin() + firstPosition);
+
+                if (bestOrdering_.empty() || maxBagSizes_[size] < bestMaxBagSize_ || (maxBagSizes_[size] == bestMaxBagSize_ && fillCounts_[size] < bestFillCount_))
+                {
+                    bestOrdering_ = ordering_;
+
+                    bestMaxBagSize_ = maxBagSizes_[size];
+
+                    bestFillCount_ = fillCounts_[size];
+                }
+            }
+    };
+
+    /**
+     *  Compute the vertex ordering of a given graph and write it to the end of a given vector.
+     *
+     *  @param[in] graph                The input graph.
+     *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+     *  @param[out] target              The target vector to which the computed ordering shall be appended.
+     *
+     *  @return The maximum bag size of the decomposition which is obtained via bucket elimination using the input graph and the resulting ordering.
+     */
+    std::size_t writeOrderingTo(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::vector<htd::vertex_t> & target) const HTD_NOEXCEPT;
+};
+
+htd::LocalSearchOrderingAlgorithm::LocalSearchOrderingAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd::LocalSearchOrderingAlgorithm::LocalSearchOrderingAlgorithm(const htd::LocalSearchOrderingAlgorithm & original) : implementation_(new Implementation(*(original.implementation_)))
+{
+
+}
+
+htd::LocalSearchOrderingAlgorithm::~LocalSearchOrderingAlgorithm()
+{
+
+}
+
+htd::IVertexOrdering * htd::LocalSearchOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT
+{
+    return computeOrdering(graph, (std::size_t)-1, 1);
+}
+
+htd::IWidthLimitedVertexOrdering * htd::LocalSearchOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT
+{
+    htd::RandomNumberGeneratorScope randomNumberGeneratorScope;
+
+    htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
+
+    htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
+
+    htd::IWidthLimitedVertexOrdering * ret = computeOrdering(graph, *preprocessedGraph, maxBagSize, maxIterationCount);
+
+    delete preprocessedGraph;
+    delete preprocessor;
+
+    return ret;
+}
+
+htd::IVertexOrdering * htd::LocalSearchOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT
+{
+    return computeOrdering(graph, preprocessedGraph, (std::size_t)-1, 1);
+}
+
+htd::IWidthLimitedVertexOrdering * htd::LocalSearchOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT
+{
+    htd::RandomNumberGeneratorScope randomNumberGeneratorScope;
+
+    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+
+    std::vector<htd::vertex_t> ordering;
+    ordering.reserve(graph.vertexCount());
+
+    std::size_t iterations = 0;
+
+    std::size_t currentMaxBagSize = (std::size_t)-1;
+
+    do
+    {
+        ordering.clear();
+
+        currentMaxBagSize = implementation_->writeOrderingTo(graph, preprocessedGraph, ordering);
+
+        ++iterations;
+    }
+    while (currentMaxBagSize > maxBagSize && iterations < maxIterationCount && !managementInstance.isTerminated());
+
+    if (maxIterationCount == 0 && currentMaxBagSize > maxBagSize)
+    {
+        ordering.clear();
+
+        currentMaxBagSize = 0;
+    }
+
+    return new htd::VertexOrdering(std::move(ordering), iterations, currentMaxBagSize);
+}
+
+std::size_t htd::LocalSearchOrderingAlgorithm::Implementation::writeOrderingTo(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::vector<htd::vertex_t> & target) const HTD_NOEXCEPT
+{
+    std::size_t ret = preprocessedGraph.minTreeWidth() + 1;
+
+    const std::vector<htd::vertex_t> & remainingVertices = preprocessedGraph.remainingVertices();
+
+    target.insert(target.end(),
+                  preprocessedGraph.eliminationSequence().begin(),
+                  preprocessedGraph.eliminationSequence().end());
+
+    if (!remainingVertices.empty())
+    {
+        std::unordered_map<htd::vertex_t, htd::vertex_t> indices(remainingVertices.size());
+
+        for (htd::vertex_t vertex : remainingVertices)
+        {
+            indices[preprocessedGraph.vertexName(vertex)] = vertex;
+        }
+
+        std::vector<std::vector<htd::vertex_t>> neighborhood(preprocessedGraph.neighborhood().begin(), preprocessedGraph.neighborhood().end());
+
+        for (htd::vertex_t vertex : remainingVertices)
+        {
+            std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
+
+            currentNeighborhood.insert(std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), vertex), vertex);
+        }
+
+        std::vector<std::unique_ptr<Search>> searches;
+
+        /* The first search starts from the best ordering stored in the decomposition cache, if available. */
+        std::vector<htd::vertex_t> cachedOrdering;
+
+        const htd::DecompositionCache * cache = managementInstance_->decompositionCache();
+
+        if (cache != nullptr)
+        {
+            std::size_t cachedMaxBagSize = 0;
+
+            cache->loadOrdering(htd::DecompositionCache::computeKey(graph), cachedOrdering, cachedMaxBagSize);
+        }
+
+        for (htd::index_t index = 0; index < threadCount_ && (index == 0 || !managementInstance_->isTerminated()); ++index)
+        {
+            htd::IVertexOrdering * initialOrdering = nullptr;
+
+            if (index > 0 || cachedOrdering.size() != graph.vertexCount())
+            {
+                initialOrdering = orderingAlgorithm_->computeOrdering(graph, preprocessedGraph);
+            }
+
+            const std::vector<htd::vertex_t> & initialSequence = initialOrdering != nullptr ? initialOrdering->sequence() : cachedOrdering;
+
+            std::vector<htd::vertex_t> ordering;
+            ordering.reserve(remainingVertices.size());
+
+            std::vector<bool> contained(neighborhood.size(), false);
+
+            for (htd::vertex_t vertex : initialSequence)
+            {
+                auto position = indices.find(vertex);
+
+                if (position != indices.end() && !contained[position->second])
+                {
+                    ordering.push_back(position->second);
+
+                    contained[position->second] = true;
+                }
+            }
+
+            delete initialOrdering;
+
+            for (htd::vertex_t vertex : remainingVertices)
+            {
+                if (!contained[vertex])
+                {
+                    ordering.push_back(vertex);
+                }
+            }
+
+            searches.emplace_back(new Search(managementInstance_, neighborhood, std::move(ordering), static_cast<unsigned int>(htd::randomNumberGenerator()())));
+        }
+
+        std::size_t lowerBound = ret;
+
+        std::vector<std::thread> threads;
+
+        for (htd::index_t index = 1; index < searches.size(); ++index)
+        {
+            threads.emplace_back(&Search::run, searches[index].get(), stepCount_, initialTemperature_, lowerBound);
+        }
+
+        searches[0]->run(stepCount_, initialTemperature_, lowerBound);
+
+        for (std::thread & thread : threads)
+        {
+            thread.join();
+        }
+
+        const Search * bestSearch = searches[0].get();
+
+        for (const std::unique_ptr<Search> & search : searches)
+        {
+            if (search->bestMaxBagSize() < bestSearch->bestMaxBagSize() || (search->bestMaxBagSize() == bestSearch->bestMaxBagSize() && search->bestFillCount() < bestSearch->bestFillCount()))
+            {
+                bestSearch = search.get();
+            }
+        }
+
+        for (htd::vertex_t vertex : bestSearch->bestOrdering())
+        {
+            target.push_back(preprocessedGraph.vertexName(vertex));
+        }
+
+        if (bestSearch->bestMaxBagSize() > ret)
+        {
+            ret = bestSearch->bestMaxBagSize();
+        }
+    }
+
+    return ret;
+}
+
+const htd::LibraryInstance * htd::LocalSearchOrderingAlgorithm::managementInstance(void) const HTD_NOEXCEPT
+{
+    return implementation_->managementInstance_;
+}
+
+void htd::LocalSearchOrderingAlgorithm::setManagementInstance(const htd::LibraryInstance * const manager)
+{
+    HTD_ASSERT(manager != nullptr)
+
+    implementation_->managementInstance_ = manager;
+}
+
+void htd::LocalSearchOrderingAlgorithm::setOrderingAlgorithm(htd::IOrderingAlgorithm * algorithm)
+{
+    HTD_ASSERT(algorithm != nullptr)
+
+    delete implementation_->orderingAlgorithm_;
+
+    implementation_->orderingAlgorithm_ = algorithm;
+}
+
+std::size_t htd::LocalSearchOrderingAlgorithm::stepCount(void) const
+{
+    return implementation_->stepCount_;
+}
+
+void htd::LocalSearchOrderingAlgorithm::setStepCount(std::size_t stepCount)
+{
+    implementation_->stepCount_ = stepCount;
+}
+
+double htd::LocalSearchOrderingAlgorithm::initialTemperature(void) const
+{
+    return implementation_->initialTemperature_;
+}
+
+void htd::LocalSearchOrderingAlgorithm::setInitialTemperature(double initialTemperature)
+{
+    HTD_ASSERT(initialTemperature >= 0)
+
+    implementation_->initialTemperature_ = initialTemperature;
+}
+
+std::size_t htd::LocalSearchOrderingAlgorithm::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::LocalSearchOrderingAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    HTD_ASSERT(threadCount > 0)
+
+    implementation_->threadCount_ = threadCount;
+}
+
+htd::LocalSearchOrderingAlgorithm * htd::LocalSearchOrderingAlgorithm::clone(void) const
+{
+    return new htd::LocalSearchOrderingAlgorithm(*this);
+}
+
+#ifdef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+htd::IOrderingAlgorithm * htd::LocalSearchOrderingAlgorithm::cloneOrderingAlgorithm(void) const
+{
+    return clone();
+}
+
+htd::IWidthLimitableOrderingAlgorithm * htd::LocalSearchOrderingAlgorithm::cloneWidthLimitableOrderingAlgorithm(void) const
+{
+    return clone();
+}
+#endif
+
+#endif /* HTD_HTD_LOCALSEARCHORDERINGALGORITHM_CPP */
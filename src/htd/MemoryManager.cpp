@@ -0,0 +1,480 @@
+/* 
+ * File:   MemoryManager.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_MEMORYMANAGER_CPP
+#define HTD_HTD_MEMORYMANAGER_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/LibraryInstance.hpp>
+#include <htd/MemoryManager.hpp>
+#include <htd/NewDeleteMemoryResource.hpp>
+#include <htd/PoolMemoryResource.hpp>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+/**
+ *  Private implementation details of class htd::MemoryManager.
+ */
+struct htd::MemoryManager::Implementation
+{
+    /**
+     *  Structure holding the accounting information which is shared by all memory resources of a memory manager.
+     */
+    struct Accounting
+    {
+        /**
+         *  The number of bytes currently allocated by all subsystems.
+         */
+        std::atomic<std::size_t> liveBytes;
+
+        /**
+         *  The maximum number of bytes allocated by all subsystems at the same time.
+         */
+        std::atomic<std::size_t> peakBytes;
+
+        /**
+         *  The maximum number of live bytes before the library instance is terminated.
+         */
+        std::atomic<std::size_t> memoryLimit;
+
+        /**
+         *  A boolean flag indicating whether the memory limit was exceeded.
+         */
+        std::atomic<bool> memoryLimitExceeded;
+
+        /**
+         *  The management instance which shall be terminated when the memory limit is exceeded (nullptr after the memory manager was destroyed).
+         */
+        std::atomic<htd::LibraryInstance *> managementInstance;
+
+        /**
+         *  Constructor for the accounting information.
+         *
+         *  @param[in] manager  The management instance which shall be terminated when the memory limit is exceeded.
+         */
+        Accounting(htd::LibraryInstance * manager) : liveBytes(0), peakBytes(0), memoryLimit((std::size_t)-1), memoryLimitExceeded(false), managementInstance(manager)
+        {
+
+        }
+    };
+
+    /**
+     *  Memory resource which accounts for the allocations and deallocations of a subsystem and forwards them to the memory resource configured for the subsystem.
+     */
+    class AccountedMemoryResource : public htd::IMemoryResource
+    {
+        public:
+            /**
+             *  Constructor for a new accounted memory resource.
+             *
+             *  @param[in] accounting   The accounting information of the memory manager.
+             *  @param[in] upstream     The memory resource to which the requests are forwarded (nullptr for the global operators new and delete).
+             */
+            AccountedMemoryResource(const std::shared_ptr<Accounting> & accounting, htd::IMemoryResource * upstream) : accounting_(accounting), upstream_(), mutex_(), synchronized_(false), activeRequests_(0), replacing_(false), liveBytes_(0), peakBytes_(0)
+            {
+                setUpstream(upstream);
+            }
+
+            virtual ~AccountedMemoryResource()
+            {
+
+            }
+
+            void * allocate(std::size_t bytes, std::size_t alignment) HTD_OVERRIDE
+            {
+                RequestGuard guard(*this);
+
+                void * ret = nullptr;
+
+                if (synchronized_)
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+
+                    ret = upstream()->allocate(bytes, alignment);
+                }
+                else
+                {
+                    ret = upstream()->allocate(bytes, alignment);
+                }
+
+                updatePeak(peakBytes_, liveBytes_ += bytes);
+
+                std::size_t totalLiveBytes = accounting_->liveBytes += bytes;
+
+                updatePeak(accounting_->peakBytes, totalLiveBytes);
+
+                if (totalLiveBytes > accounting_->memoryLimit)
+                {
+                    accounting_->memoryLimitExceeded = true;
+
+                    htd::LibraryInstance * manager = accounting_->managementInstance;
+
+                    if (manager != nullptr && !manager->isTerminated())
+                    {
+                        manager->terminate();
+                    }
+                }
+
+                return ret;
+            }
+
+            void deallocate(void * pointer, std::size_t bytes, std::size_t alignment) HTD_OVERRIDE
+            {
+                RequestGuard guard(*this);
+
+                if (synchronized_)
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+
+                    upstream()->deallocate(pointer, bytes, alignment);
+                }
+                else
+                {
+                    upstream()->deallocate(pointer, bytes, alignment);
+                }
+
+                liveBytes_ -= bytes;
+
+                accounting_->liveBytes -= bytes;
+            }
+
+            bool isThreadSafe(void) const HTD_OVERRIDE
+            {
+                return true;
+            }
+
+            /**
+             *  Set the memory resource to which the requests are forwarded.
+             *
+             *  Requests which are issued concurrently wait until the memory resource is replaced. Calls of this method
+             *  must not overlap each other.
+             *
+             *  @param[in] upstream The memory resource to which the requests are forwarded (nullptr for the global operators new and delete).
+             *
+             *  @throws std::logic_error If memory regions allocated via the memory resource are still in use. The given memory resource is deleted in this case.
+             */
+            void setUpstream(htd::IMemoryResource * upstream)
+            {
+                std::unique_ptr<htd::IMemoryResource> newUpstream(upstream);
+
+                replacing_ = true;
+
+                while (activeRequests_ != 0)
+                {
+                    std::this_thread::yield();
+                }
+
+                if (liveBytes_ != 0)
+                {
+                    replacing_ = false;
+
+                    throw std::logic_error("void htd::MemoryManager::setResource(const std::string &, htd::IMemoryResource *)");
+                }
+
+                upstream_ = std::move(newUpstream);
+
+                synchronized_ = !(this->upstream()->isThreadSafe());
+
+                replacing_ = false;
+            }
+
+            /**
+             *  Getter for the number of bytes currently allocated via the memory resource.
+             *
+             *  @return The number of bytes currently allocated via the memory resource.
+             */
+            std::size_t liveBytes(void) const
+            {
+                return liveBytes_;
+            }
+
+            /**
+             *  Getter for the maximum number of bytes allocated via the memory resource at the same time.
+             *
+             *  @return The maximum number of bytes allocated via the memory resource at the same time.
+             */
+            std::size_t peakBytes(void) const
+            {
+                return peakBytes_;
+            }
+
+        private:
+            /**
+             *  The accounting information of the memory manager.
+             */
+            std::shared_ptr<Accounting> accounting_;
+
+            /**
+             *  The memory resource to which the requests are forwarded (nullptr for the global operators new and delete).
+             */
+            std::unique_ptr<htd::IMemoryResource> upstream_;
+
+            /**
+             *  The mutex serializing the requests in case that the upstream memory resource is not thread-safe.
+             */
+            std::mutex mutex_;
+
+            /**
+             *  A boolean flag indicating whether the requests must be serialized.
+             */
+            bool synchronized_;
+
+            /**
+             *  The number of allocation and deallocation requests which are currently processed.
+             */
+            std::atomic<std::size_t> activeRequests_;
+
+            /**
+             *  A boolean flag indicating whether the upstream memory resource is currently replaced.
+             */
+            std::atomic<bool> replacing_;
+
+            /**
+             *  The number of bytes currently allocated via the memory resource.
+             */
+            std::atomic<std::size_t> liveBytes_;
+
+            /**
+             *  The maximum number of bytes allocated via the memory resource at the same time.
+             */
+            std::atomic<std::size_t> peakBytes_;
+
+            /**
+             *  Guard registering a request for the lifetime of the guard, so that the upstream memory resource is not replaced while the request is processed.
+             */
+            class RequestGuard
+            {
+                public:
+                    /**
+                     *  Constructor for a new request guard. The constructor waits while the upstream memory resource is replaced.
+                     *
+                     *  @param[in] resource The memory resource processing the request.
+                     */
+                    RequestGuard(AccountedMemoryResource & resource) : resource_(resource)
+                    {
+                        ++resource_.activeRequests_;
+
+                        while (resource_.replacing_)
+                        {
+                            --resource_.activeRequests_;
+
+                            while (resource_.replacing_)
+                            {
+                                std::this_thread::yield();
+                            }
+
+                            ++resource_.activeRequests_;
+                        }
+                    }
+
+                    ~RequestGuard()
+                    {
+                        --resource_.activeRequests_;
+                    }
+
+                    RequestGuard(const RequestGuard & original) = delete;
+
+                    RequestGuard & operator=(const RequestGuard & original) = delete;
+
+                private:
+                    /**
+                     *  The memory resource processing the request.
+                     */
+                    AccountedMemoryResource & resource_;
+            };
+
+            /**
+             *  Getter for the memory resource to which the requests are forwarded.
+             *
+             *  @return The memory resource to which the requests are forwarded.
+             */
+            htd::IMemoryResource * upstream(void) const
+            {
+                return upstream_ != nullptr ? upstream_.get() : &(htd::NewDeleteMemoryResource::instance());
+            }
+
+            /**
+             *  Raise the given peak value to the given value if the latter is larger.
+             *
+             *  @param[in,out] peak The peak value.
+             *  @param[in] value    The current value.
+             */
+            static void updatePeak(std::atomic<std::size_t> & peak, std::size_t value)
+            {
+                std::size_t currentPeak = peak;
+
+                while (value > currentPeak && !peak.compare_exchange_weak(currentPeak, value))
+                {
+
+                }
+            }
+    };
+
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager  The management instance which shall be terminated when the memory limit is exceeded.
+     */
+    Implementation(htd::LibraryInstance * manager) : accounting_(std::make_shared<Accounting>(manager)), mutex_(), resources_()
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+        accounting_->managementInstance = nullptr;
+    }
+
+    /**
+     *  The accounting information shared by all memory resources.
+     */
+    std::shared_ptr<Accounting> accounting_;
+
+    /**
+     *  The mutex guarding the map of memory resources.
+     */
+    std::mutex mutex_;
+
+    /**
+     *  The memory resources of the subsystems.
+     */
+    std::map<std::string, std::shared_ptr<AccountedMemoryResource>> resources_;
+
+    /**
+     *  Access the memory resource of the given subsystem, creating it if necessary.
+     *
+     *  @note The mutex of the memory manager must be locked when calling this function.
+     *
+     *  @param[in] subsystem    The name of the subsystem.
+     *
+     *  @return The memory resource of the given subsystem.
+     */
+    const std::shared_ptr<AccountedMemoryResource> & accountedResource(const std::string & subsystem)
+    {
+        auto position = resources_.find(subsystem);
+
+        if (position == resources_.end())
+        {
+            htd::IMemoryResource * upstream = nullptr;
+
+            if (subsystem == "tree")
+            {
+                upstream = new htd::PoolMemoryResource();
+            }
+
+            position = resources_.emplace(subsystem, std::make_shared<AccountedMemoryResource>(accounting_, upstream)).first;
+        }
+
+        return position->second;
+    }
+};
+
+htd::MemoryManager::MemoryManager(htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd::MemoryManager::~MemoryManager()
+{
+
+}
+
+std::shared_ptr<htd::IMemoryResource> htd::MemoryManager::resource(const std::string & subsystem) const
+{
+    std::lock_guard<std::mutex> lock(implementation_->mutex_);
+
+    return implementation_->accountedResource(subsystem);
+}
+
+void htd::MemoryManager::setResource(const std::string & subsystem, htd::IMemoryResource * resource)
+{
+    std::lock_guard<std::mutex> lock(implementation_->mutex_);
+
+    implementation_->accountedResource(subsystem)->setUpstream(resource);
+}
+
+std::vector<std::string> htd::MemoryManager::subsystems(void) const
+{
+    std::lock_guard<std::mutex> lock(implementation_->mutex_);
+
+    std::vector<std::string> ret;
+
+    for (const auto & resource : implementation_->resources_)
+    {
+        ret.push_back(resource.first);
+    }
+
+    return ret;
+}
+
+std::size_t htd::MemoryManager::liveBytes(void) const
+{
+    return implementation_->accounting_->liveBytes;
+}
+
+std::size_t htd::MemoryManager::liveBytes(const std::string & subsystem) const
+{
+    std::lock_guard<std::mutex> lock(implementation_->mutex_);
+
+    auto position = implementation_->resources_.find(subsystem);
+
+    return position != implementation_->resources_.end() ? position->second->liveBytes() : 0;
+}
+
+std::size_t htd::MemoryManager::peakBytes(void) const
+{
+    return implementation_->accounting_->peakBytes;
+}
+
+std::size_t htd::MemoryManager::peakBytes(const std::string & subsystem) const
+{
+    std::lock_guard<std::mutex> lock(implementation_->mutex_);
+
+    auto position = implementation_->resources_.find(subsystem);
+
+    return position != implementation_->resources_.end() ? position->second->peakBytes() : 0;
+}
+
+std::size_t htd::MemoryManager::memoryLimit(void) const
+{
+    return implementation_->accounting_->memoryLimit;
+}
+
+void htd::MemoryManager::setMemoryLimit(std::size_t memoryLimit)
+{
+    implementation_->accounting_->memoryLimit = memoryLimit;
+}
+
+bool htd::MemoryManager::isMemoryLimitExceeded(void) const
+{
+    return implementation_->accounting_->memoryLimitExceeded;
+}
+
+#endif /* HTD_HTD_MEMORYMANAGER_CPP */
@@ -30,10 +30,15 @@
 #include <htd/MinDegreeOrderingAlgorithm.hpp>
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
+#include <htd/Instrumentation.hpp>
+#include <htd/MemoryManager.hpp>
+#include <htd/MemoryResourceAllocator.hpp>
+#include <htd/ScopedTimer.hpp>
 #include <htd/VertexOrdering.hpp>
 #include <htd/PriorityQueue.hpp>
 
 #include <algorithm>
+#include <memory>
 #include <unordered_set>
 
 /**
@@ -41,6 +46,11 @@
  */
 struct htd::MinDegreeOrderingAlgorithm::Implementation
 {
+    /**
+     *  The type of the working copies of the neighborhoods.
+     */
+    typedef std::vector<htd::vertex_t, htd::MemoryResourceAllocator<htd::vertex_t>> VertexVector;
+
     /**
      *  Constructor for the implementation details structure.
      *
@@ -90,6 +100,8 @@ htd::IVertexOrdering * htd::MinDegreeOrderingAlgorithm::computeOrdering(const ht
 
 htd::IWidthLimitedVertexOrdering * htd::MinDegreeOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT
 {
+    htd::RandomNumberGeneratorScope randomNumberGeneratorScope;
+
     htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
 
     htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
@@ -109,6 +121,8 @@ htd::IVertexOrdering * htd::MinDegreeOrderingAlgorithm::computeOrdering(const ht
 
 htd::IWidthLimitedVertexOrdering * htd::MinDegreeOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT
 {
+    htd::RandomNumberGeneratorScope randomNumberGeneratorScope;
+
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
     std::vector<htd::vertex_t> ordering;
@@ -148,25 +162,46 @@ std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(con
 
     htd::fillSet(preprocessedGraph.remainingVertices(), vertices);
 
-    std::vector<std::vector<htd::vertex_t>> neighborhood(preprocessedGraph.neighborhood().begin(), preprocessedGraph.neighborhood().end());
+    /* The working copy of the neighborhoods is allocated from the memory resource of the ordering subsystem. */
+    std::shared_ptr<htd::IMemoryResource> resource = managementInstance_->memoryManager().resource("ordering");
+
+    htd::MemoryResourceAllocator<htd::vertex_t> allocator(resource.get());
+
+    std::vector<VertexVector, htd::MemoryResourceAllocator<VertexVector>> neighborhood(allocator);
+
+    neighborhood.reserve(preprocessedGraph.neighborhood().size());
+
+    for (const std::vector<htd::vertex_t> & currentNeighborhood : preprocessedGraph.neighborhood())
+    {
+        neighborhood.emplace_back(currentNeighborhood.begin(), currentNeighborhood.end(), allocator);
+    }
 
-    std::vector<htd::vertex_t> difference;
+    VertexVector difference(allocator);
 
-    htd::PriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>> priorityQueue;
+    /* The degrees are bounded by the number of vertices, hence they fit into htd::count_t. */
+    htd::PriorityQueue<htd::vertex_t, htd::count_t, std::greater<htd::count_t>> priorityQueue;
 
     target.insert(target.end(),
                   preprocessedGraph.eliminationSequence().begin(),
                   preprocessedGraph.eliminationSequence().end());
 
+    htd::ScopedTimer timer(managementInstance_, "Min-degree iteration", "ordering");
+
+    std::size_t eliminatedVertexCount = 0;
+
+    std::size_t fillEdgeCount = 0;
+
+    std::size_t queueOperationCount = size;
+
     ret = preprocessedGraph.minTreeWidth() + 1;
 
     for (htd::vertex_t vertex : vertices)
     {
-        std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
+        VertexVector & currentNeighborhood = neighborhood[vertex];
 
         currentNeighborhood.insert(std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), vertex), vertex);
 
-        priorityQueue.push(vertex, currentNeighborhood.size());
+        priorityQueue.push(vertex, static_cast<htd::count_t>(currentNeighborhood.size()));
     }
 
     while (size > 0 && ret <= maxBagSize && !managementInstance_->isTerminated())
@@ -175,7 +210,9 @@ std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(con
 
         priorityQueue.eraseFromTopCollection(selectedVertex);
 
-        std::vector<htd::vertex_t> & selectedNeighborhood = neighborhood[selectedVertex];
+        ++queueOperationCount;
+
+        VertexVector & selectedNeighborhood = neighborhood[selectedVertex];
 
         if (selectedNeighborhood.size() > ret)
         {
@@ -188,7 +225,7 @@ std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(con
 
         for (htd::vertex_t neighbor : selectedNeighborhood)
         {
-            std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[neighbor];
+            VertexVector & currentNeighborhood = neighborhood[neighbor];
 
             std::size_t oldNeighborhoodSize = currentNeighborhood.size();
 
@@ -202,19 +239,33 @@ std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(con
 
             if (!difference.empty())
             {
+                fillEdgeCount += difference.size();
+
                 htd::inplace_merge(currentNeighborhood, difference);
 
                 difference.clear();
             }
 
-            priorityQueue.updatePriority(neighbor, oldNeighborhoodSize, currentNeighborhood.size());
+            priorityQueue.updatePriority(neighbor, static_cast<htd::count_t>(oldNeighborhoodSize), static_cast<htd::count_t>(currentNeighborhood.size()));
+
+            ++queueOperationCount;
         }
 
-        std::vector<htd::vertex_t>().swap(selectedNeighborhood);
+        VertexVector(allocator).swap(selectedNeighborhood);
 
         --size;
 
         target.push_back(preprocessedGraph.vertexName(selectedVertex));
+
+        ++eliminatedVertexCount;
+    }
+
+    if (timer.instrumentation() != nullptr)
+    {
+        /* Each fill edge was added to the neighborhoods of both of its endpoints. */
+        timer.instrumentation()->addCounter("Min-degree: Eliminated vertices", eliminatedVertexCount);
+        timer.instrumentation()->addCounter("Min-degree: Fill edges", fillEdgeCount / 2);
+        timer.instrumentation()->addCounter("Min-degree: Queue operations", queueOperationCount);
     }
 
     return ret;
@@ -30,10 +30,14 @@
 #include <htd/MinFillOrderingAlgorithm.hpp>
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
+#include <htd/Instrumentation.hpp>
+#include <htd/ScopedTimer.hpp>
+#include <htd/ScopedWorkspace.hpp>
 #include <htd/VertexOrdering.hpp>
 #include <htd/PriorityQueue.hpp>
 
 #include <algorithm>
+#include <limits>
 #include <unordered_set>
 
 /**
@@ -145,9 +149,74 @@ struct htd::MinFillOrderingAlgorithm::Implementation
         std::vector<std::size_t> fillValue;
     };
 
+    /**
+     *  The slot of the workspace buffer holding the working copy of the neighborhoods.
+     */
+    static const htd::index_t NEIGHBORHOOD_SLOT = 0;
+
+    /**
+     *  The slot of the workspace buffer holding the neighbors of the affected vertices which are already adjacent to them.
+     */
+    static const htd::index_t EXISTING_NEIGHBORS_SLOT = 1;
+
+    /**
+     *  The slot of the workspace buffer holding the neighbors which become adjacent to the affected vertices.
+     */
+    static const htd::index_t ADDITIONAL_NEIGHBORS_SLOT = 2;
+
+    /**
+     *  The slot of the workspace buffer holding the neighbors of the affected vertices which are not affected by the elimination.
+     */
+    static const htd::index_t UNAFFECTED_NEIGHBORS_SLOT = 3;
+
+    /**
+     *  The slot of the workspace buffer holding the vertices affected by the elimination of a vertex.
+     */
+    static const htd::index_t AFFECTED_VERTICES_SLOT = 0;
+
+    /**
+     *  The slot of the workspace buffer holding the fill values. It differs from the slots of the vertex buffers because the type of the fill values may coincide with htd::vertex_t.
+     */
+    static const htd::index_t FILL_VALUE_SLOT = 1;
+
+    /**
+     *  The slot of the workspace buffer holding the update status of the vertices.
+     */
+    static const htd::index_t UPDATE_STATUS_SLOT = 0;
+
+    /**
+     *  Resize the given collection of neighborhoods to the given size and clear all neighborhoods while keeping their capacity.
+     *
+     *  @param[in,out] neighborhoods    The collection of neighborhoods.
+     *  @param[in] size                 The requested number of neighborhoods.
+     */
+    static void clearNeighborhoods(std::vector<std::vector<htd::vertex_t>> & neighborhoods, std::size_t size)
+    {
+        neighborhoods.resize(size);
+
+        for (std::vector<htd::vertex_t> & neighborhood : neighborhoods)
+        {
+            neighborhood.clear();
+        }
+    }
+
+    /**
+     *  Compute the vertex ordering of a given graph and write it to the end of a given vector.
+     *
+     *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+     *  @param[in] input                The preprocessed, algorithm-specific input data.
+     *  @param[out] target              The target vector to which the computed ordering shall be appended.
+     *  @param[in] maxBagSize           The upper bound for the maximum bag size of a decomposition based on the resulting ordering.
+     *
+     *  @return The maximum bag size of the decomposition which is obtained via bucket elimination using the input graph and the resulting ordering.
+     */
+    std::size_t writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, const PreparedInput & input, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT;
+
     /**
      *  Compute the vertex ordering of a given graph and write it to the end of a given vector.
      *
+     *  @tparam FillType                The datatype used for storing the fill values and the priorities of the vertices. It must be able to represent the fill value of each vertex at each point of the elimination process.
+     *
      *  @param[in] preprocessedGraph    The input graph in preprocessed format.
      *  @param[in] input                The preprocessed, algorithm-specific input data.
      *  @param[out] target              The target vector to which the computed ordering shall be appended.
@@ -155,6 +224,7 @@ struct htd::MinFillOrderingAlgorithm::Implementation
      *
      *  @return The maximum bag size of the decomposition which is obtained via bucket elimination using the input graph and the resulting ordering.
      */
+    template <typename FillType>
     std::size_t writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, const PreparedInput & input, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT;
 };
 
@@ -175,6 +245,8 @@ htd::IVertexOrdering * htd::MinFillOrderingAlgorithm::computeOrdering(const htd:
 
 htd::IWidthLimitedVertexOrdering * htd::MinFillOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT
 {
+    htd::RandomNumberGeneratorScope randomNumberGeneratorScope;
+
     htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
 
     htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
@@ -194,6 +266,8 @@ htd::IVertexOrdering * htd::MinFillOrderingAlgorithm::computeOrdering(const htd:
 
 htd::IWidthLimitedVertexOrdering * htd::MinFillOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT
 {
+    htd::RandomNumberGeneratorScope randomNumberGeneratorScope;
+
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
     std::vector<htd::vertex_t> ordering;
@@ -225,6 +299,20 @@ htd::IWidthLimitedVertexOrdering * htd::MinFillOrderingAlgorithm::computeOrderin
     return new htd::VertexOrdering(std::move(ordering), iterations, currentMaxBagSize);
 }
 
+std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, const PreparedInput & input, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT
+{
+    std::size_t remainingVertexCount = preprocessedGraph.remainingVertices().size();
+
+    /* The fill value of a vertex never exceeds the number of pairs of the other remaining vertices. */
+    if (remainingVertexCount <= 2 || (remainingVertexCount - 1) <= (std::numeric_limits<htd::count_t>::max() / (remainingVertexCount - 2)) * 2)
+    {
+        return writeOrderingTo<htd::count_t>(preprocessedGraph, input, target, maxBagSize);
+    }
+
+    return writeOrderingTo<std::size_t>(preprocessedGraph, input, target, maxBagSize);
+}
+
+template <typename FillType>
 std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, const PreparedInput & input, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT
 {
     std::size_t ret = 0;
@@ -235,31 +323,54 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
     htd::fillSet(preprocessedGraph.remainingVertices(), vertices);
 
-    std::vector<std::size_t> fillValue(input.fillValue.begin(), input.fillValue.end());
+    /* The working copies are kept in a workspace of the calling thread, hence repeated calls reuse their memory unless the workspace grows too large to be pooled. */
+    htd::ScopedWorkspace workspace;
+
+    std::vector<FillType> & fillValue = workspace->buffer<FillType>(FILL_VALUE_SLOT);
+
+    fillValue.assign(input.fillValue.begin(), input.fillValue.end());
+
+    htd::PriorityQueue<htd::vertex_t, FillType, std::greater<FillType>> priorityQueue;
 
-    htd::PriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>> priorityQueue;
+    std::vector<std::vector<htd::vertex_t>> & neighborhood = workspace->buffer<std::vector<htd::vertex_t>>(NEIGHBORHOOD_SLOT);
 
-    std::vector<std::vector<htd::vertex_t>> neighborhood(preprocessedGraph.neighborhood().begin(), preprocessedGraph.neighborhood().end());
+    neighborhood.assign(preprocessedGraph.neighborhood().begin(), preprocessedGraph.neighborhood().end());
 
     std::size_t totalFill = input.totalFill;
 
-    std::vector<htd::state_t> updateStatus(size, 0);
+    std::vector<htd::state_t> & updateStatus = workspace->buffer<htd::state_t>(UPDATE_STATUS_SLOT);
 
-    std::vector<std::vector<htd::vertex_t>> existingNeighbors(size);
-    std::vector<std::vector<htd::vertex_t>> additionalNeighbors(size);
-    std::vector<std::vector<htd::vertex_t>> unaffectedNeighbors(size);
+    updateStatus.assign(size, 0);
 
-    std::vector<htd::vertex_t> affectedVertices;
+    std::vector<std::vector<htd::vertex_t>> & existingNeighbors = workspace->buffer<std::vector<htd::vertex_t>>(EXISTING_NEIGHBORS_SLOT);
+    std::vector<std::vector<htd::vertex_t>> & additionalNeighbors = workspace->buffer<std::vector<htd::vertex_t>>(ADDITIONAL_NEIGHBORS_SLOT);
+    std::vector<std::vector<htd::vertex_t>> & unaffectedNeighbors = workspace->buffer<std::vector<htd::vertex_t>>(UNAFFECTED_NEIGHBORS_SLOT);
+
+    clearNeighborhoods(existingNeighbors, size);
+    clearNeighborhoods(additionalNeighbors, size);
+    clearNeighborhoods(unaffectedNeighbors, size);
+
+    std::vector<htd::vertex_t> & affectedVertices = workspace->buffer<htd::vertex_t>(AFFECTED_VERTICES_SLOT);
+
+    affectedVertices.clear();
     affectedVertices.reserve(size);
 
     target.insert(target.end(),
                   preprocessedGraph.eliminationSequence().begin(),
                   preprocessedGraph.eliminationSequence().end());
 
+    htd::ScopedTimer timer(managementInstance_, "Min-fill iteration", "ordering");
+
     ret = preprocessedGraph.minTreeWidth() + 1;
 
     size = preprocessedGraph.remainingVertices().size();
 
+    std::size_t eliminatedVertexCount = 0;
+
+    std::size_t fillEdgeCount = 0;
+
+    std::size_t queueOperationCount = size;
+
     for (htd::vertex_t vertex : vertices)
     {
         std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
@@ -275,6 +386,8 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
         priorityQueue.eraseFromTopCollection(selectedVertex);
 
+        ++queueOperationCount;
+
         std::vector<htd::vertex_t> & selectedNeighborhood = neighborhood[selectedVertex];
 
         if (selectedNeighborhood.size() > ret)
@@ -288,6 +401,8 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
         totalFill -= fillValue[selectedVertex];
 
+        fillEdgeCount += fillValue[selectedVertex];
+
         selectedNeighborhood.erase(std::lower_bound(selectedNeighborhood.begin(), selectedNeighborhood.end(), selectedVertex));
 
         if (fillValue[selectedVertex] == 0)
@@ -315,6 +430,8 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
                         priorityQueue.updatePriority(vertex, fillValue[vertex], tmp);
 
+                        ++queueOperationCount;
+
                         fillValue[vertex] = tmp;
                     }
                 }
@@ -456,6 +573,8 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
                         priorityQueue.updatePriority(vertex, fillValue[vertex], tmp);
 
+                        ++queueOperationCount;
+
                         fillValue[vertex] = tmp;
                     }
                 }
@@ -465,6 +584,8 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
                     priorityQueue.updatePriority(vertex, fillValue[vertex], 0);
 
+                    ++queueOperationCount;
+
                     fillValue[vertex] = 0;
                 }
 
@@ -520,6 +641,8 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
                         priorityQueue.updatePriority(vertex, fillValue[vertex], tmp);
 
+                        ++queueOperationCount;
+
                         fillValue[vertex] = tmp;
                     }
                 }
@@ -544,6 +667,8 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
         target.push_back(preprocessedGraph.vertexName(selectedVertex));
 
+        ++eliminatedVertexCount;
+
         --size;
 
         //std::cout << "ORDERING: " << selectedVertex << std::endl;
@@ -652,6 +777,8 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
         target.push_back(preprocessedGraph.vertexName(vertex));
 
+        ++eliminatedVertexCount;
+
         vertices.erase(vertex);
 
         --size;
@@ -659,6 +786,13 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
         //std::cout << "ORDERING: " << vertexNames[vertex] << std::endl;
     }
 
+    if (timer.instrumentation() != nullptr)
+    {
+        timer.instrumentation()->addCounter("Min-fill: Eliminated vertices", eliminatedVertexCount);
+        timer.instrumentation()->addCounter("Min-fill: Fill edges", fillEdgeCount);
+        timer.instrumentation()->addCounter("Min-fill: Queue operations", queueOperationCount);
+    }
+
     return ret;
 }
 
@@ -0,0 +1,189 @@
+/* 
+ * File:   MonotonicMemoryResource.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_MONOTONICMEMORYRESOURCE_CPP
+#define HTD_HTD_MONOTONICMEMORYRESOURCE_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/MonotonicMemoryResource.hpp>
+#include <htd/NewDeleteMemoryResource.hpp>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ *  Private implementation details of class htd::MonotonicMemoryResource.
+ */
+struct htd::MonotonicMemoryResource::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] upstream     The memory resource from which the chunks are obtained.
+     *  @param[in] chunkSize    The size of the first chunk in bytes.
+     */
+    Implementation(htd::IMemoryResource * upstream, std::size_t chunkSize) : upstream_(upstream), initialChunkSize_(chunkSize), nextChunkSize_(chunkSize), chunks_(), current_(0), remaining_(0), reservedBytes_(0)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+        release();
+    }
+
+    /**
+     *  The memory resource from which the chunks are obtained.
+     */
+    htd::IMemoryResource * upstream_;
+
+    /**
+     *  The size of the first chunk in bytes.
+     */
+    std::size_t initialChunkSize_;
+
+    /**
+     *  The size of the next chunk in bytes.
+     */
+    std::size_t nextChunkSize_;
+
+    /**
+     *  The chunks obtained from the upstream memory resource together with their sizes.
+     */
+    std::vector<std::pair<void *, std::size_t>> chunks_;
+
+    /**
+     *  The address of the first unused byte of the current chunk.
+     */
+    std::uintptr_t current_;
+
+    /**
+     *  The number of unused bytes of the current chunk.
+     */
+    std::size_t remaining_;
+
+    /**
+     *  The total size of the chunks in bytes.
+     */
+    std::size_t reservedBytes_;
+
+    /**
+     *  Release all chunks to the upstream memory resource.
+     */
+    void release(void)
+    {
+        for (const std::pair<void *, std::size_t> & chunk : chunks_)
+        {
+            upstream_->deallocate(chunk.first, chunk.second, alignof(std::max_align_t));
+        }
+
+        chunks_.clear();
+
+        current_ = 0;
+
+        remaining_ = 0;
+
+        reservedBytes_ = 0;
+
+        nextChunkSize_ = initialChunkSize_;
+    }
+};
+
+htd::MonotonicMemoryResource::MonotonicMemoryResource(htd::IMemoryResource * upstream, std::size_t chunkSize) : implementation_(new Implementation(upstream != nullptr ? upstream : &(htd::NewDeleteMemoryResource::instance()), chunkSize > 0 ? chunkSize : 1))
+{
+
+}
+
+htd::MonotonicMemoryResource::~MonotonicMemoryResource()
+{
+
+}
+
+void * htd::MonotonicMemoryResource::allocate(std::size_t bytes, std::size_t alignment)
+{
+    HTD_ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0 && alignment <= alignof(std::max_align_t))
+
+    Implementation & implementation = *implementation_;
+
+    std::size_t padding = (alignment - (implementation.current_ & (alignment - 1))) & (alignment - 1);
+
+    if (implementation.remaining_ < bytes || implementation.remaining_ - bytes < padding)
+    {
+        std::size_t chunkSize = implementation.nextChunkSize_;
+
+        while (chunkSize < bytes)
+        {
+            chunkSize *= 2;
+        }
+
+        void * chunk = implementation.upstream_->allocate(chunkSize, alignof(std::max_align_t));
+
+        implementation.chunks_.emplace_back(chunk, chunkSize);
+
+        implementation.current_ = reinterpret_cast<std::uintptr_t>(chunk);
+
+        implementation.remaining_ = chunkSize;
+
+        implementation.reservedBytes_ += chunkSize;
+
+        implementation.nextChunkSize_ = chunkSize * 2;
+
+        padding = 0;
+    }
+
+    void * ret = reinterpret_cast<void *>(implementation.current_ + padding);
+
+    implementation.current_ += padding + bytes;
+
+    implementation.remaining_ -= padding + bytes;
+
+    return ret;
+}
+
+void htd::MonotonicMemoryResource::deallocate(void * pointer, std::size_t bytes, std::size_t alignment)
+{
+    HTD_UNUSED(pointer)
+    HTD_UNUSED(bytes)
+    HTD_UNUSED(alignment)
+}
+
+bool htd::MonotonicMemoryResource::isThreadSafe(void) const
+{
+    return false;
+}
+
+void htd::MonotonicMemoryResource::release(void)
+{
+    implementation_->release();
+}
+
+std::size_t htd::MonotonicMemoryResource::reservedBytes(void) const
+{
+    return implementation_->reservedBytes_;
+}
+
+#endif /* HTD_HTD_MONOTONICMEMORYRESOURCE_CPP */
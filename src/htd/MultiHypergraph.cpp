@@ -30,6 +30,8 @@
 #include <htd/MultiHypergraph.hpp>
 #include <htd/VectorAdapter.hpp>
 #include <htd/HyperedgeDeque.hpp>
+#include <htd/CopyOnWrite.hpp>
+#include <htd/ScopedWorkspace.hpp>
 
 #include <htd/Algorithm.hpp>
 
@@ -37,7 +39,6 @@
 #include <array>
 #include <deque>
 #include <iterator>
-#include <stack>
 #include <unordered_set>
 #include <vector>
 
@@ -59,7 +60,7 @@ struct htd::MultiHypergraph::Implementation
           vertices_(),
           selfLoops_(),
           deletions_(),
-          edges_(std::make_shared<std::deque<htd::Hyperedge>>()),
+          edges_(),
           neighborhood_()
     {
 
@@ -83,7 +84,7 @@ struct htd::MultiHypergraph::Implementation
           vertices_(original.vertices_),
           selfLoops_(original.selfLoops_),
           deletions_(original.deletions_),
-          edges_(std::make_shared<std::deque<htd::Hyperedge>>(*(original.edges_))),
+          edges_(original.edges_),
           neighborhood_(original.neighborhood_)
     {
 
@@ -100,15 +101,15 @@ struct htd::MultiHypergraph::Implementation
 
         next_vertex_ = htd::Vertex::FIRST;
 
-        vertices_.clear();
+        vertices_ = htd::CopyOnWrite<std::vector<htd::vertex_t>>();
 
         selfLoops_.clear();
 
         deletions_.clear();
 
-        edges_->clear();
+        edges_ = htd::CopyOnWrite<std::deque<htd::Hyperedge>>();
 
-        neighborhood_.clear();
+        neighborhood_ = htd::CopyOnWrite<std::vector<std::vector<htd::vertex_t>>>();
     }
 
     /**
@@ -134,7 +135,7 @@ struct htd::MultiHypergraph::Implementation
     /**
      *  The vector of all vertices in the graph sorted in ascending order.
      */
-    std::vector<htd::vertex_t> vertices_;
+    htd::CopyOnWrite<std::vector<htd::vertex_t>> vertices_;
 
     /**
      *  The set of vertices which have self-loops.
@@ -149,12 +150,12 @@ struct htd::MultiHypergraph::Implementation
     /**
      *  The collection of hyperedges sorted by ID in ascending order.
      */
-    std::shared_ptr<std::deque<htd::Hyperedge>> edges_;
+    htd::CopyOnWrite<std::deque<htd::Hyperedge>> edges_;
 
     /**
      *  The vector of neighbors for each vertex in the hypergraph. The neighborhood of each vertex is sorted in ascending order.
      */
-    std::vector<std::vector<htd::vertex_t>> neighborhood_;
+    htd::CopyOnWrite<std::vector<std::vector<htd::vertex_t>>> neighborhood_;
 };
 
 htd::MultiHypergraph::MultiHypergraph(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -310,7 +311,7 @@ bool htd::MultiHypergraph::isNeighbor(htd::vertex_t vertex, htd::vertex_t neighb
 
     if (vertex != neighbor)
     {
-        const std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_[vertex - htd::Vertex::FIRST];
+        const std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_.content()[vertex - htd::Vertex::FIRST];
 
         ret = std::binary_search(currentNeighborhood.begin(), currentNeighborhood.end(), neighbor);
     }
@@ -334,7 +335,7 @@ std::size_t htd::MultiHypergraph::neighborCount(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return implementation_->neighborhood_[vertex - htd::Vertex::FIRST].size();
+    return implementation_->neighborhood_.content()[vertex - htd::Vertex::FIRST].size();
 }
 
 bool htd::MultiHypergraph::isConnected(void) const
@@ -343,39 +344,39 @@ bool htd::MultiHypergraph::isConnected(void) const
     
     if (implementation_->size_ > 0)
     {
-        std::stack<htd::vertex_t> originStack;
+        htd::ScopedWorkspace workspace;
 
-        std::unordered_set<htd::vertex_t> visitedVertices;
+        workspace->beginVisit(implementation_->size_ + htd::Vertex::FIRST);
 
-        htd::vertex_t currentVertex = implementation_->vertices_[0];
+        std::vector<htd::vertex_t> & originStack = workspace->buffer<htd::vertex_t>();
 
-        originStack.push(currentVertex);
+        std::size_t visitedVertexCount = 0;
+
+        originStack.clear();
+
+        originStack.push_back(implementation_->vertices_.content()[0]);
 
         while (!originStack.empty())
         {
-            currentVertex = originStack.top();
+            htd::vertex_t currentVertex = originStack.back();
 
-            if (visitedVertices.count(currentVertex) == 0)
-            {
-                visitedVertices.insert(currentVertex);
+            originStack.pop_back();
 
-                originStack.pop();
+            if (workspace->visit(currentVertex))
+            {
+                ++visitedVertexCount;
 
-                for (htd::vertex_t neighbor : implementation_->neighborhood_[currentVertex - htd::Vertex::FIRST])
+                for (htd::vertex_t neighbor : implementation_->neighborhood_.content()[currentVertex - htd::Vertex::FIRST])
                 {
-                    if (visitedVertices.count(neighbor) == 0)
+                    if (!workspace->isVisited(neighbor))
                     {
-                        originStack.push(neighbor);
+                        originStack.push_back(neighbor);
                     }
                 }
             }
-            else
-            {
-                originStack.pop();
-            }
         }
 
-        ret = visitedVertices.size() == implementation_->vertices_.size();
+        ret = visitedVertexCount == implementation_->vertices_.content().size();
     }
     else
     {
@@ -397,42 +398,33 @@ bool htd::MultiHypergraph::isConnected(htd::vertex_t vertex1, htd::vertex_t vert
     }
     else
     {
-        std::vector<htd::vertex_t> newVertices;
-        std::vector<htd::vertex_t> tmpVertices;
+        htd::ScopedWorkspace workspace;
 
-        std::vector<bool> reachableVertices(implementation_->size_);
+        workspace->beginVisit(implementation_->size_ + htd::Vertex::FIRST);
 
-        reachableVertices[vertex1 - htd::Vertex::FIRST] = true;
+        std::vector<htd::vertex_t> & reachableVertices = workspace->buffer<htd::vertex_t>();
 
-        newVertices.push_back(vertex1);
+        reachableVertices.clear();
 
-        while (!ret && !newVertices.empty())
+        workspace->visit(vertex1);
+
+        reachableVertices.push_back(vertex1);
+
+        for (htd::index_t index = 0; !ret && index < reachableVertices.size(); ++index)
         {
-            std::swap(tmpVertices, newVertices);
+            htd::vertex_t vertex = reachableVertices[index];
 
-            newVertices.resize(0);
+            const std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_.content()[vertex - htd::Vertex::FIRST];
 
-            for (auto it = tmpVertices.begin(); !ret && it != tmpVertices.end(); it++)
+            for (auto it = currentNeighborhood.begin(); !ret && it != currentNeighborhood.end(); ++it)
             {
-                htd::vertex_t vertex = *it;
-
-                const std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_[vertex - htd::Vertex::FIRST];
+                htd::vertex_t neighbor = *it;
 
-                for (auto it2 = currentNeighborhood.begin(); !ret && it2 != currentNeighborhood.end(); ++it2)
+                if (workspace->visit(neighbor))
                 {
-                    htd::vertex_t neighbor = *it2;
-
-                    if (neighbor != vertex && !reachableVertices[neighbor - htd::Vertex::FIRST])
-                    {
-                        reachableVertices[neighbor - htd::Vertex::FIRST] = true;
-
-                        newVertices.push_back(neighbor);
+                    reachableVertices.push_back(neighbor);
 
-                        if (neighbor == vertex2)
-                        {
-                            ret = true;
-                        }
-                    }
+                    ret = neighbor == vertex2;
                 }
             }
         }
@@ -445,14 +437,14 @@ htd::ConstCollection<htd::vertex_t> htd::MultiHypergraph::neighbors(htd::vertex_
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->neighborhood_[vertex - htd::Vertex::FIRST]);
+    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->neighborhood_.content()[vertex - htd::Vertex::FIRST]);
 }
 
 void htd::MultiHypergraph::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    const std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_[vertex - htd::Vertex::FIRST];
+    const std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_.content()[vertex - htd::Vertex::FIRST];
 
     target.insert(target.end(), currentNeighborhood.begin(), currentNeighborhood.end());
 }
@@ -461,7 +453,7 @@ htd::vertex_t htd::MultiHypergraph::neighborAtPosition(htd::vertex_t vertex, htd
 {
     HTD_ASSERT(isVertex(vertex))
 
-    const std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_[vertex - htd::Vertex::FIRST];
+    const std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_.content()[vertex - htd::Vertex::FIRST];
 
     HTD_ASSERT(index < currentNeighborhood.size())
 
@@ -470,35 +462,35 @@ htd::vertex_t htd::MultiHypergraph::neighborAtPosition(htd::vertex_t vertex, htd
 
 htd::ConstCollection<htd::vertex_t> htd::MultiHypergraph::vertices(void) const
 {
-    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->vertices_);
+    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->vertices_.content());
 }
 
 void htd::MultiHypergraph::copyVerticesTo(std::vector<htd::vertex_t> & target) const
 {
     target.insert(target.end(),
-                  implementation_->vertices_.begin(),
-                  implementation_->vertices_.end());
+                  implementation_->vertices_.content().begin(),
+                  implementation_->vertices_.content().end());
 }
 
 htd::vertex_t htd::MultiHypergraph::vertexAtPosition(htd::index_t index) const
 {
-    HTD_ASSERT(index < implementation_->vertices_.size())
+    HTD_ASSERT(index < implementation_->vertices_.content().size())
 
-    return implementation_->vertices_[index];
+    return implementation_->vertices_.content()[index];
 }
 
 const std::vector<htd::vertex_t> & htd::MultiHypergraph::vertexVector(void) const
 {
-    return implementation_->vertices_;
+    return implementation_->vertices_.content();
 }
 
 std::size_t htd::MultiHypergraph::isolatedVertexCount(void) const
 {
     std::size_t ret = 0;
 
-    for (htd::vertex_t vertex : implementation_->vertices_)
+    for (htd::vertex_t vertex : implementation_->vertices_.content())
     {
-        if (implementation_->neighborhood_[vertex - htd::Vertex::FIRST].empty())
+        if (implementation_->neighborhood_.content()[vertex - htd::Vertex::FIRST].empty())
         {
             ret++;
         }
@@ -513,7 +505,7 @@ htd::ConstCollection<htd::vertex_t> htd::MultiHypergraph::isolatedVertices(void)
 
     auto & result = ret.container();
 
-    for (htd::vertex_t vertex : implementation_->vertices_)
+    for (htd::vertex_t vertex : implementation_->vertices_.content())
     {
         bool isolated = true;
 
@@ -632,12 +624,12 @@ const htd::Hyperedge & htd::MultiHypergraph::hyperedgeAtPosition(htd::index_t in
 
 htd::FilteredHyperedgeCollection htd::MultiHypergraph::hyperedgesAtPositions(const std::vector<htd::index_t> & indices) const
 {
-    return htd::FilteredHyperedgeCollection(new htd::HyperedgeDeque(implementation_->edges_), indices);
+    return htd::FilteredHyperedgeCollection(new htd::HyperedgeDeque(implementation_->edges_.sharedContent()), indices);
 }
 
 htd::FilteredHyperedgeCollection htd::MultiHypergraph::hyperedgesAtPositions(std::vector<htd::index_t> && indices) const
 {
-    return htd::FilteredHyperedgeCollection(new htd::HyperedgeDeque(implementation_->edges_), std::move(indices));
+    return htd::FilteredHyperedgeCollection(new htd::HyperedgeDeque(implementation_->edges_.sharedContent()), std::move(indices));
 }
 
 htd::vertex_t htd::MultiHypergraph::nextVertex(void) const
@@ -658,9 +650,9 @@ htd::vertex_t htd::MultiHypergraph::addVertex(void)
 
     implementation_->next_vertex_++;
 
-    implementation_->neighborhood_.emplace_back(std::vector<htd::vertex_t>());
+    implementation_->neighborhood_.mutableContent().emplace_back(std::vector<htd::vertex_t>());
 
-    implementation_->vertices_.push_back(ret);
+    implementation_->vertices_.mutableContent().push_back(ret);
 
     return ret;
 }
@@ -671,18 +663,20 @@ htd::vertex_t htd::MultiHypergraph::addVertices(std::size_t count)
 
     if (count > 0)
     {
-        std::size_t previousSize = implementation_->vertices_.size();
+        std::vector<htd::vertex_t> & vertices = implementation_->vertices_.mutableContent();
 
-        implementation_->vertices_.resize(previousSize + count, 0);
+        std::size_t previousSize = vertices.size();
+
+        vertices.resize(previousSize + count, 0);
 
         for (htd::index_t index = 0; index < count; ++index)
         {
-            implementation_->vertices_[previousSize + index + 1 - htd::Vertex::FIRST] = implementation_->next_vertex_;
+            vertices[previousSize + index + 1 - htd::Vertex::FIRST] = implementation_->next_vertex_;
 
             ++(implementation_->next_vertex_);
         }
 
-        implementation_->neighborhood_.resize(implementation_->neighborhood_.size() + count, std::vector<htd::vertex_t>());
+        implementation_->neighborhood_.mutableContent().resize(implementation_->neighborhood_->size() + count, std::vector<htd::vertex_t>());
 
         implementation_->size_ += count;
     }
@@ -702,7 +696,13 @@ void htd::MultiHypergraph::removeVertex(htd::vertex_t vertex)
 
     std::vector<htd::index_t> emptyEdges;
 
-    for (auto & edge : *(implementation_->edges_))
+    std::deque<htd::Hyperedge> & edges = implementation_->edges_.mutableContent();
+
+    std::vector<std::vector<htd::vertex_t>> & neighborhood = implementation_->neighborhood_.mutableContent();
+
+    std::vector<htd::vertex_t> & vertices = implementation_->vertices_.mutableContent();
+
+    for (auto & edge : edges)
     {
         edge.erase(vertex);
 
@@ -716,18 +716,18 @@ void htd::MultiHypergraph::removeVertex(htd::vertex_t vertex)
 
     for (auto it = emptyEdges.rbegin(); it != emptyEdges.rend(); ++it)
     {
-        implementation_->edges_->erase(implementation_->edges_->begin() + *it);
+        edges.erase(edges.begin() + *it);
     }
 
     implementation_->selfLoops_.erase(vertex);
 
     implementation_->deletions_.insert(vertex);
 
-    for (htd::vertex_t neighbor : implementation_->neighborhood_[vertex - htd::Vertex::FIRST])
+    for (htd::vertex_t neighbor : neighborhood[vertex - htd::Vertex::FIRST])
     {
         if (neighbor != vertex)
         {
-            auto & currentNeighborhood = implementation_->neighborhood_[neighbor - htd::Vertex::FIRST];
+            auto & currentNeighborhood = neighborhood[neighbor - htd::Vertex::FIRST];
 
             /* Because 'neighbor' is a neighbor of 'vertex', std::lower_bound will always find 'vertex' in 'currentNeighborhood'. */
             // coverity[use_iterator]
@@ -735,9 +735,9 @@ void htd::MultiHypergraph::removeVertex(htd::vertex_t vertex)
         }
     }
 
-    implementation_->neighborhood_[vertex - htd::Vertex::FIRST].clear();
+    neighborhood[vertex - htd::Vertex::FIRST].clear();
 
-    implementation_->vertices_.erase(std::lower_bound(implementation_->vertices_.begin(), implementation_->vertices_.end(), vertex));
+    vertices.erase(std::lower_bound(vertices.begin(), vertices.end(), vertex));
 
     --(implementation_->size_);
 }
@@ -746,11 +746,11 @@ htd::id_t htd::MultiHypergraph::addEdge(htd::vertex_t vertex1, htd::vertex_t ver
 {
     HTD_ASSERT(isVertex(vertex1) && isVertex(vertex2))
 
-    implementation_->edges_->emplace_back(implementation_->next_edge_, vertex1, vertex2);
+    implementation_->edges_.mutableContent().emplace_back(implementation_->next_edge_, vertex1, vertex2);
 
     if (vertex1 != vertex2)
     {
-        std::vector<htd::vertex_t> & currentNeighborhood1 = implementation_->neighborhood_[vertex1 - htd::Vertex::FIRST];
+        std::vector<htd::vertex_t> & currentNeighborhood1 = implementation_->neighborhood_.mutableContent()[vertex1 - htd::Vertex::FIRST];
 
         auto position = std::lower_bound(currentNeighborhood1.begin(), currentNeighborhood1.end(), vertex2);
 
@@ -758,14 +758,14 @@ htd::id_t htd::MultiHypergraph::addEdge(htd::vertex_t vertex1, htd::vertex_t ver
         {
             currentNeighborhood1.insert(position, vertex2);
 
-            std::vector<htd::vertex_t> & currentNeighborhood2 = implementation_->neighborhood_[vertex2 - htd::Vertex::FIRST];
+            std::vector<htd::vertex_t> & currentNeighborhood2 = implementation_->neighborhood_.mutableContent()[vertex2 - htd::Vertex::FIRST];
 
             currentNeighborhood2.insert(std::lower_bound(currentNeighborhood2.begin(), currentNeighborhood2.end(), vertex1), vertex1);
         }
     }
     else
     {
-        std::vector<htd::vertex_t> & currentNeighborhood1 = implementation_->neighborhood_[vertex1 - htd::Vertex::FIRST];
+        std::vector<htd::vertex_t> & currentNeighborhood1 = implementation_->neighborhood_.mutableContent()[vertex1 - htd::Vertex::FIRST];
 
         auto position = std::lower_bound(currentNeighborhood1.begin(), currentNeighborhood1.end(), vertex1);
 
@@ -795,7 +795,7 @@ htd::id_t htd::MultiHypergraph::addEdge(std::vector<htd::vertex_t> && elements)
         {
             HTD_ASSERT(isVertex(elements[0]))
 
-            implementation_->edges_->emplace_back(implementation_->next_edge_, elements[0]);
+            implementation_->edges_.mutableContent().emplace_back(implementation_->next_edge_, elements[0]);
 
             return implementation_->next_edge_++;
         }
@@ -831,7 +831,7 @@ htd::id_t htd::MultiHypergraph::addEdge(std::vector<htd::vertex_t> && elements)
 
     for (htd::vertex_t vertex : sortedElements)
     {
-        std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_[vertex - htd::Vertex::FIRST];
+        std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_.mutableContent()[vertex - htd::Vertex::FIRST];
 
         std::vector<htd::vertex_t> tmp;
         tmp.reserve(sortedElements.size());
@@ -857,7 +857,7 @@ htd::id_t htd::MultiHypergraph::addEdge(std::vector<htd::vertex_t> && elements)
         }
     }
 
-    implementation_->edges_->emplace_back(implementation_->next_edge_, std::move(elements), std::move(sortedElements));
+    implementation_->edges_.mutableContent().emplace_back(implementation_->next_edge_, std::move(elements), std::move(sortedElements));
 
     return implementation_->next_edge_++;
 }
@@ -877,7 +877,7 @@ htd::id_t htd::MultiHypergraph::addEdge(const htd::Hyperedge & hyperedge)
         {
             HTD_ASSERT(isVertex(hyperedge[0]))
 
-            implementation_->edges_->emplace_back(implementation_->next_edge_, hyperedge.elements());
+            implementation_->edges_.mutableContent().emplace_back(implementation_->next_edge_, hyperedge.elements());
 
             return implementation_->next_edge_++;
         }
@@ -898,7 +898,7 @@ htd::id_t htd::MultiHypergraph::addEdge(const htd::Hyperedge & hyperedge)
         HTD_ASSERT(isVertex(vertex));
     }
 
-    implementation_->edges_->emplace_back(implementation_->next_edge_, hyperedge.elements());
+    implementation_->edges_.mutableContent().emplace_back(implementation_->next_edge_, hyperedge.elements());
 
     std::vector<htd::vertex_t> sortedElements(hyperedge.begin(), hyperedge.end());
 
@@ -917,7 +917,7 @@ htd::id_t htd::MultiHypergraph::addEdge(const htd::Hyperedge & hyperedge)
 
     for (htd::vertex_t vertex : sortedElements)
     {
-        auto & currentNeighborhood = implementation_->neighborhood_[vertex - htd::Vertex::FIRST];
+        auto & currentNeighborhood = implementation_->neighborhood_.mutableContent()[vertex - htd::Vertex::FIRST];
 
         if (implementation_->selfLoops_.count(vertex) > 0)
         {
@@ -948,7 +948,7 @@ htd::id_t htd::MultiHypergraph::addEdge(htd::Hyperedge && hyperedge)
 
             hyperedge.setId(implementation_->next_edge_);
 
-            implementation_->edges_->emplace_back(std::move(hyperedge));
+            implementation_->edges_.mutableContent().emplace_back(std::move(hyperedge));
 
             return implementation_->next_edge_++;
         }
@@ -973,7 +973,7 @@ htd::id_t htd::MultiHypergraph::addEdge(htd::Hyperedge && hyperedge)
 
     newHyperedge.setId(implementation_->next_edge_);
 
-    implementation_->edges_->emplace_back(newHyperedge);
+    implementation_->edges_.mutableContent().emplace_back(newHyperedge);
 
     std::vector<htd::vertex_t> sortedElements(newHyperedge.begin(), newHyperedge.end());
 
@@ -992,7 +992,7 @@ htd::id_t htd::MultiHypergraph::addEdge(htd::Hyperedge && hyperedge)
 
     for (htd::vertex_t vertex : sortedElements)
     {
-        auto & currentNeighborhood = implementation_->neighborhood_[vertex - htd::Vertex::FIRST];
+        auto & currentNeighborhood = implementation_->neighborhood_.mutableContent()[vertex - htd::Vertex::FIRST];
 
         if (implementation_->selfLoops_.count(vertex) > 0)
         {
@@ -1015,9 +1015,11 @@ void htd::MultiHypergraph::removeEdge(htd::id_t edgeId)
 {
     bool found = false;
 
-    auto position = implementation_->edges_->begin();
+    std::deque<htd::Hyperedge> & edges = implementation_->edges_.mutableContent();
 
-    for (auto it = implementation_->edges_->begin(); !found && it != implementation_->edges_->end(); ++it)
+    auto position = edges.begin();
+
+    for (auto it = edges.begin(); !found && it != edges.end(); ++it)
     {
         if (it->id() == edgeId)
         {
@@ -1037,7 +1039,7 @@ void htd::MultiHypergraph::removeEdge(htd::id_t edgeId)
 
             bool selfLoopExists = false;
 
-            for (auto it = implementation_->edges_->begin(); !missing.empty() && it != implementation_->edges_->end(); it++)
+            for (auto it = edges.begin(); !missing.empty() && it != edges.end(); it++)
             {
                 htd::Hyperedge & currentEdge = *it;
 
@@ -1061,7 +1063,7 @@ void htd::MultiHypergraph::removeEdge(htd::id_t edgeId)
 
             if (!missing.empty())
             {
-                std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_[vertex - htd::Vertex::FIRST];
+                std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_.mutableContent()[vertex - htd::Vertex::FIRST];
 
                 for (auto it = missing.begin(); it != missing.end(); it++)
                 {
@@ -1078,7 +1080,7 @@ void htd::MultiHypergraph::removeEdge(htd::id_t edgeId)
 
             if (implementation_->selfLoops_.count(vertex) > 0 && !selfLoopExists)
             {
-                std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_[vertex - htd::Vertex::FIRST];
+                std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_.mutableContent()[vertex - htd::Vertex::FIRST];
 
                 auto position2 = std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), vertex);
 
@@ -1093,7 +1095,7 @@ void htd::MultiHypergraph::removeEdge(htd::id_t edgeId)
             }
         }
 
-        implementation_->edges_->erase(position);
+        edges.erase(position);
     }
 }
 
@@ -1153,7 +1155,7 @@ htd::MultiHypergraph & htd::MultiHypergraph::operator=(const htd::IMultiHypergra
             {
                 implementation_->deletions_.insert(implementation_->next_vertex_);
 
-                implementation_->neighborhood_.emplace_back(std::vector<htd::vertex_t>());
+                implementation_->neighborhood_.mutableContent().emplace_back(std::vector<htd::vertex_t>());
 
                 ++(implementation_->next_vertex_);
             }
@@ -1162,9 +1164,9 @@ htd::MultiHypergraph & htd::MultiHypergraph::operator=(const htd::IMultiHypergra
 
             implementation_->next_vertex_++;
 
-            implementation_->neighborhood_.emplace_back(std::vector<htd::vertex_t>());
+            implementation_->neighborhood_.mutableContent().emplace_back(std::vector<htd::vertex_t>());
 
-            implementation_->vertices_.push_back(vertex);
+            implementation_->vertices_.mutableContent().push_back(vertex);
         }
 
         for (const htd::Hyperedge & hyperedge : original.hyperedges())
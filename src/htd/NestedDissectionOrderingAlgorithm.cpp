@@ -0,0 +1,1481 @@
+/* 
+ * File:   NestedDissectionOrderingAlgorithm.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_NESTEDDISSECTIONORDERINGALGORITHM_CPP
+#define HTD_HTD_NESTEDDISSECTIONORDERINGALGORITHM_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/NestedDissectionOrderingAlgorithm.hpp>
+#include <htd/GraphFactory.hpp>
+#include <htd/GraphPreprocessorFactory.hpp>
+#include <htd/IGraphPreprocessor.hpp>
+#include <htd/MinFillOrderingAlgorithm.hpp>
+#include <htd/VertexOrdering.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <random>
+#include <thread>
+
+/**
+ *  Private implementation details of class htd::NestedDissectionOrderingAlgorithm.
+ */
+struct htd::NestedDissectionOrderingAlgorithm::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager   The management instance to which the current object instance belongs.
+     */
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), leafOrderingAlgorithm_(new htd::MinFillOrderingAlgorithm(manager)), leafSize_(256), threadCount_(1)
+    {
+
+    }
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+    /**
+     *  Copy constructor for the implementation details structure.
+     *
+     *  @param[in] original The original implementation details structure.
+     */
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), leafOrderingAlgorithm_(original.leafOrderingAlgorithm_->clone()), leafSize_(original.leafSize_), threadCount_(original.threadCount_)
+    {
+
+    }
+#else
+    /**
+     *  Copy constructor for the implementation details structure.
+     *
+     *  @param[in] original The original implementation details structure.
+     */
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), leafOrderingAlgorithm_(original.leafOrderingAlgorithm_->cloneOrderingAlgorithm()), leafSize_(original.leafSize_), threadCount_(original.threadCount_)
+    {
+
+    }
+#endif
+
+    virtual ~Implementation()
+    {
+        delete leafOrderingAlgorithm_;
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The ordering algorithm which shall be used to order the parts of the graph which are not split any further.
+     */
+    htd::IOrderingAlgorithm * leafOrderingAlgorithm_;
+
+    /**
+     *  The maximum number of vertices of a part of the graph which is not split any further.
+     */
+    std::size_t leafSize_;
+
+    /**
+     *  The number of threads which process recursion branches in parallel.
+     */
+    std::size_t threadCount_;
+
+    /**
+     *  The number of vertices below which a graph is not coarsened any further.
+     */
+    static const std::size_t COARSEST_GRAPH_SIZE = 100;
+
+    /**
+     *  The number of bisections of the coarsest graph from which the best one is selected.
+     */
+    static const std::size_t INITIAL_BISECTION_COUNT = 4;
+
+    /**
+     *  The maximum number of refinement passes on each level.
+     */
+    static const std::size_t REFINEMENT_PASS_COUNT = 4;
+
+    /**
+     *  The number of consecutive moves without improvement after which a Fiduccia-Mattheyses pass is stopped.
+     */
+    static const std::size_t MAXIMUM_UNSUCCESSFUL_MOVE_COUNT = 64;
+
+    /**
+     *  The maximum share of the total vertex weight (in percent) which may be assigned to one side of a bisection.
+     */
+    static const std::size_t MAXIMUM_SIDE_WEIGHT_PERCENTAGE = 55;
+
+    /**
+     *  Internal graph data structure in compressed sparse row format with weighted vertices and edges.
+     *
+     *  The neighbors of vertex v are stored at the positions offsets[v] to offsets[v + 1] - 1 of the neighbor vector and
+     *  the weight of the edge to each neighbor is stored at the same position of the edge weight vector. Each edge is
+     *  stored for both of its endpoints.
+     */
+    struct WeightedGraph
+    {
+        /**
+         *  The position of the first neighbor of each vertex followed by the total number of neighbor entries.
+         */
+        std::vector<std::size_t> offsets;
+
+        /**
+         *  The neighbors of all vertices.
+         */
+        std::vector<htd::vertex_t> neighbors;
+
+        /**
+         *  The weight of the edge to each neighbor.
+         */
+        std::vector<std::size_t> edgeWeights;
+
+        /**
+         *  The weight of each vertex.
+         */
+        std::vector<std::size_t> vertexWeights;
+
+        /**
+         *  Getter for the number of vertices of the graph.
+         *
+         *  @return The number of vertices of the graph.
+         */
+        std::size_t vertexCount(void) const
+        {
+            return vertexWeights.size();
+        }
+    };
+
+    /**
+     *  Internal data structure representing a part of the graph which is ordered independently.
+     */
+    struct Part
+    {
+        /**
+         *  The subgraph induced by the vertices of the part.
+         */
+        WeightedGraph graph;
+
+        /**
+         *  The names of the vertices of the part in the input graph.
+         */
+        std::vector<htd::vertex_t> names;
+
+        /**
+         *  The position of the first vertex of the part within the ordering of its parent.
+         */
+        std::size_t position;
+    };
+
+    /**
+     *  Compute the vertex ordering of a given graph and write it to a given memory region.
+     *
+     *  @param[in] graph                    The graph which shall be ordered.
+     *  @param[in] names                    The names of the vertices of the graph in the input graph.
+     *  @param[out] target                  The memory region to which the names of the vertices shall be written in the order of their elimination.
+     *  @param[in] depth                    The depth of the current recursion step.
+     *  @param[in] leafOrderingAlgorithm    The ordering algorithm which shall be used to order the parts of the graph which are not split any further.
+     *  @param[in] generator                The random number generator of the current thread.
+     */
+    void dissect(const WeightedGraph & graph, const std::vector<htd::vertex_t> & names, htd::vertex_t * target, std::size_t depth, const htd::IOrderingAlgorithm & leafOrderingAlgorithm, std::mt19937 & generator) const;
+
+    /**
+     *  Compute the vertex orderings of a range of parts of the graph.
+     *
+     *  In case that the depth permits additional threads, the range is split into two halves of similar size and the first
+     *  half is processed by a new thread. Each split increases the depth, so that the number of threads never exceeds the
+     *  configured thread count.
+     *
+     *  @param[in] parts                    The parts of the graph.
+     *  @param[in] begin                    The index of the first part which shall be processed.
+     *  @param[in] end                      The index after the last part which shall be processed.
+     *  @param[out] target                  The memory region to which the names of the vertices shall be written. Each part is written to the position stored in the part.
+     *  @param[in] depth                    The depth of the recursion step which created the parts.
+     *  @param[in] leafOrderingAlgorithm    The ordering algorithm which shall be used to order the parts of the graph which are not split any further.
+     *  @param[in] generator                The random number generator of the current thread.
+     */
+    void dissectParts(std::vector<Part> & parts, std::size_t begin, std::size_t end, htd::vertex_t * target, std::size_t depth, const htd::IOrderingAlgorithm & leafOrderingAlgorithm, std::mt19937 & generator) const;
+
+    /**
+     *  Compute the vertex ordering of a graph which is not split any further via the leaf ordering algorithm.
+     *
+     *  @param[in] graph                    The graph which shall be ordered.
+     *  @param[in] names                    The names of the vertices of the graph in the input graph.
+     *  @param[out] target                  The memory region to which the names of the vertices shall be written in the order of their elimination.
+     *  @param[in] leafOrderingAlgorithm    The ordering algorithm which shall be used to order the graph.
+     */
+    void orderLeaf(const WeightedGraph & graph, const std::vector<htd::vertex_t> & names, htd::vertex_t * target, const htd::IOrderingAlgorithm & leafOrderingAlgorithm) const;
+
+    /**
+     *  Compute the connected components of a graph.
+     *
+     *  @param[in] graph        The graph.
+     *  @param[out] component   The index of the connected component of each vertex.
+     *
+     *  @return The number of connected components of the graph.
+     */
+    std::size_t computeConnectedComponents(const WeightedGraph & graph, std::vector<htd::index_t> & component) const;
+
+    /**
+     *  Split a graph into the subgraphs induced by the labels of its vertices.
+     *
+     *  @param[in] graph        The graph.
+     *  @param[in] names        The names of the vertices of the graph in the input graph.
+     *  @param[in] label        The label of each vertex. Vertices with a label of at least partCount are not assigned to any part.
+     *  @param[in] partCount    The number of parts.
+     *  @param[out] parts       The parts of the graph. The parts are positioned one after another in the order of their labels.
+     */
+    void createParts(const WeightedGraph & graph, const std::vector<htd::vertex_t> & names, const std::vector<htd::index_t> & label, std::size_t partCount, std::vector<Part> & parts) const;
+
+    /**
+     *  Compute a small, balanced separating vertex set of a connected graph.
+     *
+     *  @param[in] graph        The graph.
+     *  @param[out] side        The side of each vertex. The values 0 and 1 denote the two parts, the value 2 denotes the separator.
+     *  @param[in] generator    The random number generator of the current thread.
+     */
+    void computeSeparator(const WeightedGraph & graph, std::vector<htd::index_t> & side, std::mt19937 & generator) const;
+
+    /**
+     *  Coarsen a graph by contracting the edges of a heavy-edge matching.
+     *
+     *  @param[in] graph        The graph.
+     *  @param[out] coarseGraph The coarsened graph.
+     *  @param[out] mapping     The vertex of the coarsened graph into which each vertex of the graph is contracted.
+     *  @param[in] generator    The random number generator of the current thread.
+     */
+    void coarsen(const WeightedGraph & graph, WeightedGraph & coarseGraph, std::vector<htd::vertex_t> & mapping, std::mt19937 & generator) const;
+
+    /**
+     *  Compute a bisection of a graph via greedy graph growing.
+     *
+     *  @param[in] graph        The graph.
+     *  @param[out] side        The side of each vertex.
+     *  @param[in] generator    The random number generator of the current thread.
+     */
+    void computeInitialBisection(const WeightedGraph & graph, std::vector<htd::index_t> & side, std::mt19937 & generator) const;
+
+    /**
+     *  Reduce the weight of the cut edges of a bisection via Fiduccia-Mattheyses passes.
+     *
+     *  @param[in] graph    The graph.
+     *  @param[in,out] side The side of each vertex.
+     */
+    void refineBisection(const WeightedGraph & graph, std::vector<htd::index_t> & side) const;
+
+    /**
+     *  Turn a bisection into a separating vertex set by selecting a minimum vertex cover of the cut edges.
+     *
+     *  The separator is refined afterwards by moving separator vertices into one of the parts whenever the neighbors which
+     *  need to be moved into the separator in exchange have a lower total weight.
+     *
+     *  @param[in] graph    The graph.
+     *  @param[in,out] side The side of each vertex. Vertices of the separator are assigned the value 2.
+     */
+    void computeVertexSeparator(const WeightedGraph & graph, std::vector<htd::index_t> & side) const;
+
+    /**
+     *  Compute the maximum weight of a single side of a bisection.
+     *
+     *  @param[in] graph    The graph.
+     *
+     *  @return The maximum weight of a single side of a bisection.
+     */
+    std::size_t maximumSideWeight(const WeightedGraph & graph) const;
+
+    /**
+     *  Compute the total weight of the cut edges of a bisection.
+     *
+     *  @param[in] graph    The graph.
+     *  @param[in] side     The side of each vertex.
+     *
+     *  @return The total weight of the cut edges of the bisection.
+     */
+    std::size_t cutWeight(const WeightedGraph & graph, const std::vector<htd::index_t> & side) const;
+};
+
+htd::NestedDissectionOrderingAlgorithm::NestedDissectionOrderingAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd::NestedDissectionOrderingAlgorithm::NestedDissectionOrderingAlgorithm(const htd::NestedDissectionOrderingAlgorithm & original) : implementation_(new Implementation(*(original.implementation_)))
+{
+
+}
+
+htd::NestedDissectionOrderingAlgorithm::~NestedDissectionOrderingAlgorithm()
+{
+
+}
+
+htd::IVertexOrdering * htd::NestedDissectionOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT
+{
+    htd::RandomNumberGeneratorScope randomNumberGeneratorScope;
+
+    htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
+
+    htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
+
+    htd::IVertexOrdering * ret = computeOrdering(graph, *preprocessedGraph);
+
+    delete preprocessedGraph;
+    delete preprocessor;
+
+    return ret;
+}
+
+htd::IVertexOrdering * htd::NestedDissectionOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT
+{
+    htd::RandomNumberGeneratorScope randomNumberGeneratorScope;
+
+    HTD_UNUSED(graph)
+
+    const std::vector<htd::vertex_t> & remainingVertices = preprocessedGraph.remainingVertices();
+
+    std::vector<htd::vertex_t> ordering(preprocessedGraph.eliminationSequence().begin(), preprocessedGraph.eliminationSequence().end());
+
+    std::size_t prefixLength = ordering.size();
+
+    ordering.resize(prefixLength + remainingVertices.size());
+
+    if (!remainingVertices.empty())
+    {
+        const htd::vertex_t unassigned = std::numeric_limits<htd::vertex_t>::max();
+
+        std::vector<htd::vertex_t> index(preprocessedGraph.neighborhood().size(), unassigned);
+
+        std::vector<htd::vertex_t> names;
+        names.reserve(remainingVertices.size());
+
+        for (htd::vertex_t vertex : remainingVertices)
+        {
+            index[vertex] = (htd::vertex_t)names.size();
+
+            names.push_back(preprocessedGraph.vertexName(vertex));
+        }
+
+        Implementation::WeightedGraph inputGraph;
+
+        inputGraph.offsets.reserve(remainingVertices.size() + 1);
+        inputGraph.offsets.push_back(0);
+
+        for (htd::vertex_t vertex : remainingVertices)
+        {
+            for (htd::vertex_t neighbor : preprocessedGraph.neighborhood(vertex))
+            {
+                if (index[neighbor] != unassigned && neighbor != vertex)
+                {
+                    inputGraph.neighbors.push_back(index[neighbor]);
+                }
+            }
+
+            inputGraph.offsets.push_back(inputGraph.neighbors.size());
+        }
+
+        inputGraph.edgeWeights.resize(inputGraph.neighbors.size(), 1);
+        inputGraph.vertexWeights.resize(remainingVertices.size(), 1);
+
+        std::mt19937 generator(static_cast<unsigned int>(htd::randomNumberGenerator()()));
+
+        implementation_->dissect(inputGraph, names, ordering.data() + prefixLength, 0, *(implementation_->leafOrderingAlgorithm_), generator);
+    }
+
+    return new htd::VertexOrdering(std::move(ordering), 1);
+}
+
+void htd::NestedDissectionOrderingAlgorithm::Implementation::dissect(const WeightedGraph & graph, const std::vector<htd::vertex_t> & names, htd::vertex_t * target, std::size_t depth, const htd::IOrderingAlgorithm & leafOrderingAlgorithm, std::mt19937 & generator) const
+{
+    std::size_t size = graph.vertexCount();
+
+    if (managementInstance_->isTerminated())
+    {
+        std::copy(names.begin(), names.end(), target);
+    }
+    else if (size <= leafSize_)
+    {
+        orderLeaf(graph, names, target, leafOrderingAlgorithm);
+    }
+    else
+    {
+        std::vector<htd::index_t> label;
+
+        std::vector<Part> parts;
+
+        std::size_t componentCount = computeConnectedComponents(graph, label);
+
+        if (componentCount > 1)
+        {
+            /* Small components are combined, so that the leaf ordering algorithm is not invoked for each of them separately. */
+            std::vector<std::size_t> componentSize(componentCount, 0);
+
+            for (htd::index_t component : label)
+            {
+                ++componentSize[component];
+            }
+
+            std::vector<htd::index_t> group(componentCount);
+
+            std::size_t groupCount = 0;
+
+            std::size_t groupSize = leafSize_;
+
+            for (htd::index_t component = 0; component < componentCount; ++component)
+            {
+                if (groupSize + componentSize[component] > leafSize_)
+                {
+                    ++groupCount;
+
+                    groupSize = 0;
+                }
+
+                group[component] = groupCount - 1;
+
+                groupSize += componentSize[component];
+            }
+
+            for (htd::index_t & currentLabel : label)
+            {
+                currentLabel = group[currentLabel];
+            }
+
+            createParts(graph, names, label, groupCount, parts);
+        }
+        else
+        {
+            computeSeparator(graph, label, generator);
+
+            createParts(graph, names, label, 2, parts);
+
+            if (parts[0].names.empty() || parts[1].names.empty())
+            {
+                parts.clear();
+            }
+            else
+            {
+                htd::vertex_t * separatorTarget = target + parts[1].position + parts[1].names.size();
+
+                for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
+                {
+                    if (label[vertex] == 2)
+                    {
+                        *separatorTarget = names[vertex];
+
+                        ++separatorTarget;
+                    }
+                }
+            }
+        }
+
+        if (parts.empty())
+        {
+            /* The graph could not be split into balanced parts, hence it is ordered as a whole. */
+            orderLeaf(graph, names, target, leafOrderingAlgorithm);
+        }
+        else
+        {
+            dissectParts(parts, 0, parts.size(), target, depth, leafOrderingAlgorithm, generator);
+        }
+    }
+}
+
+void htd::NestedDissectionOrderingAlgorithm::Implementation::dissectParts(std::vector<Part> & parts, std::size_t begin, std::size_t end, htd::vertex_t * target, std::size_t depth, const htd::IOrderingAlgorithm & leafOrderingAlgorithm, std::mt19937 & generator) const
+{
+    if (end - begin > 1 && depth < std::numeric_limits<std::size_t>::digits && ((std::size_t)1 << depth) < threadCount_)
+    {
+        std::size_t totalSize = 0;
+
+        for (htd::index_t index = begin; index < end; ++index)
+        {
+            totalSize += parts[index].names.size();
+        }
+
+        std::size_t middle = begin;
+
+        std::size_t accumulatedSize = 0;
+
+        do
+        {
+            accumulatedSize += parts[middle].names.size();
+
+            ++middle;
+        }
+        while (middle < end - 1 && accumulatedSize * 2 < totalSize);
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+        htd::IOrderingAlgorithm * threadLeafOrderingAlgorithm = leafOrderingAlgorithm.clone();
+#else
+        htd::IOrderingAlgorithm * threadLeafOrderingAlgorithm = leafOrderingAlgorithm.cloneOrderingAlgorithm();
+#endif
+
+        unsigned int seed = static_cast<unsigned int>(generator());
+
+        unsigned int leafSeed = static_cast<unsigned int>(generator());
+
+        std::thread thread([this, &parts, begin, middle, target, depth, threadLeafOrderingAlgorithm, seed, leafSeed]()
+        {
+            /* The leaf ordering algorithm breaks ties via the generator of the calling thread, which is seeded here so that the workers neither share nor repeat random choices. */
+            htd::seedRandomNumberGenerator(leafSeed);
+
+            std::mt19937 threadGenerator(seed);
+
+            dissectParts(parts, begin, middle, target, depth + 1, *threadLeafOrderingAlgorithm, threadGenerator);
+
+            delete threadLeafOrderingAlgorithm;
+        });
+
+        dissectParts(parts, middle, end, target, depth + 1, leafOrderingAlgorithm, generator);
+
+        thread.join();
+    }
+    else
+    {
+        for (htd::index_t index = begin; index < end; ++index)
+        {
+            Part & part = parts[index];
+
+            dissect(part.graph, part.names, target + part.position, depth + 1, leafOrderingAlgorithm, generator);
+
+            /* The subgraph is not needed any more, hence its memory is released before the next part is processed. */
+            part.graph = WeightedGraph();
+        }
+    }
+}
+
+void htd::NestedDissectionOrderingAlgorithm::Implementation::orderLeaf(const WeightedGraph & graph, const std::vector<htd::vertex_t> & names, htd::vertex_t * target, const htd::IOrderingAlgorithm & leafOrderingAlgorithm) const
+{
+    std::size_t size = graph.vertexCount();
+
+    if (size <= 2)
+    {
+        std::copy(names.begin(), names.end(), target);
+    }
+    else
+    {
+        htd::IMutableGraph * leafGraph = managementInstance_->graphFactory().createInstance();
+
+        htd::vertex_t firstVertex = leafGraph->addVertices(size);
+
+        for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
+        {
+            for (htd::index_t position = graph.offsets[vertex]; position < graph.offsets[vertex + 1]; ++position)
+            {
+                htd::vertex_t neighbor = graph.neighbors[position];
+
+                if (vertex < neighbor)
+                {
+                    leafGraph->addEdge(firstVertex + vertex, firstVertex + neighbor);
+                }
+            }
+        }
+
+        htd::IVertexOrdering * ordering = leafOrderingAlgorithm.computeOrdering(*leafGraph);
+
+        const std::vector<htd::vertex_t> & sequence = ordering->sequence();
+
+        if (sequence.size() == size)
+        {
+            for (htd::index_t index = 0; index < size; ++index)
+            {
+                target[index] = names[sequence[index] - firstVertex];
+            }
+        }
+        else
+        {
+            /* The leaf ordering algorithm was interrupted, hence the vertices are written in their original order. */
+            std::copy(names.begin(), names.end(), target);
+        }
+
+        delete ordering;
+        delete leafGraph;
+    }
+}
+
+std::size_t htd::NestedDissectionOrderingAlgorithm::Implementation::computeConnectedComponents(const WeightedGraph & graph, std::vector<htd::index_t> & component) const
+{
+    std::size_t ret = 0;
+
+    std::size_t size = graph.vertexCount();
+
+    const htd::index_t unassigned = std::numeric_limits<htd::index_t>::max();
+
+    component.assign(size, unassigned);
+
+    std::vector<htd::vertex_t> queue;
+    queue.reserve(size);
+
+    for (htd::vertex_t start = 0; start < size; ++start)
+    {
+        if (component[start] == unassigned)
+        {
+            component[start] = ret;
+
+            queue.clear();
+
+            queue.push_back(start);
+
+            for (htd::index_t head = 0; head < queue.size(); ++head)
+            {
+                htd::vertex_t vertex = queue[head];
+
+                for (htd::index_t position = graph.offsets[vertex]; position < graph.offsets[vertex + 1]; ++position)
+                {
+                    htd::vertex_t neighbor = graph.neighbors[position];
+
+                    if (component[neighbor] == unassigned)
+                    {
+                        component[neighbor] = ret;
+
+                        queue.push_back(neighbor);
+                    }
+                }
+            }
+
+            ++ret;
+        }
+    }
+
+    return ret;
+}
+
+void htd::NestedDissectionOrderingAlgorithm::Implementation::createParts(const WeightedGraph & graph, const std::vector<htd::vertex_t> & names, const std::vector<htd::index_t> & label, std::size_t partCount, std::vector<Part> & parts) const
+{
+    std::size_t size = graph.vertexCount();
+
+    parts.clear();
+    parts.resize(partCount);
+
+    std::vector<htd::vertex_t> index(size);
+
+    for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
+    {
+        htd::index_t currentLabel = label[vertex];
+
+        if (currentLabel < partCount)
+        {
+            Part & part = parts[currentLabel];
+
+            index[vertex] = (htd::vertex_t)part.names.size();
+
+            part.names.push_back(names[vertex]);
+
+            part.graph.vertexWeights.push_back(graph.vertexWeights[vertex]);
+        }
+    }
+
+    std::size_t position = 0;
+
+    for (Part & part : parts)
+    {
+        part.position = position;
+
+        position += part.names.size();
+
+        part.graph.offsets.reserve(part.names.size() + 1);
+        part.graph.offsets.push_back(0);
+    }
+
+    for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
+    {
+        htd::index_t currentLabel = label[vertex];
+
+        if (currentLabel < partCount)
+        {
+            WeightedGraph & partGraph = parts[currentLabel].graph;
+
+            for (htd::index_t position = graph.offsets[vertex]; position < graph.offsets[vertex + 1]; ++position)
+            {
+                htd::vertex_t neighbor = graph.neighbors[position];
+
+                if (label[neighbor] == currentLabel)
+                {
+                    partGraph.neighbors.push_back(index[neighbor]);
+
+                    partGraph.edgeWeights.push_back(graph.edgeWeights[position]);
+                }
+            }
+
+            partGraph.offsets.push_back(partGraph.neighbors.size());
+        }
+    }
+}
+
+void htd::NestedDissectionOrderingAlgorithm::Implementation::computeSeparator(const WeightedGraph & graph, std::vector<htd::index_t> & side, std::mt19937 & generator) const
+{
+    std::vector<WeightedGraph> levels;
+
+    std::vector<std::vector<htd::vertex_t>> mappings;
+
+    const WeightedGraph * currentGraph = &graph;
+
+    bool coarsened = true;
+
+    while (coarsened && currentGraph->vertexCount() > COARSEST_GRAPH_SIZE && !managementInstance_->isTerminated())
+    {
+        WeightedGraph coarseGraph;
+
+        std::vector<htd::vertex_t> mapping;
+
+        coarsen(*currentGraph, coarseGraph, mapping, generator);
+
+        /* Coarsening is stopped as soon as it does not reduce the size of the graph significantly any more. */
+        coarsened = coarseGraph.vertexCount() * 20 < currentGraph->vertexCount() * 19;
+
+        if (coarsened)
+        {
+            levels.push_back(std::move(coarseGraph));
+
+            mappings.push_back(std::move(mapping));
+
+            currentGraph = &(levels.back());
+        }
+    }
+
+    computeInitialBisection(*currentGraph, side, generator);
+
+    for (std::size_t level = levels.size(); level > 0; --level)
+    {
+        const WeightedGraph & fineGraph = level > 1 ? levels[level - 2] : graph;
+
+        const std::vector<htd::vertex_t> & mapping = mappings[level - 1];
+
+        std::vector<htd::index_t> fineSide(fineGraph.vertexCount());
+
+        for (htd::vertex_t vertex = 0; vertex < fineSide.size(); ++vertex)
+        {
+            fineSide[vertex] = side[mapping[vertex]];
+        }
+
+        refineBisection(fineGraph, fineSide);
+
+        side.swap(fineSide);
+    }
+
+    computeVertexSeparator(graph, side);
+}
+
+void htd::NestedDissectionOrderingAlgorithm::Implementation::coarsen(const WeightedGraph & graph, WeightedGraph & coarseGraph, std::vector<htd::vertex_t> & mapping, std::mt19937 & generator) const
+{
+    std::size_t size = graph.vertexCount();
+
+    const htd::vertex_t unassigned = std::numeric_limits<htd::vertex_t>::max();
+
+    std::vector<htd::vertex_t> permutation(size);
+
+    std::iota(permutation.begin(), permutation.end(), 0);
+
+    std::shuffle(permutation.begin(), permutation.end(), generator);
+
+    mapping.assign(size, unassigned);
+
+    /* The members of each coarse vertex. In case that a vertex is not matched, both members are identical. */
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> members;
+    members.reserve(size);
+
+    for (htd::vertex_t vertex : permutation)
+    {
+        if (mapping[vertex] == unassigned)
+        {
+            htd::vertex_t partner = vertex;
+
+            std::size_t partnerEdgeWeight = 0;
+
+            for (htd::index_t position = graph.offsets[vertex]; position < graph.offsets[vertex + 1]; ++position)
+            {
+                htd::vertex_t neighbor = graph.neighbors[position];
+
+                if (mapping[neighbor] == unassigned && graph.edgeWeights[position] > partnerEdgeWeight)
+                {
+                    partner = neighbor;
+
+                    partnerEdgeWeight = graph.edgeWeights[position];
+                }
+            }
+
+            mapping[vertex] = (htd::vertex_t)members.size();
+            mapping[partner] = (htd::vertex_t)members.size();
+
+            members.emplace_back(vertex, partner);
+        }
+    }
+
+    std::size_t coarseSize = members.size();
+
+    coarseGraph.offsets.clear();
+    coarseGraph.offsets.reserve(coarseSize + 1);
+    coarseGraph.offsets.push_back(0);
+
+    coarseGraph.neighbors.clear();
+    coarseGraph.edgeWeights.clear();
+
+    coarseGraph.vertexWeights.assign(coarseSize, 0);
+
+    /* The coarse vertex for which the position of each coarse neighbor was recorded most recently. */
+    std::vector<htd::vertex_t> marker(coarseSize, unassigned);
+
+    std::vector<std::size_t> neighborPosition(coarseSize, 0);
+
+    for (htd::vertex_t coarseVertex = 0; coarseVertex < coarseSize; ++coarseVertex)
+    {
+        const std::pair<htd::vertex_t, htd::vertex_t> & currentMembers = members[coarseVertex];
+
+        for (htd::index_t memberIndex = 0; memberIndex < 2; ++memberIndex)
+        {
+            htd::vertex_t member = memberIndex == 0 ? currentMembers.first : currentMembers.second;
+
+            if (memberIndex == 0 || member != currentMembers.first)
+            {
+                coarseGraph.vertexWeights[coarseVertex] += graph.vertexWeights[member];
+
+                for (htd::index_t position = graph.offsets[member]; position < graph.offsets[member + 1]; ++position)
+                {
+                    htd::vertex_t coarseNeighbor = mapping[graph.neighbors[position]];
+
+                    if (coarseNeighbor != coarseVertex)
+                    {
+                        if (marker[coarseNeighbor] == coarseVertex)
+                        {
+                            coarseGraph.edgeWeights[neighborPosition[coarseNeighbor]] += graph.edgeWeights[position];
+                        }
+                        else
+                        {
+                            marker[coarseNeighbor] = coarseVertex;
+
+                            neighborPosition[coarseNeighbor] = coarseGraph.neighbors.size();
+
+                            coarseGraph.neighbors.push_back(coarseNeighbor);
+
+                            coarseGraph.edgeWeights.push_back(graph.edgeWeights[position]);
+                        }
+                    }
+                }
+            }
+        }
+
+        coarseGraph.offsets.push_back(coarseGraph.neighbors.size());
+    }
+}
+
+void htd::NestedDissectionOrderingAlgorithm::Implementation::computeInitialBisection(const WeightedGraph & graph, std::vector<htd::index_t> & side, std::mt19937 & generator) const
+{
+    std::size_t size = graph.vertexCount();
+
+    std::size_t totalWeight = std::accumulate(graph.vertexWeights.begin(), graph.vertexWeights.end(), (std::size_t)0);
+
+    std::vector<htd::index_t> candidate(size);
+
+    std::vector<htd::vertex_t> queue;
+    queue.reserve(size);
+
+    std::uniform_int_distribution<std::size_t> distribution(0, size - 1);
+
+    std::size_t bestCutWeight = std::numeric_limits<std::size_t>::max();
+
+    std::size_t bestImbalance = std::numeric_limits<std::size_t>::max();
+
+    for (htd::index_t attempt = 0; attempt < INITIAL_BISECTION_COUNT; ++attempt)
+    {
+        std::fill(candidate.begin(), candidate.end(), 1);
+
+        queue.clear();
+
+        htd::vertex_t start = (htd::vertex_t)distribution(generator);
+
+        candidate[start] = 0;
+
+        queue.push_back(start);
+
+        std::size_t weight = graph.vertexWeights[start];
+
+        htd::index_t head = 0;
+
+        htd::vertex_t nextUnreachedVertex = 0;
+
+        /* Grow the first side from the start vertex in breadth-first order until it holds half of the total weight. */
+        while (weight * 2 < totalWeight)
+        {
+            if (head == queue.size())
+            {
+                while (candidate[nextUnreachedVertex] == 0)
+                {
+                    ++nextUnreachedVertex;
+                }
+
+                candidate[nextUnreachedVertex] = 0;
+
+                queue.push_back(nextUnreachedVertex);
+
+                weight += graph.vertexWeights[nextUnreachedVertex];
+            }
+            else
+            {
+                htd::vertex_t vertex = queue[head];
+
+                ++head;
+
+                for (htd::index_t position = graph.offsets[vertex]; position < graph.offsets[vertex + 1] && weight * 2 < totalWeight; ++position)
+                {
+                    htd::vertex_t neighbor = graph.neighbors[position];
+
+                    if (candidate[neighbor] == 1)
+                    {
+                        candidate[neighbor] = 0;
+
+                        queue.push_back(neighbor);
+
+                        weight += graph.vertexWeights[neighbor];
+                    }
+                }
+            }
+        }
+
+        refineBisection(graph, candidate);
+
+        std::size_t currentCutWeight = cutWeight(graph, candidate);
+
+        std::size_t sideWeight = 0;
+
+        for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
+        {
+            if (candidate[vertex] == 0)
+            {
+                sideWeight += graph.vertexWeights[vertex];
+            }
+        }
+
+        std::size_t imbalance = sideWeight * 2 > totalWeight ? sideWeight * 2 - totalWeight : totalWeight - sideWeight * 2;
+
+        if (currentCutWeight < bestCutWeight || (currentCutWeight == bestCutWeight && imbalance < bestImbalance))
+        {
+            bestCutWeight = currentCutWeight;
+
+            bestImbalance = imbalance;
+
+            side = candidate;
+        }
+    }
+}
+
+void htd::NestedDissectionOrderingAlgorithm::Implementation::refineBisection(const WeightedGraph & graph, std::vector<htd::index_t> & side) const
+{
+    std::size_t size = graph.vertexCount();
+
+    std::size_t maxSideWeight = maximumSideWeight(graph);
+
+    std::size_t sideWeight[2] = { 0, 0 };
+
+    /* The gain of each vertex is the reduction of the cut weight which is achieved by moving it to the other side. */
+    std::vector<std::int64_t> gain(size, 0);
+
+    std::vector<bool> boundary(size, false);
+
+    for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
+    {
+        sideWeight[side[vertex]] += graph.vertexWeights[vertex];
+
+        for (htd::index_t position = graph.offsets[vertex]; position < graph.offsets[vertex + 1]; ++position)
+        {
+            if (side[graph.neighbors[position]] != side[vertex])
+            {
+                gain[vertex] += (std::int64_t)graph.edgeWeights[position];
+
+                boundary[vertex] = true;
+            }
+            else
+            {
+                gain[vertex] -= (std::int64_t)graph.edgeWeights[position];
+            }
+        }
+    }
+
+    std::vector<bool> locked(size);
+
+    std::vector<htd::vertex_t> moves;
+
+    bool improved = true;
+
+    for (htd::index_t pass = 0; pass < REFINEMENT_PASS_COUNT && improved && !managementInstance_->isTerminated(); ++pass)
+    {
+        std::fill(locked.begin(), locked.end(), false);
+
+        moves.clear();
+
+        std::priority_queue<std::pair<std::int64_t, htd::vertex_t>> queue;
+
+        for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
+        {
+            if (boundary[vertex])
+            {
+                queue.emplace(gain[vertex], vertex);
+            }
+        }
+
+        /* The states are rated by the weight exceeding the balance constraint, the change of the cut weight and the imbalance. */
+        std::size_t bestExcess = std::max(std::max(sideWeight[0], sideWeight[1]), maxSideWeight) - maxSideWeight;
+
+        std::int64_t bestCutChange = 0;
+
+        std::size_t bestImbalance = std::max(sideWeight[0], sideWeight[1]) - std::min(sideWeight[0], sideWeight[1]);
+
+        std::size_t bestMoveCount = 0;
+
+        std::int64_t cutChange = 0;
+
+        while (!queue.empty() && moves.size() < bestMoveCount + MAXIMUM_UNSUCCESSFUL_MOVE_COUNT)
+        {
+            htd::vertex_t vertex = queue.top().second;
+
+            std::int64_t vertexGain = queue.top().first;
+
+            queue.pop();
+
+            htd::index_t from = side[vertex];
+
+            htd::index_t to = 1 - from;
+
+            /* Entries with outdated gains are skipped, the current gain of the vertex is contained in the queue as well. */
+            if (!locked[vertex] && vertexGain == gain[vertex] && sideWeight[to] + graph.vertexWeights[vertex] <= std::max(maxSideWeight, sideWeight[from]))
+            {
+                locked[vertex] = true;
+
+                side[vertex] = to;
+
+                sideWeight[from] -= graph.vertexWeights[vertex];
+                sideWeight[to] += graph.vertexWeights[vertex];
+
+                cutChange -= vertexGain;
+
+                gain[vertex] = -vertexGain;
+
+                moves.push_back(vertex);
+
+                for (htd::index_t position = graph.offsets[vertex]; position < graph.offsets[vertex + 1]; ++position)
+                {
+                    htd::vertex_t neighbor = graph.neighbors[position];
+
+                    if (side[neighbor] == to)
+                    {
+                        gain[neighbor] -= 2 * (std::int64_t)graph.edgeWeights[position];
+                    }
+                    else
+                    {
+                        gain[neighbor] += 2 * (std::int64_t)graph.edgeWeights[position];
+                    }
+
+                    if (!locked[neighbor])
+                    {
+                        queue.emplace(gain[neighbor], neighbor);
+                    }
+                }
+
+                std::size_t excess = std::max(std::max(sideWeight[0], sideWeight[1]), maxSideWeight) - maxSideWeight;
+
+                std::size_t imbalance = std::max(sideWeight[0], sideWeight[1]) - std::min(sideWeight[0], sideWeight[1]);
+
+                if (excess < bestExcess || (excess == bestExcess && (cutChange < bestCutChange || (cutChange == bestCutChange && imbalance < bestImbalance))))
+                {
+                    bestExcess = excess;
+
+                    bestCutChange = cutChange;
+
+                    bestImbalance = imbalance;
+
+                    bestMoveCount = moves.size();
+                }
+            }
+        }
+
+        /* Undo all moves after the best state of the pass. */
+        while (moves.size() > bestMoveCount)
+        {
+            htd::vertex_t vertex = moves.back();
+
+            moves.pop_back();
+
+            htd::index_t from = side[vertex];
+
+            htd::index_t to = 1 - from;
+
+            side[vertex] = to;
+
+            sideWeight[from] -= graph.vertexWeights[vertex];
+            sideWeight[to] += graph.vertexWeights[vertex];
+
+            gain[vertex] = -gain[vertex];
+
+            for (htd::index_t position = graph.offsets[vertex]; position < graph.offsets[vertex + 1]; ++position)
+            {
+                htd::vertex_t neighbor = graph.neighbors[position];
+
+                if (side[neighbor] == to)
+                {
+                    gain[neighbor] -= 2 * (std::int64_t)graph.edgeWeights[position];
+                }
+                else
+                {
+                    gain[neighbor] += 2 * (std::int64_t)graph.edgeWeights[position];
+                }
+            }
+        }
+
+        improved = bestMoveCount > 0;
+
+        if (improved)
+        {
+            for (htd::vertex_t vertex : moves)
+            {
+                boundary[vertex] = true;
+
+                for (htd::index_t position = graph.offsets[vertex]; position < graph.offsets[vertex + 1]; ++position)
+                {
+                    boundary[graph.neighbors[position]] = true;
+                }
+            }
+        }
+    }
+}
+
+void htd::NestedDissectionOrderingAlgorithm::Implementation::computeVertexSeparator(const WeightedGraph & graph, std::vector<htd::index_t> & side) const
+{
+    std::size_t size = graph.vertexCount();
+
+    const std::size_t unassigned = std::numeric_limits<std::size_t>::max();
+
+    /* The endpoints of the cut edges form a bipartite graph whose left vertices belong to side 0 and whose right vertices belong to side 1. */
+    std::vector<std::size_t> bipartiteIndex(size, unassigned);
+
+    std::vector<htd::vertex_t> leftVertices;
+
+    std::vector<htd::vertex_t> rightVertices;
+
+    for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
+    {
+        bool cut = false;
+
+        for (htd::index_t position = graph.offsets[vertex]; position < graph.offsets[vertex + 1] && !cut; ++position)
+        {
+            cut = side[graph.neighbors[position]] != side[vertex];
+        }
+
+        if (cut)
+        {
+            std::vector<htd::vertex_t> & currentVertices = side[vertex] == 0 ? leftVertices : rightVertices;
+
+            bipartiteIndex[vertex] = currentVertices.size();
+
+            currentVertices.push_back(vertex);
+        }
+    }
+
+    std::vector<std::size_t> leftOffsets;
+    leftOffsets.reserve(leftVertices.size() + 1);
+    leftOffsets.push_back(0);
+
+    std::vector<std::size_t> leftNeighbors;
+
+    for (htd::vertex_t vertex : leftVertices)
+    {
+        for (htd::index_t position = graph.offsets[vertex]; position < graph.offsets[vertex + 1]; ++position)
+        {
+            htd::vertex_t neighbor = graph.neighbors[position];
+
+            if (side[neighbor] == 1)
+            {
+                leftNeighbors.push_back(bipartiteIndex[neighbor]);
+            }
+        }
+
+        leftOffsets.push_back(leftNeighbors.size());
+    }
+
+    /* Compute a maximum matching of the bipartite graph via augmenting paths. */
+    std::vector<std::size_t> leftMatch(leftVertices.size(), unassigned);
+
+    std::vector<std::size_t> rightMatch(rightVertices.size(), unassigned);
+
+    std::vector<std::size_t> visited(leftVertices.size(), unassigned);
+
+    /* Each stack entry holds a left vertex and the position of its next neighbor which shall be visited. */
+    std::vector<std::pair<std::size_t, std::size_t>> stack;
+
+    for (htd::index_t leftVertex = 0; leftVertex < leftVertices.size() && !managementInstance_->isTerminated(); ++leftVertex)
+    {
+        bool augmented = false;
+
+        stack.clear();
+
+        stack.emplace_back(leftVertex, leftOffsets[leftVertex]);
+
+        visited[leftVertex] = leftVertex;
+
+        while (!stack.empty() && !augmented)
+        {
+            std::pair<std::size_t, std::size_t> & top = stack.back();
+
+            if (top.second == leftOffsets[top.first + 1])
+            {
+                stack.pop_back();
+            }
+            else
+            {
+                std::size_t rightVertex = leftNeighbors[top.second];
+
+                ++top.second;
+
+                if (rightMatch[rightVertex] == unassigned)
+                {
+                    /* Each left vertex on the stack is matched with the right vertex via which the search continued. */
+                    for (const std::pair<std::size_t, std::size_t> & entry : stack)
+                    {
+                        std::size_t matchedVertex = leftNeighbors[entry.second - 1];
+
+                        leftMatch[entry.first] = matchedVertex;
+
+                        rightMatch[matchedVertex] = entry.first;
+                    }
+
+                    augmented = true;
+                }
+                else if (visited[rightMatch[rightVertex]] != leftVertex)
+                {
+                    visited[rightMatch[rightVertex]] = leftVertex;
+
+                    stack.emplace_back(rightMatch[rightVertex], leftOffsets[rightMatch[rightVertex]]);
+                }
+            }
+        }
+    }
+
+    /*
+     *  According to König's theorem, a minimum vertex cover consists of the left vertices which are not reachable from an
+     *  unmatched left vertex via alternating paths and of the right vertices which are reachable in this way.
+     */
+    std::vector<bool> leftReached(leftVertices.size(), false);
+
+    std::vector<bool> rightReached(rightVertices.size(), false);
+
+    std::vector<std::size_t> queue;
+
+    for (htd::index_t leftVertex = 0; leftVertex < leftVertices.size(); ++leftVertex)
+    {
+        if (leftMatch[leftVertex] == unassigned)
+        {
+            leftReached[leftVertex] = true;
+
+            queue.push_back(leftVertex);
+        }
+    }
+
+    for (htd::index_t head = 0; head < queue.size(); ++head)
+    {
+        std::size_t leftVertex = queue[head];
+
+        for (htd::index_t position = leftOffsets[leftVertex]; position < leftOffsets[leftVertex + 1]; ++position)
+        {
+            std::size_t rightVertex = leftNeighbors[position];
+
+            if (!rightReached[rightVertex])
+            {
+                rightReached[rightVertex] = true;
+
+                std::size_t matchedVertex = rightMatch[rightVertex];
+
+                if (matchedVertex != unassigned && !leftReached[matchedVertex])
+                {
+                    leftReached[matchedVertex] = true;
+
+                    queue.push_back(matchedVertex);
+                }
+            }
+        }
+    }
+
+    std::size_t sideWeight[3] = { 0, 0, 0 };
+
+    for (htd::index_t leftVertex = 0; leftVertex < leftVertices.size(); ++leftVertex)
+    {
+        if (!leftReached[leftVertex])
+        {
+            side[leftVertices[leftVertex]] = 2;
+        }
+    }
+
+    for (htd::index_t rightVertex = 0; rightVertex < rightVertices.size(); ++rightVertex)
+    {
+        if (rightReached[rightVertex])
+        {
+            side[rightVertices[rightVertex]] = 2;
+        }
+    }
+
+    for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
+    {
+        sideWeight[side[vertex]] += graph.vertexWeights[vertex];
+    }
+
+    std::size_t maxSideWeight = maximumSideWeight(graph);
+
+    bool improved = true;
+
+    for (htd::index_t pass = 0; pass < REFINEMENT_PASS_COUNT && improved; ++pass)
+    {
+        improved = false;
+
+        for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
+        {
+            /* Separator vertices are preferably moved to the lighter side. */
+            for (htd::index_t attempt = 0; attempt < 2 && side[vertex] == 2; ++attempt)
+            {
+                htd::index_t targetSide = sideWeight[0] <= sideWeight[1] ? attempt : 1 - attempt;
+
+                htd::index_t otherSide = 1 - targetSide;
+
+                std::size_t cost = 0;
+
+                for (htd::index_t position = graph.offsets[vertex]; position < graph.offsets[vertex + 1]; ++position)
+                {
+                    htd::vertex_t neighbor = graph.neighbors[position];
+
+                    if (side[neighbor] == otherSide)
+                    {
+                        cost += graph.vertexWeights[neighbor];
+                    }
+                }
+
+                if (cost < graph.vertexWeights[vertex] && sideWeight[targetSide] + graph.vertexWeights[vertex] <= maxSideWeight)
+                {
+                    side[vertex] = targetSide;
+
+                    sideWeight[2] -= graph.vertexWeights[vertex];
+                    sideWeight[targetSide] += graph.vertexWeights[vertex];
+
+                    for (htd::index_t position = graph.offsets[vertex]; position < graph.offsets[vertex + 1]; ++position)
+                    {
+                        htd::vertex_t neighbor = graph.neighbors[position];
+
+                        if (side[neighbor] == otherSide)
+                        {
+                            side[neighbor] = 2;
+
+                            sideWeight[otherSide] -= graph.vertexWeights[neighbor];
+                            sideWeight[2] += graph.vertexWeights[neighbor];
+                        }
+                    }
+
+                    improved = true;
+                }
+            }
+        }
+    }
+}
+
+std::size_t htd::NestedDissectionOrderingAlgorithm::Implementation::maximumSideWeight(const WeightedGraph & graph) const
+{
+    std::size_t totalWeight = std::accumulate(graph.vertexWeights.begin(), graph.vertexWeights.end(), (std::size_t)0);
+
+    std::size_t maxVertexWeight = graph.vertexWeights.empty() ? 0 : *std::max_element(graph.vertexWeights.begin(), graph.vertexWeights.end());
+
+    /* Heavy vertices of coarse graphs would prevent any move if the balance constraint did not account for them. */
+    return std::max(totalWeight * MAXIMUM_SIDE_WEIGHT_PERCENTAGE / 100, (totalWeight + 1) / 2 + maxVertexWeight);
+}
+
+std::size_t htd::NestedDissectionOrderingAlgorithm::Implementation::cutWeight(const WeightedGraph & graph, const std::vector<htd::index_t> & side) const
+{
+    std::size_t ret = 0;
+
+    for (htd::vertex_t vertex = 0; vertex < graph.vertexCount(); ++vertex)
+    {
+        for (htd::index_t position = graph.offsets[vertex]; position < graph.offsets[vertex + 1]; ++position)
+        {
+            if (side[graph.neighbors[position]] != side[vertex])
+            {
+                ret += graph.edgeWeights[position];
+            }
+        }
+    }
+
+    return ret / 2;
+}
+
+const htd::LibraryInstance * htd::NestedDissectionOrderingAlgorithm::managementInstance(void) const HTD_NOEXCEPT
+{
+    return implementation_->managementInstance_;
+}
+
+void htd::NestedDissectionOrderingAlgorithm::setManagementInstance(const htd::LibraryInstance * const manager)
+{
+    HTD_ASSERT(manager != nullptr)
+
+    implementation_->managementInstance_ = manager;
+}
+
+void htd::NestedDissectionOrderingAlgorithm::setLeafOrderingAlgorithm(htd::IOrderingAlgorithm * algorithm)
+{
+    HTD_ASSERT(algorithm != nullptr)
+
+    delete implementation_->leafOrderingAlgorithm_;
+
+    implementation_->leafOrderingAlgorithm_ = algorithm;
+}
+
+std::size_t htd::NestedDissectionOrderingAlgorithm::leafSize(void) const
+{
+    return implementation_->leafSize_;
+}
+
+void htd::NestedDissectionOrderingAlgorithm::setLeafSize(std::size_t leafSize)
+{
+    HTD_ASSERT(leafSize > 0)
+
+    implementation_->leafSize_ = leafSize;
+}
+
+std::size_t htd::NestedDissectionOrderingAlgorithm::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::NestedDissectionOrderingAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    HTD_ASSERT(threadCount > 0)
+
+    implementation_->threadCount_ = threadCount;
+}
+
+htd::NestedDissectionOrderingAlgorithm * htd::NestedDissectionOrderingAlgorithm::clone(void) const
+{
+    return new htd::NestedDissectionOrderingAlgorithm(*this);
+}
+
+#ifdef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+htd::IOrderingAlgorithm * htd::NestedDissectionOrderingAlgorithm::cloneOrderingAlgorithm(void) const
+{
+    return clone();
+}
+#endif
+
+#endif /* HTD_HTD_NESTEDDISSECTIONORDERINGALGORITHM_CPP */
@@ -0,0 +1,74 @@
+/* 
+ * File:   NewDeleteMemoryResource.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_NEWDELETEMEMORYRESOURCE_CPP
+#define HTD_HTD_NEWDELETEMEMORYRESOURCE_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/NewDeleteMemoryResource.hpp>
+
+#include <new>
+
+htd::NewDeleteMemoryResource::NewDeleteMemoryResource(void)
+{
+
+}
+
+htd::NewDeleteMemoryResource::~NewDeleteMemoryResource()
+{
+
+}
+
+void * htd::NewDeleteMemoryResource::allocate(std::size_t bytes, std::size_t alignment)
+{
+    HTD_ASSERT(alignment <= alignof(std::max_align_t))
+
+    HTD_UNUSED(alignment)
+
+    return ::operator new(bytes);
+}
+
+void htd::NewDeleteMemoryResource::deallocate(void * pointer, std::size_t bytes, std::size_t alignment)
+{
+    HTD_UNUSED(bytes)
+    HTD_UNUSED(alignment)
+
+    ::operator delete(pointer);
+}
+
+bool htd::NewDeleteMemoryResource::isThreadSafe(void) const
+{
+    return true;
+}
+
+htd::NewDeleteMemoryResource & htd::NewDeleteMemoryResource::instance(void)
+{
+    static htd::NewDeleteMemoryResource ret;
+
+    return ret;
+}
+
+#endif /* HTD_HTD_NEWDELETEMEMORYRESOURCE_CPP */
@@ -0,0 +1,221 @@
+/* 
+ * File:   PoolMemoryResource.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_POOLMEMORYRESOURCE_CPP
+#define HTD_HTD_POOLMEMORYRESOURCE_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/NewDeleteMemoryResource.hpp>
+#include <htd/PoolMemoryResource.hpp>
+
+#include <utility>
+#include <vector>
+
+/**
+ *  Private implementation details of class htd::PoolMemoryResource.
+ */
+struct htd::PoolMemoryResource::Implementation
+{
+    /**
+     *  The granularity of the block sizes in bytes.
+     */
+    static const std::size_t GRANULARITY = alignof(std::max_align_t);
+
+    /**
+     *  Structure representing a pool of blocks of identical size.
+     */
+    struct Pool
+    {
+        /**
+         *  The first free block of the pool. The first bytes of each free block hold the pointer to the next free block.
+         */
+        void * freeList;
+
+        /**
+         *  The chunks obtained from the upstream memory resource.
+         */
+        std::vector<void *> chunks;
+
+        /**
+         *  Constructor for a pool.
+         */
+        Pool(void) : freeList(nullptr), chunks()
+        {
+
+        }
+    };
+
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] upstream         The memory resource from which the chunks are obtained.
+     *  @param[in] maxBlockSize     The size of the largest block in bytes which is served from a pool.
+     *  @param[in] blocksPerChunk   The number of blocks which are obtained from the upstream memory resource at once.
+     */
+    Implementation(htd::IMemoryResource * upstream, std::size_t maxBlockSize, std::size_t blocksPerChunk) : upstream_(upstream), pools_((maxBlockSize + GRANULARITY - 1) / GRANULARITY), blocksPerChunk_(blocksPerChunk), reservedBytes_(0)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+        for (htd::index_t index = 0; index < pools_.size(); ++index)
+        {
+            for (void * chunk : pools_[index].chunks)
+            {
+                upstream_->deallocate(chunk, chunkSize(index), GRANULARITY);
+            }
+        }
+    }
+
+    /**
+     *  The memory resource from which the chunks are obtained.
+     */
+    htd::IMemoryResource * upstream_;
+
+    /**
+     *  The pools, ordered by ascending block size.
+     */
+    std::vector<Pool> pools_;
+
+    /**
+     *  The number of blocks which are obtained from the upstream memory resource at once.
+     */
+    std::size_t blocksPerChunk_;
+
+    /**
+     *  The total size of the chunks in bytes.
+     */
+    std::size_t reservedBytes_;
+
+    /**
+     *  Getter for the index of the pool serving requests of the given size.
+     *
+     *  @param[in] bytes    The size of the request in bytes.
+     *
+     *  @return The index of the pool serving requests of the given size. If the index is not smaller than the number of pools, the request is not served by a pool.
+     */
+    static htd::index_t poolIndex(std::size_t bytes)
+    {
+        return bytes > 0 ? (bytes - 1) / GRANULARITY : 0;
+    }
+
+    /**
+     *  Getter for the size of the chunks of the pool with the given index.
+     *
+     *  @param[in] index    The index of the pool.
+     *
+     *  @return The size of the chunks of the pool with the given index in bytes.
+     */
+    std::size_t chunkSize(htd::index_t index) const
+    {
+        return (index + 1) * GRANULARITY * blocksPerChunk_;
+    }
+};
+
+htd::PoolMemoryResource::PoolMemoryResource(htd::IMemoryResource * upstream, std::size_t maxBlockSize, std::size_t blocksPerChunk) : implementation_(new Implementation(upstream != nullptr ? upstream : &(htd::NewDeleteMemoryResource::instance()), maxBlockSize, blocksPerChunk > 0 ? blocksPerChunk : 1))
+{
+
+}
+
+htd::PoolMemoryResource::~PoolMemoryResource()
+{
+
+}
+
+void * htd::PoolMemoryResource::allocate(std::size_t bytes, std::size_t alignment)
+{
+    HTD_ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0 && alignment <= alignof(std::max_align_t))
+
+    Implementation & implementation = *implementation_;
+
+    htd::index_t index = Implementation::poolIndex(bytes);
+
+    if (index >= implementation.pools_.size())
+    {
+        return implementation.upstream_->allocate(bytes, alignment);
+    }
+
+    Implementation::Pool & pool = implementation.pools_[index];
+
+    if (pool.freeList == nullptr)
+    {
+        std::size_t blockSize = (index + 1) * Implementation::GRANULARITY;
+
+        char * chunk = static_cast<char *>(implementation.upstream_->allocate(implementation.chunkSize(index), Implementation::GRANULARITY));
+
+        pool.chunks.push_back(chunk);
+
+        implementation.reservedBytes_ += implementation.chunkSize(index);
+
+        for (std::size_t block = implementation.blocksPerChunk_; block > 0; --block)
+        {
+            void * current = chunk + (block - 1) * blockSize;
+
+            *static_cast<void **>(current) = pool.freeList;
+
+            pool.freeList = current;
+        }
+    }
+
+    void * ret = pool.freeList;
+
+    pool.freeList = *static_cast<void **>(ret);
+
+    return ret;
+}
+
+void htd::PoolMemoryResource::deallocate(void * pointer, std::size_t bytes, std::size_t alignment)
+{
+    Implementation & implementation = *implementation_;
+
+    htd::index_t index = Implementation::poolIndex(bytes);
+
+    if (index >= implementation.pools_.size())
+    {
+        implementation.upstream_->deallocate(pointer, bytes, alignment);
+    }
+    else
+    {
+        Implementation::Pool & pool = implementation.pools_[index];
+
+        *static_cast<void **>(pointer) = pool.freeList;
+
+        pool.freeList = pointer;
+    }
+}
+
+bool htd::PoolMemoryResource::isThreadSafe(void) const
+{
+    return false;
+}
+
+std::size_t htd::PoolMemoryResource::reservedBytes(void) const
+{
+    return implementation_->reservedBytes_;
+}
+
+#endif /* HTD_HTD_POOLMEMORYRESOURCE_CPP */
@@ -28,6 +28,7 @@
 #include <htd/Globals.hpp>
 #include <htd/Helpers.hpp>
 #include <htd/PostOrderTreeTraversal.hpp>
+#include <htd/TreeTraversal.hpp>
 
 #include <stack>
 #include <stdexcept>
@@ -112,91 +113,7 @@ void htd::PostOrderTreeTraversal::traverse(const htd::ITree & tree, const std::f
 {
     HTD_ASSERT(tree.isVertex(startingVertex))
 
-    htd::vertex_t lastNode = htd::Vertex::UNKNOWN;
-
-    htd::vertex_t peekNode = htd::Vertex::UNKNOWN;
-
-    htd::vertex_t currentNode = startingVertex;
-
-    htd::index_t lastIndex = 0;
-
-    htd::index_t peekIndex = 0;
-
-    htd::index_t currentIndex = tree.childCount(currentNode) - 1;
-
-    std::size_t currentDepth = 0;
-
-    std::stack<std::pair<htd::vertex_t, htd::index_t>> parentStack;
-
-    while (!parentStack.empty() || currentNode != htd::Vertex::UNKNOWN)
-    {
-        if (currentNode != htd::Vertex::UNKNOWN)
-        {
-            if (currentIndex < tree.childCount(currentNode))
-            {
-                parentStack.emplace(currentNode, currentIndex);
-
-                currentNode = tree.childAtPosition(currentNode, currentIndex);
-
-                currentIndex = tree.childCount(currentNode) - 1;
-
-                ++currentDepth;
-            }
-            else
-            {
-                if (!parentStack.empty() && parentStack.top().first != htd::Vertex::UNKNOWN)
-                {
-                    targetFunction(currentNode, std::get<0>(parentStack.top()), currentDepth);
-
-                    parentStack.top().second--;
-
-                    --currentDepth;
-                }
-                else
-                {
-                    targetFunction(startingVertex, htd::Vertex::UNKNOWN, 0);
-                }
-
-                currentNode = htd::Vertex::UNKNOWN;
-            }
-        }
-        else
-        {
-            peekNode = parentStack.top().first;
-            peekIndex = parentStack.top().second;
-
-            if (peekIndex < tree.childCount(peekNode) && !(lastNode == peekNode && lastIndex == peekIndex))
-            {
-                currentNode = tree.childAtPosition(peekNode, peekIndex);
-
-                currentIndex = tree.childCount(currentNode) - 1;
-
-                ++currentDepth;
-            }
-            else
-            {
-                lastNode = peekNode;
-                lastIndex = peekIndex;
-
-                currentNode = htd::Vertex::UNKNOWN;
-
-                parentStack.pop();
-
-                if (!parentStack.empty() && parentStack.top().first != htd::Vertex::UNKNOWN)
-                {
-                    targetFunction(peekNode, std::get<0>(parentStack.top()), currentDepth);
-
-                    parentStack.top().second--;
-
-                    --currentDepth;
-                }
-                else
-                {
-                    targetFunction(startingVertex, htd::Vertex::UNKNOWN, 0);
-                }
-            }
-        }
-    }
+    htd::TreeTraversal::postOrder(tree, targetFunction, startingVertex);
 }
 
 #endif /* HTD_HTD_POSTORDERTREETRAVERSAL_CPP */
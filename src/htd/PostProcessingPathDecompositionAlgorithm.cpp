@@ -28,6 +28,7 @@
 #include <htd/Globals.hpp>
 #include <htd/Helpers.hpp>
 #include <htd/PostProcessingPathDecompositionAlgorithm.hpp>
+#include <htd/ScopedTimer.hpp>
 #include <htd/PathDecompositionFactory.hpp>
 #include <htd/TreeDecompositionFactory.hpp>
 #include <htd/TreeDecompositionAlgorithmFactory.hpp>
@@ -38,6 +39,7 @@
 
 #include <cstdarg>
 #include <stdexcept>
+#include <typeinfo>
 #include <vector>
 
 /**
@@ -180,11 +182,15 @@ htd::IPathDecomposition * htd::PostProcessingPathDecompositionAlgorithm::compute
 
     for (const auto & operation : implementation_->postProcessingOperations_)
     {
+        htd::ScopedTimer timer(implementation_->managementInstance_, typeid(*operation), "manipulation");
+
         operation->apply(graph, *ret);
     }
 
     for (const auto & operation : postProcessingOperations)
     {
+        htd::ScopedTimer timer(implementation_->managementInstance_, typeid(*operation), "manipulation");
+
         operation->apply(graph, *ret);
     }
 
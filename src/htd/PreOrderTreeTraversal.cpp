@@ -28,8 +28,8 @@
 #include <htd/Globals.hpp>
 #include <htd/Helpers.hpp>
 #include <htd/PreOrderTreeTraversal.hpp>
+#include <htd/TreeTraversal.hpp>
 
-#include <stack>
 #include <stdexcept>
 #include <utility>
 
@@ -92,56 +92,7 @@ void htd::PreOrderTreeTraversal::traverse(const htd::ITree & tree, const std::fu
 {
     HTD_ASSERT(tree.isVertex(startingVertex))
 
-    htd::vertex_t currentNode = startingVertex;
-
-    std::size_t currentDepth = 0;
-
-    htd::index_t currentIndex = 0;
-
-    std::stack<std::pair<htd::vertex_t, htd::index_t>> parentStack;
-
-    while (!parentStack.empty() || currentNode != htd::Vertex::UNKNOWN)
-    {
-        if (currentNode != htd::Vertex::UNKNOWN)
-        {
-            if (currentIndex == 0)
-            {
-                if (!parentStack.empty())
-                {
-                    targetFunction(currentNode, std::get<0>(parentStack.top()), currentDepth);
-                }
-                else
-                {
-                    targetFunction(currentNode, htd::Vertex::UNKNOWN, 0);
-                }
-            }
-
-            if (currentIndex < tree.childCount(currentNode))
-            {
-                parentStack.emplace(currentNode, currentIndex + 1);
-
-                currentNode = tree.childAtPosition(currentNode, currentIndex);
-
-                currentIndex = 0;
-
-                ++currentDepth;
-            }
-            else
-            {
-                currentNode = htd::Vertex::UNKNOWN;
-            }
-        }
-        else
-        {
-            currentNode = parentStack.top().first;
-
-            currentIndex = parentStack.top().second;
-
-            --currentDepth;
-
-            parentStack.pop();
-        }
-    }
+    htd::TreeTraversal::preOrder(tree, targetFunction, startingVertex);
 }
 
 #endif /* HTD_HTD_PREORDERTREETRAVERSAL_CPP */
@@ -28,12 +28,11 @@
 #include <htd/Helpers.hpp>
 
 #include <htd/PreprocessedGraph.hpp>
+#include <htd/ScopedWorkspace.hpp>
 
 #include <htd/VectorAdapter.hpp>
 
 #include <algorithm>
-#include <stack>
-#include <unordered_set>
 #include <vector>
 
 /**
@@ -307,39 +306,39 @@ bool htd::PreprocessedGraph::isConnected(void) const
 
     if (!(implementation_->remainingVertices_.empty()))
     {
-        std::stack<htd::vertex_t> originStack;
+        htd::ScopedWorkspace workspace;
 
-        std::unordered_set<htd::vertex_t> visitedVertices;
+        workspace->beginVisit(implementation_->neighborhood_.size());
 
-        htd::vertex_t currentVertex = implementation_->remainingVertices_[0];
+        std::vector<htd::vertex_t> & originStack = workspace->buffer<htd::vertex_t>();
 
-        originStack.push(currentVertex);
+        std::size_t visitedVertexCount = 0;
+
+        originStack.clear();
+
+        originStack.push_back(implementation_->remainingVertices_[0]);
 
         while (!originStack.empty())
         {
-            currentVertex = originStack.top();
+            htd::vertex_t currentVertex = originStack.back();
 
-            if (visitedVertices.count(currentVertex) == 0)
-            {
-                visitedVertices.insert(currentVertex);
+            originStack.pop_back();
 
-                originStack.pop();
+            if (workspace->visit(currentVertex))
+            {
+                ++visitedVertexCount;
 
                 for (htd::vertex_t neighbor : implementation_->neighborhood_[currentVertex])
                 {
-                    if (visitedVertices.count(neighbor) == 0)
+                    if (!workspace->isVisited(neighbor))
                     {
-                        originStack.push(neighbor);
+                        originStack.push_back(neighbor);
                     }
                 }
             }
-            else
-            {
-                originStack.pop();
-            }
         }
 
-        ret = visitedVertices.size() == implementation_->remainingVertices_.size();
+        ret = visitedVertexCount == implementation_->remainingVertices_.size();
     }
     else
     {
@@ -361,40 +360,33 @@ bool htd::PreprocessedGraph::isConnected(htd::vertex_t vertex1, htd::vertex_t ve
     }
     else
     {
-        std::vector<htd::vertex_t> newVertices;
-        std::vector<htd::vertex_t> tmpVertices;
+        htd::ScopedWorkspace workspace;
 
-        std::vector<bool> reachableVertices(implementation_->remainingVertices_.size());
+        workspace->beginVisit(implementation_->neighborhood_.size());
 
-        reachableVertices[vertex1] = true;
+        std::vector<htd::vertex_t> & reachableVertices = workspace->buffer<htd::vertex_t>();
 
-        newVertices.push_back(vertex1);
+        reachableVertices.clear();
 
-        while (!ret && !newVertices.empty())
+        workspace->visit(vertex1);
+
+        reachableVertices.push_back(vertex1);
+
+        for (htd::index_t index = 0; !ret && index < reachableVertices.size(); ++index)
         {
-            std::swap(tmpVertices, newVertices);
+            htd::vertex_t vertex = reachableVertices[index];
 
-            newVertices.resize(0);
+            const std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_[vertex];
 
-            for (auto it = tmpVertices.begin(); !ret && it != tmpVertices.end(); it++)
+            for (auto it = currentNeighborhood.begin(); !ret && it != currentNeighborhood.end(); ++it)
             {
-                const std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_[*it];
+                htd::vertex_t neighbor = *it;
 
-                for (auto it2 = currentNeighborhood.begin(); !ret && it2 != currentNeighborhood.end(); ++it2)
+                if (workspace->visit(neighbor))
                 {
-                    htd::vertex_t neighbor = *it2;
-
-                    if (!reachableVertices[neighbor])
-                    {
-                        reachableVertices[neighbor] = true;
-
-                        newVertices.push_back(neighbor);
+                    reachableVertices.push_back(neighbor);
 
-                        if (neighbor == vertex2)
-                        {
-                            ret = true;
-                        }
-                    }
+                    ret = neighbor == vertex2;
                 }
             }
         }
@@ -27,6 +27,7 @@
 
 #include <htd/Globals.hpp>
 #include <htd/RandomOrderingAlgorithm.hpp>
+#include <htd/Helpers.hpp>
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
 #include <htd/VertexOrdering.hpp>
@@ -72,6 +73,8 @@ htd::RandomOrderingAlgorithm::~RandomOrderingAlgorithm()
 
 htd::IVertexOrdering * htd::RandomOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT
 {
+    htd::RandomNumberGeneratorScope randomNumberGeneratorScope;
+
     htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
 
     htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
@@ -86,6 +89,8 @@ htd::IVertexOrdering * htd::RandomOrderingAlgorithm::computeOrdering(const htd::
 
 htd::IVertexOrdering * htd::RandomOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT
 {
+    htd::RandomNumberGeneratorScope randomNumberGeneratorScope;
+
     HTD_UNUSED(graph)
 
     std::vector<htd::vertex_t> ordering;
@@ -106,11 +111,7 @@ htd::IVertexOrdering * htd::RandomOrderingAlgorithm::computeOrdering(const htd::
         vertex = preprocessedGraph.vertexName(vertex);
     });
 
-    /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-    // coverity[dont_call]
-    std::mt19937 g(static_cast<std::mt19937::result_type>(std::rand()));
-
-    std::shuffle(middle, ordering.end(), g);
+    std::shuffle(middle, ordering.end(), htd::randomNumberGenerator());
 
     return new htd::VertexOrdering(std::move(ordering), 1);
 }
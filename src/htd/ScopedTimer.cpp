@@ -0,0 +1,66 @@
+/* 
+ * File:   ScopedTimer.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_SCOPEDTIMER_CPP
+#define HTD_HTD_SCOPEDTIMER_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/ScopedTimer.hpp>
+
+htd::ScopedTimer::ScopedTimer(const htd::LibraryInstance * const manager, const char * name, const char * category) : instrumentation_(manager->instrumentation()), name_(), category_(category), start_()
+{
+    if (instrumentation_ != nullptr)
+    {
+        name_ = name;
+
+        start_ = std::chrono::steady_clock::now();
+    }
+}
+
+htd::ScopedTimer::ScopedTimer(const htd::LibraryInstance * const manager, const std::type_info & type, const char * category) : instrumentation_(manager->instrumentation()), name_(), category_(category), start_()
+{
+    if (instrumentation_ != nullptr)
+    {
+        name_ = htd::Instrumentation::typeName(type);
+
+        start_ = std::chrono::steady_clock::now();
+    }
+}
+
+htd::ScopedTimer::~ScopedTimer()
+{
+    if (instrumentation_ != nullptr)
+    {
+        instrumentation_->recordEvent(name_, category_, start_, std::chrono::steady_clock::now());
+    }
+}
+
+const htd::Instrumentation * htd::ScopedTimer::instrumentation(void) const HTD_NOEXCEPT
+{
+    return instrumentation_;
+}
+
+#endif /* HTD_HTD_SCOPEDTIMER_CPP */
@@ -29,6 +29,7 @@
 #include <htd/Helpers.hpp>
 
 #include <htd/SeparatorBasedTreeDecompositionAlgorithm.hpp>
+#include <htd/ScopedTimer.hpp>
 #include <htd/ConnectedComponentAlgorithmFactory.hpp>
 #include <htd/TreeDecompositionFactory.hpp>
 #include <htd/GraphLabeling.hpp>
@@ -44,6 +45,7 @@
 #include <algorithm>
 #include <cstdarg>
 #include <memory>
+#include <typeinfo>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -213,11 +215,15 @@ htd::ITreeDecomposition * htd::SeparatorBasedTreeDecompositionAlgorithm::compute
 
         for (const htd::ITreeDecompositionManipulationOperation * operation : implementation_->postProcessingOperations_)
         {
+            htd::ScopedTimer timer(implementation_->managementInstance_, typeid(*operation), "manipulation");
+
             operation->apply(graph, *ret);
         }
 
         for (htd::ITreeDecompositionManipulationOperation * operation : postProcessingOperations)
         {
+            htd::ScopedTimer timer(implementation_->managementInstance_, typeid(*operation), "manipulation");
+
             operation->apply(graph, *ret);
         }
 
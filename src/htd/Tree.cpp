@@ -29,17 +29,18 @@
 #include <htd/Helpers.hpp>
 #include <htd/Tree.hpp>
 #include <htd/VectorAdapter.hpp>
-#include <htd/PreOrderTreeTraversal.hpp>
-#include <htd/PostOrderTreeTraversal.hpp>
 #include <htd/HyperedgePointerDeque.hpp>
 #include <htd/ConstPointerIteratorWrapper.hpp>
 
 #include <htd/Algorithm.hpp>
+#include <htd/TreeTraversal.hpp>
+#include <htd/MemoryManager.hpp>
 
 #include <algorithm>
 #include <deque>
 #include <iterator>
 #include <memory>
+#include <new>
 #include <stdexcept>
 #include <unordered_map>
 #include <utility>
@@ -111,7 +112,7 @@ struct htd::Tree::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), size_(0), root_(htd::Vertex::UNKNOWN), next_edge_(htd::Id::FIRST), next_vertex_(htd::Vertex::FIRST), vertices_(), nodes_(), edges_(std::make_shared<std::deque<htd::Hyperedge *>>())
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), size_(0), root_(htd::Vertex::UNKNOWN), next_edge_(htd::Id::FIRST), next_vertex_(htd::Vertex::FIRST), vertices_(), nodes_(), edges_(std::make_shared<std::deque<htd::Hyperedge *>>()), nodeResource_(manager->memoryManager().resource("tree"))
     {
 
     }
@@ -120,7 +121,7 @@ struct htd::Tree::Implementation
     {
         for (auto it = nodes_.begin(); it != nodes_.end(); it++)
         {
-            delete it->second;
+            destroyNode(it->second);
         }
 
         for (htd::Hyperedge * edge : *edges_)
@@ -142,13 +143,14 @@ struct htd::Tree::Implementation
           next_vertex_(original.next_vertex_),
           vertices_(original.vertices_),
           nodes_(),
-          edges_(std::make_shared<std::deque<htd::Hyperedge *>>())
+          edges_(std::make_shared<std::deque<htd::Hyperedge *>>()),
+          nodeResource_(original.nodeResource_)
     {
         nodes_.reserve(original.nodes_.size());
 
         for (const auto & node : original.nodes_)
         {
-            nodes_.emplace(node.first, new Node(*(node.second)));
+            nodes_.emplace(node.first, createNode(*(node.second)));
         }
 
         for (const htd::Hyperedge * edge : *(original.edges_))
@@ -164,7 +166,7 @@ struct htd::Tree::Implementation
     {
         for (auto it = nodes_.begin(); it != nodes_.end(); it++)
         {
-            delete it->second;
+            destroyNode(it->second);
         }
 
         nodes_.clear();
@@ -227,6 +229,47 @@ struct htd::Tree::Implementation
      */
     std::shared_ptr<std::deque<htd::Hyperedge *>> edges_;
 
+    /**
+     *  The memory resource from which the tree nodes are allocated.
+     */
+    std::shared_ptr<htd::IMemoryResource> nodeResource_;
+
+    /**
+     *  Create a new tree node in the memory resource of the tree.
+     *
+     *  @param[in] arguments    The arguments which are forwarded to the constructor of the tree node.
+     *
+     *  @return A pointer to the new tree node.
+     */
+    template <typename... Arguments>
+    Node * createNode(Arguments &&... arguments)
+    {
+        void * memory = nodeResource_->allocate(sizeof(Node), alignof(Node));
+
+        try
+        {
+            return new (memory) Node(std::forward<Arguments>(arguments)...);
+        }
+        catch (...)
+        {
+            nodeResource_->deallocate(memory, sizeof(Node), alignof(Node));
+
+            throw;
+        }
+    }
+
+    /**
+     *  Destroy a tree node which was created by createNode() and release its memory.
+     *
+     *  @param[in] node The tree node which shall be destroyed.
+     */
+    void destroyNode(Node * node)
+    {
+        node->~Node();
+
+        nodeResource_->deallocate(node, sizeof(Node), alignof(Node));
+    }
+
     /**
      *  Delete a node of the tree and perform an update of the internal state.
      *
@@ -275,9 +318,7 @@ std::size_t htd::Tree::vertexCount(htd::vertex_t subtreeRoot) const
 
     std::size_t ret = 0;
 
-    htd::PreOrderTreeTraversal treeTraversal;
-
-    treeTraversal.traverse(*this, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToSubtreeRoot)
+    htd::TreeTraversal::preOrder(*this, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToSubtreeRoot)
     {
         HTD_UNUSED(vertex)
         HTD_UNUSED(parent)
@@ -714,6 +755,13 @@ htd::vertex_t htd::Tree::childAtPosition(htd::vertex_t vertex, htd::index_t inde
     return children[index];
 }
 
+const std::vector<htd::vertex_t> & htd::Tree::childContainer(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return implementation_->nodes_.at(vertex)->children;
+}
+
 bool htd::Tree::isChild(htd::vertex_t vertex, htd::vertex_t child) const
 {
     HTD_ASSERT(isVertex(vertex))
@@ -735,9 +783,7 @@ std::size_t htd::Tree::height(htd::vertex_t vertex) const
 
     std::size_t ret = 0;
 
-    htd::PreOrderTreeTraversal traversal;
-
-    traversal.traverse(*this, [&](htd::vertex_t currentVertex, htd::vertex_t parent, std::size_t distanceToVertex)
+    htd::TreeTraversal::preOrder(*this, [&](htd::vertex_t currentVertex, htd::vertex_t parent, std::size_t distanceToVertex)
     {
         HTD_UNUSED(currentVertex)
         HTD_UNUSED(parent)
@@ -903,6 +949,8 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
 
                 implementation_->size_ = 0;
 
+                implementation_->destroyNode(implementation_->nodes_.at(vertex));
+
                 implementation_->nodes_.clear();
                 implementation_->edges_->clear();
 
@@ -973,9 +1021,7 @@ void htd::Tree::removeSubtree(htd::vertex_t subtreeRoot)
 {
     HTD_ASSERT(isVertex(subtreeRoot))
 
-    htd::PostOrderTreeTraversal treeTraversal;
-
-    treeTraversal.traverse(*this, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToSubtreeRoot)
+    htd::TreeTraversal::postOrder(*this, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToSubtreeRoot)
     {
         HTD_UNUSED(parent)
         HTD_UNUSED(distanceToSubtreeRoot)
@@ -995,7 +1041,7 @@ htd::vertex_t htd::Tree::insertRoot(void)
         implementation_->next_vertex_ = implementation_->root_ + 1;
 
         implementation_->nodes_.clear();
-        implementation_->nodes_.emplace(implementation_->root_, new Implementation::Node(implementation_->root_, htd::Vertex::UNKNOWN));
+        implementation_->nodes_.emplace(implementation_->root_, implementation_->createNode(implementation_->root_, htd::Vertex::UNKNOWN));
 
         implementation_->vertices_.emplace_back(implementation_->root_);
 
@@ -1055,7 +1101,7 @@ htd::vertex_t htd::Tree::addChild(htd::vertex_t vertex)
 
     node.children.emplace_back(ret);
 
-    Implementation::Node * newNode = new Implementation::Node(ret, vertex);
+    Implementation::Node * newNode = implementation_->createNode(ret, vertex);
 
     implementation_->nodes_.emplace(ret, newNode);
 
@@ -1118,7 +1164,7 @@ htd::vertex_t htd::Tree::addParent(htd::vertex_t vertex)
 
         node->parent = ret;
 
-        Implementation::Node * newRootNode = new Implementation::Node(ret, htd::Vertex::UNKNOWN);
+        Implementation::Node * newRootNode = implementation_->createNode(ret, htd::Vertex::UNKNOWN);
 
         newRootNode->children.emplace_back(vertex);
 
@@ -1431,7 +1477,7 @@ void htd::Tree::Implementation::deleteNode(Node * node)
 
     nodes_.erase(vertex);
 
-    delete node;
+    destroyNode(node);
 
     size_--;
 }
@@ -1500,7 +1546,7 @@ htd::Tree & htd::Tree::operator=(const htd::Tree & original)
 
         for (const auto & node : original.implementation_->nodes_)
         {
-            implementation_->nodes_.emplace(node.first, new Implementation::Node(*(node.second)));
+            implementation_->nodes_.emplace(node.first, implementation_->createNode(*(node.second)));
         }
 
         implementation_->root_ = original.implementation_->root_;
@@ -1555,11 +1601,11 @@ htd::Tree & htd::Tree::operator=(const htd::ITree & original)
 
                 if (original.isRoot(vertex))
                 {
-                    newNode = new Implementation::Node(vertex, htd::Vertex::UNKNOWN);
+                    newNode = implementation_->createNode(vertex, htd::Vertex::UNKNOWN);
                 }
                 else
                 {
-                    newNode = new Implementation::Node(vertex, original.parent(vertex));
+                    newNode = implementation_->createNode(vertex, original.parent(vertex));
                 }
 
                 const htd::ConstCollection<htd::vertex_t> & childCollection = original.children(vertex);
@@ -30,7 +30,7 @@
 #include <htd/TreeDecomposition.hpp>
 #include <htd/VectorAdapter.hpp>
 #include <htd/Label.hpp>
-#include <htd/PostOrderTreeTraversal.hpp>
+#include <htd/TreeTraversal.hpp>
 
 #include <algorithm>
 #include <stdexcept>
@@ -94,9 +94,7 @@ void htd::TreeDecomposition::removeSubtree(htd::vertex_t subtreeRoot)
 {
     HTD_ASSERT(isVertex(subtreeRoot))
 
-    htd::PostOrderTreeTraversal treeTraversal;
-
-    treeTraversal.traverse(*this, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToSubtreeRoot)
+    htd::TreeTraversal::postOrder(*this, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToSubtreeRoot)
     {
         HTD_UNUSED(parent)
         HTD_UNUSED(distanceToSubtreeRoot)
@@ -1087,12 +1085,9 @@ htd::TreeDecomposition & htd::TreeDecomposition::operator=(const htd::TreeDecomp
     {
         htd::LabeledTree::operator=(original);
 
-        for (htd::vertex_t vertex : original.vertexVector())
-        {
-            bagContent_[vertex] = original.bagContent(vertex);
+        bagContent_ = original.bagContent_;
 
-            inducedEdges_[vertex] = original.inducedHyperedges(vertex);
-        }
+        inducedEdges_ = original.inducedEdges_;
     }
 
     return *this;
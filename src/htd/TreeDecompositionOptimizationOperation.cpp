@@ -32,7 +32,10 @@
 #include <htd/CompressionOperation.hpp>
 
 #include <algorithm>
+#include <functional>
+#include <memory>
 #include <stack>
+#include <thread>
 #include <unordered_set>
 
 /**
@@ -46,7 +49,7 @@ struct htd::TreeDecompositionOptimizationOperation::Implementation
      *  @param[in] manager  The management instance to which the current object instance belongs.
      */
     Implementation(const htd::LibraryInstance * const manager)
-        : managementInstance_(manager), enforceNaiveOptimization_(false), strategy_(nullptr), fitnessFunction_(nullptr), manipulationOperations_()
+        : managementInstance_(manager), enforceNaiveOptimization_(false), threadCount_(1), strategy_(nullptr), fitnessFunction_(nullptr), manipulationOperations_()
     {
 
     }
@@ -59,7 +62,7 @@ struct htd::TreeDecompositionOptimizationOperation::Implementation
      *  @param[in] enforceNaiveOptimization A boolean flag to enforce that each iteration of the optimization algorithm starts from scratch with a copy of the given decomposition.
      */
     Implementation(const htd::LibraryInstance * const manager, htd::ITreeDecompositionFitnessFunction * fitnessFunction, bool enforceNaiveOptimization)
-        : managementInstance_(manager), enforceNaiveOptimization_(enforceNaiveOptimization), strategy_(new htd::ExhaustiveVertexSelectionStrategy()), fitnessFunction_(fitnessFunction), manipulationOperations_()
+        : managementInstance_(manager), enforceNaiveOptimization_(enforceNaiveOptimization), threadCount_(1), strategy_(new htd::ExhaustiveVertexSelectionStrategy()), fitnessFunction_(fitnessFunction), manipulationOperations_()
     {
 
     }
@@ -93,6 +96,11 @@ struct htd::TreeDecompositionOptimizationOperation::Implementation
      */
     bool enforceNaiveOptimization_;
 
+    /**
+     *  The number of threads which are used to evaluate the candidate roots.
+     */
+    std::size_t threadCount_;
+
     /**
      *  The strategy defining which vertices shall be considered as root of the tree decomposition.
      */
@@ -155,6 +163,126 @@ struct htd::TreeDecompositionOptimizationOperation::Implementation
      *                                  visiting created nodes.
      */
     void removeCreatedNodes(htd::IMutableTreeDecomposition & decomposition, htd::vertex_t start, htd::vertex_t lastRegularVertex) const;
+
+    /**
+     *  Make the given vertex the new root of a decomposition to which the given local manipulation operations were already applied.
+     *
+     *  Only the vertices on the path between the old and the new root are subject to the manipulation operations, all other parts
+     *  of the decomposition remain untouched.
+     *
+     *  @param[in] graph                    The graph which was decomposed.
+     *  @param[in] decomposition            The tree decomposition which shall be rerooted.
+     *  @param[in] vertex                   The new root of the decomposition.
+     *  @param[in] lastRegularVertex        The identifier of the last vertex which was not created by a manipulation operation.
+     *  @param[in] manipulationOperations   The manipulation operations which shall be re-applied to the vertices on the path between the old and the new root.
+     *  @param[in] labelingFunctions        A vector of labeling functions which shall be applied after the modifications.
+     */
+    void rerootIncrementally(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition, htd::vertex_t vertex, htd::vertex_t lastRegularVertex, const std::vector<htd::ITreeDecompositionManipulationOperation *> & manipulationOperations, const std::vector<htd::ILabelingFunction *> & labelingFunctions) const;
+
+    /**
+     *  Structure holding the resources which are used by a single thread during the evaluation of the candidate roots.
+     */
+    struct WorkerContext
+    {
+        /**
+         *  Constructor for a worker context.
+         *
+         *  @param[in] decomposition            The tree decomposition on which the thread operates, if any.
+         *  @param[in] fitnessFunction          The fitness function which is used by the thread.
+         *  @param[in] manipulationOperations   The manipulation operations which are applied by the thread.
+         *  @param[in] labelingFunctions        The labeling functions which are applied by the thread.
+         *  @param[in] ownsResources            A boolean flag indicating whether the given resources shall be deleted together with the context.
+         */
+        WorkerContext(htd::IMutableTreeDecomposition * decomposition, htd::ITreeDecompositionFitnessFunction * fitnessFunction, const std::vector<htd::ITreeDecompositionManipulationOperation *> & manipulationOperations, const std::vector<htd::ILabelingFunction *> & labelingFunctions, bool ownsResources)
+            : decomposition_(decomposition), fitnessFunction_(fitnessFunction), manipulationOperations_(manipulationOperations), labelingFunctions_(labelingFunctions), ownsResources_(ownsResources)
+        {
+
+        }
+
+        ~WorkerContext()
+        {
+            if (ownsResources_)
+            {
+                delete decomposition_;
+
+                delete fitnessFunction_;
+
+                for (htd::ITreeDecompositionManipulationOperation * operation : manipulationOperations_)
+                {
+                    delete operation;
+                }
+
+                for (htd::ILabelingFunction * labelingFunction : labelingFunctions_)
+                {
+                    delete labelingFunction;
+                }
+            }
+        }
+
+        /**
+         *  The tree decomposition on which the thread operates, if any.
+         */
+        htd::IMutableTreeDecomposition * decomposition_;
+
+        /**
+         *  The fitness function which is used by the thread.
+         */
+        htd::ITreeDecompositionFitnessFunction * fitnessFunction_;
+
+        /**
+         *  The manipulation operations which are applied by the thread.
+         */
+        std::vector<htd::ITreeDecompositionManipulationOperation *> manipulationOperations_;
+
+        /**
+         *  The labeling functions which are applied by the thread.
+         */
+        std::vector<htd::ILabelingFunction *> labelingFunctions_;
+
+        /**
+         *  A boolean flag indicating whether the resources shall be deleted together with the context.
+         */
+        bool ownsResources_;
+    };
+
+    /**
+     *  Create the contexts of the threads which evaluate the candidate roots.
+     *
+     *  The first context shares the resources of the given primary context, all further contexts hold private copies of them.
+     *
+     *  @param[in] primaryContext   The context of the calling thread.
+     *  @param[in] candidateCount   The number of candidate roots.
+     *
+     *  @return The contexts of the threads which evaluate the candidate roots.
+     */
+    std::vector<std::unique_ptr<WorkerContext>> createWorkerContexts(const WorkerContext & primaryContext, std::size_t candidateCount) const;
+
+    /**
+     *  Evaluate the candidate roots using one thread per worker context.
+     *
+     *  The worker with index i is responsible for the candidates at the positions i, i + n, i + 2n, ... where n is the number of
+     *  worker contexts. The first worker is executed by the calling thread.
+     *
+     *  @param[in] candidateCount   The number of candidate roots.
+     *  @param[in] workerContexts   The contexts of the threads which evaluate the candidate roots.
+     *  @param[in] worker           The function which evaluates the candidate root at the given position using the given worker context.
+     */
+    void evaluateCandidates(std::size_t candidateCount, const std::vector<std::unique_ptr<WorkerContext>> & workerContexts, const std::function<void(std::size_t, WorkerContext &)> & worker) const;
+
+    /**
+     *  Select the optimal root among the given candidates.
+     *
+     *  The candidates are inspected in the given order and a candidate is selected only if its fitness is strictly better
+     *  than the best fitness found so far. The method takes care of deleting all fitness evaluations.
+     *
+     *  @param[in] candidates       The candidate roots.
+     *  @param[in] initialRoot      The initial root of the decomposition.
+     *  @param[in] initialFitness   The fitness of the decomposition rooted at the initial root.
+     *  @param[in] fitnessValues    The fitness of the decomposition for each of the candidate roots, nullptr if the candidate was not evaluated.
+     *
+     *  @return The optimal root among the given candidates.
+     */
+    htd::vertex_t selectOptimalRoot(const std::vector<htd::vertex_t> & candidates, htd::vertex_t initialRoot, htd::FitnessEvaluation * initialFitness, const std::vector<htd::FitnessEvaluation *> & fitnessValues) const;
 };
 
 htd::TreeDecompositionOptimizationOperation::TreeDecompositionOptimizationOperation(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -357,58 +485,48 @@ void htd::TreeDecompositionOptimizationOperation::setVertexSelectionStrategy(htd
     implementation_->strategy_ = strategy;
 }
 
-void htd::TreeDecompositionOptimizationOperation::Implementation::quickOptimization(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition) const
+std::size_t htd::TreeDecompositionOptimizationOperation::threadCount(void) const
 {
-    const htd::ITreeDecompositionFitnessFunction & fitnessFunction = *fitnessFunction_;
+    return implementation_->threadCount_;
+}
 
-    htd::vertex_t initialRoot = decomposition.root();
+void htd::TreeDecompositionOptimizationOperation::setThreadCount(std::size_t threadCount)
+{
+    HTD_ASSERT(threadCount > 0)
 
-    htd::vertex_t optimalRoot = initialRoot;
+    implementation_->threadCount_ = threadCount;
+}
+
+void htd::TreeDecompositionOptimizationOperation::Implementation::quickOptimization(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition) const
+{
+    htd::vertex_t initialRoot = decomposition.root();
 
     std::vector<htd::vertex_t> candidates;
 
     strategy_->selectVertices(decomposition, candidates);
 
-    htd::FitnessEvaluation * optimalFitness = fitnessFunction.fitness(graph, decomposition);
+    htd::FitnessEvaluation * initialFitness = fitnessFunction_->fitness(graph, decomposition);
 
-    HTD_ASSERT(optimalFitness != nullptr)
+    HTD_ASSERT(initialFitness != nullptr)
 
-    for (auto it = candidates.begin(); it != candidates.end() && !managementInstance_->isTerminated(); ++it)
-    {
-        htd::vertex_t vertex = *it;
-
-        if (vertex != initialRoot)
-        {
-            decomposition.makeRoot(vertex);
-        }
+    WorkerContext primaryContext(&decomposition, fitnessFunction_, std::vector<htd::ITreeDecompositionManipulationOperation *>(), std::vector<htd::ILabelingFunction *>(), false);
 
-        htd::FitnessEvaluation * currentFitness = fitnessFunction.fitness(graph, decomposition);
+    std::vector<htd::FitnessEvaluation *> fitnessValues(candidates.size(), nullptr);
 
-        HTD_ASSERT(currentFitness != nullptr)
+    evaluateCandidates(candidates.size(), createWorkerContexts(primaryContext, candidates.size()), [&](std::size_t index, WorkerContext & context)
+    {
+        context.decomposition_->makeRoot(candidates[index]);
 
-        if (*currentFitness > *optimalFitness)
-        {
-            delete optimalFitness;
+        fitnessValues[index] = context.fitnessFunction_->fitness(graph, *(context.decomposition_));
 
-            optimalFitness = currentFitness;
+        HTD_ASSERT(fitnessValues[index] != nullptr)
+    });
 
-            optimalRoot = vertex;
-        }
-        else
-        {
-            delete currentFitness;
-        }
-    }
-
-    decomposition.makeRoot(optimalRoot);
-
-    delete optimalFitness;
+    decomposition.makeRoot(selectOptimalRoot(candidates, initialRoot, initialFitness, fitnessValues));
 }
 
 void htd::TreeDecompositionOptimizationOperation::Implementation::naiveOptimization(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition, const std::vector<htd::ILabelingFunction *> & labelingFunctions) const
 {
-    const htd::ITreeDecompositionFitnessFunction & fitnessFunction = *fitnessFunction_;
-
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
     htd::IMutableTreeDecomposition * localDecomposition = decomposition.clone();
 #else
@@ -438,55 +556,44 @@ void htd::TreeDecompositionOptimizationOperation::Implementation::naiveOptimizat
         clone->apply(graph, *localDecomposition, labelingFunctions);
     }
 
-    htd::vertex_t optimalRoot = initialRoot;
+    htd::FitnessEvaluation * initialFitness = fitnessFunction_->fitness(graph, *localDecomposition);
 
-    htd::FitnessEvaluation * optimalFitness = fitnessFunction.fitness(graph, *localDecomposition);
+    HTD_ASSERT(initialFitness != nullptr)
 
-    HTD_ASSERT(optimalFitness != nullptr)
+    delete localDecomposition;
 
-    for (auto it = candidates.begin(); it != candidates.end() && !managementInstance_->isTerminated(); ++it)
+    WorkerContext primaryContext(nullptr, fitnessFunction_, clonedManipulationOperations, labelingFunctions, false);
+
+    std::vector<htd::FitnessEvaluation *> fitnessValues(candidates.size(), nullptr);
+
+    evaluateCandidates(candidates.size(), createWorkerContexts(primaryContext, candidates.size()), [&](std::size_t index, WorkerContext & context)
     {
-        htd::vertex_t vertex = *it;
+        htd::vertex_t vertex = candidates[index];
 
         if (vertex != initialRoot)
         {
-            delete localDecomposition;
-
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
-            localDecomposition = decomposition.clone();
+            htd::IMutableTreeDecomposition * candidateDecomposition = decomposition.clone();
 #else
-            localDecomposition = decomposition.cloneMutableTreeDecomposition();
+            htd::IMutableTreeDecomposition * candidateDecomposition = decomposition.cloneMutableTreeDecomposition();
 #endif
 
-            localDecomposition->makeRoot(vertex);
+            candidateDecomposition->makeRoot(vertex);
 
-            for (const htd::ITreeDecompositionManipulationOperation * operation : clonedManipulationOperations)
+            for (const htd::ITreeDecompositionManipulationOperation * operation : context.manipulationOperations_)
             {
-                operation->apply(graph, *localDecomposition, labelingFunctions);
+                operation->apply(graph, *candidateDecomposition, context.labelingFunctions_);
             }
 
-            htd::FitnessEvaluation * currentFitness = fitnessFunction.fitness(graph, *localDecomposition);
+            fitnessValues[index] = context.fitnessFunction_->fitness(graph, *candidateDecomposition);
 
-            HTD_ASSERT(currentFitness != nullptr)
+            HTD_ASSERT(fitnessValues[index] != nullptr)
 
-            if (*currentFitness > *optimalFitness)
-            {
-                delete optimalFitness;
-
-                optimalFitness = currentFitness;
-
-                optimalRoot = vertex;
-            }
-            else
-            {
-                delete currentFitness;
-            }
+            delete candidateDecomposition;
         }
-    }
-
-    delete localDecomposition;
+    });
 
-    decomposition.makeRoot(optimalRoot);
+    decomposition.makeRoot(selectOptimalRoot(candidates, initialRoot, initialFitness, fitnessValues));
 
     for (const htd::ITreeDecompositionManipulationOperation * operation : clonedManipulationOperations)
     {
@@ -494,14 +601,10 @@ void htd::TreeDecompositionOptimizationOperation::Implementation::naiveOptimizat
 
         delete operation;
     }
-
-    delete optimalFitness;
 }
 
 void htd::TreeDecompositionOptimizationOperation::Implementation::intelligentOptimization(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition, const std::vector<htd::ILabelingFunction *> & labelingFunctions) const
 {
-    const htd::ITreeDecompositionFitnessFunction & fitnessFunction = *fitnessFunction_;
-
     htd::vertex_t initialRoot = decomposition.root();
 
     std::vector<htd::vertex_t> candidates;
@@ -527,135 +630,193 @@ void htd::TreeDecompositionOptimizationOperation::Implementation::intelligentOpt
         clone->apply(graph, decomposition, labelingFunctions);
     }
 
-    htd::vertex_t optimalRoot = initialRoot;
+    htd::FitnessEvaluation * initialFitness = fitnessFunction_->fitness(graph, decomposition);
 
-    htd::FitnessEvaluation * optimalFitness = fitnessFunction.fitness(graph, decomposition);
+    HTD_ASSERT(initialFitness != nullptr)
 
-    HTD_ASSERT(optimalFitness != nullptr)
+    WorkerContext primaryContext(&decomposition, fitnessFunction_, clonedManipulationOperations, labelingFunctions, false);
 
-    std::vector<htd::vertex_t> createdVertices;
-    std::vector<htd::vertex_t> removedVertices;
+    std::vector<htd::FitnessEvaluation *> fitnessValues(candidates.size(), nullptr);
 
-    for (auto it = candidates.begin(); it != candidates.end() && !managementInstance_->isTerminated(); ++it)
+    evaluateCandidates(candidates.size(), createWorkerContexts(primaryContext, candidates.size()), [&](std::size_t index, WorkerContext & context)
     {
-        htd::vertex_t vertex = *it;
+        htd::vertex_t vertex = candidates[index];
 
         if (vertex != initialRoot)
         {
-            htd::vertex_t currentVertex = vertex;
+            rerootIncrementally(graph, *(context.decomposition_), vertex, lastRegularVertex, context.manipulationOperations_, context.labelingFunctions_);
 
-            std::vector<htd::vertex_t> affectedVertices;
+            fitnessValues[index] = context.fitnessFunction_->fitness(graph, *(context.decomposition_));
 
-            while (!decomposition.isRoot(currentVertex))
-            {
-                htd::vertex_t nextVertex = decomposition.parent(currentVertex);
+            HTD_ASSERT(fitnessValues[index] != nullptr)
+        }
+    });
 
-                if (currentVertex <= lastRegularVertex)
-                {
-                    affectedVertices.push_back(currentVertex);
-                }
+    rerootIncrementally(graph, decomposition, selectOptimalRoot(candidates, initialRoot, initialFitness, fitnessValues), lastRegularVertex, clonedManipulationOperations, labelingFunctions);
 
-                currentVertex = nextVertex;
-            }
+    for (htd::ITreeDecompositionManipulationOperation * operation : clonedManipulationOperations)
+    {
+        delete operation;
+    }
+}
 
-            if (currentVertex <= lastRegularVertex)
-            {
-                affectedVertices.push_back(currentVertex);
-            }
+void htd::TreeDecompositionOptimizationOperation::Implementation::rerootIncrementally(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition, htd::vertex_t vertex, htd::vertex_t lastRegularVertex, const std::vector<htd::ITreeDecompositionManipulationOperation *> & manipulationOperations, const std::vector<htd::ILabelingFunction *> & labelingFunctions) const
+{
+    htd::vertex_t currentVertex = vertex;
 
-            for (htd::vertex_t affectedVertex : affectedVertices)
-            {
-                removeCreatedNodes(decomposition, affectedVertex, lastRegularVertex);
-            }
+    std::vector<htd::vertex_t> affectedVertices;
 
-            std::size_t newVertexCount = 0;
+    while (!decomposition.isRoot(currentVertex))
+    {
+        htd::vertex_t nextVertex = decomposition.parent(currentVertex);
 
-            std::size_t oldCreatedVerticesCount = createdVertices.size();
+        if (currentVertex <= lastRegularVertex)
+        {
+            affectedVertices.push_back(currentVertex);
+        }
 
-            decomposition.makeRoot(vertex);
+        currentVertex = nextVertex;
+    }
 
-            for (const htd::ITreeDecompositionManipulationOperation * operation : clonedManipulationOperations)
-            {
-                operation->apply(graph, decomposition, affectedVertices, labelingFunctions, createdVertices, removedVertices);
+    if (currentVertex <= lastRegularVertex)
+    {
+        affectedVertices.push_back(currentVertex);
+    }
 
-                newVertexCount = createdVertices.size() - oldCreatedVerticesCount;
+    for (htd::vertex_t affectedVertex : affectedVertices)
+    {
+        removeCreatedNodes(decomposition, affectedVertex, lastRegularVertex);
+    }
 
-                if (newVertexCount > 0)
-                {
-                    affectedVertices.insert(affectedVertices.end(), createdVertices.begin() + oldCreatedVerticesCount, createdVertices.end());
+    std::vector<htd::vertex_t> createdVertices;
+    std::vector<htd::vertex_t> removedVertices;
 
-                    oldCreatedVerticesCount = createdVertices.size();
-                }
-            }
+    decomposition.makeRoot(vertex);
 
-            htd::FitnessEvaluation * currentFitness = fitnessFunction.fitness(graph, decomposition);
+    for (const htd::ITreeDecompositionManipulationOperation * operation : manipulationOperations)
+    {
+        std::size_t oldCreatedVerticesCount = createdVertices.size();
 
-            HTD_ASSERT(currentFitness != nullptr)
+        operation->apply(graph, decomposition, affectedVertices, labelingFunctions, createdVertices, removedVertices);
 
-            if (*currentFitness > *optimalFitness)
-            {
-                delete optimalFitness;
+        affectedVertices.insert(affectedVertices.end(), createdVertices.begin() + oldCreatedVerticesCount, createdVertices.end());
+    }
+}
 
-                optimalFitness = currentFitness;
+std::vector<std::unique_ptr<htd::TreeDecompositionOptimizationOperation::Implementation::WorkerContext>> htd::TreeDecompositionOptimizationOperation::Implementation::createWorkerContexts(const WorkerContext & primaryContext, std::size_t candidateCount) const
+{
+    std::vector<std::unique_ptr<WorkerContext>> ret;
 
-                optimalRoot = vertex;
-            }
-            else
-            {
-                delete currentFitness;
-            }
+    ret.emplace_back(new WorkerContext(primaryContext.decomposition_, primaryContext.fitnessFunction_, primaryContext.manipulationOperations_, primaryContext.labelingFunctions_, false));
+
+    for (std::size_t index = 1; index < std::min(threadCount_, candidateCount); ++index)
+    {
+        htd::IMutableTreeDecomposition * decomposition = nullptr;
+
+        if (primaryContext.decomposition_ != nullptr)
+        {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            decomposition = primaryContext.decomposition_->clone();
+#else
+            decomposition = primaryContext.decomposition_->cloneMutableTreeDecomposition();
+#endif
+        }
+
+        std::vector<htd::ITreeDecompositionManipulationOperation *> manipulationOperations;
+
+        for (const htd::ITreeDecompositionManipulationOperation * operation : primaryContext.manipulationOperations_)
+        {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            htd::ITreeDecompositionManipulationOperation * clone = operation->clone();
+#else
+            htd::ITreeDecompositionManipulationOperation * clone = operation->cloneTreeDecompositionManipulationOperation();
+#endif
+
+            clone->setManagementInstance(managementInstance_);
+
+            manipulationOperations.push_back(clone);
         }
+
+        std::vector<htd::ILabelingFunction *> labelingFunctions;
+
+        for (const htd::ILabelingFunction * labelingFunction : primaryContext.labelingFunctions_)
+        {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            htd::ILabelingFunction * clone = labelingFunction->clone();
+#else
+            htd::ILabelingFunction * clone = labelingFunction->cloneLabelingFunction();
+#endif
+
+            clone->setManagementInstance(managementInstance_);
+
+            labelingFunctions.push_back(clone);
+        }
+
+        ret.emplace_back(new WorkerContext(decomposition, primaryContext.fitnessFunction_->clone(), manipulationOperations, labelingFunctions, true));
     }
 
-    htd::vertex_t currentVertex = optimalRoot;
+    return ret;
+}
 
-    std::vector<htd::vertex_t> affectedVertices;
+void htd::TreeDecompositionOptimizationOperation::Implementation::evaluateCandidates(std::size_t candidateCount, const std::vector<std::unique_ptr<WorkerContext>> & workerContexts, const std::function<void(std::size_t, WorkerContext &)> & worker) const
+{
+    std::size_t workerCount = workerContexts.size();
 
-    while (!decomposition.isRoot(currentVertex))
+    auto evaluate = [&](std::size_t workerIndex)
     {
-        htd::vertex_t nextVertex = decomposition.parent(currentVertex);
+        WorkerContext & context = *(workerContexts[workerIndex]);
 
-        if (currentVertex <= lastRegularVertex)
+        for (std::size_t index = workerIndex; index < candidateCount && !managementInstance_->isTerminated(); index += workerCount)
         {
-            affectedVertices.push_back(currentVertex);
+            worker(index, context);
         }
+    };
 
-        currentVertex = nextVertex;
-    }
+    std::vector<std::thread> threads;
 
-    if (currentVertex <= lastRegularVertex)
+    for (std::size_t workerIndex = 1; workerIndex < workerCount; ++workerIndex)
     {
-        affectedVertices.push_back(currentVertex);
+        threads.emplace_back(evaluate, workerIndex);
     }
 
-    for (htd::vertex_t affectedVertex : affectedVertices)
+    evaluate(0);
+
+    for (std::thread & thread : threads)
     {
-        removeCreatedNodes(decomposition, affectedVertex, lastRegularVertex);
+        thread.join();
     }
+}
 
-    std::size_t newVertexCount = 0;
-
-    std::size_t oldCreatedVerticesCount = createdVertices.size();
+htd::vertex_t htd::TreeDecompositionOptimizationOperation::Implementation::selectOptimalRoot(const std::vector<htd::vertex_t> & candidates, htd::vertex_t initialRoot, htd::FitnessEvaluation * initialFitness, const std::vector<htd::FitnessEvaluation *> & fitnessValues) const
+{
+    htd::vertex_t ret = initialRoot;
 
-    decomposition.makeRoot(optimalRoot);
+    htd::FitnessEvaluation * optimalFitness = initialFitness;
 
-    for (const htd::ITreeDecompositionManipulationOperation * operation : clonedManipulationOperations)
+    for (std::size_t index = 0; index < candidates.size(); ++index)
     {
-        operation->apply(graph, decomposition, affectedVertices, labelingFunctions, createdVertices, removedVertices);
+        htd::FitnessEvaluation * currentFitness = fitnessValues[index];
 
-        newVertexCount = createdVertices.size() - oldCreatedVerticesCount;
-
-        if (newVertexCount > 0)
+        if (currentFitness != nullptr)
         {
-            std::copy(createdVertices.begin() + oldCreatedVerticesCount, createdVertices.end(), std::back_inserter(affectedVertices));
+            if (*currentFitness > *optimalFitness)
+            {
+                delete optimalFitness;
 
-            oldCreatedVerticesCount = createdVertices.size();
-        }
+                optimalFitness = currentFitness;
 
-        delete operation;
+                ret = candidates[index];
+            }
+            else
+            {
+                delete currentFitness;
+            }
+        }
     }
 
     delete optimalFitness;
+
+    return ret;
 }
 
 bool htd::TreeDecompositionOptimizationOperation::Implementation::isSafeOperation(const htd::ITreeDecompositionManipulationOperation & manipulationOperation) const
@@ -752,9 +913,11 @@ htd::TreeDecompositionOptimizationOperation * htd::TreeDecompositionOptimization
     }
     else
     {
-        ret = new htd::TreeDecompositionOptimizationOperation(managementInstance(), implementation_->fitnessFunction_->clone());
+        ret = new htd::TreeDecompositionOptimizationOperation(managementInstance(), implementation_->fitnessFunction_->clone(), implementation_->enforceNaiveOptimization_);
     }
 
+    ret->setThreadCount(implementation_->threadCount_);
+
     for (const htd::ITreeDecompositionManipulationOperation * manipulationOperation : implementation_->manipulationOperations_)
     {
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
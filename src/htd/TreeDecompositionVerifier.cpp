@@ -28,13 +28,46 @@
 #include <htd/Globals.hpp>
 #include <htd/Helpers.hpp>
 #include <htd/TreeDecompositionVerifier.hpp>
-#include <htd/PostOrderTreeTraversal.hpp>
 #include <htd/VectorAdapter.hpp>
 
-#include <map>
 #include <algorithm>
-#include <unordered_set>
-#include <unordered_map>
+#include <thread>
+#include <vector>
+
+/**
+ *  The accumulated bag size starting from which the three checks of TreeDecompositionVerifier::verify are run concurrently.
+ */
+static const std::size_t PARALLEL_VERIFICATION_THRESHOLD = 1 << 16;
+
+/**
+ *  Compute an upper bound for the identifiers of the vertices of the given graph and the vertices occurring in the bags of the given decomposition.
+ *
+ *  @param[in] graph            The input graph.
+ *  @param[in] decomposition    The tree decomposition.
+ *
+ *  @return A value which is greater than the identifier of each vertex of the graph and each vertex occurring in a bag of the decomposition.
+ */
+static std::size_t vertexIdentifierBound(const htd::IMultiHypergraph & graph, const htd::ITreeDecomposition & decomposition)
+{
+    std::size_t ret = 0;
+
+    for (htd::vertex_t vertex : graph.vertices())
+    {
+        ret = std::max(ret, static_cast<std::size_t>(vertex) + 1);
+    }
+
+    for (htd::vertex_t node : decomposition.vertices())
+    {
+        const std::vector<htd::vertex_t> & bag = decomposition.bagContent(node);
+
+        if (!bag.empty())
+        {
+            ret = std::max(ret, static_cast<std::size_t>(bag.back()) + 1);
+        }
+    }
+
+    return ret;
+}
 
 htd::TreeDecompositionVerifier::TreeDecompositionVerifier(void)
 {
@@ -48,7 +81,39 @@ htd::TreeDecompositionVerifier::~TreeDecompositionVerifier()
 
 bool htd::TreeDecompositionVerifier::verify(const htd::IMultiHypergraph & graph, const htd::ITreeDecomposition & decomposition) const
 {
-    return verifyVertexExistence(graph, decomposition) && verifyHyperedgeCoverage(graph, decomposition) && verifyConnectednessCriterion(graph, decomposition);
+    std::size_t accumulatedBagSize = 0;
+
+    for (htd::vertex_t node : decomposition.vertices())
+    {
+        accumulatedBagSize += decomposition.bagSize(node);
+    }
+
+    if (accumulatedBagSize < PARALLEL_VERIFICATION_THRESHOLD)
+    {
+        return verifyVertexExistence(graph, decomposition) && verifyHyperedgeCoverage(graph, decomposition) && verifyConnectednessCriterion(graph, decomposition);
+    }
+
+    bool vertexExistence = false;
+
+    bool hyperedgeCoverage = false;
+
+    std::thread vertexExistenceThread([&](void)
+    {
+        vertexExistence = verifyVertexExistence(graph, decomposition);
+    });
+
+    std::thread hyperedgeCoverageThread([&](void)
+    {
+        hyperedgeCoverage = verifyHyperedgeCoverage(graph, decomposition);
+    });
+
+    bool connectednessCriterion = verifyConnectednessCriterion(graph, decomposition);
+
+    vertexExistenceThread.join();
+
+    hyperedgeCoverageThread.join();
+
+    return vertexExistence && hyperedgeCoverage && connectednessCriterion;
 }
 
 //Ensure that every vertex of the original graph is contained in at least one node of the tree decomposition.
@@ -75,23 +140,23 @@ htd::ConstCollection<htd::vertex_t> htd::TreeDecompositionVerifier::violationsVe
 
     auto & result = ret.container();
 
-    bool ok = false;
+    std::vector<bool> contained(vertexIdentifierBound(graph, decomposition), false);
 
-    std::unordered_set<htd::vertex_t> missingVertices(graph.vertices().begin(), graph.vertices().end());
-    
-    for (auto it1 = decomposition.vertices().begin(); !ok && it1 != decomposition.vertices().end(); it1++)
+    for (htd::vertex_t node : decomposition.vertices())
     {
-        const std::vector<htd::vertex_t> & bag = decomposition.bagContent(*it1);
-
-        for (auto it2 = bag.begin(); !ok && it2 != bag.end(); it2++)
+        for (htd::vertex_t vertex : decomposition.bagContent(node))
         {
-            missingVertices.erase(*it2);
-            
-            ok = missingVertices.empty();
+            contained[vertex] = true;
         }
     }
 
-    std::copy(missingVertices.begin(), missingVertices.end(), std::back_inserter(result));
+    for (htd::vertex_t vertex : graph.vertices())
+    {
+        if (!contained[vertex])
+        {
+            result.push_back(vertex);
+        }
+    }
 
     std::sort(result.begin(), result.end());
 
@@ -104,81 +169,80 @@ htd::ConstCollection<htd::Hyperedge> htd::TreeDecompositionVerifier::violationsH
 
     auto & result = ret.container();
 
-    bool ok = false;
+    std::size_t bound = vertexIdentifierBound(graph, decomposition);
 
-    std::size_t edgeCount = graph.edgeCount();
+    std::vector<const std::vector<htd::vertex_t> *> bags;
 
-    std::unordered_set<htd::id_t> missingEdges(edgeCount);
+    bags.reserve(decomposition.vertexCount());
 
-    std::vector<htd::id_t> identifiers(edgeCount);
+    /* Occurrence index in compressed form: The bags containing vertex v are stored at positions offsets[v] to offsets[v + 1] - 1 of 'occurrences'. */
+    std::vector<std::size_t> offsets(bound + 1, 0);
 
-    std::vector<std::vector<htd::vertex_t>> sortedEdges(edgeCount);
+    for (htd::vertex_t node : decomposition.vertices())
+    {
+        const std::vector<htd::vertex_t> & bag = decomposition.bagContent(node);
 
-    htd::index_t index = 0;
+        bags.push_back(&bag);
 
-    const htd::ConstCollection<htd::Hyperedge> & hyperedges = graph.hyperedges();
+        for (htd::vertex_t vertex : bag)
+        {
+            ++offsets[vertex + 1];
+        }
+    }
 
-    for (const htd::Hyperedge & hyperedge : hyperedges)
+    for (std::size_t vertex = 0; vertex < bound; ++vertex)
     {
-        std::vector<htd::vertex_t> & elements = sortedEdges[index];
+        offsets[vertex + 1] += offsets[vertex];
+    }
 
-        std::copy(hyperedge.sortedElements().begin(), hyperedge.sortedElements().end(), std::back_inserter(elements));
+    std::vector<htd::index_t> occurrences(offsets[bound]);
 
-        identifiers[index] = hyperedge.id();
+    std::vector<std::size_t> position(offsets.begin(), offsets.end() - 1);
 
-        missingEdges.insert(hyperedge.id());
+    for (htd::index_t index = 0; index < bags.size(); ++index)
+    {
+        for (htd::vertex_t vertex : *(bags[index]))
+        {
+            occurrences[position[vertex]] = index;
 
-        index++;
+            ++position[vertex];
+        }
     }
 
-    htd::PostOrderTreeTraversal treeTraversal;
-
-    treeTraversal.traverse(decomposition, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToSubtreeRoot)
+    for (const htd::Hyperedge & hyperedge : graph.hyperedges())
     {
-        HTD_UNUSED(parent)
-        HTD_UNUSED(distanceToSubtreeRoot)
+        const std::vector<htd::vertex_t> & elements = hyperedge.sortedElements();
 
-        if (!ok)
-        {
-            const std::vector<htd::vertex_t> & bag = decomposition.bagContent(vertex);
+        bool covered = elements.empty() && !bags.empty();
 
-            index = 0;
+        if (!elements.empty())
+        {
+            htd::vertex_t rarestVertex = elements[0];
 
-            while (!ok && index < edgeCount)
+            for (htd::vertex_t vertex : elements)
             {
-                htd::id_t id = identifiers[index];
-
-                const std::vector<htd::vertex_t> & edge = sortedEdges[index];
-
-                if (missingEdges.count(id) > 0 && std::includes(bag.begin(), bag.end(), edge.begin(), edge.end()))
+                if (offsets[vertex + 1] - offsets[vertex] < offsets[rarestVertex + 1] - offsets[rarestVertex])
                 {
-                    missingEdges.erase(id);
+                    rarestVertex = vertex;
                 }
+            }
 
-                ok = missingEdges.empty();
+            for (std::size_t occurrence = offsets[rarestVertex]; !covered && occurrence < offsets[rarestVertex + 1]; ++occurrence)
+            {
+                const std::vector<htd::vertex_t> & bag = *(bags[occurrences[occurrence]]);
 
-                ++index;
+                covered = std::all_of(elements.begin(), elements.end(), [&](htd::vertex_t vertex) { return std::binary_search(bag.begin(), bag.end(), vertex); });
             }
         }
-    });
 
-    if (!ok)
-    {
-        index = 0;
-
-        for (const htd::Hyperedge & hyperedge : hyperedges)
+        if (!covered)
         {
-            if (missingEdges.count(static_cast<htd::id_t>(index)) > 0)
-            {
-                result.push_back(hyperedge);
-            }
-
-            ++index;
+            result.push_back(hyperedge);
         }
-
-        std::sort(result.begin(), result.end());
     }
 
+    std::sort(result.begin(), result.end());
+
     return htd::ConstCollection<htd::Hyperedge>::getInstance(ret);
 }
 
@@ -188,52 +252,47 @@ htd::ConstCollection<htd::vertex_t> htd::TreeDecompositionVerifier::violationsCo
 
     auto & result = ret.container();
 
-    std::unordered_set<htd::vertex_t> forgottenVertices(graph.vertexCount());
+    std::size_t bound = vertexIdentifierBound(graph, decomposition);
 
-    htd::PostOrderTreeTraversal treeTraversal;
+    /*
+     *  The bags containing a vertex v induce a forest whose number of connected components equals the number
+     *  of bags containing v minus the number of tree edges whose endpoints both contain v. Hence, the bags
+     *  containing v are connected if and only if the difference is at most one.
+     */
+    std::vector<std::size_t> componentCount(bound, 0);
 
-    std::vector<htd::vertex_t> forgottenBagContent;
+    std::vector<htd::vertex_t> stamp(bound, htd::Vertex::UNKNOWN);
 
-    treeTraversal.traverse(decomposition, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distanceToSubtreeRoot)
+    for (htd::vertex_t node : decomposition.vertices())
     {
-        HTD_UNUSED(distanceToSubtreeRoot)
+        const std::vector<htd::vertex_t> & bag = decomposition.bagContent(node);
 
-        const std::vector<htd::vertex_t> & bag = decomposition.bagContent(vertex);
-
-        if (parent != htd::Vertex::UNKNOWN)
+        for (htd::vertex_t vertex : bag)
         {
-            decomposition.copyForgottenVerticesTo(parent, forgottenBagContent, vertex);
+            ++componentCount[vertex];
 
-            for (htd::vertex_t bagElement : bag)
-            {
-                if (forgottenVertices.count(bagElement) > 0)
-                {
-                    result.push_back(bagElement);
-                }
-            }
-
-            for (htd::vertex_t forgottenVertex : forgottenBagContent)
-            {
-                forgottenVertices.insert(forgottenVertex);
-            }
-
-            forgottenBagContent.clear();
+            stamp[vertex] = node;
         }
-        else
+
+        for (htd::vertex_t child : decomposition.children(node))
         {
-            for (htd::vertex_t bagElement : bag)
+            for (htd::vertex_t vertex : decomposition.bagContent(child))
             {
-                if (forgottenVertices.count(bagElement) > 0)
+                if (stamp[vertex] == node)
                 {
-                    result.push_back(bagElement);
+                    --componentCount[vertex];
                 }
             }
         }
-    });
-
-    std::sort(result.begin(), result.end());
+    }
 
-    result.erase(std::unique(result.begin(), result.end()), result.end());
+    for (std::size_t vertex = 0; vertex < bound; ++vertex)
+    {
+        if (componentCount[vertex] > 1)
+        {
+            result.push_back(static_cast<htd::vertex_t>(vertex));
+        }
+    }
 
     return htd::ConstCollection<htd::vertex_t>::getInstance(ret);
 }
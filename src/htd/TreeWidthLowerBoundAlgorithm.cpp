@@ -0,0 +1,485 @@
+/*
+ * File:   TreeWidthLowerBoundAlgorithm.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_TREEWIDTHLOWERBOUNDALGORITHM_CPP
+#define HTD_HTD_TREEWIDTHLOWERBOUNDALGORITHM_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/TreeWidthLowerBoundAlgorithm.hpp>
+#include <htd/GraphPreprocessorFactory.hpp>
+#include <htd/IGraphPreprocessor.hpp>
+
+#include <algorithm>
+
+/**
+ *  Private implementation details of class htd::TreeWidthLowerBoundAlgorithm.
+ */
+struct htd::TreeWidthLowerBoundAlgorithm::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager   The management instance to which the current object instance belongs.
+     */
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), minorMinWidthEnabled_(true), leastCommonNeighborContractionEnabled_(true), improvedGraphEnabled_(true)
+    {
+
+    }
+
+    /**
+     *  Copy constructor for the implementation details structure.
+     *
+     *  @param[in] original The original implementation details structure.
+     */
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), minorMinWidthEnabled_(original.minorMinWidthEnabled_), leastCommonNeighborContractionEnabled_(original.leastCommonNeighborContractionEnabled_), improvedGraphEnabled_(original.improvedGraphEnabled_)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  A boolean flag indicating whether the minor-min-width bound shall be computed.
+     */
+    bool minorMinWidthEnabled_;
+
+    /**
+     *  A boolean flag indicating whether the MMD+ bound (least-c strategy) shall be computed.
+     */
+    bool leastCommonNeighborContractionEnabled_;
+
+    /**
+     *  A boolean flag indicating whether the contraction bounds shall be improved further based on improved graphs.
+     */
+    bool improvedGraphEnabled_;
+
+    /**
+     *  Compute the maximum of all enabled contraction bounds for the given graph.
+     *
+     *  @param[in] neighborhood The sorted neighborhoods of the vertices of the graph. The vertices are identified by their position.
+     *  @param[in] lowerBound   A known lower bound for the treewidth of the given graph.
+     *  @param[in] upperBound   The value at which the computation shall stop.
+     *
+     *  @return The maximum of all enabled contraction bounds and the given lower bound.
+     */
+    std::size_t computeContractionBound(const std::vector<std::vector<htd::vertex_t>> & neighborhood, std::size_t lowerBound, std::size_t upperBound) const
+    {
+        std::size_t ret = lowerBound;
+
+        if (minorMinWidthEnabled_)
+        {
+            ret = computeContractionBound(neighborhood, false, ret, upperBound);
+        }
+
+        if (leastCommonNeighborContractionEnabled_ && ret < upperBound)
+        {
+            ret = computeContractionBound(neighborhood, true, ret, upperBound);
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Compute a contraction bound for the given graph. In each step, a vertex of minimum degree is selected and
+     *  contracted into one of its neighbors. The bound is the maximum degree of all selected vertices.
+     *
+     *  @param[in] neighborhood         The sorted neighborhoods of the vertices of the graph. The vertices are identified by their position.
+     *  @param[in] leastCommonNeighbors A boolean flag indicating whether the contracted vertex shall be merged into the neighbor with the least common neighbors (MMD+) instead of the neighbor of minimum degree (minor-min-width).
+     *  @param[in] lowerBound           A known lower bound for the treewidth of the given graph.
+     *  @param[in] upperBound           The value at which the computation shall stop.
+     *
+     *  @return The maximum of the contraction bound and the given lower bound.
+     */
+    std::size_t computeContractionBound(std::vector<std::vector<htd::vertex_t>> neighborhood, bool leastCommonNeighbors, std::size_t lowerBound, std::size_t upperBound) const;
+
+    /**
+     *  Compute the improved graph of the given graph, i.e., the graph in which each pair of non-adjacent vertices
+     *  sharing at least the given number of common neighbors is connected by an additional edge.
+     *
+     *  @param[in] neighborhood     The sorted neighborhoods of the vertices of the graph. The vertices are identified by their position.
+     *  @param[in] threshold        The minimum number of common neighbors of two vertices such that they become adjacent.
+     *  @param[out] target          The sorted neighborhoods of the vertices of the improved graph.
+     */
+    void computeImprovedGraph(const std::vector<std::vector<htd::vertex_t>> & neighborhood, std::size_t threshold, std::vector<std::vector<htd::vertex_t>> & target) const;
+
+    /**
+     *  Insert a vertex into the bucket structure used for finding a vertex of minimum degree.
+     *
+     *  @param[in] vertex           The vertex which shall be inserted.
+     *  @param[in] degree           The current degree of the vertex.
+     *  @param[in,out] buckets      The vertices grouped by their degree.
+     *  @param[in,out] minimumDegree The minimum degree of all vertices in the bucket structure.
+     */
+    static void insertIntoBucket(htd::vertex_t vertex, std::size_t degree, std::vector<std::vector<htd::vertex_t>> & buckets, std::size_t & minimumDegree)
+    {
+        buckets[degree].push_back(vertex);
+
+        if (degree < minimumDegree)
+        {
+            minimumDegree = degree;
+        }
+    }
+};
+
+htd::TreeWidthLowerBoundAlgorithm::TreeWidthLowerBoundAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd::TreeWidthLowerBoundAlgorithm::TreeWidthLowerBoundAlgorithm(const htd::TreeWidthLowerBoundAlgorithm & original) : implementation_(new Implementation(*(original.implementation_)))
+{
+
+}
+
+htd::TreeWidthLowerBoundAlgorithm::~TreeWidthLowerBoundAlgorithm()
+{
+
+}
+
+std::size_t htd::TreeWidthLowerBoundAlgorithm::computeLowerBound(const htd::IMultiHypergraph & graph) const
+{
+    htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
+
+    htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
+
+    std::size_t ret = computeLowerBound(*preprocessedGraph);
+
+    delete preprocessedGraph;
+    delete preprocessor;
+
+    return ret;
+}
+
+std::size_t htd::TreeWidthLowerBoundAlgorithm::computeLowerBound(const htd::IPreprocessedGraph & preprocessedGraph) const
+{
+    return computeLowerBound(preprocessedGraph, (std::size_t)-1);
+}
+
+std::size_t htd::TreeWidthLowerBoundAlgorithm::computeLowerBound(const htd::IPreprocessedGraph & preprocessedGraph, std::size_t upperBound) const
+{
+    std::size_t ret = preprocessedGraph.minTreeWidth();
+
+    const std::vector<htd::vertex_t> & remainingVertices = preprocessedGraph.remainingVertices();
+
+    if (ret >= upperBound || remainingVertices.size() <= ret + 1 || (!implementation_->minorMinWidthEnabled_ && !implementation_->leastCommonNeighborContractionEnabled_))
+    {
+        return ret;
+    }
+
+    const std::vector<std::vector<htd::vertex_t>> & inputNeighborhood = preprocessedGraph.neighborhood();
+
+    std::vector<htd::vertex_t> positions(inputNeighborhood.size(), (htd::vertex_t)-1);
+
+    for (htd::index_t index = 0; index < remainingVertices.size(); ++index)
+    {
+        positions[remainingVertices[index]] = static_cast<htd::vertex_t>(index);
+    }
+
+    std::vector<std::vector<htd::vertex_t>> neighborhood(remainingVertices.size());
+
+    for (htd::index_t index = 0; index < remainingVertices.size(); ++index)
+    {
+        std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[index];
+
+        for (htd::vertex_t neighbor : inputNeighborhood[remainingVertices[index]])
+        {
+            htd::vertex_t position = positions[neighbor];
+
+            if (position != (htd::vertex_t)-1 && position != index)
+            {
+                currentNeighborhood.push_back(position);
+            }
+        }
+
+        std::sort(currentNeighborhood.begin(), currentNeighborhood.end());
+
+        currentNeighborhood.erase(std::unique(currentNeighborhood.begin(), currentNeighborhood.end()), currentNeighborhood.end());
+    }
+
+    ret = implementation_->computeContractionBound(neighborhood, ret, upperBound);
+
+    if (implementation_->improvedGraphEnabled_)
+    {
+        const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+
+        std::vector<std::vector<htd::vertex_t>> improvedNeighborhood;
+
+        bool improved = true;
+
+        /*
+         *  If the treewidth of a graph is at most k, the same holds for the graph in which all non-adjacent vertices
+         *  with at least k+1 common neighbors are connected. Hence, if the contraction bound of the latter graph exceeds
+         *  k, the treewidth of the original graph is at least k+1.
+         */
+        while (improved && ret < upperBound && neighborhood.size() > ret + 1 && !managementInstance.isTerminated())
+        {
+            implementation_->computeImprovedGraph(neighborhood, ret + 1, improvedNeighborhood);
+
+            improved = !managementInstance.isTerminated() && implementation_->computeContractionBound(improvedNeighborhood, ret, ret + 1) > ret;
+
+            if (improved)
+            {
+                ++ret;
+            }
+        }
+    }
+
+    return ret;
+}
+
+bool htd::TreeWidthLowerBoundAlgorithm::isOptimal(const htd::LibraryInstance * const manager, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t & lowerBound)
+{
+    if (lowerBound == (std::size_t)-1)
+    {
+        if (maxBagSize <= preprocessedGraph.minTreeWidth() + 1)
+        {
+            return true;
+        }
+
+        htd::TreeWidthLowerBoundAlgorithm algorithm(manager);
+
+        lowerBound = algorithm.computeLowerBound(preprocessedGraph, maxBagSize - 1);
+    }
+
+    return maxBagSize <= lowerBound + 1;
+}
+
+bool htd::TreeWidthLowerBoundAlgorithm::isMinorMinWidthEnabled(void) const
+{
+    return implementation_->minorMinWidthEnabled_;
+}
+
+void htd::TreeWidthLowerBoundAlgorithm::setMinorMinWidthEnabled(bool minorMinWidthEnabled)
+{
+    implementation_->minorMinWidthEnabled_ = minorMinWidthEnabled;
+}
+
+bool htd::TreeWidthLowerBoundAlgorithm::isLeastCommonNeighborContractionEnabled(void) const
+{
+    return implementation_->leastCommonNeighborContractionEnabled_;
+}
+
+void htd::TreeWidthLowerBoundAlgorithm::setLeastCommonNeighborContractionEnabled(bool leastCommonNeighborContractionEnabled)
+{
+    implementation_->leastCommonNeighborContractionEnabled_ = leastCommonNeighborContractionEnabled;
+}
+
+bool htd::TreeWidthLowerBoundAlgorithm::isImprovedGraphEnabled(void) const
+{
+    return implementation_->improvedGraphEnabled_;
+}
+
+void htd::TreeWidthLowerBoundAlgorithm::setImprovedGraphEnabled(bool improvedGraphEnabled)
+{
+    implementation_->improvedGraphEnabled_ = improvedGraphEnabled;
+}
+
+const htd::LibraryInstance * htd::TreeWidthLowerBoundAlgorithm::managementInstance(void) const HTD_NOEXCEPT
+{
+    return implementation_->managementInstance_;
+}
+
+void htd::TreeWidthLowerBoundAlgorithm::setManagementInstance(const htd::LibraryInstance * const manager)
+{
+    HTD_ASSERT(manager != nullptr)
+
+    implementation_->managementInstance_ = manager;
+}
+
+htd::TreeWidthLowerBoundAlgorithm * htd::TreeWidthLowerBoundAlgorithm::clone(void) const
+{
+    return new htd::TreeWidthLowerBoundAlgorithm(*this);
+}
+
+std::size_t htd::TreeWidthLowerBoundAlgorithm::Implementation::computeContractionBound(std::vector<std::vector<htd::vertex_t>> neighborhood, bool leastCommonNeighbors, std::size_t lowerBound, std::size_t upperBound) const
+{
+    std::size_t ret = lowerBound;
+
+    std::size_t size = neighborhood.size();
+
+    std::size_t remainingVertexCount = size;
+
+    std::size_t minimumDegree = size;
+
+    std::vector<std::vector<htd::vertex_t>> buckets(size);
+
+    std::vector<bool> contracted(size, false);
+
+    for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
+    {
+        insertIntoBucket(vertex, neighborhood[vertex].size(), buckets, minimumDegree);
+    }
+
+    /* A graph with r vertices has no vertex of degree r or higher, hence the bound cannot grow once r <= ret + 1. */
+    while (remainingVertexCount > ret + 1 && ret < upperBound && !managementInstance_->isTerminated())
+    {
+        htd::vertex_t vertex = 0;
+
+        bool found = false;
+
+        while (!found)
+        {
+            std::vector<htd::vertex_t> & bucket = buckets[minimumDegree];
+
+            if (bucket.empty())
+            {
+                ++minimumDegree;
+            }
+            else
+            {
+                vertex = bucket.back();
+
+                bucket.pop_back();
+
+                found = !contracted[vertex] && neighborhood[vertex].size() == minimumDegree;
+            }
+        }
+
+        ret = std::max(ret, minimumDegree);
+
+        contracted[vertex] = true;
+
+        --remainingVertexCount;
+
+        std::vector<htd::vertex_t> & vertexNeighborhood = neighborhood[vertex];
+
+        if (!vertexNeighborhood.empty())
+        {
+            htd::vertex_t target = vertexNeighborhood[0];
+
+            std::size_t bestValue = (std::size_t)-1;
+
+            std::size_t bestDegree = (std::size_t)-1;
+
+            for (htd::vertex_t neighbor : vertexNeighborhood)
+            {
+                const std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[neighbor];
+
+                std::size_t currentValue = currentNeighborhood.size();
+
+                if (leastCommonNeighbors)
+                {
+                    currentValue = htd::set_intersection_size(vertexNeighborhood.begin(), vertexNeighborhood.end(), currentNeighborhood.begin(), currentNeighborhood.end());
+                }
+
+                if (currentValue < bestValue || (currentValue == bestValue && currentNeighborhood.size() < bestDegree))
+                {
+                    target = neighbor;
+
+                    bestValue = currentValue;
+
+                    bestDegree = currentNeighborhood.size();
+                }
+            }
+
+            std::vector<htd::vertex_t> & targetNeighborhood = neighborhood[target];
+
+            for (htd::vertex_t neighbor : vertexNeighborhood)
+            {
+                std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[neighbor];
+
+                currentNeighborhood.erase(std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), vertex));
+
+                if (neighbor != target)
+                {
+                    auto position = std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), target);
+
+                    if (position == currentNeighborhood.end() || *position != target)
+                    {
+                        currentNeighborhood.insert(position, target);
+
+                        targetNeighborhood.insert(std::lower_bound(targetNeighborhood.begin(), targetNeighborhood.end(), neighbor), neighbor);
+                    }
+                    else
+                    {
+                        insertIntoBucket(neighbor, currentNeighborhood.size(), buckets, minimumDegree);
+                    }
+                }
+            }
+
+            insertIntoBucket(target, targetNeighborhood.size(), buckets, minimumDegree);
+
+            std::vector<htd::vertex_t>().swap(vertexNeighborhood);
+        }
+    }
+
+    return ret;
+}
+
+void htd::TreeWidthLowerBoundAlgorithm::Implementation::computeImprovedGraph(const std::vector<std::vector<htd::vertex_t>> & neighborhood, std::size_t threshold, std::vector<std::vector<htd::vertex_t>> & target) const
+{
+    std::size_t size = neighborhood.size();
+
+    target = neighborhood;
+
+    std::vector<std::size_t> commonNeighborCount(size, 0);
+
+    std::vector<htd::vertex_t> candidates;
+
+    for (htd::vertex_t vertex = 0; vertex < size && !managementInstance_->isTerminated(); ++vertex)
+    {
+        const std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
+
+        for (htd::vertex_t neighbor : currentNeighborhood)
+        {
+            for (htd::vertex_t candidate : neighborhood[neighbor])
+            {
+                if (candidate > vertex && commonNeighborCount[candidate]++ == 0)
+                {
+                    candidates.push_back(candidate);
+                }
+            }
+        }
+
+        for (htd::vertex_t candidate : candidates)
+        {
+            if (commonNeighborCount[candidate] >= threshold && !std::binary_search(currentNeighborhood.begin(), currentNeighborhood.end(), candidate))
+            {
+                target[vertex].push_back(candidate);
+
+                target[candidate].push_back(vertex);
+            }
+
+            commonNeighborCount[candidate] = 0;
+        }
+
+        candidates.clear();
+    }
+
+    for (std::vector<htd::vertex_t> & currentNeighborhood : target)
+    {
+        std::sort(currentNeighborhood.begin(), currentNeighborhood.end());
+    }
+}
+
+#endif /* HTD_HTD_TREEWIDTHLOWERBOUNDALGORITHM_CPP */
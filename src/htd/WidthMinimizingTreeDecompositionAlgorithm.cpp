@@ -30,6 +30,7 @@
 
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
+#include <htd/TreeWidthLowerBoundAlgorithm.hpp>
 
 #include <cstdarg>
 #include <algorithm>
@@ -45,7 +46,7 @@ struct htd::WidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  @param[in] manager  The management instance to which the current object instance belongs.
      */
     Implementation(const htd::LibraryInstance * const manager)
-        : managementInstance_(manager), algorithm_(new htd::BucketEliminationTreeDecompositionAlgorithm(manager)), iterationCount_(1), nonImprovementLimit_(-1)
+        : managementInstance_(manager), algorithm_(new htd::BucketEliminationTreeDecompositionAlgorithm(manager)), iterationCount_(1), nonImprovementLimit_(-1), lowerBoundTerminationEnabled_(true)
     {
 
     }
@@ -57,7 +58,7 @@ struct htd::WidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  @param[in] manipulationOperations   The manipulation operations which shall be applied globally to each decomposition generated by the algorithm.
      */
     Implementation(const htd::LibraryInstance * const manager, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations)
-        : managementInstance_(manager), algorithm_(new htd::BucketEliminationTreeDecompositionAlgorithm(manager, manipulationOperations)), iterationCount_(1), nonImprovementLimit_(-1)
+        : managementInstance_(manager), algorithm_(new htd::BucketEliminationTreeDecompositionAlgorithm(manager, manipulationOperations)), iterationCount_(1), nonImprovementLimit_(-1), lowerBoundTerminationEnabled_(true)
     {
 
     }
@@ -67,7 +68,7 @@ struct htd::WidthMinimizingTreeDecompositionAlgorithm::Implementation
      *
      *  @param[in] original The original implementation details structure.
      */
-    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithm_(original.algorithm_->clone()), iterationCount_(original.iterationCount_), nonImprovementLimit_(original.nonImprovementLimit_)
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithm_(original.algorithm_->clone()), iterationCount_(original.iterationCount_), nonImprovementLimit_(original.nonImprovementLimit_), lowerBoundTerminationEnabled_(original.lowerBoundTerminationEnabled_)
     {
 
     }
@@ -96,6 +97,21 @@ struct htd::WidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  The maximum number of iterations without improvement after which the algorithm shall terminate.
      */
     std::size_t nonImprovementLimit_;
+
+    /**
+     *  A boolean flag indicating whether the algorithm shall terminate as soon as the width of the best decomposition matches the lower bound for the treewidth.
+     */
+    bool lowerBoundTerminationEnabled_;
+
+    /**
+     *  Check whether a decomposition of the given maximum bag size is optimal. Always false if lower bound termination is disabled.
+     *
+     *  @see htd::TreeWidthLowerBoundAlgorithm::isOptimal()
+     */
+    bool isOptimal(const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t & lowerBound) const
+    {
+        return lowerBoundTerminationEnabled_ && htd::TreeWidthLowerBoundAlgorithm::isOptimal(managementInstance_, preprocessedGraph, maxBagSize, lowerBound);
+    }
 };
 
 htd::WidthMinimizingTreeDecompositionAlgorithm::WidthMinimizingTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -279,7 +295,10 @@ htd::ITreeDecomposition * htd::WidthMinimizingTreeDecompositionAlgorithm::comput
 
     htd::index_t iteration = 0;
 
-    while ((iteration == 0 || implementation_->iterationCount_ == 0 || iteration < implementation_->iterationCount_) && !managementInstance.isTerminated())
+    std::size_t lowerBound = (std::size_t)-1;
+
+    while ((iteration == 0 || implementation_->iterationCount_ == 0 || iteration < implementation_->iterationCount_) && !managementInstance.isTerminated() &&
+           (ret == nullptr || !implementation_->isOptimal(preprocessedGraph, bestMaxBagSize, lowerBound)))
     {
         std::vector<htd::IDecompositionManipulationOperation *> clonedManipulationOperations;
 
@@ -434,6 +453,16 @@ void htd::WidthMinimizingTreeDecompositionAlgorithm::setNonImprovementLimit(std:
     implementation_->nonImprovementLimit_ = nonImprovementLimit;
 }
 
+bool htd::WidthMinimizingTreeDecompositionAlgorithm::isLowerBoundTerminationEnabled(void) const
+{
+    return implementation_->lowerBoundTerminationEnabled_;
+}
+
+void htd::WidthMinimizingTreeDecompositionAlgorithm::setLowerBoundTerminationEnabled(bool lowerBoundTerminationEnabled)
+{
+    implementation_->lowerBoundTerminationEnabled_ = lowerBoundTerminationEnabled;
+}
+
 bool htd::WidthMinimizingTreeDecompositionAlgorithm::isCompressionEnabled(void) const
 {
     return implementation_->algorithm_->isCompressionEnabled();
@@ -27,13 +27,20 @@
 
 #include <htd/Globals.hpp>
 #include <htd/WidthReductionOperation.hpp>
-#include <htd/MultiGraphFactory.hpp>
+#include <htd/Helpers.hpp>
 #include <htd/MinimumSeparatorAlgorithm.hpp>
 #include <htd/GraphSeparatorAlgorithmFactory.hpp>
 #include <htd/ConnectedComponentAlgorithmFactory.hpp>
 
+#include <htd/VectorAdapter.hpp>
+
 #include <algorithm>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 /**
@@ -48,7 +55,7 @@ struct htd::WidthReductionOperation::Implementation
      */
     Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager),
                                                                  separatorAlgorithm_(managementInstance_->graphSeparatorAlgorithmFactory().createInstance()),
-                                                                 connectedComponentAlgorithm_(managementInstance_->connectedComponentAlgorithmFactory().createInstance()), restrictedToLargestBags_(true)
+                                                                 connectedComponentAlgorithm_(managementInstance_->connectedComponentAlgorithmFactory().createInstance()), restrictedToLargestBags_(true), threadCount_(1)
     {
 
     }
@@ -58,7 +65,7 @@ struct htd::WidthReductionOperation::Implementation
      *
      *  @param[in] original The original implementation details structure.
      */
-    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), separatorAlgorithm_(original.separatorAlgorithm_->clone()), connectedComponentAlgorithm_(original.connectedComponentAlgorithm_->clone()), restrictedToLargestBags_(original.restrictedToLargestBags_)
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), separatorAlgorithm_(original.separatorAlgorithm_->clone()), connectedComponentAlgorithm_(original.connectedComponentAlgorithm_->clone()), restrictedToLargestBags_(original.restrictedToLargestBags_), threadCount_(original.threadCount_)
     {
 
     }
@@ -90,175 +97,398 @@ struct htd::WidthReductionOperation::Implementation
     bool restrictedToLargestBags_;
 
     /**
-     * Internal data structure for storing induced graphs.
+     *  The number of threads which are used to analyze the bags of the decomposition.
+     */
+    std::size_t threadCount_;
+
+    /**
+     *  Internal data structure for storing the graph induced by a bag in compressed sparse row format.
+     *
+     *  The vertices of the induced graph are the positions of the respective base graph vertices within the bag, starting at one.
      */
-    class InducedGraph
+    class InducedGraph : public htd::IGraphStructure
     {
         public:
             /**
              *  Constructor for a new induced graph.
              *
-             *  @param[in] graph            The graph for which the induced graph shall be constructed.
-             *  @param[in] relevantVertices The vertices of the induced graph.
+             *  @param[in] graph    The graph for which the induced graph shall be constructed.
+             *  @param[in] bag      The sorted vertices of the induced graph.
+             *  @param[in] cliques  The sorted sets of base graph vertices which shall additionally form a clique in the induced graph.
              */
-            InducedGraph(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & relevantVertices) : baseGraphToInducedGraphMapping_(), inducedGraphToBaseGraphMapping_(relevantVertices), graph_(graph.managementInstance()->multiGraphFactory().createInstance(relevantVertices.size()))
+            InducedGraph(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & bag, const std::vector<std::vector<htd::vertex_t>> & cliques) : vertices_(bag.size()), offsets_(bag.size() + 2, 0), neighbors_(), edgeCount_(0)
             {
-                #ifndef NDEBUG
-                for (htd::vertex_t vertex : relevantVertices)
+                std::iota(vertices_.begin(), vertices_.end(), 1);
+
+                std::vector<std::vector<htd::vertex_t>> neighborhood(bag.size() + 1);
+
+                std::vector<htd::vertex_t> relevantNeighbors;
+
+                for (htd::index_t index = 0; index < bag.size(); ++index)
                 {
-                    HTD_ASSERT(graph.isVertex(vertex))
-                }
-                #endif
+                    HTD_ASSERT(graph.isVertex(bag[index]))
+
+                    const htd::ConstCollection<htd::vertex_t> & currentNeighborhood = graph.neighbors(bag[index]);
 
-                htd::index_t index = 0;
+                    relevantNeighbors.clear();
 
-                for (htd::vertex_t vertex : relevantVertices)
+                    std::set_intersection(currentNeighborhood.begin(), currentNeighborhood.end(), bag.begin() + index + 1, bag.end(), std::back_inserter(relevantNeighbors));
+
+                    for (htd::vertex_t relevantNeighbor : relevantNeighbors)
+                    {
+                        htd::vertex_t neighbor = localVertex(bag, relevantNeighbor);
+
+                        neighborhood[index + 1].push_back(neighbor);
+                        neighborhood[neighbor].push_back(static_cast<htd::vertex_t>(index + 1));
+                    }
+                }
+
+                for (const std::vector<htd::vertex_t> & clique : cliques)
                 {
-                    baseGraphToInducedGraphMapping_.emplace(vertex, index);
+                    for (auto it = clique.begin(); it != clique.end(); ++it)
+                    {
+                        htd::vertex_t vertex = localVertex(bag, *it);
+
+                        for (auto it2 = it + 1; it2 != clique.end(); ++it2)
+                        {
+                            htd::vertex_t neighbor = localVertex(bag, *it2);
 
-                    ++index;
+                            neighborhood[vertex].push_back(neighbor);
+                            neighborhood[neighbor].push_back(vertex);
+                        }
+                    }
                 }
 
-                for (auto it = relevantVertices.begin(); it != relevantVertices.end();)
+                for (std::vector<htd::vertex_t> & currentNeighborhood : neighborhood)
                 {
-                    htd::vertex_t vertex = *it;
+                    std::sort(currentNeighborhood.begin(), currentNeighborhood.end());
 
-                    htd::vertex_t mappedVertex = baseGraphToInducedGraphMapping_.at(vertex) + 1;
+                    currentNeighborhood.erase(std::unique(currentNeighborhood.begin(), currentNeighborhood.end()), currentNeighborhood.end());
+                }
 
-                    const htd::ConstCollection<htd::vertex_t> & currentNeighborhood = graph.neighbors(vertex);
+                compress(neighborhood);
+            }
 
-                    std::vector<htd::vertex_t> relevantNeighbors;
+            /**
+             *  Constructor for a new induced graph which results from removing a set of vertices from an existing induced graph.
+             *
+             *  @param[in] original         The original induced graph.
+             *  @param[in] removedVertices  The vertices of the original induced graph which shall not be part of the new induced graph.
+             */
+            InducedGraph(const InducedGraph & original, const std::vector<htd::vertex_t> & removedVertices) : vertices_(), offsets_(original.offsets_.size(), 0), neighbors_(), edgeCount_(0)
+            {
+                std::vector<bool> removed(original.offsets_.size(), false);
 
-                    ++it;
+                for (htd::vertex_t removedVertex : removedVertices)
+                {
+                    removed[removedVertex] = true;
+                }
 
-                    std::set_intersection(currentNeighborhood.begin(), currentNeighborhood.end(), it, relevantVertices.end(), std::back_inserter(relevantNeighbors));
+                std::vector<std::vector<htd::vertex_t>> neighborhood(original.offsets_.size() - 1);
 
-                    for (htd::vertex_t relevantNeighbor : relevantNeighbors)
+                for (htd::vertex_t vertex : original.vertices_)
+                {
+                    if (!removed[vertex])
                     {
-                        graph_->addEdge(mappedVertex, baseGraphToInducedGraphMapping_.at(relevantNeighbor) + 1);
+                        vertices_.push_back(vertex);
+
+                        for (std::size_t position = original.offsets_[vertex]; position < original.offsets_[vertex + 1]; ++position)
+                        {
+                            if (!removed[original.neighbors_[position]])
+                            {
+                                neighborhood[vertex].push_back(original.neighbors_[position]);
+                            }
+                        }
                     }
                 }
+
+                compress(neighborhood);
             }
 
             /**
              *  Destructor for an induced graph.
              */
-            ~InducedGraph()
+            virtual ~InducedGraph()
             {
-               delete graph_;
+
             }
 
-            /**
-             *  Getter for the number of vertices in the induced graph.
-             *
-             *  @return The number of vertices in the induced graph.
-             */
-            std::size_t vertexCount(void) const
+            std::size_t vertexCount(void) const HTD_OVERRIDE
             {
-                return graph_->vertexCount();
+                return vertices_.size();
             }
 
-            /**
-             *  Access the underlying IMultiGraph object.
-             *
-             *  @return The underlying IMultiGraph object.
-             */
-            const htd::IMultiGraph & internalGraph(void) const
+            std::size_t edgeCount(void) const HTD_OVERRIDE
             {
-                return *graph_;
+                return edgeCount_;
             }
 
-            /**
-             *  Create a clique in the induced graph.
-             *
-             *  @param[in] vertices The vertices of the induced graph which shall form a clique.
-             */
-            void createClique(const std::vector<htd::vertex_t> & vertices)
+            std::size_t edgeCount(htd::vertex_t vertex) const HTD_OVERRIDE
             {
-                #ifndef NDEBUG
-                for (htd::vertex_t vertex : vertices)
-                {
-                    HTD_ASSERT(graph_->isVertex(vertex))
-                }
-                #endif
+                return neighborCount(vertex);
+            }
 
-                for (auto it = vertices.begin(); it != vertices.end();)
-                {
-                    htd::vertex_t vertex = *it;
+            htd::ConstCollection<htd::vertex_t> vertices(void) const HTD_OVERRIDE
+            {
+                return htd::ConstCollection<htd::vertex_t>::getInstance(vertices_);
+            }
 
-                    ++it;
+            void copyVerticesTo(std::vector<htd::vertex_t> & target) const HTD_OVERRIDE
+            {
+                target.insert(target.end(), vertices_.begin(), vertices_.end());
+            }
 
-                    for (auto it2 = it; it2 != vertices.end(); ++it2)
-                    {
-                        if (!graph_->isNeighbor(vertex, *it2))
-                        {
-                            graph_->addEdge(vertex, *it2);
-                        }
-                    }
-                }
+            htd::vertex_t vertexAtPosition(htd::index_t index) const HTD_OVERRIDE
+            {
+                HTD_ASSERT(index < vertices_.size())
+
+                return vertices_[index];
             }
 
-            /**
-             *  Remove a vertex from the induced graph.
-             *
-             *  @param[in] vertex   The ID of the vertex which shall be removed.
-             */
-            void removeVertex(htd::vertex_t vertex)
+            bool isVertex(htd::vertex_t vertex) const HTD_OVERRIDE
+            {
+                return std::binary_search(vertices_.begin(), vertices_.end(), vertex);
+            }
+
+            std::size_t isolatedVertexCount(void) const HTD_OVERRIDE
+            {
+                return static_cast<std::size_t>(std::count_if(vertices_.begin(), vertices_.end(), [&](htd::vertex_t vertex) { return offsets_[vertex] == offsets_[vertex + 1]; }));
+            }
+
+            htd::ConstCollection<htd::vertex_t> isolatedVertices(void) const HTD_OVERRIDE
+            {
+                htd::VectorAdapter<htd::vertex_t> ret;
+
+                auto & result = ret.container();
+
+                std::copy_if(vertices_.begin(), vertices_.end(), std::back_inserter(result), [&](htd::vertex_t vertex) { return offsets_[vertex] == offsets_[vertex + 1]; });
+
+                return htd::ConstCollection<htd::vertex_t>::getInstance(ret);
+            }
+
+            htd::vertex_t isolatedVertexAtPosition(htd::index_t index) const HTD_OVERRIDE
             {
-                HTD_ASSERT(graph_->isVertex(vertex))
+                const htd::ConstCollection<htd::vertex_t> & isolatedVertexCollection = isolatedVertices();
 
-                graph_->removeVertex(vertex);
+                HTD_ASSERT(index < isolatedVertexCollection.size())
+
+                return isolatedVertexCollection[index];
+            }
+
+            bool isIsolatedVertex(htd::vertex_t vertex) const HTD_OVERRIDE
+            {
+                HTD_ASSERT(isVertex(vertex))
+
+                return offsets_[vertex] == offsets_[vertex + 1];
+            }
+
+            std::size_t neighborCount(htd::vertex_t vertex) const HTD_OVERRIDE
+            {
+                HTD_ASSERT(isVertex(vertex))
+
+                return offsets_[vertex + 1] - offsets_[vertex];
+            }
+
+            htd::ConstCollection<htd::vertex_t> neighbors(htd::vertex_t vertex) const HTD_OVERRIDE
+            {
+                HTD_ASSERT(isVertex(vertex))
+
+                return htd::ConstCollection<htd::vertex_t>(htd::ConstIterator<htd::vertex_t>(neighbors_.begin() + offsets_[vertex]),
+                                                           htd::ConstIterator<htd::vertex_t>(neighbors_.begin() + offsets_[vertex + 1]));
+            }
+
+            void copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const HTD_OVERRIDE
+            {
+                HTD_ASSERT(isVertex(vertex))
+
+                target.insert(target.end(), neighbors_.begin() + offsets_[vertex], neighbors_.begin() + offsets_[vertex + 1]);
+            }
+
+            htd::vertex_t neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const HTD_OVERRIDE
+            {
+                HTD_ASSERT(isVertex(vertex))
+                HTD_ASSERT(index < neighborCount(vertex))
+
+                return neighbors_[offsets_[vertex] + index];
+            }
+
+            bool isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const HTD_OVERRIDE
+            {
+                HTD_ASSERT(isVertex(vertex))
+
+                return std::binary_search(neighbors_.begin() + offsets_[vertex], neighbors_.begin() + offsets_[vertex + 1], neighbor);
+            }
+
+            bool isConnected(void) const HTD_OVERRIDE
+            {
+                return vertices_.empty() || reachableVertexCount(vertices_[0], htd::Vertex::UNKNOWN) == vertices_.size();
+            }
+
+            bool isConnected(htd::vertex_t vertex1, htd::vertex_t vertex2) const HTD_OVERRIDE
+            {
+                HTD_ASSERT(isVertex(vertex1) && isVertex(vertex2))
+
+                return vertex1 == vertex2 || reachableVertexCount(vertex1, vertex2) == 0;
             }
 
             /**
-             *  Get the vertex of the base graph which corresponds to the given vertex of the induced graph.
-             *
-             *  @param[in] inducedGraphVertex   The vertex of the induced graph.
+             *  Check whether the induced graph is complete.
              *
-             *  @return The vertex of the base graph which corresponds to the given vertex of the induced graph.
+             *  @return True if the induced graph is complete, false otherwise.
              */
-            htd::vertex_t baseGraphVertex(htd::vertex_t inducedGraphVertex) const
+            bool isComplete(void) const
             {
-                return inducedGraphToBaseGraphMapping_[inducedGraphVertex - 1];
+                return std::all_of(vertices_.begin(), vertices_.end(), [&](htd::vertex_t vertex) { return neighborCount(vertex) + 1 >= vertices_.size(); });
             }
 
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            InducedGraph * clone(void) const HTD_OVERRIDE
+            {
+                return new InducedGraph(*this);
+            }
+#else
+            InducedGraph * clone(void) const
+            {
+                return new InducedGraph(*this);
+            }
+
+            htd::IGraphStructure * cloneGraphStructure(void) const HTD_OVERRIDE
+            {
+                return clone();
+            }
+#endif
+
+        private:
+            /**
+             *  The vertices of the induced graph.
+             */
+            std::vector<htd::vertex_t> vertices_;
+
+            /**
+             *  The neighbors of vertex v are stored at the positions offsets_[v] to offsets_[v + 1] - 1 of neighbors_.
+             */
+            std::vector<std::size_t> offsets_;
+
+            /**
+             *  The sorted neighborhoods of all vertices, stored consecutively.
+             */
+            std::vector<htd::vertex_t> neighbors_;
+
+            /**
+             *  The number of edges of the induced graph.
+             */
+            std::size_t edgeCount_;
+
             /**
              *  Get the vertex of the induced graph which corresponds to the given vertex of the base graph.
              *
+             *  @param[in] bag              The sorted vertices of the induced graph.
              *  @param[in] baseGraphVertex  The vertex of the base graph.
              *
              *  @return The vertex of the induced graph which corresponds to the given vertex of the base graph.
              */
-            htd::vertex_t inducedGraphVertex(htd::vertex_t baseGraphVertex) const
+            static htd::vertex_t localVertex(const std::vector<htd::vertex_t> & bag, htd::vertex_t baseGraphVertex)
             {
-                return baseGraphToInducedGraphMapping_.at(baseGraphVertex) + 1;
+                HTD_ASSERT(std::binary_search(bag.begin(), bag.end(), baseGraphVertex))
+
+                return static_cast<htd::vertex_t>(std::distance(bag.begin(), std::lower_bound(bag.begin(), bag.end(), baseGraphVertex)) + 1);
             }
 
-        private:
             /**
-             * A mapping from the base graph vertices to the vertices of the induced graph.
+             *  Store the given neighborhoods in compressed form.
+             *
+             *  @param[in] neighborhood The sorted neighborhoods, indexed by the vertices of the induced graph.
              */
-            std::unordered_map<htd::vertex_t, htd::vertex_t> baseGraphToInducedGraphMapping_;
+            void compress(const std::vector<std::vector<htd::vertex_t>> & neighborhood)
+            {
+                for (htd::index_t vertex = 0; vertex < neighborhood.size(); ++vertex)
+                {
+                    offsets_[vertex + 1] = offsets_[vertex] + neighborhood[vertex].size();
+                }
 
-            /**
-             * A mapping from the vertices of the induced graph to the base graph vertices.
-             */
-            std::vector<htd::vertex_t> inducedGraphToBaseGraphMapping_;
+                neighbors_.reserve(offsets_[neighborhood.size()]);
+
+                for (const std::vector<htd::vertex_t> & currentNeighborhood : neighborhood)
+                {
+                    neighbors_.insert(neighbors_.end(), currentNeighborhood.begin(), currentNeighborhood.end());
+                }
+
+                edgeCount_ = neighbors_.size() / 2;
+            }
 
             /**
-             * The induced graph.
+             *  Count the vertices reachable from the given starting vertex.
+             *
+             *  @param[in] startingVertex   The starting vertex.
+             *  @param[in] targetVertex     The vertex at which the search shall stop, or htd::Vertex::UNKNOWN if the search shall be exhaustive.
+             *
+             *  @return The number of reachable vertices, or zero if the target vertex was reached.
              */
-            htd::IMutableMultiGraph * graph_;
+            std::size_t reachableVertexCount(htd::vertex_t startingVertex, htd::vertex_t targetVertex) const
+            {
+                std::vector<bool> visited(offsets_.size(), false);
+
+                std::vector<htd::vertex_t> stack(1, startingVertex);
+
+                std::size_t ret = 0;
+
+                visited[startingVertex] = true;
+
+                while (!stack.empty())
+                {
+                    htd::vertex_t vertex = stack.back();
+
+                    stack.pop_back();
+
+                    ++ret;
+
+                    for (std::size_t position = offsets_[vertex]; position < offsets_[vertex + 1]; ++position)
+                    {
+                        htd::vertex_t neighbor = neighbors_[position];
+
+                        if (neighbor == targetVertex)
+                        {
+                            return 0;
+                        }
+
+                        if (!visited[neighbor])
+                        {
+                            visited[neighbor] = true;
+
+                            stack.push_back(neighbor);
+                        }
+                    }
+                }
+
+                return ret;
+            }
     };
 
     /**
-     *  Check whether the given graph is complete.
-     *
-     *  @param[in] graph    The graph.
-     *
-     *  @return True if the given graph is complete, false otherwise.
+     *  The result of analyzing the graph induced by a bag.
      */
-    bool isComplete(const htd::IGraphStructure & graph) const;
+    struct BagAnalysis
+    {
+        /**
+         *  A boolean flag indicating whether the induced graph is complete.
+         */
+        bool complete;
+
+        /**
+         *  The separator of the induced graph, given as sorted base graph vertices.
+         */
+        std::vector<htd::vertex_t> separator;
+
+        /**
+         *  The connected components of the induced graph after removing the separator, given as sorted base graph vertices.
+         */
+        std::vector<std::vector<htd::vertex_t>> components;
+    };
+
+    /**
+     *  Cache of bag analyses. The key is an encoding of the bag and the cliques which determine the induced graph.
+     */
+    typedef std::unordered_map<std::vector<htd::vertex_t>, BagAnalysis> AnalysisCache;
 
     /**
      *  Check whether a vertex is contained in a subtree of the given decomposition.
@@ -271,37 +501,55 @@ struct htd::WidthReductionOperation::Implementation
      */
     bool isInSubtree(const htd::ITreeDecomposition & decomposition, htd::vertex_t root, htd::vertex_t vertex) const;
 
-    /**
-     *  Remove unneccessary vertices from bags.
-     *
-     *  @param[in] graph            The graph from which the decomposition was computed.
-     *  @param[in] decomposition    The decomposition which shall be updated.
-     */
-    void performCleanup(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition) const;
-
     /**
      *  Try to improve the bag size of the selected decomposition node.
      *
      *  @param[in] graph            The graph from which the decomposition was computed.
      *  @param[in] decomposition    The decomposition which shall be updated.
      *  @param[in] vertex           The selected node.
+     *  @param[in,out] cache        The cache of bag analyses.
      *  @param[out] createdVertices A vector of vertices which were created by the manipulation operation.
      *  @param[out] removedVertices A vector of vertices which were removed by the manipulation operation.
      *
      *  @return True if the bag size of the selected decomposition node could be reduced, false otherwise.
      */
-    bool processDecompositionNode(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition, htd::vertex_t vertex, std::vector<htd::vertex_t> & createdVertices, std::vector<htd::vertex_t> & removedVertices) const;
+    bool processDecompositionNode(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition, htd::vertex_t vertex, AnalysisCache & cache, std::vector<htd::vertex_t> & createdVertices, std::vector<htd::vertex_t> & removedVertices) const;
 
     /**
-     *  Create the graph which corresponds to the bag of the selected decomposition node.
+     *  Compute the key identifying the graph which corresponds to the bag of the selected decomposition node.
+     *
+     *  The graph consists of the subgraph induced by the bag together with a clique on the intersection of the bag with the bag of each neighboring node.
      *
-     *  @param[in] graph            The graph from which the decomposition was computed.
      *  @param[in] decomposition    The decomposition.
      *  @param[in] vertex           The selected node.
+     *  @param[out] cliques         The sorted, duplicate-free intersections of the bag with the bags of the neighboring nodes.
      *
-     *  @return The graph which corresponds to the bag of the selected decomposition node.
+     *  @return The key identifying the graph which corresponds to the bag of the selected decomposition node.
      */
-    InducedGraph * createCorrespondingGraph(const htd::IMultiHypergraph & graph, const htd::ITreeDecomposition & decomposition, htd::vertex_t vertex) const;
+    std::vector<htd::vertex_t> computeKey(const htd::ITreeDecomposition & decomposition, htd::vertex_t vertex, std::vector<std::vector<htd::vertex_t>> & cliques) const;
+
+    /**
+     *  Analyze the graph which corresponds to a bag.
+     *
+     *  @param[in] graph                        The graph from which the decomposition was computed.
+     *  @param[in] bag                          The bag.
+     *  @param[in] cliques                      The intersections of the bag with the bags of the neighboring nodes.
+     *  @param[in] separatorAlgorithm           The algorithm for computing separating vertex sets.
+     *  @param[in] connectedComponentAlgorithm  The algorithm for computing connected components.
+     *
+     *  @return The result of the analysis.
+     */
+    BagAnalysis analyzeBag(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & bag, const std::vector<std::vector<htd::vertex_t>> & cliques, const htd::IGraphSeparatorAlgorithm & separatorAlgorithm, const htd::IConnectedComponentAlgorithm & connectedComponentAlgorithm) const;
+
+    /**
+     *  Analyze the bags of the given decomposition nodes concurrently and store the results in the cache.
+     *
+     *  @param[in] graph            The graph from which the decomposition was computed.
+     *  @param[in] decomposition    The decomposition.
+     *  @param[in] vertices         The decomposition nodes whose bags shall be analyzed.
+     *  @param[in,out] cache        The cache of bag analyses.
+     */
+    void analyzeBags(const htd::IMultiHypergraph & graph, const htd::ITreeDecomposition & decomposition, const std::vector<htd::vertex_t> & vertices, AnalysisCache & cache) const;
 };
 
 htd::WidthReductionOperation::WidthReductionOperation(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -341,6 +589,8 @@ void htd::WidthReductionOperation::apply(const htd::IMultiHypergraph & graph, ht
 
     std::unordered_set<htd::vertex_t> updatedRelevantVertices(relevantVertices.begin(), relevantVertices.end());
 
+    Implementation::AnalysisCache cache;
+
     while (ok)
     {
         ok = false;
@@ -375,9 +625,14 @@ void htd::WidthReductionOperation::apply(const htd::IMultiHypergraph & graph, ht
             std::set_intersection(vertexCollection.begin(), vertexCollection.end(), updatedRelevantVertices.begin(), updatedRelevantVertices.end(), std::back_inserter(pool));
         }
 
+        if (implementation_->threadCount_ > 1)
+        {
+            implementation_->analyzeBags(graph, decomposition, pool, cache);
+        }
+
         for (htd::vertex_t vertex : pool)
         {
-            if (implementation_->processDecompositionNode(graph, decomposition, vertex, createdVertices, removedVertices))
+            if (implementation_->processDecompositionNode(graph, decomposition, vertex, cache, createdVertices, removedVertices))
             {
                 for (htd::vertex_t createdVertex : createdVertices)
                 {
@@ -464,9 +719,27 @@ void htd::WidthReductionOperation::setRestrictedToLargestBags(bool restrictedToL
     implementation_->restrictedToLargestBags_ = restrictedToLargestBags;
 }
 
+std::size_t htd::WidthReductionOperation::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::WidthReductionOperation::setThreadCount(std::size_t threadCount)
+{
+    HTD_ASSERT(threadCount > 0)
+
+    implementation_->threadCount_ = threadCount;
+}
+
 htd::WidthReductionOperation * htd::WidthReductionOperation::clone(void) const
 {
-    return new htd::WidthReductionOperation(implementation_->managementInstance_);
+    htd::WidthReductionOperation * ret = new htd::WidthReductionOperation(implementation_->managementInstance_);
+
+    ret->setRestrictedToLargestBags(implementation_->restrictedToLargestBags_);
+
+    ret->setThreadCount(implementation_->threadCount_);
+
+    return ret;
 }
 
 void htd::WidthReductionOperation::setGraphSeparatorAlgorithm(htd::IGraphSeparatorAlgorithm * algorithm)
@@ -490,7 +763,7 @@ htd::ITreeDecompositionManipulationOperation * htd::WidthReductionOperation::clo
 }
 #endif
 
-bool htd::WidthReductionOperation::Implementation::processDecompositionNode(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition, htd::vertex_t vertex, std::vector<htd::vertex_t> & createdVertices, std::vector<htd::vertex_t> & removedVertices) const
+bool htd::WidthReductionOperation::Implementation::processDecompositionNode(const htd::IMultiHypergraph & graph, htd::IMutableTreeDecomposition & decomposition, htd::vertex_t vertex, AnalysisCache & cache, std::vector<htd::vertex_t> & createdVertices, std::vector<htd::vertex_t> & removedVertices) const
 {
     HTD_ASSERT(decomposition.isVertex(vertex))
 
@@ -498,25 +771,27 @@ bool htd::WidthReductionOperation::Implementation::processDecompositionNode(cons
 
     const std::vector<htd::vertex_t> & bagContent = decomposition.bagContent(vertex);
 
-    htd::WidthReductionOperation::Implementation::InducedGraph * inducedGraph = createCorrespondingGraph(graph, decomposition, vertex);
+    std::vector<std::vector<htd::vertex_t>> cliques;
 
-    if (!isComplete(inducedGraph->internalGraph()))
-    {
-        std::vector<htd::vertex_t> neighbors;
-        decomposition.copyNeighborsTo(vertex, neighbors);
+    std::vector<htd::vertex_t> key = computeKey(decomposition, vertex, cliques);
 
-        std::vector<htd::vertex_t> * separator = separatorAlgorithm_->computeSeparator(inducedGraph->internalGraph());
+    auto cachedAnalysis = cache.find(key);
 
-        for (htd::vertex_t & separatingVertex : *separator)
-        {
-            inducedGraph->removeVertex(separatingVertex);
+    if (cachedAnalysis == cache.end())
+    {
+        cachedAnalysis = cache.emplace(std::move(key), analyzeBag(graph, bagContent, cliques, *separatorAlgorithm_, *connectedComponentAlgorithm_)).first;
+    }
 
-            separatingVertex = inducedGraph->baseGraphVertex(separatingVertex);
-        }
+    const BagAnalysis & analysis = cachedAnalysis->second;
 
-        std::vector<std::vector<htd::vertex_t>> components;
+    if (!analysis.complete)
+    {
+        std::vector<htd::vertex_t> neighbors;
+        decomposition.copyNeighborsTo(vertex, neighbors);
+
+        std::vector<htd::vertex_t> * separator = new std::vector<htd::vertex_t>(analysis.separator);
 
-        connectedComponentAlgorithm_->determineComponents(inducedGraph->internalGraph(), components);
+        std::vector<std::vector<htd::vertex_t>> components(analysis.components);
 
         std::vector<htd::id_t> componentIdentifiers(components.size());
 
@@ -530,11 +805,6 @@ bool htd::WidthReductionOperation::Implementation::processDecompositionNode(cons
         {
             std::vector<htd::vertex_t> newBag;
 
-            std::for_each(component.begin(), component.end(), [&](htd::vertex_t & componentVertex)
-            {
-                componentVertex = inducedGraph->baseGraphVertex(componentVertex);
-            });
-
             std::set_union(component.begin(), component.end(), separator->begin(), separator->end(), std::back_inserter(newBag));
 
             auto position =
@@ -654,25 +924,6 @@ bool htd::WidthReductionOperation::Implementation::processDecompositionNode(cons
         delete separator;
     }
 
-    delete inducedGraph;
-
-    return ret;
-}
-
-bool htd::WidthReductionOperation::Implementation::isComplete(const htd::IGraphStructure & graph) const
-{
-    bool ret = true;
-
-    std::vector<htd::vertex_t> vertices;
-    graph.copyVerticesTo(vertices);
-
-    for (auto it = vertices.begin(); ret && it != vertices.end(); ++it)
-    {
-        const htd::ConstCollection<htd::vertex_t> & currentNeighborhood = graph.neighbors(*it);
-
-        ret = htd::set_intersection_size(currentNeighborhood.begin(), currentNeighborhood.end(), vertices.begin(), vertices.end()) >= vertices.size() - 1;
-    }
-
     return ret;
 }
 
@@ -696,14 +947,12 @@ bool htd::WidthReductionOperation::Implementation::isInSubtree(const htd::ITreeD
     return ret || current == root;
 }
 
-htd::WidthReductionOperation::Implementation::InducedGraph * htd::WidthReductionOperation::Implementation::createCorrespondingGraph(const htd::IMultiHypergraph & graph, const htd::ITreeDecomposition & decomposition, htd::vertex_t vertex) const
+std::vector<htd::vertex_t> htd::WidthReductionOperation::Implementation::computeKey(const htd::ITreeDecomposition & decomposition, htd::vertex_t vertex, std::vector<std::vector<htd::vertex_t>> & cliques) const
 {
     HTD_ASSERT(decomposition.isVertex(vertex))
 
     const std::vector<htd::vertex_t> & bagContent = decomposition.bagContent(vertex);
 
-    htd::WidthReductionOperation::Implementation::InducedGraph * ret = new htd::WidthReductionOperation::Implementation::InducedGraph(graph, bagContent);
-
     std::vector<htd::vertex_t> neighbors;
     decomposition.copyNeighborsTo(vertex, neighbors);
 
@@ -715,15 +964,137 @@ htd::WidthReductionOperation::Implementation::InducedGraph * htd::WidthReduction
 
         std::set_intersection(neighborBagContent.begin(), neighborBagContent.end(), bagContent.begin(), bagContent.end(), std::back_inserter(relevantBagContent));
 
-        std::for_each(relevantBagContent.begin(), relevantBagContent.end(), [&](htd::vertex_t & bagElement)
+        if (relevantBagContent.size() > 1)
         {
-            bagElement = ret->inducedGraphVertex(bagElement);
-        });
+            cliques.push_back(std::move(relevantBagContent));
+        }
+    }
+
+    std::sort(cliques.begin(), cliques.end());
+
+    cliques.erase(std::unique(cliques.begin(), cliques.end()), cliques.end());
 
-        ret->createClique(relevantBagContent);
+    /* Each sequence is prefixed with its length which makes the encoding unambiguous. */
+    std::vector<htd::vertex_t> ret;
+
+    ret.push_back(static_cast<htd::vertex_t>(bagContent.size()));
+
+    ret.insert(ret.end(), bagContent.begin(), bagContent.end());
+
+    for (const std::vector<htd::vertex_t> & clique : cliques)
+    {
+        ret.push_back(static_cast<htd::vertex_t>(clique.size()));
+
+        ret.insert(ret.end(), clique.begin(), clique.end());
     }
 
     return ret;
 }
 
+htd::WidthReductionOperation::Implementation::BagAnalysis htd::WidthReductionOperation::Implementation::analyzeBag(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & bag, const std::vector<std::vector<htd::vertex_t>> & cliques, const htd::IGraphSeparatorAlgorithm & separatorAlgorithm, const htd::IConnectedComponentAlgorithm & connectedComponentAlgorithm) const
+{
+    BagAnalysis ret;
+
+    InducedGraph inducedGraph(graph, bag, cliques);
+
+    ret.complete = inducedGraph.isComplete();
+
+    if (!ret.complete)
+    {
+        std::vector<htd::vertex_t> * separator = separatorAlgorithm.computeSeparator(inducedGraph);
+
+        InducedGraph remainder(inducedGraph, *separator);
+
+        connectedComponentAlgorithm.determineComponents(remainder, ret.components);
+
+        for (htd::vertex_t separatingVertex : *separator)
+        {
+            ret.separator.push_back(bag[separatingVertex - 1]);
+        }
+
+        std::sort(ret.separator.begin(), ret.separator.end());
+
+        for (std::vector<htd::vertex_t> & component : ret.components)
+        {
+            for (htd::vertex_t & componentVertex : component)
+            {
+                componentVertex = bag[componentVertex - 1];
+            }
+        }
+
+        delete separator;
+    }
+
+    return ret;
+}
+
+void htd::WidthReductionOperation::Implementation::analyzeBags(const htd::IMultiHypergraph & graph, const htd::ITreeDecomposition & decomposition, const std::vector<htd::vertex_t> & vertices, AnalysisCache & cache) const
+{
+    std::vector<std::vector<htd::vertex_t>> keys;
+
+    std::vector<std::vector<std::vector<htd::vertex_t>>> cliques;
+
+    std::vector<htd::vertex_t> pendingVertices;
+
+    std::unordered_set<std::vector<htd::vertex_t>> pendingKeys;
+
+    for (htd::vertex_t vertex : vertices)
+    {
+        std::vector<std::vector<htd::vertex_t>> currentCliques;
+
+        std::vector<htd::vertex_t> key = computeKey(decomposition, vertex, currentCliques);
+
+        if (cache.count(key) == 0 && pendingKeys.insert(key).second)
+        {
+            keys.push_back(std::move(key));
+
+            cliques.push_back(std::move(currentCliques));
+
+            pendingVertices.push_back(vertex);
+        }
+    }
+
+    std::vector<BagAnalysis> results(pendingVertices.size());
+
+    std::size_t workerCount = std::min(threadCount_, pendingVertices.size());
+
+    /* Each worker uses its own copies of the algorithms. The decomposition is only read while the workers are running. */
+    auto analyze = [&](std::size_t workerIndex)
+    {
+        std::unique_ptr<htd::IGraphSeparatorAlgorithm> separatorAlgorithm(separatorAlgorithm_->clone());
+
+        std::unique_ptr<htd::IConnectedComponentAlgorithm> connectedComponentAlgorithm(connectedComponentAlgorithm_->clone());
+
+        for (std::size_t index = workerIndex; index < pendingVertices.size() && !managementInstance_->isTerminated(); index += workerCount)
+        {
+            results[index] = analyzeBag(graph, decomposition.bagContent(pendingVertices[index]), cliques[index], *separatorAlgorithm, *connectedComponentAlgorithm);
+        }
+    };
+
+    std::vector<std::thread> threads;
+
+    for (std::size_t workerIndex = 1; workerIndex < workerCount; ++workerIndex)
+    {
+        threads.emplace_back(analyze, workerIndex);
+    }
+
+    if (workerCount > 0)
+    {
+        analyze(0);
+    }
+
+    for (std::thread & thread : threads)
+    {
+        thread.join();
+    }
+
+    if (!managementInstance_->isTerminated())
+    {
+        for (htd::index_t index = 0; index < pendingVertices.size(); ++index)
+        {
+            cache.emplace(std::move(keys[index]), std::move(results[index]));
+        }
+    }
+}
+
 #endif /* HTD_HTD_WIDTHREDUCTIONOPERATION_CPP */
@@ -0,0 +1,122 @@
+/* 
+ * File:   Workspace.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_WORKSPACE_CPP
+#define HTD_HTD_WORKSPACE_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/Workspace.hpp>
+
+namespace
+{
+    /**
+     *  The maximum number of bytes which a workspace may retain in order to be kept in the pool.
+     */
+    const std::size_t MAXIMUM_POOLED_BYTES = 16 * 1024 * 1024;
+
+    /**
+     *  Pool of idle workspaces of the calling thread.
+     */
+    std::vector<std::unique_ptr<htd::Workspace>> & workspacePool(void)
+    {
+        static thread_local std::vector<std::unique_ptr<htd::Workspace>> pool;
+
+        return pool;
+    }
+}
+
+htd::Workspace::Workspace(void) : stamps_(), epoch_(0), buffers_()
+{
+
+}
+
+htd::Workspace::~Workspace()
+{
+
+}
+
+htd::Workspace * htd::Workspace::acquire(void)
+{
+    std::vector<std::unique_ptr<htd::Workspace>> & pool = workspacePool();
+
+    htd::Workspace * ret = nullptr;
+
+    if (pool.empty())
+    {
+        ret = new htd::Workspace();
+    }
+    else
+    {
+        ret = pool.back().release();
+
+        pool.pop_back();
+    }
+
+    return ret;
+}
+
+std::size_t htd::Workspace::retainedBytes(void) const
+{
+    std::size_t ret = retainedBytes(stamps_);
+
+    for (const auto & entry : buffers_)
+    {
+        ret += entry.second->retainedBytes();
+    }
+
+    return ret;
+}
+
+void htd::Workspace::release(htd::Workspace * workspace)
+{
+    HTD_ASSERT(workspace != nullptr)
+
+    if (workspace->retainedBytes() <= MAXIMUM_POOLED_BYTES)
+    {
+        workspacePool().emplace_back(workspace);
+    }
+    else
+    {
+        delete workspace;
+    }
+}
+
+std::size_t htd::Workspace::maximumPooledBytes(void)
+{
+    return MAXIMUM_POOLED_BYTES;
+}
+
+void htd::Workspace::releaseIdleWorkspaces(void)
+{
+    workspacePool().clear();
+}
+
+std::size_t htd::Workspace::idleWorkspaceCount(void)
+{
+    return workspacePool().size();
+}
+
+#endif /* HTD_HTD_WORKSPACE_CPP */
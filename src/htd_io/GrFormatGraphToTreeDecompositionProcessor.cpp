@@ -171,7 +171,13 @@ void htd_io::GrFormatGraphToTreeDecompositionProcessor::process(std::istream & i
 {
     htd_io::GrFormatImporter importer(implementation_->managementInstance_);
 
-    htd::IMultiGraph * graph = importer.import(inputStream);
+    htd::IMultiGraph * graph = nullptr;
+
+    {
+        htd::ScopedTimer timer(implementation_->managementInstance_, "Import", "io");
+
+        graph = importer.import(inputStream);
+    }
 
     if (graph != nullptr)
     {
@@ -248,6 +254,8 @@ void htd_io::GrFormatGraphToTreeDecompositionProcessor::process(std::istream & i
         {
             if (implementation_->exporter_ != nullptr)
             {
+                htd::ScopedTimer timer(implementation_->managementInstance_, "Export", "io");
+
                 implementation_->exporter_->write(*decomposition, *graph, outputStream);
             }
 
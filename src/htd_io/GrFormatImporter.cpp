@@ -30,6 +30,7 @@
 #include <htd/MultiGraphFactory.hpp>
 
 #include <fstream>
+#include <limits>
 #include <string>
 #include <stdexcept>
 
@@ -135,15 +136,23 @@ htd::IMultiGraph * htd_io::GrFormatImporter::import(std::istream & stream) const
                             error = true;
                         }
 
-                        ret->addVertices(vertexCount);
+                        /* The vertex identifiers and edge indices must be representable by the configured datatypes. */
+                        if (vertexCount >= std::numeric_limits<htd::vertex_t>::max() || edgeCount > std::numeric_limits<htd::count_t>::max())
+                        {
+                            error = true;
+                        }
+                        else
+                        {
+                            ret->addVertices(vertexCount);
+                        }
 
                         firstLine = false;
                     }
                     else
                     {
-                        htd::vertex_t vertex1 = std::stoul(line, &pos);
+                        std::size_t vertex1 = std::stoul(line, &pos);
 
-                        if (line[pos] != ' ')
+                        if (line[pos] != ' ' || vertex1 == 0 || vertex1 > vertexCount)
                         {
                             error = true;
                         }
@@ -151,16 +160,18 @@ htd::IMultiGraph * htd_io::GrFormatImporter::import(std::istream & stream) const
                         {
                             line = line.substr(pos + 1);
 
-                            htd::vertex_t vertex2 = std::stoul(line, &pos);
+                            std::size_t vertex2 = std::stoul(line, &pos);
 
-                            if (pos != line.length())
+                            if (pos != line.length() || vertex2 == 0 || vertex2 > vertexCount)
                             {
                                 error = true;
                             }
+                            else
+                            {
+                                ret->addEdge(static_cast<htd::vertex_t>(vertex1), static_cast<htd::vertex_t>(vertex2));
 
-                            ret->addEdge(vertex1, vertex2);
-
-                            edgeCount--;
+                                edgeCount--;
+                            }
                         }
                     }
                 }
@@ -171,7 +171,13 @@ void htd_io::HgrFormatGraphToTreeDecompositionProcessor::process(std::istream &
 {
     htd_io::HgrFormatImporter importer(implementation_->managementInstance_);
 
-    htd::IMultiHypergraph * graph = importer.import(inputStream);
+    htd::IMultiHypergraph * graph = nullptr;
+
+    {
+        htd::ScopedTimer timer(implementation_->managementInstance_, "Import", "io");
+
+        graph = importer.import(inputStream);
+    }
 
     if (graph != nullptr)
     {
@@ -248,6 +254,8 @@ void htd_io::HgrFormatGraphToTreeDecompositionProcessor::process(std::istream &
         {
             if (implementation_->exporter_ != nullptr)
             {
+                htd::ScopedTimer timer(implementation_->managementInstance_, "Export", "io");
+
                 implementation_->exporter_->write(*decomposition, *graph, outputStream);
             }
 
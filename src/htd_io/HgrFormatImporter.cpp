@@ -30,6 +30,7 @@
 #include <htd/MultiHypergraphFactory.hpp>
 
 #include <fstream>
+#include <limits>
 #include <string>
 #include <stdexcept>
 
@@ -136,7 +137,15 @@ htd::IMultiHypergraph * htd_io::HgrFormatImporter::import(std::istream & stream)
                                 error = true;
                             }
 
-                            ret->addVertices(vertexCount);
+                            /* The vertex identifiers and edge indices must be representable by the configured datatypes. */
+                            if (vertexCount >= std::numeric_limits<htd::vertex_t>::max() || edgeCount > std::numeric_limits<htd::count_t>::max())
+                            {
+                                error = true;
+                            }
+                            else
+                            {
+                                ret->addVertices(vertexCount);
+                            }
 
                             firstLine = false;
                         }
@@ -149,9 +158,18 @@ htd::IMultiHypergraph * htd_io::HgrFormatImporter::import(std::istream & stream)
 
                         while (!error && pos != line.length())
                         {
-                            vertices.push_back(std::stoul(line, &pos));
+                            std::size_t vertex = std::stoul(line, &pos);
 
-                            if (pos != line.length())
+                            if (vertex == 0 || vertex > vertexCount)
+                            {
+                                error = true;
+                            }
+                            else
+                            {
+                                vertices.push_back(static_cast<htd::vertex_t>(vertex));
+                            }
+
+                            if (!error && pos != line.length())
                             {
                                 if (line[pos] != ' ')
                                 {
@@ -166,9 +184,12 @@ htd::IMultiHypergraph * htd_io::HgrFormatImporter::import(std::istream & stream)
                             }
                         }
 
-                        ret->addEdge(std::move(vertices));
+                        if (!error)
+                        {
+                            ret->addEdge(std::move(vertices));
 
-                        edgeCount--;
+                            edgeCount--;
+                        }
                     }
                 }
             }
@@ -172,7 +172,13 @@ void htd_io::LpFormatGraphToTreeDecompositionProcessor::process(std::istream & i
 {
     htd_io::LpFormatImporter importer(implementation_->managementInstance_);
 
-    htd::NamedMultiHypergraph<std::string, std::string> * graph = importer.import(inputStream);
+    htd::NamedMultiHypergraph<std::string, std::string> * graph = nullptr;
+
+    {
+        htd::ScopedTimer timer(implementation_->managementInstance_, "Import", "io");
+
+        graph = importer.import(inputStream);
+    }
 
     if (graph != nullptr)
     {
@@ -249,6 +255,8 @@ void htd_io::LpFormatGraphToTreeDecompositionProcessor::process(std::istream & i
         {
             if (implementation_->exporter_ != nullptr)
             {
+                htd::ScopedTimer timer(implementation_->managementInstance_, "Export", "io");
+
                 implementation_->exporter_->write(*decomposition, *graph, outputStream);
             }
 
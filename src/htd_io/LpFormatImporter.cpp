@@ -27,9 +27,12 @@
 
 #include <htd_io/LpFormatImporter.hpp>
 
+#include <cctype>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <string>
+#include <vector>
 
 /**
  *  Private implementation details of class htd_io::LpFormatImporter.
@@ -57,11 +60,42 @@ struct htd_io::LpFormatImporter::Implementation
     const htd::LibraryInstance * managementInstance_;
 
     /**
-     *  Remove all leading and trailing whitespaces from a given string.
+     *  The initial size of the buffer into which the input is read block-wise.
+     */
+    static const std::size_t BLOCK_SIZE = 65536;
+
+    /**
+     *  Parse a single line of the input and add its content to the given graph.
+     *
+     *  Lines of the form "edge(...)." and "vertex(...)." are recognized, all other lines are ignored.
+     *  Elements are trimmed in place and copied into the recycled element buffers, hence names which
+     *  are already known to the graph do not cause any allocation.
+     *
+     *  @param[in] begin        A pointer to the first character of the line.
+     *  @param[in] end          A pointer past the last character of the line.
+     *  @param[in] graph        The graph to which the content of the line shall be added.
+     *  @param[in] hyperedge    A buffer for the names of the endpoints of a hyperedge.
+     *  @param[in] vertexName   A buffer for the name of a single vertex.
+     */
+    void parseLine(const char * begin, const char * end, htd::NamedMultiHypergraph<std::string, std::string> & graph, std::vector<std::string> & hyperedge, std::string & vertexName) const;
+
+    /**
+     *  Compute the sub-range of a given range without leading and trailing whitespaces.
+     *
+     *  @param[in,out] begin    A pointer to the first character of the range.
+     *  @param[in,out] end      A pointer past the last character of the range.
+     */
+    static void trim(const char * & begin, const char * & end);
+
+    /**
+     *  Check whether a given range ends with the terminator ")." and contains no earlier occurrence of it.
      *
-     *  @param[in] value    The string which shall be trimmed.
+     *  @param[in] begin    A pointer to the first character of the range.
+     *  @param[in] end      A pointer past the last character of the range.
+     *
+     *  @return True if the range ends with the terminator ")." and contains no earlier occurrence of it, false otherwise.
      */
-    void trim(std::string & value);
+    static bool isTerminated(const char * begin, const char * end);
 };
 
 htd_io::LpFormatImporter::LpFormatImporter(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -91,80 +125,55 @@ htd::NamedMultiHypergraph<std::string, std::string> * htd_io::LpFormatImporter::
 
     if (stream.good())
     {
-        std::string line;
-
-        std::size_t nextPosition = 0;
-        
-        std::size_t startPosition = 0;
-        
-        std::size_t finishPosition = 0;
-        
-        while (!error && std::getline(stream, line) && !managementInstance.isTerminated())
+        std::vector<char> buffer(Implementation::BLOCK_SIZE);
+
+        std::vector<std::string> hyperedge;
+
+        std::string vertexName;
+
+        std::size_t remainder = 0;
+
+        bool finished = false;
+
+        while (!finished && !managementInstance.isTerminated())
         {
-            finishPosition = 0;
-            
-            startPosition = line.find("edge(");
-            
-            if (startPosition == 0)
+            stream.read(buffer.data() + remainder, static_cast<std::streamsize>(buffer.size() - remainder));
+
+            std::size_t available = remainder + static_cast<std::size_t>(stream.gcount());
+
+            finished = !stream;
+
+            const char * lineStart = buffer.data();
+
+            const char * bufferEnd = buffer.data() + available;
+
+            const char * lineEnd = static_cast<const char *>(std::memchr(lineStart, '\n', available));
+
+            while (lineEnd != nullptr && !managementInstance.isTerminated())
             {
-                startPosition = startPosition + std::string("edge(").length();
-                
-                finishPosition = line.find(").", startPosition);
-                
-                if (finishPosition == line.length() - 2)
+                implementation_->parseLine(lineStart, lineEnd, *ret, hyperedge, vertexName);
+
+                lineStart = lineEnd + 1;
+
+                lineEnd = static_cast<const char *>(std::memchr(lineStart, '\n', bufferEnd - lineStart));
+            }
+
+            remainder = bufferEnd - lineStart;
+
+            if (finished)
+            {
+                if (remainder > 0 && !managementInstance.isTerminated())
                 {
-                    line.erase(finishPosition, std::string(").").length());
-                    line.erase(0, startPosition);
-                    
-                    std::vector<std::string> hyperedge;
-                    
-                    nextPosition = line.find(",");
-                    
-                    while (nextPosition != std::string::npos)
-                    {
-                        std::string element = line.substr(0, nextPosition);
-
-                        this->implementation_->trim(element);
-
-                        hyperedge.push_back(element);
-                        
-                        line.erase(0, nextPosition + 1);
-                        
-                        nextPosition = line.find(",");
-                    }
-
-                    this->implementation_->trim(line);
-
-                    if (line.length() > 0)
-                    {
-                        hyperedge.push_back(line);
-                    }
-
-                    if (hyperedge.size() > 0)
-                    {
-                        ret->addEdge(hyperedge);
-                    }
+                    implementation_->parseLine(lineStart, bufferEnd, *ret, hyperedge, vertexName);
                 }
             }
             else
             {
-                startPosition = line.find("vertex(");
+                std::memmove(buffer.data(), lineStart, remainder);
 
-                if (startPosition == 0)
+                if (remainder == buffer.size())
                 {
-                    startPosition = startPosition + std::string("vertex(").length();
-
-                    finishPosition = line.find(").", startPosition);
-
-                    if (finishPosition == line.length() - 2)
-                    {
-                        line.erase(finishPosition, std::string(").").length());
-                        line.erase(0, startPosition);
-
-                        this->implementation_->trim(line);
-
-                        ret->addVertex(line);
-                    }
+                    buffer.resize(buffer.size() * 2);
                 }
             }
         }
@@ -184,10 +193,121 @@ htd::NamedMultiHypergraph<std::string, std::string> * htd_io::LpFormatImporter::
     return ret;
 }
 
-void htd_io::LpFormatImporter::Implementation::trim(std::string & value)
+void htd_io::LpFormatImporter::Implementation::parseLine(const char * begin, const char * end, htd::NamedMultiHypergraph<std::string, std::string> & graph, std::vector<std::string> & hyperedge, std::string & vertexName) const
+{
+    static const char EDGE_PREFIX[] = "edge(";
+    static const char VERTEX_PREFIX[] = "vertex(";
+
+    static const std::size_t EDGE_PREFIX_LENGTH = sizeof(EDGE_PREFIX) - 1;
+    static const std::size_t VERTEX_PREFIX_LENGTH = sizeof(VERTEX_PREFIX) - 1;
+
+    std::size_t length = end - begin;
+
+    if (length >= EDGE_PREFIX_LENGTH && std::memcmp(begin, EDGE_PREFIX, EDGE_PREFIX_LENGTH) == 0)
+    {
+        begin += EDGE_PREFIX_LENGTH;
+
+        if (isTerminated(begin, end))
+        {
+            end -= 2;
+
+            std::size_t elementCount = 0;
+
+            const char * elementStart = begin;
+
+            const char * separator = static_cast<const char *>(std::memchr(elementStart, ',', end - elementStart));
+
+            while (separator != nullptr)
+            {
+                const char * elementEnd = separator;
+
+                trim(elementStart, elementEnd);
+
+                if (elementCount == hyperedge.size())
+                {
+                    hyperedge.emplace_back();
+                }
+
+                hyperedge[elementCount].assign(elementStart, elementEnd);
+
+                ++elementCount;
+
+                elementStart = separator + 1;
+
+                separator = static_cast<const char *>(std::memchr(elementStart, ',', end - elementStart));
+            }
+
+            trim(elementStart, end);
+
+            if (elementStart != end)
+            {
+                if (elementCount == hyperedge.size())
+                {
+                    hyperedge.emplace_back();
+                }
+
+                hyperedge[elementCount].assign(elementStart, end);
+
+                ++elementCount;
+            }
+
+            if (elementCount > 0)
+            {
+                /* Only the first elements belong to the current edge. The remaining buffers are kept to recycle their memory. */
+                graph.addEdge(htd::ConstCollection<std::string>::getInstance(hyperedge.data(), elementCount));
+            }
+        }
+    }
+    else if (length >= VERTEX_PREFIX_LENGTH && std::memcmp(begin, VERTEX_PREFIX, VERTEX_PREFIX_LENGTH) == 0)
+    {
+        begin += VERTEX_PREFIX_LENGTH;
+
+        if (isTerminated(begin, end))
+        {
+            end -= 2;
+
+            trim(begin, end);
+
+            vertexName.assign(begin, end);
+
+            graph.addVertex(vertexName);
+        }
+    }
+}
+
+void htd_io::LpFormatImporter::Implementation::trim(const char * & begin, const char * & end)
+{
+    while (begin != end && std::isspace(static_cast<unsigned char>(*begin)))
+    {
+        ++begin;
+    }
+
+    while (end != begin && std::isspace(static_cast<unsigned char>(*(end - 1))))
+    {
+        --end;
+    }
+}
+
+bool htd_io::LpFormatImporter::Implementation::isTerminated(const char * begin, const char * end)
 {
-    value.erase(0, value.find_first_not_of(" \t\n\r\f\v"));
-    value.erase(value.find_last_not_of(" \t\n\r\f\v") + 1);
+    if (end - begin < 2 || *(end - 2) != ')' || *(end - 1) != '.')
+    {
+        return false;
+    }
+
+    const char * position = static_cast<const char *>(std::memchr(begin, ')', end - begin));
+
+    while (position != end - 2)
+    {
+        if (*(position + 1) == '.')
+        {
+            return false;
+        }
+
+        position = static_cast<const char *>(std::memchr(position + 1, ')', end - position - 1));
+    }
+
+    return true;
 }
 
 #endif /* HTD_IO_LPFORMATIMPORTER_CPP */
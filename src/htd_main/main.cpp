@@ -26,11 +26,19 @@
 #include <htd_io/main.hpp>
 #include <htd_cli/main.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
 #include <csignal>
 #include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <thread>
 
 htd::LibraryInstance * const libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
 
@@ -89,6 +97,10 @@ htd_cli::OptionManager * createOptionManager(void)
 
         manager->registerOption(printProgressOption, "Output-Specific Options");
 
+        htd_cli::SingleValueOption * statsOption = new htd_cli::SingleValueOption("stats", "Write timings and counters of the individual phases to file <file>.\n  (The data is written in CSV format if <file> ends with '.csv' and in Chrome trace format otherwise.)", "file");
+
+        manager->registerOption(statsOption, "Output-Specific Options");
+
         htd_cli::Choice * strategyChoice = new htd_cli::Choice("strategy", "Set the decomposition strategy which shall be used to <algorithm>.", "algorithm");
 
         strategyChoice->addPossibility("random", "Use a random vertex ordering.");
@@ -97,6 +109,7 @@ htd_cli::OptionManager * createOptionManager(void)
         strategyChoice->addPossibility("min-separator", "Minimum separating vertex set heuristic");
         strategyChoice->addPossibility("max-cardinality", "Maximum cardinality search ordering algorithm");
         strategyChoice->addPossibility("max-cardinality-enhanced", "Enhanced maximum cardinality search ordering algorithm (MCS-M)");
+        strategyChoice->addPossibility("nested-dissection", "Multilevel nested dissection ordering algorithm");
         strategyChoice->addPossibility("challenge", "Use a combination of different decomposition strategies.");
 
         strategyChoice->setDefaultValue("min-fill");
@@ -118,6 +131,18 @@ htd_cli::OptionManager * createOptionManager(void)
 
         manager->registerOption(triangulationMinimizationOption, "Algorithm Options");
 
+        htd_cli::Option * localSearchOption = new htd_cli::Option("local-search", "Improve the vertex elimination ordering via simulated annealing.");
+
+        manager->registerOption(localSearchOption, "Algorithm Options");
+
+        htd_cli::SingleValueOption * cacheOption = new htd_cli::SingleValueOption("cache", "Reuse preprocessing results and vertex elimination orderings stored in the\n  existing directory <directory> and store new results and improvements there.", "directory");
+
+        manager->registerOption(cacheOption, "Algorithm Options");
+
+        htd_cli::SingleValueOption * memoryLimitOption = new htd_cli::SingleValueOption("memory-limit", "Stop the computation as soon as the tracked data structures occupy more than\n  <megabytes> MiB and output the best decomposition found so far. Only the nodes of\n  the decompositions and the working data of the min-degree ordering algorithm\n  are tracked.", "megabytes");
+
+        manager->registerOption(memoryLimitOption, "Algorithm Options");
+
         htd_cli::Choice * optimizationChoice = new htd_cli::Choice("opt", "Iteratively compute a decomposition which optimizes <criterion>.", "criterion");
 
         optimizationChoice->addPossibility("none", "Do not perform any optimization.");
@@ -134,6 +159,14 @@ htd_cli::OptionManager * createOptionManager(void)
         htd_cli::SingleValueOption * patienceOption = new htd_cli::SingleValueOption("patience", "Terminate the algorithm if more than <amount> iterations did not lead to an improvement (-1 = infinite). (Default: -1)", "amount");
 
         manager->registerOption(patienceOption, "Optimization Options");
+
+        htd_cli::SingleValueOption * batchOption = new htd_cli::SingleValueOption("batch", "Decompose all instances listed in file <manifest> (one path per line).\n  (If <manifest> is '-', length-prefixed instances are read from standard input.)", "manifest");
+
+        manager->registerOption(batchOption, "Batch Options");
+
+        htd_cli::SingleValueOption * threadsOption = new htd_cli::SingleValueOption("threads", "Set the number of worker threads used in batch mode or, otherwise, by the local search to <count>.\n  (Default: Number of hardware threads in batch mode, 1 for the local search)", "count");
+
+        manager->registerOption(threadsOption, "Batch Options");
     }
     catch (const std::runtime_error & exception)
     {
@@ -147,7 +180,7 @@ htd_cli::OptionManager * createOptionManager(void)
     return manager;
 }
 
-bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionManager & optionManager, htd::LibraryInstance * const manager)
+bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionManager & optionManager)
 {
     bool ret = true;
 
@@ -184,6 +217,16 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
 
     const htd_cli::Option & triangulationMinimizationOption = optionManager.accessOption("triangulation-minimization");
 
+    const htd_cli::Option & localSearchOption = optionManager.accessOption("local-search");
+
+    const htd_cli::Option & printProgressOption = optionManager.accessOption("print-progress");
+
+    const htd_cli::SingleValueOption & batchOption = optionManager.accessSingleValueOption("batch");
+
+    const htd_cli::SingleValueOption & threadsOption = optionManager.accessSingleValueOption("threads");
+
+    const htd_cli::SingleValueOption & memoryLimitOption = optionManager.accessSingleValueOption("memory-limit");
+
     if (ret && helpOption.used())
     {
         std::cout << "VERSION: htd_main " << htd_version() << std::endl << std::endl;
@@ -230,6 +273,8 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
                 else
                 {
                     srand(seed);
+
+                    htd::seedRandomNumberGenerator(static_cast<unsigned int>(seed));
                 }
             }
         }
@@ -258,15 +303,7 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
     {
         const std::string & value = strategyChoice.value();
 
-        if (value == "min-fill")
-        {
-            manager->orderingAlgorithmFactory().setConstructionTemplate(new htd::MinFillOrderingAlgorithm(manager));
-        }
-        else if (value == "min-degree")
-        {
-            manager->orderingAlgorithmFactory().setConstructionTemplate(new htd::MinDegreeOrderingAlgorithm(manager));
-        }
-        else if (value == "min-separator")
+        if (value == "min-separator")
         {
             if (optimizationChoice.used() && std::string(optimizationChoice.value()) == "width")
             {
@@ -281,14 +318,13 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
 
                 ret = false;
             }
-        }
-        else if (value == "max-cardinality")
-        {
-            manager->orderingAlgorithmFactory().setConstructionTemplate(new htd::MaximumCardinalitySearchOrderingAlgorithm(manager));
-        }
-        else if (value == "max-cardinality-enhanced")
-        {
-            manager->orderingAlgorithmFactory().setConstructionTemplate(new htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm(manager));
+
+            if (ret && localSearchOption.used())
+            {
+                std::cerr << "INVALID USE OF PROGRAM OPTION: Local search may only be applied when using a decomposition strategy based on vertex elimination orderings!" << std::endl;
+
+                ret = false;
+            }
         }
         else if (value == "challenge")
         {
@@ -299,11 +335,12 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
                 ret = false;
             }
         }
-        else if (value == "random")
-        {
-            manager->orderingAlgorithmFactory().setConstructionTemplate(new htd::RandomOrderingAlgorithm(manager));
-        }
-        else
+        else if (value != "min-fill" &&
+                 value != "min-degree" &&
+                 value != "max-cardinality" &&
+                 value != "max-cardinality-enhanced" &&
+                 value != "nested-dissection" &&
+                 value != "random")
         {
             std::cerr << "INVALID DECOMPOSITION STRATEGY: " << strategyChoice.value() << std::endl;
 
@@ -404,459 +441,1058 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
         }
     }
 
-    if (ret && triangulationMinimizationOption.used())
+    if (ret)
     {
-        htd::TriangulationMinimizationOrderingAlgorithm * algorithm =
-            new htd::TriangulationMinimizationOrderingAlgorithm(libraryInstance);
+        if (threadsOption.used())
+        {
+            if (batchOption.used() || localSearchOption.used())
+            {
+                std::size_t index = 0;
 
-        algorithm->setOrderingAlgorithm(manager->orderingAlgorithmFactory().createInstance());
+                const std::string & value = threadsOption.value();
 
-        manager->orderingAlgorithmFactory().setConstructionTemplate(algorithm);
-    }
+                if (value.empty() || value.find_first_not_of("01234567890") != std::string::npos)
+                {
+                    std::cerr << "INVALID NUMBER OF THREADS: " << threadsOption.value() << std::endl;
 
-    return ret;
-}
+                    ret = false;
+                }
 
-template <typename DecompositionAlgorithm, typename GraphType, typename Exporter>
-void decompose(const htd::LibraryInstance & instance, const DecompositionAlgorithm & algorithm, GraphType * graph, const Exporter & exporter)
-{
-    if (graph != nullptr && !instance.isTerminated())
-    {
-        auto * decomposition = algorithm.computeDecomposition(*graph);
+                if (ret)
+                {
+                    std::size_t threads = std::stoul(value, &index, 10);
 
-        if (decomposition != nullptr)
-        {
-            if (!instance.isTerminated() || algorithm.isSafelyInterruptible())
-            {
-                exporter.write(*decomposition, *graph, std::cout);
-            }
-            else
-            {
-                std::cerr << "Program was terminated successfully!" << std::endl;
-            }
+                    if (index != value.length() || threads == 0)
+                    {
+                        std::cerr << "INVALID NUMBER OF THREADS: " << value << std::endl;
 
-            delete decomposition;
-        }
-        else
-        {
-            if (instance.isTerminated())
-            {
-                std::cerr << "Program was terminated successfully!" << std::endl;
+                        ret = false;
+                    }
+                }
             }
             else
             {
-                std::cerr << "NO TREE DECOMPOSITION COMPUTED!" << std::endl;
-            }
-        }
+                std::cerr << "INVALID PROGRAM CALL: Option --threads may only be used in combination with option --batch or option --local-search!" << std::endl;
 
-        delete graph;
-    }
-    else
-    {
-        if (instance.isTerminated())
-        {
-            std::cerr << "Program was terminated successfully!" << std::endl;
-        }
-        else
-        {
-            std::cerr << "NO VALID INSTANCE PROVIDED!" << std::endl;
+                ret = false;
+            }
         }
     }
-}
 
-template <typename DecompositionAlgorithm, typename GraphType, typename Exporter>
-void decomposeNamed(const htd::LibraryInstance & instance, const DecompositionAlgorithm & algorithm, GraphType * graph, const Exporter & exporter)
-{
-    if (graph != nullptr && !instance.isTerminated())
+    if (ret && memoryLimitOption.used())
     {
-        auto * decomposition = algorithm.computeDecomposition(graph->internalGraph());
+        const std::string & value = memoryLimitOption.value();
 
-        if (decomposition != nullptr)
+        /* The number of digits is checked first, so that std::stoull cannot fail and the limit in bytes cannot overflow. */
+        if (value.empty() || value.find_first_not_of("01234567890") != std::string::npos || value.length() > (std::size_t)std::numeric_limits<std::size_t>::digits10)
         {
-            if (!instance.isTerminated() || algorithm.isSafelyInterruptible())
-            {
-                exporter.write(*decomposition, *graph, std::cout);
-            }
-            else
-            {
-                std::cerr << "Program was terminated successfully!" << std::endl;
-            }
+            std::cerr << "INVALID MEMORY LIMIT: " << value << std::endl;
 
-            delete decomposition;
+            ret = false;
         }
         else
         {
-            if (instance.isTerminated())
-            {
-                std::cerr << "Program was terminated successfully!" << std::endl;
-            }
-            else
+            unsigned long long megabytes = std::stoull(value, nullptr, 10);
+
+            if (megabytes == 0 || megabytes > std::numeric_limits<std::size_t>::max() / (1024 * 1024))
             {
-                std::cerr << "NO TREE DECOMPOSITION COMPUTED!" << std::endl;
+                std::cerr << "INVALID MEMORY LIMIT: " << value << std::endl;
+
+                ret = false;
             }
         }
-
-        delete graph;
     }
-    else
+
+    if (ret && batchOption.used())
     {
-        if (instance.isTerminated())
+        if (instanceOption.used())
         {
-            std::cerr << "Program was terminated successfully!" << std::endl;
+            std::cerr << "INVALID PROGRAM CALL: Options --batch and --instance are mutually exclusive!" << std::endl;
+
+            ret = false;
         }
-        else
+
+        if (ret && decompositionTypeChoice.used() && std::string(decompositionTypeChoice.value()) == "hypertree")
         {
-            std::cerr << "NO VALID INSTANCE PROVIDED!" << std::endl;
+            std::cerr << "INVALID PROGRAM CALL: Currently, batch mode is supported only for tree decompositions!" << std::endl;
+
+            ret = false;
         }
 
-        if (graph != nullptr)
+        if (ret && printProgressOption.used())
         {
-            delete graph;
+            std::cerr << "INVALID PROGRAM CALL: Option --print-progress may not be used in batch mode!" << std::endl;
+
+            ret = false;
         }
-    }
-}
 
-template <typename DecompositionAlgorithm, typename Exporter>
-void run(const DecompositionAlgorithm & algorithm, const Exporter & exporter, const std::string & inputFormat, const htd::LibraryInstance * const manager)
-{
-    if (inputFormat == "gr")
-    {
-        htd_io::GrFormatImporter importer(manager);
+        if (ret && std::string(batchOption.value()) != "-")
+        {
+            std::ifstream manifestStream(batchOption.value());
 
-        decompose(*manager, algorithm, importer.import(std::cin), exporter);
-    }
-    else if (inputFormat == "lp")
-    {
-        htd_io::LpFormatImporter importer(manager);
+            if (!manifestStream.good())
+            {
+                std::cerr << "INVALID MANIFEST FILE: " << batchOption.value() << std::endl;
 
-        decomposeNamed(*manager, algorithm, importer.import(std::cin), exporter);
+                ret = false;
+            }
+        }
     }
-    else if (inputFormat == "hgr")
-    {
-        htd_io::HgrFormatImporter importer(manager);
 
-        decompose(*manager, algorithm, importer.import(std::cin), exporter);
-    }
+    return ret;
 }
 
-template <typename DecompositionAlgorithm, typename Exporter>
-void run(const DecompositionAlgorithm & algorithm, const Exporter & exporter, const std::string & inputFormat, const htd::LibraryInstance * const manager, const std::string & instanceFile)
+void configureLibraryInstance(const htd_cli::OptionManager & optionManager, htd::LibraryInstance * const manager)
 {
-    if (inputFormat == "gr")
-    {
-        htd_io::GrFormatImporter importer(manager);
+    const htd_cli::Choice & strategyChoice = optionManager.accessChoice("strategy");
 
-        decompose(*manager, algorithm, importer.import(instanceFile), exporter);
-    }
-    else if (inputFormat == "lp")
-    {
-        htd_io::LpFormatImporter importer(manager);
+    const htd_cli::Choice & optimizationChoice = optionManager.accessChoice("opt");
 
-        decomposeNamed(*manager, algorithm, importer.import(instanceFile), exporter);
+    const htd_cli::SingleValueOption & iterationOption = optionManager.accessSingleValueOption("iterations");
+
+    const htd_cli::SingleValueOption & patienceOption = optionManager.accessSingleValueOption("patience");
+
+    const htd_cli::Option & triangulationMinimizationOption = optionManager.accessOption("triangulation-minimization");
+
+    const htd_cli::Option & localSearchOption = optionManager.accessOption("local-search");
+
+    const htd_cli::SingleValueOption & batchOption = optionManager.accessSingleValueOption("batch");
+
+    const htd_cli::SingleValueOption & threadsOption = optionManager.accessSingleValueOption("threads");
+
+    const htd_cli::SingleValueOption & cacheOption = optionManager.accessSingleValueOption("cache");
+
+    const htd_cli::SingleValueOption & statsOption = optionManager.accessSingleValueOption("stats");
+
+    const htd_cli::SingleValueOption & memoryLimitOption = optionManager.accessSingleValueOption("memory-limit");
+
+    const std::string & strategy = strategyChoice.value();
+
+    if (cacheOption.used())
+    {
+        manager->setDecompositionCache(new htd::DecompositionCache(cacheOption.value()));
     }
-    else if (inputFormat == "hgr")
+
+    if (statsOption.used())
     {
-        htd_io::HgrFormatImporter importer(manager);
+        manager->setInstrumentation(new htd::Instrumentation());
+    }
 
-        decompose(*manager, algorithm, importer.import(instanceFile), exporter);
+    if (memoryLimitOption.used())
+    {
+        manager->memoryManager().setMemoryLimit(static_cast<std::size_t>(std::stoull(memoryLimitOption.value(), nullptr, 10)) * 1024 * 1024);
     }
-}
 
-void handleSignal(int signal)
-{
-    switch (signal)
+    if (strategyChoice.used())
     {
-        case SIGINT:
+        if (strategy == "min-fill")
         {
-            libraryInstance->terminate();
-
-            break;
+            manager->orderingAlgorithmFactory().setConstructionTemplate(new htd::MinFillOrderingAlgorithm(manager));
         }
-        case SIGTERM:
+        else if (strategy == "min-degree")
         {
-            libraryInstance->terminate();
-
-            break;
+            manager->orderingAlgorithmFactory().setConstructionTemplate(new htd::MinDegreeOrderingAlgorithm(manager));
         }
-        default:
+        else if (strategy == "max-cardinality")
         {
-            break;
+            manager->orderingAlgorithmFactory().setConstructionTemplate(new htd::MaximumCardinalitySearchOrderingAlgorithm(manager));
+        }
+        else if (strategy == "max-cardinality-enhanced")
+        {
+            manager->orderingAlgorithmFactory().setConstructionTemplate(new htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm(manager));
+        }
+        else if (strategy == "nested-dissection")
+        {
+            manager->orderingAlgorithmFactory().setConstructionTemplate(new htd::NestedDissectionOrderingAlgorithm(manager));
+        }
+        else if (strategy == "random")
+        {
+            manager->orderingAlgorithmFactory().setConstructionTemplate(new htd::RandomOrderingAlgorithm(manager));
         }
     }
-}
-
-int main(int argc, const char * const * const argv)
-{
-    int ret = 0;
 
-    bool error = false;
+    if (localSearchOption.used())
+    {
+        htd::LocalSearchOrderingAlgorithm * algorithm =
+            new htd::LocalSearchOrderingAlgorithm(manager);
 
-    std::ios_base::sync_with_stdio(false);
+        algorithm->setOrderingAlgorithm(manager->orderingAlgorithmFactory().createInstance());
 
-    std::signal(SIGINT, handleSignal);
-    std::signal(SIGTERM, handleSignal);
+        /* In batch mode, the threads are used to process multiple instances in parallel instead. */
+        if (threadsOption.used() && !batchOption.used())
+        {
+            algorithm->setThreadCount(std::stoul(threadsOption.value(), nullptr, 10));
+        }
 
-    htd_cli::OptionManager * optionManager = createOptionManager();
+        manager->orderingAlgorithmFactory().setConstructionTemplate(algorithm);
+    }
 
-    if (optionManager != nullptr && handleOptions(argc, argv, *optionManager, libraryInstance))
+    if (triangulationMinimizationOption.used())
     {
-        const htd_cli::Choice & inputFormatChoice = optionManager->accessChoice("input");
+        htd::TriangulationMinimizationOrderingAlgorithm * algorithm =
+            new htd::TriangulationMinimizationOrderingAlgorithm(manager);
 
-        const htd_cli::Choice & outputFormatChoice = optionManager->accessChoice("output");
+        algorithm->setOrderingAlgorithm(manager->orderingAlgorithmFactory().createInstance());
 
-        const htd_cli::Choice & decompositionTypeChoice = optionManager->accessChoice("type");
+        manager->orderingAlgorithmFactory().setConstructionTemplate(algorithm);
+    }
 
-        const htd_cli::Choice & strategyChoice = optionManager->accessChoice("strategy");
+    if (strategy == "min-separator")
+    {
+        htd::SeparatorBasedTreeDecompositionAlgorithm * treeDecompositionAlgorithm = new htd::SeparatorBasedTreeDecompositionAlgorithm(manager);
 
-        const htd_cli::Choice & preprocessingChoice = optionManager->accessChoice("preprocessing");
+        treeDecompositionAlgorithm->setComputeInducedEdgesEnabled(false);
 
-        const htd_cli::Choice & optimizationChoice = optionManager->accessChoice("opt");
+        manager->treeDecompositionAlgorithmFactory().setConstructionTemplate(treeDecompositionAlgorithm);
+    }
+    else
+    {
+        htd::BucketEliminationTreeDecompositionAlgorithm * treeDecompositionAlgorithm = new htd::BucketEliminationTreeDecompositionAlgorithm(manager);
 
-        const htd_cli::SingleValueOption & iterationOption = optionManager->accessSingleValueOption("iterations");
+        treeDecompositionAlgorithm->setComputeInducedEdgesEnabled(false);
 
-        const htd_cli::SingleValueOption & instanceOption = optionManager->accessSingleValueOption("instance");
+        manager->treeDecompositionAlgorithmFactory().setConstructionTemplate(treeDecompositionAlgorithm);
+    }
 
-        const htd_cli::SingleValueOption & patienceOption = optionManager->accessSingleValueOption("patience");
+    if (std::string(optimizationChoice.value()) == "width")
+    {
+        htd::CombinedWidthMinimizingTreeDecompositionAlgorithm * algorithm = new htd::CombinedWidthMinimizingTreeDecompositionAlgorithm(manager);
 
-        const htd_cli::Option & printProgressOption = optionManager->accessOption("print-progress");
+        if (std::string(strategyChoice.value()) == "challenge")
+        {
+            htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm * adaptiveAlgorithm = new htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm(manager);
+
+            htd::BucketEliminationTreeDecompositionAlgorithm * algorithm1 = new htd::BucketEliminationTreeDecompositionAlgorithm(manager);
+
+            algorithm1->setOrderingAlgorithm(new htd::MinDegreeOrderingAlgorithm(manager));
+
+            adaptiveAlgorithm->addDecompositionAlgorithm(algorithm1);
+
+            htd::BucketEliminationTreeDecompositionAlgorithm * algorithm2 = new htd::BucketEliminationTreeDecompositionAlgorithm(manager);
+
+            algorithm2->setOrderingAlgorithm(new htd::MinFillOrderingAlgorithm(manager));
+
+            adaptiveAlgorithm->addDecompositionAlgorithm(algorithm2);
+
+            htd::BucketEliminationTreeDecompositionAlgorithm * algorithm3 = new htd::BucketEliminationTreeDecompositionAlgorithm(manager);
+
+            algorithm3->setOrderingAlgorithm(new htd::MaximumCardinalitySearchOrderingAlgorithm(manager));
+
+            adaptiveAlgorithm->addDecompositionAlgorithm(algorithm3,
+                                                         [](const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph)
+            {
+                HTD_UNUSED(graph)
+
+                return preprocessedGraph.vertexCount() <= 10240;
+            });
+
+            if (iterationOption.used())
+            {
+                std::size_t iterations = std::stoul(iterationOption.value(), nullptr, 10);
+
+                if (iterations == 0)
+                {
+                    iterations = (std::size_t)-1;
+                }
+
+                adaptiveAlgorithm->setIterationCount(iterations);
+            }
+            else
+            {
+                adaptiveAlgorithm->setIterationCount(10);
+            }
+
+            if (patienceOption.used())
+            {
+                if (std::string(patienceOption.value()) == "-1")
+                {
+                    adaptiveAlgorithm->setNonImprovementLimit((std::size_t)-1);
+                }
+                else
+                {
+                    adaptiveAlgorithm->setNonImprovementLimit(std::stoul(patienceOption.value(), nullptr, 10));
+                }
+            }
+
+            adaptiveAlgorithm->setDecisionRounds(5);
+
+            algorithm->addDecompositionAlgorithm(new htd::TrivialTreeDecompositionAlgorithm(manager));
+
+            algorithm->addDecompositionAlgorithm(adaptiveAlgorithm);
+        }
+        else
+        {
+            htd::WidthMinimizingTreeDecompositionAlgorithm * baseAlgorithm = new htd::WidthMinimizingTreeDecompositionAlgorithm(manager);
+
+            if (iterationOption.used())
+            {
+                std::size_t iterations = std::stoul(iterationOption.value(), nullptr, 10);
+
+                if (iterations == 0)
+                {
+                    iterations = (std::size_t)-1;
+                }
+
+                baseAlgorithm->setIterationCount(iterations);
+            }
+            else
+            {
+                baseAlgorithm->setIterationCount(10);
+            }
+
+            if (patienceOption.used())
+            {
+                if (std::string(patienceOption.value()) == "-1")
+                {
+                    baseAlgorithm->setNonImprovementLimit((std::size_t)-1);
+                }
+                else
+                {
+                    baseAlgorithm->setNonImprovementLimit(std::stoul(patienceOption.value(), nullptr, 10));
+                }
+            }
+
+            algorithm->addDecompositionAlgorithm(baseAlgorithm);
+        }
+
+        algorithm->setComputeInducedEdgesEnabled(false);
+
+        manager->treeDecompositionAlgorithmFactory().setConstructionTemplate(algorithm);
+    }
+}
+
+htd_io::IGraphToTreeDecompositionProcessor * createGraphToTreeDecompositionProcessor(const htd_cli::OptionManager & optionManager, const htd::LibraryInstance * const manager)
+{
+    const htd_cli::Choice & inputFormatChoice = optionManager.accessChoice("input");
+
+    const htd_cli::Choice & outputFormatChoice = optionManager.accessChoice("output");
+
+    const htd_cli::Choice & preprocessingChoice = optionManager.accessChoice("preprocessing");
+
+    const std::string & inputFormat = inputFormatChoice.value();
+
+    const std::string & outputFormat = outputFormatChoice.value();
+
+    htd_io::ITreeDecompositionExporter * exporter = nullptr;
+
+    if (outputFormat == "td")
+    {
+        exporter = new htd_io::TdFormatExporter();
+    }
+    else if (outputFormat == "human")
+    {
+        exporter = new htd_io::HumanReadableExporter();
+    }
+    else if (outputFormat == "width")
+    {
+        exporter = new htd_io::WidthExporter();
+    }
+    else
+    {
+        std::cerr << "INVALID OUTPUT FORMAT: " << outputFormat << std::endl;
+
+        return nullptr;
+    }
+
+    htd_io::IGraphToTreeDecompositionProcessor * ret = nullptr;
+
+    if (inputFormat == "gr")
+    {
+        ret = new htd_io::GrFormatGraphToTreeDecompositionProcessor(manager);
+    }
+    else if (inputFormat == "hgr")
+    {
+        ret = new htd_io::HgrFormatGraphToTreeDecompositionProcessor(manager);
+    }
+    else if (inputFormat == "lp")
+    {
+        ret = new htd_io::LpFormatGraphToTreeDecompositionProcessor(manager);
+    }
+    else
+    {
+        std::cerr << "INVALID INPUT FORMAT: " << inputFormat << std::endl;
+
+        delete exporter;
+
+        return nullptr;
+    }
+
+    htd::GraphPreprocessor * preprocessor = new htd::GraphPreprocessor(manager);
+
+    if (std::string(preprocessingChoice.value()) == "none")
+    {
+        preprocessor->setPreprocessingStrategy(0);
+    }
+    else if (std::string(preprocessingChoice.value()) == "simple")
+    {
+        preprocessor->setPreprocessingStrategy(1);
+    }
+    else if (std::string(preprocessingChoice.value()) == "advanced")
+    {
+        preprocessor->setPreprocessingStrategy(2);
+    }
+    else if (std::string(preprocessingChoice.value()) == "full")
+    {
+        preprocessor->setPreprocessingStrategy(3);
+
+        preprocessor->setIterationCount(256);
+        preprocessor->setNonImprovementLimit(64);
+    }
+
+    ret->setExporter(exporter);
+
+    ret->setPreprocessor(preprocessor);
+
+    return ret;
+}
+
+template <typename DecompositionAlgorithm, typename GraphType, typename Exporter>
+void decompose(const htd::LibraryInstance & instance, const DecompositionAlgorithm & algorithm, GraphType * graph, const Exporter & exporter)
+{
+    if (graph != nullptr && !instance.isTerminated())
+    {
+        auto * decomposition = algorithm.computeDecomposition(*graph);
+
+        if (decomposition != nullptr)
+        {
+            if (!instance.isTerminated() || algorithm.isSafelyInterruptible())
+            {
+                htd::ScopedTimer timer(&instance, "Export", "io");
+
+                exporter.write(*decomposition, *graph, std::cout);
+            }
+            else
+            {
+                std::cerr << "Program was terminated successfully!" << std::endl;
+            }
+
+            delete decomposition;
+        }
+        else
+        {
+            if (instance.isTerminated())
+            {
+                std::cerr << "Program was terminated successfully!" << std::endl;
+            }
+            else
+            {
+                std::cerr << "NO TREE DECOMPOSITION COMPUTED!" << std::endl;
+            }
+        }
+
+        delete graph;
+    }
+    else
+    {
+        if (instance.isTerminated())
+        {
+            std::cerr << "Program was terminated successfully!" << std::endl;
+        }
+        else
+        {
+            std::cerr << "NO VALID INSTANCE PROVIDED!" << std::endl;
+        }
+    }
+}
+
+template <typename DecompositionAlgorithm, typename GraphType, typename Exporter>
+void decomposeNamed(const htd::LibraryInstance & instance, const DecompositionAlgorithm & algorithm, GraphType * graph, const Exporter & exporter)
+{
+    if (graph != nullptr && !instance.isTerminated())
+    {
+        auto * decomposition = algorithm.computeDecomposition(graph->internalGraph());
+
+        if (decomposition != nullptr)
+        {
+            if (!instance.isTerminated() || algorithm.isSafelyInterruptible())
+            {
+                htd::ScopedTimer timer(&instance, "Export", "io");
+
+                exporter.write(*decomposition, *graph, std::cout);
+            }
+            else
+            {
+                std::cerr << "Program was terminated successfully!" << std::endl;
+            }
+
+            delete decomposition;
+        }
+        else
+        {
+            if (instance.isTerminated())
+            {
+                std::cerr << "Program was terminated successfully!" << std::endl;
+            }
+            else
+            {
+                std::cerr << "NO TREE DECOMPOSITION COMPUTED!" << std::endl;
+            }
+        }
+
+        delete graph;
+    }
+    else
+    {
+        if (instance.isTerminated())
+        {
+            std::cerr << "Program was terminated successfully!" << std::endl;
+        }
+        else
+        {
+            std::cerr << "NO VALID INSTANCE PROVIDED!" << std::endl;
+        }
+
+        if (graph != nullptr)
+        {
+            delete graph;
+        }
+    }
+}
+
+template <typename DecompositionAlgorithm, typename Exporter>
+void run(const DecompositionAlgorithm & algorithm, const Exporter & exporter, const std::string & inputFormat, const htd::LibraryInstance * const manager)
+{
+    if (inputFormat == "gr")
+    {
+        htd_io::GrFormatImporter importer(manager);
+
+        decompose(*manager, algorithm, importer.import(std::cin), exporter);
+    }
+    else if (inputFormat == "lp")
+    {
+        htd_io::LpFormatImporter importer(manager);
+
+        decomposeNamed(*manager, algorithm, importer.import(std::cin), exporter);
+    }
+    else if (inputFormat == "hgr")
+    {
+        htd_io::HgrFormatImporter importer(manager);
+
+        decompose(*manager, algorithm, importer.import(std::cin), exporter);
+    }
+}
+
+template <typename DecompositionAlgorithm, typename Exporter>
+void run(const DecompositionAlgorithm & algorithm, const Exporter & exporter, const std::string & inputFormat, const htd::LibraryInstance * const manager, const std::string & instanceFile)
+{
+    if (inputFormat == "gr")
+    {
+        htd_io::GrFormatImporter importer(manager);
+
+        decompose(*manager, algorithm, importer.import(instanceFile), exporter);
+    }
+    else if (inputFormat == "lp")
+    {
+        htd_io::LpFormatImporter importer(manager);
+
+        decomposeNamed(*manager, algorithm, importer.import(instanceFile), exporter);
+    }
+    else if (inputFormat == "hgr")
+    {
+        htd_io::HgrFormatImporter importer(manager);
+
+        decompose(*manager, algorithm, importer.import(instanceFile), exporter);
+    }
+}
+
+/**
+ *  Sequential source of the instances which are decomposed in batch mode.
+ *
+ *  The source either reads a manifest listing one instance file per line or a stream of
+ *  length-prefixed instances. In the latter case, each instance is preceded by a header
+ *  line holding the size of the instance in bytes, optionally followed by an identifier.
+ */
+class BatchInstanceSource
+{
+    public:
+        BatchInstanceSource(std::istream & input, bool lengthPrefixed) : input_(input), lengthPrefixed_(lengthPrefixed), aborted_(false), nextIndex_(0), mutex_()
+        {
+
+        }
+
+        /**
+         *  Fetch the next instance from the source.
+         *
+         *  @param[out] index       The zero-based position of the instance within the source.
+         *  @param[out] identifier  The identifier of the instance.
+         *  @param[out] content     The content of the instance.
+         *  @param[out] valid       A boolean flag indicating whether the instance could be read.
+         *
+         *  @return True if an instance was fetched, false if the source is exhausted.
+         */
+        bool next(std::size_t & index, std::string & identifier, std::string & content, bool & valid)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            std::string line;
+
+            bool ret = false;
+
+            while (!ret && !aborted_ && std::getline(input_, line))
+            {
+                std::size_t begin = line.find_first_not_of(" \t\r");
+
+                if (begin != std::string::npos)
+                {
+                    line = line.substr(begin, line.find_last_not_of(" \t\r") + 1 - begin);
+
+                    ret = lengthPrefixed_ ? readStreamedInstance(line, identifier, content, valid) : readInstanceFile(line, identifier, content, valid);
+                }
+            }
+
+            if (ret)
+            {
+                index = nextIndex_++;
+            }
+
+            return ret;
+        }
+
+    private:
+        std::istream & input_;
+
+        bool lengthPrefixed_;
+
+        /**
+         *  A boolean flag indicating whether the stream of length-prefixed instances was aborted because the
+         *  position of the next header cannot be determined.
+         */
+        bool aborted_;
+
+        std::size_t nextIndex_;
+
+        std::mutex mutex_;
+
+        bool readInstanceFile(const std::string & path, std::string & identifier, std::string & content, bool & valid)
+        {
+            std::ifstream instanceStream(path, std::ios::in | std::ios::binary);
+
+            identifier = path;
+
+            valid = instanceStream.good();
+
+            if (valid)
+            {
+                std::ostringstream buffer;
+
+                buffer << instanceStream.rdbuf();
+
+                content = buffer.str();
+            }
+            else
+            {
+                content.clear();
+            }
+
+            return true;
+        }
+
+        bool readStreamedInstance(const std::string & header, std::string & identifier, std::string & content, bool & valid)
+        {
+            std::size_t separator = header.find_first_of(" \t");
+
+            std::string length = header.substr(0, separator);
+
+            /* Without a valid length, the end of the instance is unknown, hence the rest of the stream cannot be interpreted. */
+            if (length.empty() || length.find_first_not_of("0123456789") != std::string::npos || length.length() > (std::size_t)std::numeric_limits<std::size_t>::digits10)
+            {
+                std::cerr << "INVALID INSTANCE HEADER: " << header << std::endl;
+
+                aborted_ = true;
+
+                return false;
+            }
+
+            std::size_t identifierBegin = separator != std::string::npos ? header.find_first_not_of(" \t", separator) : std::string::npos;
+
+            if (identifierBegin != std::string::npos)
+            {
+                identifier = header.substr(identifierBegin);
+            }
+            else
+            {
+                identifier = std::to_string(nextIndex_ + 1);
+            }
+
+            std::size_t size = static_cast<std::size_t>(std::stoull(length, nullptr, 10));
+
+            content.clear();
+
+            /* The instance is read in chunks, so that a bogus length does not allocate more memory than the stream provides. */
+            const std::size_t chunkSize = 65536;
+
+            while (content.size() < size)
+            {
+                std::size_t offset = content.size();
+
+                std::size_t count = std::min(chunkSize, size - offset);
+
+                content.resize(offset + count);
+
+                input_.read(&(content[offset]), static_cast<std::streamsize>(count));
+
+                if (input_.gcount() != static_cast<std::streamsize>(count))
+                {
+                    content.resize(offset + static_cast<std::size_t>(input_.gcount()));
+
+                    break;
+                }
+            }
+
+            valid = content.size() == size;
+
+            if (!valid)
+            {
+                std::cerr << "INCOMPLETE INSTANCE: " << identifier << std::endl;
+
+                aborted_ = true;
+
+                return false;
+            }
+
+            return true;
+        }
+};
+
+void recordMemoryUsage(const htd::LibraryInstance & instance)
+{
+    const htd::MemoryManager & memoryManager = instance.memoryManager();
+
+    for (const std::string & subsystem : memoryManager.subsystems())
+    {
+        instance.instrumentation()->addCounter("Memory: " + subsystem + " (peak bytes)", memoryManager.peakBytes(subsystem));
+    }
+}
+
+bool processBatch(const htd_cli::OptionManager & optionManager)
+{
+    const htd_cli::SingleValueOption & batchOption = optionManager.accessSingleValueOption("batch");
+
+    const htd_cli::SingleValueOption & threadsOption = optionManager.accessSingleValueOption("threads");
+
+    std::size_t threadCount = std::thread::hardware_concurrency();
+
+    if (threadsOption.used())
+    {
+        threadCount = std::stoul(threadsOption.value(), nullptr, 10);
+    }
+
+    if (threadCount == 0)
+    {
+        threadCount = 1;
+    }
+
+    std::vector<htd::LibraryInstance *> instances;
 
-        const std::string & outputFormat = outputFormatChoice.value();
+    std::vector<htd_io::IGraphToTreeDecompositionProcessor *> processors;
 
-        bool hypertreeDecompositionRequested = decompositionTypeChoice.used() && std::string(decompositionTypeChoice.value()) == "hypertree";
+    bool ret = true;
 
-        if (std::string(strategyChoice.value()) == "min-separator")
-        {
-            htd::SeparatorBasedTreeDecompositionAlgorithm * treeDecompositionAlgorithm = new htd::SeparatorBasedTreeDecompositionAlgorithm(libraryInstance);
+    for (std::size_t index = 0; ret && index < threadCount; ++index)
+    {
+        htd::LibraryInstance * instance = htd::createManagementInstance(htd::Id::FIRST + static_cast<htd::id_t>(index) + 1);
+
+        configureLibraryInstance(optionManager, instance);
 
-            treeDecompositionAlgorithm->setComputeInducedEdgesEnabled(false);
+        instances.push_back(instance);
 
-            libraryInstance->treeDecompositionAlgorithmFactory().setConstructionTemplate(treeDecompositionAlgorithm);
+        htd_io::IGraphToTreeDecompositionProcessor * processor = createGraphToTreeDecompositionProcessor(optionManager, instance);
+
+        if (processor != nullptr)
+        {
+            processors.push_back(processor);
         }
         else
         {
-            htd::BucketEliminationTreeDecompositionAlgorithm * treeDecompositionAlgorithm = new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance);
+            ret = false;
+        }
+    }
 
-            treeDecompositionAlgorithm->setComputeInducedEdgesEnabled(false);
+    if (ret)
+    {
+        std::ifstream manifestStream;
 
-            libraryInstance->treeDecompositionAlgorithmFactory().setConstructionTemplate(treeDecompositionAlgorithm);
-        }
+        bool lengthPrefixed = std::string(batchOption.value()) == "-";
 
-        if (hypertreeDecompositionRequested)
+        if (!lengthPrefixed)
         {
-            htd::IHypertreeDecompositionAlgorithm * algorithm = libraryInstance->hypertreeDecompositionAlgorithmFactory().createInstance();
+            manifestStream.open(batchOption.value());
+        }
 
-            htd_io::IHypertreeDecompositionExporter * exporter = nullptr;
+        BatchInstanceSource source(lengthPrefixed ? std::cin : manifestStream, lengthPrefixed);
 
-            if (outputFormat == "human")
-            {
-                exporter = new htd_io::HumanReadableExporter();
-            }
-            else if (outputFormat == "width")
-            {
-                exporter = new htd_io::WidthExporter();
-            }
-            else
-            {
-                std::cerr << "INVALID OUTPUT FORMAT: " << outputFormat << std::endl;
+        std::mutex outputMutex;
 
-                error = true;
-            }
+        std::map<std::size_t, std::string> pendingResults;
 
-            if (!error)
-            {
-                if (instanceOption.used())
-                {
-                    run(*algorithm, *exporter, inputFormatChoice.value(), libraryInstance, instanceOption.value());
-                }
-                else
-                {
-                    run(*algorithm, *exporter, inputFormatChoice.value(), libraryInstance);
-                }
+        std::size_t nextResult = 0;
 
-                delete exporter;
-            }
+        std::mutex watcherMutex;
 
-            delete algorithm;
-        }
-        else
+        std::condition_variable watcherCondition;
+
+        bool finished = false;
+
+        /* The signal handler only terminates the main instance, the worker instances are terminated by this thread. */
+        std::thread watcher([&]()
         {
-            htd_io::ITreeDecompositionExporter * exporter = nullptr;
+            std::unique_lock<std::mutex> lock(watcherMutex);
 
-            if (outputFormat == "td")
+            while (!finished && !libraryInstance->isTerminated())
             {
-                exporter = new htd_io::TdFormatExporter();
+                watcherCondition.wait_for(lock, std::chrono::milliseconds(10));
             }
-            else if (outputFormat == "human")
-            {
-                exporter = new htd_io::HumanReadableExporter();
-            }
-            else if (outputFormat == "width")
+
+            if (libraryInstance->isTerminated())
             {
-                exporter = new htd_io::WidthExporter();
+                for (htd::LibraryInstance * instance : instances)
+                {
+                    instance->terminate();
+                }
             }
-            else
-            {
-                std::cerr << "INVALID OUTPUT FORMAT: " << outputFormat << std::endl;
+        });
 
-                error = true;
-            }
+        /* Each instance is decomposed with a generator seeded by its position, so the result does not depend on the worker which processes it. */
+        unsigned int batchSeed = static_cast<unsigned int>(htd::randomNumberGenerator()());
 
-            if (!error)
+        std::vector<std::thread> workers;
+
+        for (std::size_t index = 0; index < threadCount; ++index)
+        {
+            htd::LibraryInstance * instance = instances[index];
+
+            const htd_io::IGraphToTreeDecompositionProcessor * processor = processors[index];
+
+            workers.emplace_back([&, instance, processor]()
             {
-                std::size_t optimalMaximumBagSize = (std::size_t)-1;
+                std::size_t position = 0;
+
+                std::string identifier;
 
-                if (std::string(optimizationChoice.value()) == "width")
+                std::string content;
+
+                bool valid = false;
+
+                while (!instance->isTerminated() && source.next(position, identifier, content, valid))
                 {
-                    htd::CombinedWidthMinimizingTreeDecompositionAlgorithm * algorithm = new htd::CombinedWidthMinimizingTreeDecompositionAlgorithm(libraryInstance);
+                    std::ostringstream result;
 
-                    if (std::string(strategyChoice.value()) == "challenge")
+                    result << "c instance " << identifier << std::endl;
+
+                    if (valid)
                     {
-                        htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm * adaptiveAlgorithm = new htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm(libraryInstance);
+                        std::istringstream inputStream(content);
 
-                        htd::BucketEliminationTreeDecompositionAlgorithm * algorithm1 = new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance);
+                        htd::seedRandomNumberGenerator(batchSeed + static_cast<unsigned int>(position));
 
-                        algorithm1->setOrderingAlgorithm(new htd::MinDegreeOrderingAlgorithm(libraryInstance));
+                        processor->process(inputStream, result);
+                    }
+                    else
+                    {
+                        result << "c error INVALID INSTANCE FILE" << std::endl;
+                    }
 
-                        adaptiveAlgorithm->addDecompositionAlgorithm(algorithm1);
+                    /* The main instance is terminated only by signals, hence the worker instance was terminated because of the memory limit. */
+                    if (instance->isTerminated() && !libraryInstance->isTerminated())
+                    {
+                        instance->reset();
+                    }
 
-                        htd::BucketEliminationTreeDecompositionAlgorithm * algorithm2 = new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance);
+                    std::lock_guard<std::mutex> lock(outputMutex);
 
-                        algorithm2->setOrderingAlgorithm(new htd::MinFillOrderingAlgorithm(libraryInstance));
+                    pendingResults.emplace(position, result.str());
 
-                        adaptiveAlgorithm->addDecompositionAlgorithm(algorithm2);
+                    auto next = pendingResults.find(nextResult);
 
-                        htd::BucketEliminationTreeDecompositionAlgorithm * algorithm3 = new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance);
+                    while (next != pendingResults.end())
+                    {
+                        std::cout << next->second;
 
-                        algorithm3->setOrderingAlgorithm(new htd::MaximumCardinalitySearchOrderingAlgorithm(libraryInstance));
+                        pendingResults.erase(next);
 
-                        adaptiveAlgorithm->addDecompositionAlgorithm(algorithm3,
-                                                                     [](const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph)
-                        {
-                            HTD_UNUSED(graph)
+                        next = pendingResults.find(++nextResult);
+                    }
 
-                            return preprocessedGraph.vertexCount() <= 10240;
-                        });
+                    std::cout.flush();
+                }
+            });
+        }
 
-                        if (iterationOption.used())
-                        {
-                            std::size_t iterations = std::stoul(iterationOption.value(), nullptr, 10);
+        for (std::thread & worker : workers)
+        {
+            worker.join();
+        }
 
-                            if (iterations == 0)
-                            {
-                                iterations = (std::size_t)-1;
-                            }
+        {
+            std::lock_guard<std::mutex> lock(watcherMutex);
 
-                            adaptiveAlgorithm->setIterationCount(iterations);
-                        }
-                        else
-                        {
-                            adaptiveAlgorithm->setIterationCount(10);
-                        }
+            finished = true;
+        }
 
-                        if (patienceOption.used())
-                        {
-                            if (std::string(patienceOption.value()) == "-1")
-                            {
-                                adaptiveAlgorithm->setNonImprovementLimit((std::size_t)-1);
-                            }
-                            else
-                            {
-                                adaptiveAlgorithm->setNonImprovementLimit(std::stoul(patienceOption.value(), nullptr, 10));
-                            }
-                        }
+        watcherCondition.notify_one();
 
-                        adaptiveAlgorithm->setDecisionRounds(5);
+        watcher.join();
+    }
 
-                        algorithm->addDecompositionAlgorithm(new htd::TrivialTreeDecompositionAlgorithm(libraryInstance));
+    for (htd_io::IGraphToTreeDecompositionProcessor * processor : processors)
+    {
+        delete processor;
+    }
 
-                        algorithm->addDecompositionAlgorithm(adaptiveAlgorithm);
-                    }
-                    else
-                    {
-                        htd::WidthMinimizingTreeDecompositionAlgorithm * baseAlgorithm = new htd::WidthMinimizingTreeDecompositionAlgorithm(libraryInstance);
+    for (htd::LibraryInstance * instance : instances)
+    {
+        if (libraryInstance->instrumentation() != nullptr && instance->instrumentation() != nullptr)
+        {
+            recordMemoryUsage(*instance);
 
-                        if (iterationOption.used())
-                        {
-                            std::size_t iterations = std::stoul(iterationOption.value(), nullptr, 10);
+            libraryInstance->instrumentation()->merge(*(instance->instrumentation()));
+        }
 
-                            if (iterations == 0)
-                            {
-                                iterations = (std::size_t)-1;
-                            }
+        delete instance;
+    }
 
-                            baseAlgorithm->setIterationCount(iterations);
-                        }
-                        else
-                        {
-                            baseAlgorithm->setIterationCount(10);
-                        }
+    return ret;
+}
 
-                        if (patienceOption.used())
-                        {
-                            if (std::string(patienceOption.value()) == "-1")
-                            {
-                                baseAlgorithm->setNonImprovementLimit((std::size_t)-1);
-                            }
-                            else
-                            {
-                                baseAlgorithm->setNonImprovementLimit(std::stoul(patienceOption.value(), nullptr, 10));
-                            }
-                        }
+bool writeStatistics(const htd::Instrumentation & instrumentation, const std::string & fileName)
+{
+    std::ofstream outputStream(fileName);
 
-                        algorithm->addDecompositionAlgorithm(baseAlgorithm);
-                    }
+    if (outputStream.is_open())
+    {
+        const std::string extension(".csv");
 
-                    algorithm->setComputeInducedEdgesEnabled(false);
+        if (fileName.size() >= extension.size() && fileName.compare(fileName.size() - extension.size(), extension.size(), extension) == 0)
+        {
+            instrumentation.writeCsv(outputStream);
+        }
+        else
+        {
+            instrumentation.writeChromeTrace(outputStream);
+        }
 
-                    libraryInstance->treeDecompositionAlgorithmFactory().setConstructionTemplate(algorithm);
-                }
+        outputStream.flush();
+    }
 
-                htd::GraphPreprocessor * preprocessor = new htd::GraphPreprocessor(libraryInstance);
+    return outputStream.is_open() && outputStream.good();
+}
 
-                if (std::string(preprocessingChoice.value()) == "none")
-                {
-                    preprocessor->setPreprocessingStrategy(0);
-                }
-                else if (std::string(preprocessingChoice.value()) == "simple")
-                {
-                    preprocessor->setPreprocessingStrategy(1);
-                }
-                else if (std::string(preprocessingChoice.value()) == "advanced")
-                {
-                    preprocessor->setPreprocessingStrategy(2);
-                }
-                else if (std::string(preprocessingChoice.value()) == "full")
-                {
-                    preprocessor->setPreprocessingStrategy(3);
+void handleSignal(int signal)
+{
+    /* Terminating the main instance only sets its atomic flag. In batch mode, a watcher thread forwards the termination to the worker instances. */
+    switch (signal)
+    {
+        case SIGINT:
+        {
+            libraryInstance->terminate();
 
-                    preprocessor->setIterationCount(256);
-                    preprocessor->setNonImprovementLimit(64);
-                }
+            break;
+        }
+        case SIGTERM:
+        {
+            libraryInstance->terminate();
+
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+
+int main(int argc, const char * const * const argv)
+{
+    int ret = 0;
 
-                htd_io::IGraphToTreeDecompositionProcessor * processor = nullptr;
+    bool error = false;
 
-                if (std::string(inputFormatChoice.value()) == "gr")
-                {
-                    processor = new htd_io::GrFormatGraphToTreeDecompositionProcessor(libraryInstance);
-                }
-                else if (std::string(inputFormatChoice.value()) == "hgr")
-                {
-                    processor = new htd_io::HgrFormatGraphToTreeDecompositionProcessor(libraryInstance);
-                }
-                else if (std::string(inputFormatChoice.value()) == "lp")
+    std::ios_base::sync_with_stdio(false);
+
+    std::signal(SIGINT, handleSignal);
+    std::signal(SIGTERM, handleSignal);
+
+    htd_cli::OptionManager * optionManager = createOptionManager();
+
+    if (optionManager != nullptr && handleOptions(argc, argv, *optionManager))
+    {
+        configureLibraryInstance(*optionManager, libraryInstance);
+
+        const htd_cli::Choice & inputFormatChoice = optionManager->accessChoice("input");
+
+        const htd_cli::Choice & outputFormatChoice = optionManager->accessChoice("output");
+
+        const htd_cli::Choice & decompositionTypeChoice = optionManager->accessChoice("type");
+
+        const htd_cli::Choice & preprocessingChoice = optionManager->accessChoice("preprocessing");
+
+        const htd_cli::SingleValueOption & instanceOption = optionManager->accessSingleValueOption("instance");
+
+        const htd_cli::SingleValueOption & batchOption = optionManager->accessSingleValueOption("batch");
+
+        const htd_cli::Option & printProgressOption = optionManager->accessOption("print-progress");
+
+        const std::string & outputFormat = outputFormatChoice.value();
+
+        bool hypertreeDecompositionRequested = decompositionTypeChoice.used() && std::string(decompositionTypeChoice.value()) == "hypertree";
+
+        if (hypertreeDecompositionRequested)
+        {
+            htd::IHypertreeDecompositionAlgorithm * algorithm = libraryInstance->hypertreeDecompositionAlgorithmFactory().createInstance();
+
+            htd_io::IHypertreeDecompositionExporter * exporter = nullptr;
+
+            if (outputFormat == "human")
+            {
+                exporter = new htd_io::HumanReadableExporter();
+            }
+            else if (outputFormat == "width")
+            {
+                exporter = new htd_io::WidthExporter();
+            }
+            else
+            {
+                std::cerr << "INVALID OUTPUT FORMAT: " << outputFormat << std::endl;
+
+                error = true;
+            }
+
+            if (!error)
+            {
+                if (instanceOption.used())
                 {
-                    processor = new htd_io::LpFormatGraphToTreeDecompositionProcessor(libraryInstance);
+                    run(*algorithm, *exporter, inputFormatChoice.value(), libraryInstance, instanceOption.value());
                 }
                 else
                 {
-                    std::cerr << "INVALID INPUT FORMAT: " << inputFormatChoice.value() << std::endl;
-
-                    std::exit(1);
+                    run(*algorithm, *exporter, inputFormatChoice.value(), libraryInstance);
                 }
 
-                processor->setExporter(exporter);
+                delete exporter;
+            }
+
+            delete algorithm;
+        }
+        else
+        {
+            htd_io::IGraphToTreeDecompositionProcessor * processor = createGraphToTreeDecompositionProcessor(*optionManager, libraryInstance);
+
+            if (processor == nullptr)
+            {
+                error = true;
+            }
+            else if (batchOption.used())
+            {
+                delete processor;
 
-                processor->setPreprocessor(preprocessor);
+                if (!processBatch(*optionManager))
+                {
+                    ret = 1;
+                }
+            }
+            else
+            {
+                std::size_t optimalMaximumBagSize = (std::size_t)-1;
 
                 std::chrono::milliseconds::rep start =
                     std::chrono::duration_cast<std::chrono::milliseconds>
@@ -1003,6 +1639,20 @@ int main(int argc, const char * const * const argv)
         }
     }
 
+    if (libraryInstance->instrumentation() != nullptr)
+    {
+        const htd_cli::SingleValueOption & statsOption = optionManager->accessSingleValueOption("stats");
+
+        recordMemoryUsage(*libraryInstance);
+
+        if (!writeStatistics(*(libraryInstance->instrumentation()), statsOption.value()))
+        {
+            std::cerr << "COULD NOT WRITE STATISTICS TO FILE: " << statsOption.value() << std::endl;
+
+            ret = 1;
+        }
+    }
+
     delete libraryInstance;
 
     if (optionManager != nullptr)
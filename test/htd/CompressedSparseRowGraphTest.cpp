@@ -0,0 +1,344 @@
+/*
+ * File:   CompressedSparseRowGraphTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+class CompressedSparseRowGraphTest : public ::testing::Test
+{
+    public:
+        CompressedSparseRowGraphTest(void)
+        {
+
+        }
+
+        virtual ~CompressedSparseRowGraphTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+TEST(CompressedSparseRowGraphTest, CheckDerivedEdges)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    /* Path 1 - 2 - 3 and isolated vertex 4. */
+    std::vector<std::size_t> offsets { 0, 1, 3, 4, 4 };
+
+    std::vector<htd::vertex_t> adjacency { 2, 1, 3, 2 };
+
+    htd::CompressedSparseRowGraph graph(libraryInstance, 4, offsets.data(), adjacency.data());
+
+    EXPECT_EQ((std::size_t)4, graph.vertexCount());
+    EXPECT_EQ((std::size_t)2, graph.edgeCount());
+
+    EXPECT_FALSE(graph.hasExplicitHyperedges());
+
+    EXPECT_EQ(offsets.data(), graph.offsets());
+    EXPECT_EQ(adjacency.data(), graph.adjacency());
+
+    EXPECT_EQ((htd::vertex_t)1, graph.vertexAtPosition(0));
+    EXPECT_EQ((htd::vertex_t)4, graph.vertexAtPosition(3));
+
+    EXPECT_TRUE(graph.isVertex(1));
+    EXPECT_TRUE(graph.isVertex(4));
+    EXPECT_FALSE(graph.isVertex(0));
+    EXPECT_FALSE(graph.isVertex(5));
+
+    htd::ConstCollection<htd::vertex_t> neighbors = graph.neighbors(2);
+
+    ASSERT_EQ((std::size_t)2, neighbors.size());
+    EXPECT_TRUE(neighbors.isContiguous());
+    EXPECT_EQ(adjacency.data() + 1, neighbors.data());
+    EXPECT_EQ((htd::vertex_t)1, neighbors[0]);
+    EXPECT_EQ((htd::vertex_t)3, neighbors[1]);
+
+    EXPECT_EQ((std::size_t)2, graph.neighborCount(2));
+    EXPECT_EQ((htd::vertex_t)3, graph.neighborAtPosition(2, 1));
+
+    EXPECT_TRUE(graph.isNeighbor(1, 2));
+    EXPECT_TRUE(graph.isNeighbor(3, 2));
+    EXPECT_FALSE(graph.isNeighbor(1, 3));
+    EXPECT_FALSE(graph.isNeighbor(4, 1));
+
+    EXPECT_TRUE(graph.isEdge(1, 2));
+    EXPECT_FALSE(graph.isEdge(2, 1));
+    EXPECT_FALSE(graph.isEdge(1, 3));
+
+    EXPECT_TRUE(graph.isEdge((htd::id_t)1));
+    EXPECT_TRUE(graph.isEdge((htd::id_t)2));
+    EXPECT_FALSE(graph.isEdge((htd::id_t)3));
+
+    htd::ConstCollection<htd::id_t> edgeIds = graph.associatedEdgeIds(2, 3);
+
+    ASSERT_EQ((std::size_t)1, edgeIds.size());
+    EXPECT_EQ((htd::id_t)2, edgeIds[0]);
+
+    EXPECT_EQ((std::size_t)0, graph.associatedEdgeIds(1, 3).size());
+
+    EXPECT_EQ((std::size_t)1, graph.edgeCount(1));
+    EXPECT_EQ((std::size_t)2, graph.edgeCount(2));
+    EXPECT_EQ((std::size_t)0, graph.edgeCount(4));
+
+    EXPECT_EQ((std::size_t)1, graph.isolatedVertexCount());
+    EXPECT_EQ((htd::vertex_t)4, graph.isolatedVertexAtPosition(0));
+    EXPECT_TRUE(graph.isIsolatedVertex(4));
+    EXPECT_FALSE(graph.isIsolatedVertex(1));
+
+    EXPECT_FALSE(graph.isConnected());
+    EXPECT_TRUE(graph.isConnected(1, 3));
+    EXPECT_FALSE(graph.isConnected(1, 4));
+
+    htd::ConstCollection<htd::Hyperedge> hyperedges = graph.hyperedges();
+
+    ASSERT_EQ((std::size_t)2, hyperedges.size());
+
+    EXPECT_EQ((htd::id_t)1, hyperedges[0].id());
+    EXPECT_EQ((htd::vertex_t)1, hyperedges[0][0]);
+    EXPECT_EQ((htd::vertex_t)2, hyperedges[0][1]);
+
+    EXPECT_EQ((htd::id_t)2, hyperedges[1].id());
+    EXPECT_EQ((htd::vertex_t)2, hyperedges[1][0]);
+    EXPECT_EQ((htd::vertex_t)3, hyperedges[1][1]);
+
+    EXPECT_EQ((htd::id_t)2, graph.hyperedgeAtPosition(1, 2).id());
+
+    std::vector<htd::vertex_t> elements;
+
+    graph.copyHyperedgeElementsTo(1, elements);
+
+    ASSERT_EQ((std::size_t)2, elements.size());
+    EXPECT_EQ((htd::vertex_t)2, elements[0]);
+    EXPECT_EQ((htd::vertex_t)3, elements[1]);
+
+    delete libraryInstance;
+}
+
+TEST(CompressedSparseRowGraphTest, CheckExplicitHyperedges)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    /* Hyperedges {1, 2, 3} and {3, 4} together with their primal graph. */
+    std::vector<std::size_t> offsets { 0, 2, 4, 7, 8 };
+
+    std::vector<htd::vertex_t> adjacency { 2, 3, 1, 3, 1, 2, 4, 3 };
+
+    std::vector<std::size_t> hyperedgeOffsets { 0, 3, 5 };
+
+    std::vector<htd::vertex_t> hyperedgeElements { 1, 2, 3, 3, 4 };
+
+    htd::CompressedSparseRowGraph graph(libraryInstance, 4, offsets.data(), adjacency.data(), 2, hyperedgeOffsets.data(), hyperedgeElements.data());
+
+    EXPECT_TRUE(graph.hasExplicitHyperedges());
+
+    EXPECT_EQ((std::size_t)4, graph.vertexCount());
+    EXPECT_EQ((std::size_t)2, graph.edgeCount());
+
+    EXPECT_EQ((std::size_t)1, graph.edgeCount(1));
+    EXPECT_EQ((std::size_t)2, graph.edgeCount(3));
+
+    EXPECT_TRUE(graph.isEdge(3, 4));
+    EXPECT_FALSE(graph.isEdge(1, 2));
+
+    std::vector<htd::vertex_t> edge { 1, 2, 3 };
+
+    EXPECT_TRUE(graph.isEdge(edge));
+
+    htd::ConstCollection<htd::id_t> edgeIds = graph.associatedEdgeIds(edge);
+
+    ASSERT_EQ((std::size_t)1, edgeIds.size());
+    EXPECT_EQ((htd::id_t)1, edgeIds[0]);
+
+    EXPECT_TRUE(graph.isNeighbor(1, 3));
+    EXPECT_FALSE(graph.isNeighbor(1, 4));
+
+    EXPECT_EQ((std::size_t)0, graph.isolatedVertexCount());
+
+    EXPECT_TRUE(graph.isConnected());
+
+    htd::ConstCollection<htd::Hyperedge> hyperedges = graph.hyperedges();
+
+    ASSERT_EQ((std::size_t)2, hyperedges.size());
+    EXPECT_EQ((std::size_t)3, hyperedges[0].size());
+    EXPECT_EQ((std::size_t)2, hyperedges[1].size());
+
+    std::unique_ptr<htd::CompressedSparseRowGraph> clone(graph.clone());
+
+    EXPECT_EQ((std::size_t)2, clone->edgeCount());
+    EXPECT_EQ(graph.offsets(), clone->offsets());
+
+    EXPECT_EQ(hyperedges[1].elements(), clone->hyperedgeAtPosition(1).elements());
+
+    delete libraryInstance;
+}
+
+TEST(CompressedSparseRowGraphTest, CheckPreprocessing)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::vector<std::size_t> offsets { 0, 2, 4, 7, 8 };
+
+    std::vector<htd::vertex_t> adjacency { 2, 3, 1, 3, 1, 2, 4, 3 };
+
+    htd::CompressedSparseRowGraph compressedGraph(libraryInstance, 4, offsets.data(), adjacency.data());
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    graph.addVertices(4);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(1, 3);
+    graph.addEdge(2, 3);
+    graph.addEdge(3, 4);
+
+    htd::GraphPreprocessor preprocessor(libraryInstance);
+
+    std::unique_ptr<htd::IPreprocessedGraph> expected(preprocessor.prepare(graph));
+
+    std::unique_ptr<htd::IPreprocessedGraph> actual(preprocessor.prepare(compressedGraph));
+
+    ASSERT_NE(expected.get(), nullptr);
+    ASSERT_NE(actual.get(), nullptr);
+
+    EXPECT_EQ(expected->vertexCount(), actual->vertexCount());
+    EXPECT_EQ(expected->edgeCount(), actual->edgeCount());
+    EXPECT_EQ(expected->neighborhood(), actual->neighborhood());
+    EXPECT_EQ(expected->eliminationSequence(), actual->eliminationSequence());
+
+    delete libraryInstance;
+}
+
+TEST(CompressedSparseRowGraphTest, CheckDecomposition)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    /* Cycle 1 - 2 - 3 - 4 - 5 - 1 with chord {1, 3} and hyperedge {3, 4, 5}. */
+    std::vector<std::size_t> offsets { 0, 3, 5, 9, 11, 14 };
+
+    std::vector<htd::vertex_t> adjacency { 2, 3, 5, 1, 3, 1, 2, 4, 5, 3, 5, 1, 3, 4 };
+
+    std::vector<std::size_t> hyperedgeOffsets { 0, 2, 4, 6, 9, 11 };
+
+    std::vector<htd::vertex_t> hyperedgeElements { 1, 2, 1, 3, 2, 3, 3, 4, 5, 1, 5 };
+
+    htd::CompressedSparseRowGraph graph(libraryInstance, 5, offsets.data(), adjacency.data(), 5, hyperedgeOffsets.data(), hyperedgeElements.data());
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    EXPECT_TRUE(verifier.verify(graph, *decomposition));
+
+    EXPECT_EQ((std::size_t)3, decomposition->maximumBagSize());
+
+    /* Each hyperedge is induced by at least one bag and the induced hyperedges are identical to the ones of the graph. */
+    std::vector<bool> induced(5, false);
+
+    for (htd::vertex_t node : decomposition->vertices())
+    {
+        const std::vector<htd::vertex_t> & bag = decomposition->bagContent(node);
+
+        for (const htd::Hyperedge & hyperedge : decomposition->inducedHyperedges(node))
+        {
+            EXPECT_EQ(graph.hyperedge(hyperedge.id()).elements(), hyperedge.elements());
+
+            EXPECT_TRUE(std::includes(bag.begin(), bag.end(), hyperedge.sortedElements().begin(), hyperedge.sortedElements().end()));
+
+            induced[hyperedge.id() - htd::Id::FIRST] = true;
+        }
+    }
+
+    EXPECT_EQ(std::vector<bool>(5, true), induced);
+
+    delete decomposition;
+
+    delete libraryInstance;
+}
+
+TEST(CompressedSparseRowGraphTest, CheckInvalidArrays)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::vector<std::size_t> decreasingOffsets { 0, 2, 1, 2 };
+
+    std::vector<htd::vertex_t> adjacency1 { 2, 3, 1, 1 };
+
+    EXPECT_THROW(htd::CompressedSparseRowGraph(libraryInstance, 3, decreasingOffsets.data(), adjacency1.data()), std::invalid_argument);
+
+    std::vector<std::size_t> offsets { 0, 1, 3, 4 };
+
+    std::vector<htd::vertex_t> unsortedAdjacency { 2, 3, 1, 2 };
+
+    EXPECT_THROW(htd::CompressedSparseRowGraph(libraryInstance, 3, offsets.data(), unsortedAdjacency.data()), std::invalid_argument);
+
+    std::vector<htd::vertex_t> outOfRangeAdjacency { 2, 1, 4, 2 };
+
+    EXPECT_THROW(htd::CompressedSparseRowGraph(libraryInstance, 3, offsets.data(), outOfRangeAdjacency.data()), std::invalid_argument);
+
+    std::vector<htd::vertex_t> asymmetricAdjacency { 2, 1, 3, 1 };
+
+    EXPECT_THROW(htd::CompressedSparseRowGraph(libraryInstance, 3, offsets.data(), asymmetricAdjacency.data()), std::invalid_argument);
+
+    std::vector<htd::vertex_t> adjacency2 { 2, 1, 3, 2 };
+
+    EXPECT_NO_THROW(htd::CompressedSparseRowGraph(libraryInstance, 3, offsets.data(), adjacency2.data()));
+
+    std::vector<std::size_t> hyperedgeOffsets { 0, 2, 4 };
+
+    std::vector<htd::vertex_t> duplicateElements { 1, 2, 3, 3 };
+
+    EXPECT_THROW(htd::CompressedSparseRowGraph(libraryInstance, 3, offsets.data(), adjacency2.data(), 2, hyperedgeOffsets.data(), duplicateElements.data()), std::invalid_argument);
+
+    EXPECT_THROW(htd::CompressedSparseRowGraph(libraryInstance, 3, offsets.data(), adjacency2.data(), 2, nullptr, nullptr), std::invalid_argument);
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,379 @@
+/*
+ * File:   DecompositionCacheTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+class DecompositionCacheTest : public ::testing::Test
+{
+    public:
+        DecompositionCacheTest(void)
+        {
+
+        }
+
+        virtual ~DecompositionCacheTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+void addPath(htd::MultiHypergraph & graph, std::size_t size)
+{
+    graph.addVertices(size);
+
+    for (htd::vertex_t vertex = 1; vertex < size; ++vertex)
+    {
+        graph.addEdge(vertex, vertex + 1);
+    }
+}
+
+TEST(DecompositionCacheTest, CheckKeyIndependentOfInsertionOrder)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph1(libraryInstance);
+    htd::MultiHypergraph graph2(libraryInstance);
+    htd::MultiHypergraph graph3(libraryInstance);
+
+    addPath(graph1, 4);
+
+    graph2.addVertices(4);
+
+    graph2.addEdge(4, 3);
+    graph2.addEdge(3, 2);
+    graph2.addEdge(2, 1);
+
+    addPath(graph3, 4);
+
+    graph3.addEdge(1, 4);
+
+    std::string key1 = htd::DecompositionCache::computeKey(graph1);
+
+    ASSERT_EQ((std::size_t)32, key1.size());
+
+    EXPECT_EQ(key1, htd::DecompositionCache::computeKey(graph2));
+
+    EXPECT_NE(key1, htd::DecompositionCache::computeKey(graph3));
+
+    delete libraryInstance;
+}
+
+TEST(DecompositionCacheTest, CheckOrderingRoundTrip)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    addPath(graph, 7);
+
+    htd::DecompositionCache cache(".");
+
+    std::string key = htd::DecompositionCache::computeKey(graph);
+
+    std::remove(("./" + key + ".ordering").c_str());
+
+    std::vector<htd::vertex_t> ordering;
+
+    std::size_t maxBagSize = 0;
+
+    EXPECT_FALSE(cache.loadOrdering(key, ordering, maxBagSize));
+
+    EXPECT_TRUE(cache.storeOrdering(key, std::vector<htd::vertex_t> { 4, 1, 2, 3, 5, 6, 7 }, 3));
+
+    EXPECT_FALSE(cache.storeOrdering(key, std::vector<htd::vertex_t> { 1, 4, 2, 3, 5, 6, 7 }, 3));
+
+    EXPECT_TRUE(cache.storeOrdering(key, std::vector<htd::vertex_t> { 1, 2, 3, 4, 5, 6, 7 }, 2));
+
+    htd::DecompositionCache otherCache(".");
+
+    EXPECT_FALSE(otherCache.storeOrdering(key, std::vector<htd::vertex_t> { 7, 1, 2, 3, 4, 5, 6 }, 3));
+
+    ASSERT_TRUE(otherCache.loadOrdering(key, ordering, maxBagSize));
+
+    EXPECT_EQ((std::size_t)2, maxBagSize);
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3, 4, 5, 6, 7 }), ordering);
+
+    ordering.clear();
+
+    EXPECT_TRUE(otherCache.claimOrdering(key, ordering, maxBagSize));
+
+    EXPECT_EQ((std::size_t)7, ordering.size());
+
+    EXPECT_FALSE(otherCache.claimOrdering(key, ordering, maxBagSize));
+
+    EXPECT_TRUE(cache.claimOrdering(key, ordering, maxBagSize));
+
+    std::remove(("./" + key + ".ordering").c_str());
+
+    delete libraryInstance;
+}
+
+TEST(DecompositionCacheTest, CheckInvalidOrderingEntry)
+{
+    htd::DecompositionCache cache(".");
+
+    std::string key = "invalid-ordering-entry";
+
+    {
+        std::ofstream stream("./" + key + ".ordering");
+
+        stream << "htd-ordering 1\n5 2\n1 2 3\n";
+    }
+
+    std::vector<htd::vertex_t> ordering;
+
+    std::size_t maxBagSize = 0;
+
+    EXPECT_FALSE(cache.loadOrdering(key, ordering, maxBagSize));
+
+    EXPECT_TRUE(cache.storeOrdering(key, std::vector<htd::vertex_t> { 1, 2, 3 }, 4));
+
+    EXPECT_TRUE(cache.loadOrdering(key, ordering, maxBagSize));
+
+    EXPECT_EQ((std::size_t)4, maxBagSize);
+
+    std::remove(("./" + key + ".ordering").c_str());
+}
+
+TEST(DecompositionCacheTest, CheckPreprocessedGraphRoundTrip)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    libraryInstance->setDecompositionCache(new htd::DecompositionCache("."));
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    graph.addVertices(30);
+
+    /* A 5x5 grid with a pendant path which is removed by the preprocessing. */
+    for (htd::vertex_t row = 0; row < 5; ++row)
+    {
+        for (htd::vertex_t column = 0; column < 5; ++column)
+        {
+            htd::vertex_t vertex = row * 5 + column + 1;
+
+            if (column < 4)
+            {
+                graph.addEdge(vertex, vertex + 1);
+            }
+
+            if (row < 4)
+            {
+                graph.addEdge(vertex, vertex + 5);
+            }
+        }
+    }
+
+    for (htd::vertex_t vertex = 25; vertex < 30; ++vertex)
+    {
+        graph.addEdge(vertex, vertex + 1);
+    }
+
+    std::string fileName = "./" + htd::DecompositionCache::computeKey(graph) + ".preprocessing-1111.preprocessed";
+
+    std::remove(fileName.c_str());
+
+    htd::GraphPreprocessor preprocessor(libraryInstance);
+
+    preprocessor.setPreprocessingStrategy(3);
+
+    htd::IPreprocessedGraph * preprocessedGraph1 = preprocessor.prepare(graph);
+
+    ASSERT_TRUE(std::ifstream(fileName).good());
+
+    htd::IPreprocessedGraph * preprocessedGraph2 = preprocessor.prepare(graph);
+
+    ASSERT_NE(preprocessedGraph1, nullptr);
+    ASSERT_NE(preprocessedGraph2, nullptr);
+
+    EXPECT_EQ(preprocessedGraph1->vertexNames(), preprocessedGraph2->vertexNames());
+    EXPECT_EQ(preprocessedGraph1->eliminationSequence(), preprocessedGraph2->eliminationSequence());
+    EXPECT_EQ(preprocessedGraph1->remainingVertices(), preprocessedGraph2->remainingVertices());
+    EXPECT_EQ(preprocessedGraph1->neighborhood(), preprocessedGraph2->neighborhood());
+    EXPECT_EQ(preprocessedGraph1->minTreeWidth(), preprocessedGraph2->minTreeWidth());
+    EXPECT_EQ(preprocessedGraph1->inputGraphEdgeCount(), preprocessedGraph2->inputGraphEdgeCount());
+    EXPECT_EQ(preprocessedGraph1->edgeCount(), preprocessedGraph2->edgeCount());
+
+    EXPECT_FALSE(preprocessedGraph1->eliminationSequence().empty());
+
+    delete preprocessedGraph1;
+    delete preprocessedGraph2;
+
+    std::remove(fileName.c_str());
+
+    delete libraryInstance;
+}
+
+TEST(DecompositionCacheTest, CheckSeededDecomposition)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    libraryInstance->setDecompositionCache(new htd::DecompositionCache("."));
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    addPath(graph, 5);
+
+    std::string key = htd::DecompositionCache::computeKey(graph);
+
+    std::remove(("./" + key + ".ordering").c_str());
+
+    /* Eliminating the middle vertex first leads to a bag of size 3. */
+    ASSERT_TRUE(libraryInstance->decompositionCache()->storeOrdering(key, std::vector<htd::vertex_t> { 3, 1, 2, 4, 5 }, 3));
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    algorithm.setOrderingAlgorithm(new htd::MinFillOrderingAlgorithm(libraryInstance));
+
+    htd::TreeDecompositionVerifier verifier;
+
+    htd::ITreeDecomposition * decomposition1 = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(decomposition1, nullptr);
+
+    ASSERT_TRUE(verifier.verify(graph, *decomposition1));
+
+    EXPECT_EQ((std::size_t)3, decomposition1->maximumBagSize());
+
+    htd::ITreeDecomposition * decomposition2 = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(decomposition2, nullptr);
+
+    ASSERT_TRUE(verifier.verify(graph, *decomposition2));
+
+    EXPECT_EQ((std::size_t)2, decomposition2->maximumBagSize());
+
+    std::vector<htd::vertex_t> ordering;
+
+    std::size_t maxBagSize = 0;
+
+    ASSERT_TRUE(libraryInstance->decompositionCache()->loadOrdering(key, ordering, maxBagSize));
+
+    EXPECT_EQ((std::size_t)2, maxBagSize);
+
+    EXPECT_EQ((std::size_t)5, ordering.size());
+
+    delete decomposition1;
+    delete decomposition2;
+
+    std::remove(("./" + key + ".ordering").c_str());
+
+    delete libraryInstance;
+}
+
+TEST(DecompositionCacheTest, CheckForeignOrderingEntry)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    addPath(graph, 5);
+
+    std::string key = htd::DecompositionCache::computeKey(graph);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    /* Both entries are well-formed, but they are no permutations of the vertices of the graph. */
+    std::vector<std::vector<htd::vertex_t>> orderings { { 1, 2, 3, 4, 1000000 }, { 1, 1, 2, 3, 4 } };
+
+    for (const std::vector<htd::vertex_t> & ordering : orderings)
+    {
+        {
+            std::ofstream stream("./" + key + ".ordering");
+
+            stream << "htd-ordering 1\n5 1\n";
+
+            for (htd::vertex_t vertex : ordering)
+            {
+                stream << vertex << ' ';
+            }
+
+            stream << '\n';
+        }
+
+        /* Each cache object hands out the stored ordering only once. */
+        libraryInstance->setDecompositionCache(new htd::DecompositionCache("."));
+
+        htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+        ASSERT_NE(decomposition, nullptr);
+
+        EXPECT_TRUE(verifier.verify(graph, *decomposition));
+
+        EXPECT_EQ((std::size_t)2, decomposition->maximumBagSize());
+
+        delete decomposition;
+    }
+
+    std::remove(("./" + key + ".ordering").c_str());
+
+    delete libraryInstance;
+}
+
+TEST(DecompositionCacheTest, CheckKeyOfCompressedSparseRowGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    addPath(graph, 4);
+
+    std::vector<std::size_t> offsets { 0, 1, 3, 5, 6 };
+
+    std::vector<htd::vertex_t> adjacency { 2, 1, 3, 2, 4, 3 };
+
+    htd::CompressedSparseRowGraph compressedGraph(libraryInstance, 4, offsets.data(), adjacency.data());
+
+    EXPECT_EQ(htd::DecompositionCache::computeKey(graph), htd::DecompositionCache::computeKey(compressedGraph));
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
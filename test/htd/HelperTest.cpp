@@ -26,6 +26,9 @@
 
 #include <htd/main.hpp>
 
+#include <algorithm>
+#include <iterator>
+#include <random>
 #include <vector>
 
 class HelperTest : public ::testing::Test
@@ -714,6 +717,113 @@ TEST(HelperTest, CheckSymmetricDifferenceSizes3)
     ASSERT_EQ((std::size_t)3, result.second);
 }
 
+std::vector<htd::vertex_t> createRandomSet(std::mt19937 & generator, std::size_t size, htd::vertex_t maximum)
+{
+    std::uniform_int_distribution<htd::vertex_t> distribution(1, maximum);
+
+    std::vector<htd::vertex_t> ret;
+
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        ret.push_back(distribution(generator));
+    }
+
+    std::sort(ret.begin(), ret.end());
+
+    ret.erase(std::unique(ret.begin(), ret.end()), ret.end());
+
+    return ret;
+}
+
+void checkSetKernels(const std::vector<htd::vertex_t> & input1, const std::vector<htd::vertex_t> & input2)
+{
+    std::vector<htd::vertex_t> expectedOnlySet1;
+    std::vector<htd::vertex_t> expectedOnlySet2;
+    std::vector<htd::vertex_t> expectedIntersection;
+
+    std::set_difference(input1.begin(), input1.end(), input2.begin(), input2.end(), std::back_inserter(expectedOnlySet1));
+    std::set_difference(input2.begin(), input2.end(), input1.begin(), input1.end(), std::back_inserter(expectedOnlySet2));
+    std::set_intersection(input1.begin(), input1.end(), input2.begin(), input2.end(), std::back_inserter(expectedIntersection));
+
+    ASSERT_EQ(expectedIntersection.size(), htd::set_intersection_size(input1.begin(), input1.end(), input2.begin(), input2.end()));
+    ASSERT_EQ(expectedOnlySet1.size(), htd::set_difference_size(input1.begin(), input1.end(), input2.begin(), input2.end()));
+    ASSERT_EQ(expectedOnlySet1.size() + input2.size(), htd::set_union_size(input1.begin(), input1.end(), input2.begin(), input2.end()));
+
+    std::vector<htd::vertex_t> actualDifference;
+    std::vector<htd::vertex_t> actualIntersection;
+
+    htd::set_difference(input1, input2, actualDifference);
+    htd::set_intersection(input1, input2, actualIntersection);
+
+    ASSERT_TRUE(actualDifference == expectedOnlySet1);
+    ASSERT_TRUE(actualIntersection == expectedIntersection);
+
+    std::vector<htd::vertex_t> actualOnlySet1;
+    std::vector<htd::vertex_t> actualOnlySet2;
+
+    actualIntersection.clear();
+
+    htd::decompose_sets(input1, input2, actualOnlySet1, actualOnlySet2, actualIntersection);
+
+    ASSERT_TRUE(actualOnlySet1 == expectedOnlySet1);
+    ASSERT_TRUE(actualOnlySet2 == expectedOnlySet2);
+    ASSERT_TRUE(actualIntersection == expectedIntersection);
+
+    const std::tuple<std::size_t, std::size_t, std::size_t> & analysis = htd::analyze_sets(input1, input2);
+
+    ASSERT_EQ(expectedOnlySet1.size(), std::get<0>(analysis));
+    ASSERT_EQ(expectedIntersection.size(), std::get<1>(analysis));
+    ASSERT_EQ(expectedOnlySet2.size(), std::get<2>(analysis));
+
+    const std::pair<std::size_t, std::size_t> & symmetricDifference = htd::symmetric_difference_sizes(input1, input2);
+
+    ASSERT_EQ(expectedOnlySet1.size(), symmetricDifference.first);
+    ASSERT_EQ(expectedOnlySet2.size(), symmetricDifference.second);
+}
+
+TEST(HelperTest, CheckSetKernelsAgainstReference)
+{
+    std::mt19937 generator(42);
+
+    for (std::size_t size1 = 0; size1 < 40; ++size1)
+    {
+        for (std::size_t size2 = 0; size2 < 40; ++size2)
+        {
+            checkSetKernels(createRandomSet(generator, size1, 64), createRandomSet(generator, size2, 64));
+        }
+    }
+
+    for (std::size_t iteration = 0; iteration < 200; ++iteration)
+    {
+        std::vector<htd::vertex_t> input1 = createRandomSet(generator, 1 + iteration * 7 % 500, 2000);
+        std::vector<htd::vertex_t> input2 = createRandomSet(generator, 1 + iteration * 13 % 700, 2000);
+
+        checkSetKernels(input1, input2);
+        checkSetKernels(input2, input1);
+        checkSetKernels(input1, input1);
+    }
+}
+
+TEST(HelperTest, CheckSetKernelsWithSkewedSizesAgainstReference)
+{
+    std::mt19937 generator(42);
+
+    for (std::size_t iteration = 0; iteration < 100; ++iteration)
+    {
+        std::vector<htd::vertex_t> input1 = createRandomSet(generator, 1 + iteration % 10, 10000);
+        std::vector<htd::vertex_t> input2 = createRandomSet(generator, 5000, 10000);
+
+        input1.insert(input1.end(), input2.begin() + iteration % 5, input2.begin() + iteration % 5 + iteration % 3);
+
+        std::sort(input1.begin(), input1.end());
+
+        input1.erase(std::unique(input1.begin(), input1.end()), input1.end());
+
+        checkSetKernels(input1, input2);
+        checkSetKernels(input2, input1);
+    }
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
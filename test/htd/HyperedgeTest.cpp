@@ -942,6 +942,38 @@ TEST(HyperedgeTest, CheckSetElements)
     ASSERT_EQ((htd::vertex_t)1, hyperedge1.sortedElements()[0]);
 }
 
+TEST(HyperedgeTest, CheckSortedElementStorage)
+{
+    htd::Hyperedge h1(1, 1, 2);
+
+    ASSERT_EQ(&(h1.elements()), &(h1.sortedElements()));
+
+    htd::Hyperedge h2(2, 2, 1);
+
+    ASSERT_NE(&(h2.elements()), &(h2.sortedElements()));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2 }), h2.sortedElements());
+
+    h2.setElements(std::vector<htd::vertex_t> { 3, 1, 3, 2 });
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3 }), h2.sortedElements());
+
+    h2.erase(3);
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2 }), h2.elements());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2 }), h2.sortedElements());
+    ASSERT_TRUE(h2.contains(2));
+    ASSERT_FALSE(h2.contains(3));
+
+    h2.setElements(1, 3);
+
+    ASSERT_EQ(&(h2.elements()), &(h2.sortedElements()));
+
+    htd::Hyperedge h3(h2);
+
+    ASSERT_EQ(&(h3.elements()), &(h3.sortedElements()));
+    ASSERT_EQ(h2, h3);
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -27,6 +27,7 @@
 #include <htd/main.hpp>
 
 #include <algorithm>
+#include <cstdlib>
 #include <unordered_set>
 #include <vector>
 
@@ -193,6 +194,68 @@ TEST(HypertreeDecompositionAlgorithmTest, CheckResultSimpleGraph)
     delete libraryInstance;
 }
 
+TEST(HypertreeDecompositionAlgorithmTest, CheckParallelCoveringEdges)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 40);
+
+    for (htd::vertex_t vertex = 1; vertex <= 40; ++vertex)
+    {
+        graph.addEdge(std::vector<htd::vertex_t> { vertex, (htd::vertex_t)(vertex % 40 + 1), (htd::vertex_t)((vertex * 7) % 40 + 1) });
+    }
+
+    htd::HypertreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::seedRandomNumberGenerator(1);
+
+    htd::IHypertreeDecomposition * decomposition1 = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(decomposition1, nullptr);
+
+    ASSERT_TRUE(isValidHypertreeDecomposition(graph, *decomposition1));
+
+    algorithm.setThreadCount(4);
+
+    EXPECT_EQ((std::size_t)4, algorithm.threadCount());
+
+    htd::HypertreeDecompositionAlgorithm * clonedAlgorithm = algorithm.clone();
+
+    EXPECT_EQ((std::size_t)4, clonedAlgorithm->threadCount());
+
+    htd::seedRandomNumberGenerator(1);
+
+    htd::IHypertreeDecomposition * decomposition2 = clonedAlgorithm->computeDecomposition(graph);
+
+    ASSERT_NE(decomposition2, nullptr);
+
+    ASSERT_TRUE(isValidHypertreeDecomposition(graph, *decomposition2));
+
+    ASSERT_EQ(decomposition1->vertexCount(), decomposition2->vertexCount());
+
+    for (htd::vertex_t vertex : decomposition1->vertices())
+    {
+        ASSERT_TRUE(decomposition2->isVertex(vertex));
+
+        EXPECT_EQ(decomposition1->bagContent(vertex), decomposition2->bagContent(vertex));
+
+        const std::vector<htd::Hyperedge> & coveringEdges1 = decomposition1->coveringEdges(vertex);
+        const std::vector<htd::Hyperedge> & coveringEdges2 = decomposition2->coveringEdges(vertex);
+
+        ASSERT_EQ(coveringEdges1.size(), coveringEdges2.size());
+
+        for (htd::index_t index = 0; index < coveringEdges1.size(); ++index)
+        {
+            EXPECT_EQ(coveringEdges1[index].id(), coveringEdges2[index].id());
+        }
+    }
+
+    delete decomposition1;
+    delete decomposition2;
+    delete clonedAlgorithm;
+    delete libraryInstance;
+}
+
 class BagSizeLabelingFunction : public htd::ILabelingFunction
 {
     public:
@@ -0,0 +1,230 @@
+/*
+ * File:   InstrumentationTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace htd_test
+{
+    struct SampleOperation
+    {
+
+    };
+}
+
+class InstrumentationTest : public ::testing::Test
+{
+    public:
+        InstrumentationTest(void)
+        {
+
+        }
+
+        virtual ~InstrumentationTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+TEST(InstrumentationTest, CheckDisabledByDefault)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    ASSERT_EQ(nullptr, libraryInstance->instrumentation());
+
+    {
+        htd::ScopedTimer timer(libraryInstance, "Test", "test");
+
+        ASSERT_EQ(nullptr, timer.instrumentation());
+    }
+
+    delete libraryInstance;
+}
+
+TEST(InstrumentationTest, CheckScopedTimer)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    libraryInstance->setInstrumentation(new htd::Instrumentation());
+
+    {
+        htd::ScopedTimer timer1(libraryInstance, "Outer", "test");
+
+        htd::ScopedTimer timer2(libraryInstance, typeid(htd_test::SampleOperation), "manipulation");
+    }
+
+    std::vector<htd::Instrumentation::Event> events = libraryInstance->instrumentation()->events();
+
+    ASSERT_EQ((std::size_t)2, events.size());
+
+    EXPECT_EQ("htd_test::SampleOperation", events[0].name);
+    EXPECT_EQ("manipulation", events[0].category);
+
+    EXPECT_EQ("Outer", events[1].name);
+    EXPECT_EQ("test", events[1].category);
+
+    EXPECT_LE(events[1].start, events[0].start);
+    EXPECT_GE(events[1].start + events[1].duration, events[0].start + events[0].duration);
+
+    delete libraryInstance;
+}
+
+TEST(InstrumentationTest, CheckOrderingCounters)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    libraryInstance->setInstrumentation(new htd::Instrumentation());
+
+    htd::MultiHypergraph graph(libraryInstance, 6);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(2, 3);
+    graph.addEdge(3, 4);
+    graph.addEdge(4, 5);
+    graph.addEdge(5, 6);
+    graph.addEdge(6, 1);
+
+    htd::MinFillOrderingAlgorithm algorithm(libraryInstance);
+
+    htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+
+    ASSERT_NE(nullptr, ordering);
+
+    const htd::Instrumentation & instrumentation = *(libraryInstance->instrumentation());
+
+    EXPECT_EQ((std::size_t)6, instrumentation.counter("Min-fill: Eliminated vertices"));
+    EXPECT_EQ((std::size_t)3, instrumentation.counter("Min-fill: Fill edges"));
+    EXPECT_LT((std::size_t)0, instrumentation.counter("Min-fill: Queue operations"));
+    EXPECT_EQ((std::size_t)0, instrumentation.counter("Unknown counter"));
+
+    delete ordering;
+
+    delete libraryInstance;
+}
+
+TEST(InstrumentationTest, CheckOutputFormats)
+{
+    htd::Instrumentation instrumentation;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    instrumentation.recordEvent("Phase \"A\"", "test", start, start + std::chrono::microseconds(42));
+
+    instrumentation.addCounter("Counter", 3);
+    instrumentation.addCounter("Counter", 4);
+
+    std::ostringstream csv;
+
+    instrumentation.writeCsv(csv);
+
+    std::istringstream csvLines(csv.str());
+
+    std::string line;
+
+    std::getline(csvLines, line);
+
+    EXPECT_EQ("type,name,category,thread,start_us,duration_us,value", line);
+
+    std::getline(csvLines, line);
+
+    EXPECT_EQ(0u, line.find("event,\"Phase \"\"A\"\"\",test,0,"));
+    EXPECT_NE(std::string::npos, line.find(",42.000,"));
+
+    std::getline(csvLines, line);
+
+    EXPECT_EQ("counter,Counter,counter,,,,7", line);
+
+    std::ostringstream json;
+
+    instrumentation.writeChromeTrace(json);
+
+    EXPECT_NE(std::string::npos, json.str().find("\"traceEvents\""));
+    EXPECT_NE(std::string::npos, json.str().find("\"name\":\"Phase \\\"A\\\"\""));
+    EXPECT_NE(std::string::npos, json.str().find("\"ph\":\"X\""));
+    EXPECT_NE(std::string::npos, json.str().find("\"ph\":\"C\""));
+    EXPECT_NE(std::string::npos, json.str().find("\"dur\":42.000"));
+}
+
+TEST(InstrumentationTest, CheckMerge)
+{
+    htd::Instrumentation instrumentation1;
+    htd::Instrumentation instrumentation2;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    instrumentation1.recordEvent("Event1", "test", start, start + std::chrono::microseconds(10));
+    instrumentation2.recordEvent("Event2", "test", start, start + std::chrono::microseconds(20));
+
+    instrumentation1.addCounter("Counter", 1);
+    instrumentation2.addCounter("Counter", 2);
+    instrumentation2.addCounter("Other", 5);
+
+    instrumentation1.merge(instrumentation2);
+
+    std::vector<htd::Instrumentation::Event> events = instrumentation1.events();
+
+    ASSERT_EQ((std::size_t)2, events.size());
+
+    EXPECT_EQ("Event1", events[0].name);
+    EXPECT_EQ("Event2", events[1].name);
+
+    EXPECT_NE(events[0].thread, events[1].thread);
+
+    EXPECT_EQ((std::size_t)3, instrumentation1.counter("Counter"));
+    EXPECT_EQ((std::size_t)5, instrumentation1.counter("Other"));
+
+    instrumentation1.clear();
+
+    EXPECT_EQ((std::size_t)0, instrumentation1.events().size());
+    EXPECT_EQ((std::size_t)0, instrumentation1.counters().size());
+}
+
+TEST(InstrumentationTest, CheckTypeName)
+{
+    EXPECT_EQ("htd_test::SampleOperation", htd::Instrumentation::typeName(typeid(htd_test::SampleOperation)));
+    EXPECT_EQ("htd::Instrumentation::Event", htd::Instrumentation::typeName(typeid(htd::Instrumentation::Event)));
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
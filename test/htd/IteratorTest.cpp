@@ -26,6 +26,7 @@
 
 #include <htd/main.hpp>
 
+#include <list>
 #include <utility>
 #include <vector>
 
@@ -259,6 +260,51 @@ TEST(IteratorTest, CheckConstCollectionWrapper2)
     ASSERT_TRUE(it1 == collection1.end());
 }
 
+TEST(IteratorTest, CheckConstCollectionContiguousStorage)
+{
+    std::vector<int> values { 1, 2, 3 };
+
+    htd::ConstCollection<int> collection1 = htd::ConstCollection<int>::getInstance(values);
+
+    ASSERT_TRUE(collection1.isContiguous());
+    ASSERT_EQ(values.data(), collection1.data());
+    ASSERT_EQ((std::size_t)3, collection1.size());
+    ASSERT_EQ(3, collection1[2]);
+
+    std::vector<int> result;
+
+    for (int value : collection1)
+    {
+        result.push_back(value);
+    }
+
+    ASSERT_EQ(values, result);
+
+    htd::ConstCollection<int> collection2(collection1.begin(), collection1.end());
+
+    ASSERT_TRUE(collection2.isContiguous());
+    ASSERT_EQ((std::size_t)3, collection2.size());
+    ASSERT_TRUE(collection1 == collection2);
+
+    std::list<int> list { 1, 2 };
+
+    collection2 = htd::ConstCollection<int>::getInstance(list);
+
+    ASSERT_FALSE(collection2.isContiguous());
+    ASSERT_EQ(nullptr, collection2.data());
+    ASSERT_EQ((std::size_t)2, collection2.size());
+    ASSERT_EQ(2, collection2[1]);
+    ASSERT_TRUE(collection1 != collection2);
+
+    std::vector<int> emptyValues;
+
+    htd::ConstCollection<int> collection3 = htd::ConstCollection<int>::getInstance(emptyValues);
+
+    ASSERT_TRUE(collection3.empty());
+    ASSERT_EQ((std::size_t)0, collection3.size());
+    ASSERT_TRUE(collection3.begin() == collection3.end());
+}
+
 TEST(IteratorTest, CheckConstIteratorCloneMethod1)
 {
     htd::ConstCollection<int> collection1;
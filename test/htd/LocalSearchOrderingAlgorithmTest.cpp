@@ -0,0 +1,237 @@
+/*
+ * File:   LocalSearchOrderingAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <vector>
+
+class LocalSearchOrderingAlgorithmTest : public ::testing::Test
+{
+    public:
+        LocalSearchOrderingAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~LocalSearchOrderingAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+std::size_t maximumBagSize(htd::MultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering)
+{
+    std::size_t ret = 0;
+
+    for (htd::vertex_t vertex : ordering)
+    {
+        std::vector<htd::vertex_t> neighbors(graph.neighbors(vertex).begin(), graph.neighbors(vertex).end());
+
+        ret = std::max(ret, neighbors.size() + 1);
+
+        for (htd::vertex_t neighbor1 : neighbors)
+        {
+            for (htd::vertex_t neighbor2 : neighbors)
+            {
+                if (neighbor1 < neighbor2 && !graph.isNeighbor(neighbor1, neighbor2))
+                {
+                    graph.addEdge(neighbor1, neighbor2);
+                }
+            }
+        }
+
+        graph.removeVertex(vertex);
+    }
+
+    return ret;
+}
+
+htd::MultiHypergraph * createStarGraph(const htd::LibraryInstance * const libraryInstance, std::size_t size)
+{
+    htd::MultiHypergraph * ret = new htd::MultiHypergraph(libraryInstance, size);
+
+    for (htd::vertex_t vertex = 2; vertex <= size; ++vertex)
+    {
+        ret->addEdge(1, vertex);
+    }
+
+    return ret;
+}
+
+TEST(LocalSearchOrderingAlgorithmTest, CheckCloneMethod)
+{
+    htd::LibraryInstance * libraryInstance1 = htd::createManagementInstance(htd::Id::FIRST);
+    htd::LibraryInstance * libraryInstance2 = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::LocalSearchOrderingAlgorithm algorithm(libraryInstance1);
+
+    ASSERT_EQ((std::size_t)1000, algorithm.stepCount());
+    ASSERT_EQ((std::size_t)1, algorithm.threadCount());
+
+    algorithm.setStepCount(50);
+    algorithm.setInitialTemperature(2.0);
+    algorithm.setThreadCount(3);
+
+    htd::LocalSearchOrderingAlgorithm * clonedAlgorithm = algorithm.clone();
+
+    ASSERT_EQ(libraryInstance1, algorithm.managementInstance());
+    ASSERT_EQ(libraryInstance1, clonedAlgorithm->managementInstance());
+
+    ASSERT_EQ((std::size_t)50, clonedAlgorithm->stepCount());
+    ASSERT_EQ(2.0, clonedAlgorithm->initialTemperature());
+    ASSERT_EQ((std::size_t)3, clonedAlgorithm->threadCount());
+
+    algorithm.setManagementInstance(libraryInstance2);
+
+    ASSERT_EQ(libraryInstance2, algorithm.managementInstance());
+    ASSERT_EQ(libraryInstance1, clonedAlgorithm->managementInstance());
+
+    delete libraryInstance1;
+    delete libraryInstance2;
+    delete clonedAlgorithm;
+}
+
+TEST(LocalSearchOrderingAlgorithmTest, CheckEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::LocalSearchOrderingAlgorithm algorithm(libraryInstance);
+
+    const htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+
+    ASSERT_TRUE(ordering->sequence().empty());
+    ASSERT_EQ((std::size_t)1, ordering->requiredIterations());
+
+    delete libraryInstance;
+    delete ordering;
+}
+
+TEST(LocalSearchOrderingAlgorithmTest, CheckSize1Graph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 1);
+
+    htd::LocalSearchOrderingAlgorithm algorithm(libraryInstance);
+
+    const htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+
+    ASSERT_EQ((std::size_t)1, ordering->sequence().size());
+    ASSERT_EQ((htd::vertex_t)1, ordering->sequence()[0]);
+
+    delete libraryInstance;
+    delete ordering;
+}
+
+TEST(LocalSearchOrderingAlgorithmTest, CheckImprovementOfNaturalOrdering)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph * graph = createStarGraph(libraryInstance, 12);
+
+    htd::LocalSearchOrderingAlgorithm algorithm(libraryInstance);
+
+    algorithm.setOrderingAlgorithm(new htd::NaturalOrderingAlgorithm(libraryInstance));
+
+    algorithm.setStepCount(2000);
+
+    htd::IWidthLimitedVertexOrdering * ordering = algorithm.computeOrdering(*graph, (std::size_t)-1, 1);
+
+    std::vector<htd::vertex_t> sequence(ordering->sequence());
+
+    ASSERT_EQ(graph->vertexCount(), sequence.size());
+
+    std::sort(sequence.begin(), sequence.end());
+
+    ASSERT_TRUE(std::adjacent_find(sequence.begin(), sequence.end()) == sequence.end());
+
+    ASSERT_EQ((std::size_t)2, ordering->maximumBagSize());
+
+    ASSERT_EQ(ordering->maximumBagSize(), maximumBagSize(*graph, ordering->sequence()));
+
+    delete graph;
+    delete ordering;
+    delete libraryInstance;
+}
+
+TEST(LocalSearchOrderingAlgorithmTest, CheckParallelSearch)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 25);
+
+    for (htd::vertex_t vertex = 1; vertex <= 25; ++vertex)
+    {
+        if (vertex % 5 != 0)
+        {
+            graph.addEdge(vertex, vertex + 1);
+        }
+
+        if (vertex <= 20)
+        {
+            graph.addEdge(vertex, vertex + 5);
+        }
+    }
+
+    htd::LocalSearchOrderingAlgorithm algorithm(libraryInstance);
+
+    algorithm.setOrderingAlgorithm(new htd::NaturalOrderingAlgorithm(libraryInstance));
+
+    algorithm.setStepCount(200);
+    algorithm.setInitialTemperature(0);
+    algorithm.setThreadCount(4);
+
+    htd::IWidthLimitedVertexOrdering * ordering = algorithm.computeOrdering(graph, (std::size_t)-1, 1);
+
+    ASSERT_EQ(graph.vertexCount(), ordering->sequence().size());
+
+    ASSERT_LE(ordering->maximumBagSize(), (std::size_t)6);
+
+    ASSERT_EQ(ordering->maximumBagSize(), maximumBagSize(graph, ordering->sequence()));
+
+    delete ordering;
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
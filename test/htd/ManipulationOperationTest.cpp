@@ -26,6 +26,8 @@
 
 #include <htd/main.hpp>
 
+#include <algorithm>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -3940,6 +3942,320 @@ TEST(ManipulationOperationTest, CheckPathDecompositionInducedSubgraphLabelingOpe
     delete libraryInstance;
 }
 
+TEST(ManipulationOperationTest, CheckTreeDecompositionInducedSubgraphLabelingOperationWithHyperedges)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 60);
+
+    std::size_t seed = 7;
+
+    for (htd::index_t index = 0; index < 150; ++index)
+    {
+        std::vector<htd::vertex_t> elements;
+
+        std::size_t size = 2 + index % 3;
+
+        for (htd::index_t position = 0; position < size; ++position)
+        {
+            seed = (seed * 1103515245 + 12345) % 2147483648;
+
+            elements.push_back(static_cast<htd::vertex_t>(1 + (seed >> 8) % 60));
+        }
+
+        graph.addEdge(elements);
+    }
+
+    htd::JoinNodeNormalizationOperation * normalizationOperation = new htd::JoinNodeNormalizationOperation(libraryInstance);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::IMutableTreeDecomposition * decomposition = dynamic_cast<htd::IMutableTreeDecomposition *>(algorithm.computeDecomposition(graph, { normalizationOperation }));
+
+    ASSERT_NE(decomposition, nullptr);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    ASSERT_TRUE(verifier.verify(graph, *decomposition));
+
+    htd::InducedSubgraphLabelingOperation operation(libraryInstance);
+
+    operation.apply(graph, *decomposition);
+
+    ASSERT_TRUE(isValidInducedEdgeLabel(graph, *decomposition, htd::InducedSubgraphLabelingOperation::INDUCED_SUBGRAPH_LABEL_IDENTIFIER));
+
+    for (htd::vertex_t vertex : decomposition->vertices())
+    {
+        const std::vector<htd::Hyperedge> & label =
+            htd::accessLabel<std::vector<htd::Hyperedge>>(decomposition->vertexLabel(htd::InducedSubgraphLabelingOperation::INDUCED_SUBGRAPH_LABEL_IDENTIFIER, vertex));
+
+        for (htd::index_t index = 1; index < label.size(); ++index)
+        {
+            EXPECT_LT(label[index - 1].id(), label[index].id());
+        }
+    }
+
+    delete decomposition;
+    delete libraryInstance;
+}
+
+void createRandomGraph(htd::MultiHypergraph & graph, std::size_t vertexCount, std::size_t edgeCount, std::size_t seed)
+{
+    for (htd::index_t index = 0; index < edgeCount; ++index)
+    {
+        seed = (seed * 1103515245 + 12345) % 2147483648;
+
+        htd::vertex_t vertex1 = static_cast<htd::vertex_t>(1 + (seed >> 8) % vertexCount);
+
+        seed = (seed * 1103515245 + 12345) % 2147483648;
+
+        htd::vertex_t vertex2 = static_cast<htd::vertex_t>(1 + (seed >> 8) % vertexCount);
+
+        if (vertex1 != vertex2)
+        {
+            graph.addEdge(vertex1, vertex2);
+        }
+    }
+}
+
+std::string canonicalRepresentation(const htd::ITreeDecomposition & decomposition, htd::vertex_t node)
+{
+    std::string ret = "[";
+
+    for (htd::vertex_t vertex : decomposition.bagContent(node))
+    {
+        ret += std::to_string(vertex) + " ";
+    }
+
+    std::vector<std::string> children;
+
+    for (htd::vertex_t child : decomposition.children(node))
+    {
+        children.push_back(canonicalRepresentation(decomposition, child));
+    }
+
+    std::sort(children.begin(), children.end());
+
+    for (const std::string & child : children)
+    {
+        ret += child;
+    }
+
+    return ret + "]";
+}
+
+TEST(ManipulationOperationTest, CheckFusedManipulationOperation)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 80);
+
+    createRandomGraph(graph, 80, 160, 3);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::IMutableTreeDecomposition * decomposition = dynamic_cast<htd::IMutableTreeDecomposition *>(algorithm.computeDecomposition(graph));
+
+    ASSERT_NE(decomposition, nullptr);
+
+    htd::FusedManipulationOperation operation(libraryInstance);
+
+    operation.addManipulationOperation(new htd::CompressionOperation(libraryInstance));
+    operation.addManipulationOperation(new htd::JoinNodeNormalizationOperation(libraryInstance));
+    operation.addManipulationOperation(new htd::LimitChildCountOperation(libraryInstance, 2));
+    operation.addManipulationOperation(new htd::AddEmptyLeavesOperation(libraryInstance));
+    operation.addManipulationOperation(new htd::AddEmptyRootOperation(libraryInstance));
+    operation.addManipulationOperation(new htd::InducedSubgraphLabelingOperation(libraryInstance));
+
+    EXPECT_EQ((std::size_t)2, operation.passCount());
+
+    EXPECT_TRUE(operation.isLocalOperation());
+    EXPECT_TRUE(operation.createsTreeNodes());
+    EXPECT_TRUE(operation.removesTreeNodes());
+
+    htd::FusedManipulationOperation * clonedOperation = operation.clone();
+
+    EXPECT_EQ((std::size_t)2, clonedOperation->passCount());
+
+    clonedOperation->apply(graph, *decomposition);
+
+    delete clonedOperation;
+
+    htd::TreeDecompositionVerifier verifier;
+
+    EXPECT_TRUE(verifier.verify(graph, *decomposition));
+
+    EXPECT_EQ((std::size_t)0, decomposition->bagSize(decomposition->root()));
+
+    for (htd::vertex_t vertex : decomposition->vertices())
+    {
+        EXPECT_LE(decomposition->childCount(vertex), (std::size_t)2);
+
+        if (decomposition->isLeaf(vertex))
+        {
+            EXPECT_EQ((std::size_t)0, decomposition->bagSize(vertex));
+        }
+
+        if (decomposition->isJoinNode(vertex))
+        {
+            for (htd::vertex_t child : decomposition->children(vertex))
+            {
+                EXPECT_EQ(decomposition->bagContent(vertex), decomposition->bagContent(child));
+            }
+        }
+    }
+
+    EXPECT_TRUE(isValidInducedEdgeLabel(graph, *decomposition, htd::InducedSubgraphLabelingOperation::INDUCED_SUBGRAPH_LABEL_IDENTIFIER));
+
+    delete decomposition;
+    delete libraryInstance;
+}
+
+TEST(ManipulationOperationTest, CheckFusedManipulationOperationAgainstSequentialApplication)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 80);
+
+    createRandomGraph(graph, 80, 160, 7);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::IMutableTreeDecomposition * fusedDecomposition = dynamic_cast<htd::IMutableTreeDecomposition *>(algorithm.computeDecomposition(graph));
+
+    ASSERT_NE(fusedDecomposition, nullptr);
+
+    htd::IMutableTreeDecomposition * sequentialDecomposition = fusedDecomposition->clone();
+
+    std::vector<htd::ITreeDecompositionManipulationOperation *> manipulationOperations;
+
+    manipulationOperations.push_back(new htd::CompressionOperation(libraryInstance));
+    manipulationOperations.push_back(new htd::JoinNodeNormalizationOperation(libraryInstance));
+    manipulationOperations.push_back(new htd::LimitChildCountOperation(libraryInstance, 2));
+    manipulationOperations.push_back(new htd::AddEmptyLeavesOperation(libraryInstance));
+    manipulationOperations.push_back(new htd::AddEmptyRootOperation(libraryInstance));
+    manipulationOperations.push_back(new htd::InducedSubgraphLabelingOperation(libraryInstance));
+
+    for (htd::ITreeDecompositionManipulationOperation * manipulationOperation : manipulationOperations)
+    {
+        manipulationOperation->apply(graph, *sequentialDecomposition);
+    }
+
+    htd::FusedManipulationOperation operation(libraryInstance, manipulationOperations);
+
+    operation.apply(graph, *fusedDecomposition);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    EXPECT_TRUE(verifier.verify(graph, *fusedDecomposition));
+    EXPECT_TRUE(verifier.verify(graph, *sequentialDecomposition));
+
+    EXPECT_EQ(sequentialDecomposition->vertexCount(), fusedDecomposition->vertexCount());
+
+    EXPECT_EQ(sequentialDecomposition->maximumBagSize(), fusedDecomposition->maximumBagSize());
+
+    EXPECT_EQ(canonicalRepresentation(*sequentialDecomposition, sequentialDecomposition->root()),
+              canonicalRepresentation(*fusedDecomposition, fusedDecomposition->root()));
+
+    EXPECT_TRUE(isValidInducedEdgeLabel(graph, *fusedDecomposition, htd::InducedSubgraphLabelingOperation::INDUCED_SUBGRAPH_LABEL_IDENTIFIER));
+
+    delete sequentialDecomposition;
+    delete fusedDecomposition;
+    delete libraryInstance;
+}
+
+TEST(ManipulationOperationTest, CheckWidthReductionOperationWithMultipleThreads)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 24);
+
+    std::size_t seed = 11;
+
+    for (htd::index_t index = 0; index < 40; ++index)
+    {
+        seed = (seed * 1103515245 + 12345) % 2147483648;
+
+        htd::vertex_t vertex1 = static_cast<htd::vertex_t>(1 + (seed >> 8) % 24);
+
+        seed = (seed * 1103515245 + 12345) % 2147483648;
+
+        htd::vertex_t vertex2 = static_cast<htd::vertex_t>(1 + (seed >> 8) % 24);
+
+        if (vertex1 != vertex2)
+        {
+            graph.addEdge(vertex1, vertex2);
+        }
+    }
+
+    htd::TreeDecompositionVerifier verifier;
+
+    std::vector<htd::IMutableTreeDecomposition *> decompositions;
+
+    for (std::size_t threadCount : { 1, 4 })
+    {
+        htd::TreeDecomposition decomposition(libraryInstance);
+
+        const htd::ConstCollection<htd::vertex_t> & graphVertices = graph.vertices();
+
+        htd::vertex_t root = decomposition.insertRoot(std::vector<htd::vertex_t>(graphVertices.begin(), graphVertices.end()), htd::FilteredHyperedgeCollection());
+
+        /* A star of overlapping bags leaves plenty of room for reducing the width. */
+        for (htd::index_t index = 0; index < 6; ++index)
+        {
+            std::vector<htd::vertex_t> bag;
+
+            for (htd::vertex_t vertex = static_cast<htd::vertex_t>(index * 4 + 1); vertex <= static_cast<htd::vertex_t>(index * 4 + 6) && vertex <= 24; ++vertex)
+            {
+                bag.push_back(vertex);
+            }
+
+            decomposition.addChild(root, std::move(bag), htd::FilteredHyperedgeCollection());
+        }
+
+        ASSERT_TRUE(verifier.verify(graph, decomposition));
+
+        htd::WidthReductionOperation operation(libraryInstance);
+
+        operation.setThreadCount(threadCount);
+
+        EXPECT_EQ(threadCount, operation.threadCount());
+
+        htd::WidthReductionOperation * clonedOperation = operation.clone();
+
+        EXPECT_EQ(threadCount, clonedOperation->threadCount());
+
+        clonedOperation->apply(graph, decomposition);
+
+        delete clonedOperation;
+
+        EXPECT_TRUE(verifier.verify(graph, decomposition));
+
+        EXPECT_LT(decomposition.maximumBagSize(), graph.vertexCount());
+
+        decompositions.push_back(decomposition.clone());
+    }
+
+    ASSERT_EQ(decompositions[0]->vertexCount(), decompositions[1]->vertexCount());
+
+    const htd::ConstCollection<htd::vertex_t> & vertices1 = decompositions[0]->vertices();
+    const htd::ConstCollection<htd::vertex_t> & vertices2 = decompositions[1]->vertices();
+
+    EXPECT_TRUE(std::equal(vertices1.begin(), vertices1.end(), vertices2.begin()));
+
+    for (htd::vertex_t vertex : vertices1)
+    {
+        EXPECT_EQ(decompositions[0]->bagContent(vertex), decompositions[1]->bagContent(vertex));
+    }
+
+    for (htd::IMutableTreeDecomposition * decomposition : decompositions)
+    {
+        delete decomposition;
+    }
+
+    delete libraryInstance;
+}
+
 TEST(ManipulationOperationTest, CheckTreeDecompositionCompressionOperation1)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
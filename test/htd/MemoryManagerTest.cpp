@@ -0,0 +1,325 @@
+/*
+ * File:   MemoryManagerTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+class MemoryManagerTest : public ::testing::Test
+{
+    public:
+        MemoryManagerTest(void)
+        {
+
+        }
+
+        virtual ~MemoryManagerTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+TEST(MemoryManagerTest, CheckMonotonicMemoryResource)
+{
+    htd::MonotonicMemoryResource resource(nullptr, 64);
+
+    ASSERT_EQ((std::size_t)0, resource.reservedBytes());
+
+    void * pointer1 = resource.allocate(3, 1);
+    void * pointer2 = resource.allocate(8, 8);
+    void * pointer3 = resource.allocate(100, 16);
+
+    EXPECT_EQ((std::uintptr_t)0, reinterpret_cast<std::uintptr_t>(pointer2) % 8);
+    EXPECT_EQ((std::uintptr_t)0, reinterpret_cast<std::uintptr_t>(pointer3) % 16);
+
+    EXPECT_GE(reinterpret_cast<char *>(pointer2), reinterpret_cast<char *>(pointer1) + 3);
+
+    EXPECT_EQ((std::size_t)(64 + 128), resource.reservedBytes());
+
+    resource.deallocate(pointer3, 100, 16);
+
+    resource.release();
+
+    EXPECT_EQ((std::size_t)0, resource.reservedBytes());
+}
+
+TEST(MemoryManagerTest, CheckPoolMemoryResource)
+{
+    htd::PoolMemoryResource resource(nullptr, 64, 4);
+
+    void * pointer1 = resource.allocate(24, 8);
+    void * pointer2 = resource.allocate(24, 8);
+
+    EXPECT_NE(pointer1, pointer2);
+
+    std::size_t reservedBytes = resource.reservedBytes();
+
+    EXPECT_LT((std::size_t)0, reservedBytes);
+
+    resource.deallocate(pointer1, 24, 8);
+
+    void * pointer3 = resource.allocate(20, 4);
+
+    EXPECT_EQ(pointer1, pointer3);
+
+    void * pointer4 = resource.allocate(1000, 8);
+
+    EXPECT_EQ(reservedBytes, resource.reservedBytes());
+
+    resource.deallocate(pointer4, 1000, 8);
+    resource.deallocate(pointer3, 20, 4);
+    resource.deallocate(pointer2, 24, 8);
+}
+
+TEST(MemoryManagerTest, CheckMemoryResourceAllocator)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    const htd::MemoryManager & memoryManager = libraryInstance->memoryManager();
+
+    std::shared_ptr<htd::IMemoryResource> resource = memoryManager.resource("test");
+
+    htd::MemoryResourceAllocator<int> allocator(resource.get());
+
+    {
+        std::vector<int, htd::MemoryResourceAllocator<int>> vector(allocator);
+
+        vector.reserve(100);
+
+        for (int index = 0; index < 100; ++index)
+        {
+            vector.push_back(index);
+        }
+
+        EXPECT_EQ(100 * sizeof(int), memoryManager.liveBytes("test"));
+        EXPECT_EQ(100 * sizeof(int), memoryManager.liveBytes());
+    }
+
+    EXPECT_EQ((std::size_t)0, memoryManager.liveBytes("test"));
+    EXPECT_EQ(100 * sizeof(int), memoryManager.peakBytes("test"));
+
+    EXPECT_EQ((std::size_t)0, memoryManager.liveBytes("unknown"));
+    EXPECT_EQ((std::size_t)0, memoryManager.peakBytes("unknown"));
+
+    std::vector<std::string> subsystems = memoryManager.subsystems();
+
+    EXPECT_NE(subsystems.end(), std::find(subsystems.begin(), subsystems.end(), "test"));
+    EXPECT_EQ(subsystems.end(), std::find(subsystems.begin(), subsystems.end(), "unknown"));
+
+    delete libraryInstance;
+}
+
+TEST(MemoryManagerTest, CheckTreeAccounting)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    const htd::MemoryManager & memoryManager = libraryInstance->memoryManager();
+
+    htd::Tree * tree = new htd::Tree(libraryInstance);
+
+    htd::vertex_t root = tree->insertRoot();
+
+    tree->addChild(root);
+    tree->addChild(root);
+
+    std::size_t liveBytes = memoryManager.liveBytes("tree");
+
+    EXPECT_LT((std::size_t)0, liveBytes);
+
+    htd::Tree * copy = tree->clone();
+
+    EXPECT_EQ(2 * liveBytes, memoryManager.liveBytes("tree"));
+
+    delete copy;
+
+    tree->removeSubtree(root);
+
+    EXPECT_EQ((std::size_t)0, memoryManager.liveBytes("tree"));
+    EXPECT_EQ(2 * liveBytes, memoryManager.peakBytes("tree"));
+
+    tree->insertRoot();
+
+    /* The tree may outlive the library instance. */
+    delete libraryInstance;
+
+    delete tree;
+}
+
+TEST(MemoryManagerTest, CheckCustomResource)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MonotonicMemoryResource * arena = new htd::MonotonicMemoryResource();
+
+    libraryInstance->memoryManager().setResource("ordering", arena);
+
+    htd::MultiHypergraph graph(libraryInstance, 5);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(2, 3);
+    graph.addEdge(3, 4);
+    graph.addEdge(4, 5);
+    graph.addEdge(5, 1);
+
+    htd::MinDegreeOrderingAlgorithm algorithm(libraryInstance);
+
+    htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+
+    ASSERT_NE(nullptr, ordering);
+
+    EXPECT_EQ((std::size_t)5, ordering->sequence().size());
+
+    EXPECT_LT((std::size_t)0, arena->reservedBytes());
+
+    EXPECT_EQ((std::size_t)0, libraryInstance->memoryManager().liveBytes("ordering"));
+    EXPECT_LT((std::size_t)0, libraryInstance->memoryManager().peakBytes("ordering"));
+
+    delete ordering;
+
+    delete libraryInstance;
+}
+
+TEST(MemoryManagerTest, CheckMemoryLimit)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MemoryManager & memoryManager = libraryInstance->memoryManager();
+
+    EXPECT_EQ((std::size_t)-1, memoryManager.memoryLimit());
+
+    memoryManager.setMemoryLimit(1024);
+
+    EXPECT_EQ((std::size_t)1024, memoryManager.memoryLimit());
+
+    std::shared_ptr<htd::IMemoryResource> resource = memoryManager.resource("test");
+
+    void * pointer1 = resource->allocate(1000, 8);
+
+    EXPECT_FALSE(libraryInstance->isTerminated());
+    EXPECT_FALSE(memoryManager.isMemoryLimitExceeded());
+
+    void * pointer2 = resource->allocate(1000, 8);
+
+    EXPECT_TRUE(libraryInstance->isTerminated());
+    EXPECT_TRUE(memoryManager.isMemoryLimitExceeded());
+
+    resource->deallocate(pointer2, 1000, 8);
+    resource->deallocate(pointer1, 1000, 8);
+
+    EXPECT_EQ((std::size_t)0, memoryManager.liveBytes());
+    EXPECT_EQ((std::size_t)2000, memoryManager.peakBytes());
+
+    delete libraryInstance;
+}
+
+TEST(MemoryManagerTest, CheckResourceReplacement)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MemoryManager & memoryManager = libraryInstance->memoryManager();
+
+    std::shared_ptr<htd::IMemoryResource> resource = memoryManager.resource("test");
+
+    void * pointer = resource->allocate(64, 8);
+
+    EXPECT_THROW(memoryManager.setResource("test", new htd::MonotonicMemoryResource()), std::logic_error);
+
+    resource->deallocate(pointer, 64, 8);
+
+    EXPECT_NO_THROW(memoryManager.setResource("test", new htd::PoolMemoryResource()));
+
+    std::atomic<bool> finished(false);
+
+    std::vector<std::thread> threads;
+
+    for (std::size_t index = 0; index < 4; ++index)
+    {
+        threads.emplace_back([&]()
+        {
+            for (std::size_t iteration = 0; iteration < 10000; ++iteration)
+            {
+                void * currentPointer = resource->allocate(32, 8);
+
+                std::fill((char *)currentPointer, (char *)currentPointer + 32, (char)iteration);
+
+                resource->deallocate(currentPointer, 32, 8);
+            }
+        });
+    }
+
+    std::thread replacementThread([&]()
+    {
+        while (!finished)
+        {
+            try
+            {
+                memoryManager.setResource("test", new htd::PoolMemoryResource());
+            }
+            catch (const std::logic_error &)
+            {
+
+            }
+        }
+    });
+
+    for (std::thread & thread : threads)
+    {
+        thread.join();
+    }
+
+    finished = true;
+
+    replacementThread.join();
+
+    EXPECT_EQ((std::size_t)0, memoryManager.liveBytes("test"));
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
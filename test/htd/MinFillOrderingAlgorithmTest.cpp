@@ -1296,6 +1296,108 @@ TEST(MinFillOrderingAlgorithmTest, CheckSize50Graph2)
     delete libraryInstance;
 }
 
+void createGridGraph(htd::MultiHypergraph & graph, std::size_t dimension)
+{
+    for (htd::vertex_t vertex = 1; vertex <= dimension * dimension; ++vertex)
+    {
+        if (vertex % dimension != 0)
+        {
+            graph.addEdge(vertex, vertex + 1);
+        }
+
+        if (vertex <= dimension * (dimension - 1))
+        {
+            graph.addEdge(vertex, vertex + dimension);
+        }
+    }
+}
+
+std::size_t eliminationBagSize(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering)
+{
+    std::size_t ret = 0;
+
+    htd::MultiHypergraph eliminationGraph(graph);
+
+    for (htd::vertex_t vertex : ordering)
+    {
+        std::vector<htd::vertex_t> neighbors(eliminationGraph.neighbors(vertex).begin(), eliminationGraph.neighbors(vertex).end());
+
+        ret = std::max(ret, neighbors.size() + 1);
+
+        for (htd::vertex_t neighbor1 : neighbors)
+        {
+            for (htd::vertex_t neighbor2 : neighbors)
+            {
+                if (neighbor1 < neighbor2 && !eliminationGraph.isNeighbor(neighbor1, neighbor2))
+                {
+                    eliminationGraph.addEdge(neighbor1, neighbor2);
+                }
+            }
+        }
+
+        eliminationGraph.removeVertex(vertex);
+    }
+
+    return ret;
+}
+
+TEST(MinFillOrderingAlgorithmTest, CheckWidthLimitedOrdering)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 49);
+
+    createGridGraph(graph, 7);
+
+    htd::MinFillOrderingAlgorithm algorithm(libraryInstance);
+
+    std::size_t minimumBagSize = (std::size_t)-1;
+
+    for (htd::index_t index = 0; index < 20; ++index)
+    {
+        htd::IWidthLimitedVertexOrdering * ordering = algorithm.computeOrdering(graph, (std::size_t)-1, 1);
+
+        ASSERT_EQ(eliminationBagSize(graph, ordering->sequence()), ordering->maximumBagSize());
+
+        minimumBagSize = std::min(minimumBagSize, ordering->maximumBagSize());
+
+        delete ordering;
+    }
+
+    htd::IWidthLimitedVertexOrdering * ordering = algorithm.computeOrdering(graph, minimumBagSize, 1000);
+
+    ASSERT_LE(ordering->requiredIterations(), (std::size_t)1000);
+
+    ASSERT_LE(ordering->maximumBagSize(), minimumBagSize);
+
+    ASSERT_EQ(graph.vertexCount(), ordering->sequence().size());
+
+    ASSERT_EQ(eliminationBagSize(graph, ordering->sequence()), ordering->maximumBagSize());
+
+    htd::MultiHypergraph graph1(graph);
+
+    ASSERT_TRUE(isValidOrdering(graph1, ordering->sequence()));
+
+    delete ordering;
+
+    ordering = algorithm.computeOrdering(graph, 3, 25);
+
+    ASSERT_EQ((std::size_t)25, ordering->requiredIterations());
+
+    ASSERT_GT(ordering->maximumBagSize(), (std::size_t)3);
+
+    ASSERT_LT(ordering->sequence().size(), graph.vertexCount());
+
+    ASSERT_EQ(eliminationBagSize(graph, ordering->sequence()), ordering->maximumBagSize());
+
+    htd::MultiHypergraph graph2(graph);
+
+    ASSERT_TRUE(isValidOrdering(graph2, ordering->sequence()));
+
+    delete ordering;
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
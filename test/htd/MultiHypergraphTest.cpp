@@ -353,6 +353,95 @@ TEST(MultiHypergraphTest, CheckSizeInitializedGraph2)
     delete libraryInstance;
 }
 
+TEST(MultiHypergraphTest, CheckCopyOnWriteClone)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph1(libraryInstance, 4);
+
+    graph1.addEdge(1, 2);
+    graph1.addEdge(std::vector<htd::vertex_t> { 2, 3, 4 });
+
+    htd::MultiHypergraph * graph2 = graph1.clone();
+
+    graph2->addEdge(1, 4);
+    graph2->removeVertex(3);
+
+    ASSERT_EQ((std::size_t)4, graph1.vertexCount());
+    ASSERT_EQ((std::size_t)2, graph1.edgeCount());
+    ASSERT_FALSE(graph1.isNeighbor(1, 4));
+    ASSERT_TRUE(graph1.isNeighbor(2, 3));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 2, 3, 4 }), graph1.hyperedgeAtPosition(1).elements());
+
+    ASSERT_EQ((std::size_t)3, graph2->vertexCount());
+    ASSERT_EQ((std::size_t)3, graph2->edgeCount());
+    ASSERT_TRUE(graph2->isNeighbor(1, 4));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 2, 4 }), graph2->hyperedgeAtPosition(1).elements());
+
+    htd::MultiHypergraph graph3(libraryInstance);
+
+    graph3 = *graph2;
+
+    delete graph2;
+
+    graph3.removeEdge(1);
+
+    ASSERT_EQ((std::size_t)2, graph3.edgeCount());
+    ASSERT_FALSE(graph3.isNeighbor(1, 2));
+    ASSERT_TRUE(graph1.isNeighbor(1, 2));
+
+    delete libraryInstance;
+}
+
+TEST(MultiHypergraphTest, CheckCopyOnWriteObserver)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph1(libraryInstance, 4);
+
+    graph1.addEdge(1, 2);
+    graph1.addEdge(std::vector<htd::vertex_t> { 2, 3, 4 });
+    graph1.addEdge(3, 4);
+
+    htd::FilteredHyperedgeCollection hyperedges = graph1.hyperedgesAtPositions(std::vector<htd::index_t> { 0, 1 });
+
+    htd::MultiHypergraph * graph2 = graph1.clone();
+
+    graph1.removeEdge(1);
+    graph1.addEdge(1, 3);
+
+    graph2->removeEdge(2);
+    graph2->addEdge(1, 4);
+
+    ASSERT_EQ((std::size_t)2, hyperedges.size());
+
+    auto it = hyperedges.begin();
+
+    ASSERT_EQ((htd::id_t)1, it->id());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2 }), it->elements());
+
+    ++it;
+
+    ASSERT_EQ((htd::id_t)2, it->id());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 2, 3, 4 }), it->elements());
+
+    ASSERT_EQ((std::size_t)3, graph1.edgeCount());
+    ASSERT_EQ((htd::id_t)2, graph1.hyperedgeAtPosition(0).id());
+
+    ASSERT_EQ((std::size_t)3, graph2->edgeCount());
+    ASSERT_EQ((htd::id_t)3, graph2->hyperedgeAtPosition(1).id());
+
+    delete graph2;
+
+    it = hyperedges.begin();
+
+    ++it;
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 2, 3, 4 }), it->elements());
+
+    delete libraryInstance;
+}
+
 TEST(MultiHypergraphTest, CheckSelfLoop)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
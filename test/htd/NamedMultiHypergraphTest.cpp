@@ -0,0 +1,153 @@
+/*
+ * File:   NamedMultiHypergraphTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <string>
+#include <vector>
+
+class NamedMultiHypergraphTest : public ::testing::Test
+{
+    public:
+        NamedMultiHypergraphTest(void)
+        {
+
+        }
+
+        virtual ~NamedMultiHypergraphTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+TEST(NamedMultiHypergraphTest, TestVertexNames)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::NamedMultiHypergraph<std::string, std::string> graph(libraryInstance);
+
+    htd::vertex_t vertex1 = graph.addVertex("a");
+    htd::vertex_t vertex2 = graph.addVertex("b");
+
+    ASSERT_EQ(vertex1, graph.addVertex("a"));
+
+    graph.addEdge(std::vector<std::string> { "a", "c", "b", "c" });
+
+    ASSERT_EQ((std::size_t)3, graph.vertexCount());
+    ASSERT_EQ((std::size_t)1, graph.edgeCount());
+
+    ASSERT_EQ("a", graph.vertexName(vertex1));
+    ASSERT_EQ("b", graph.vertexName(vertex2));
+    ASSERT_EQ("c", graph.vertexName(graph.lookupVertex("c")));
+
+    ASSERT_TRUE(graph.isVertexName("c"));
+    ASSERT_FALSE(graph.isVertexName("d"));
+
+    graph.setVertexName(vertex1, "d");
+
+    ASSERT_FALSE(graph.isVertexName("a"));
+    ASSERT_TRUE(graph.isVertexName("d"));
+    ASSERT_EQ(vertex1, graph.lookupVertex("d"));
+
+    graph.removeVertex("b");
+
+    ASSERT_FALSE(graph.isVertexName("b"));
+
+    htd::vertex_t vertex3 = graph.addVertex("e");
+
+    ASSERT_EQ("e", graph.vertexName(vertex3));
+    ASSERT_EQ("d", graph.vertexName(vertex1));
+
+    delete libraryInstance;
+}
+
+TEST(NamedMultiHypergraphTest, TestEdgeNames)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::NamedMultiHypergraph<std::string, std::string> graph(libraryInstance);
+
+    htd::id_t edgeId1 = graph.addEdge("a", "b", "e1");
+    htd::id_t edgeId2 = graph.addEdge(std::vector<std::string> { "b", "c", "d" }, "e2");
+
+    ASSERT_EQ(graph.lookupVertex("a") + 1, graph.lookupVertex("b"));
+
+    ASSERT_EQ("e1", graph.edgeName(edgeId1));
+    ASSERT_EQ("e2", graph.edgeName(edgeId2));
+    ASSERT_TRUE(graph.isEdgeName("e2"));
+
+    graph.removeEdge("e1");
+
+    ASSERT_FALSE(graph.isEdgeName("e1"));
+    ASSERT_TRUE(graph.isEdgeName("e2"));
+    ASSERT_EQ((std::size_t)1, graph.edgeCount());
+
+    delete libraryInstance;
+}
+
+TEST(NamedMultiHypergraphTest, TestCopiedNames)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::NamedMultiHypergraph<std::string, std::string> * graph = new htd::NamedMultiHypergraph<std::string, std::string>(libraryInstance);
+
+    graph->addEdge("a", "b", "e1");
+
+    htd::id_t edgeId = graph->addEdge("b", "c", "e2");
+
+    htd::NamedMultiHypergraph<std::string, std::string> copy(*graph);
+
+    delete graph;
+
+    ASSERT_EQ((std::size_t)3, copy.vertexCount());
+    ASSERT_EQ("a", copy.vertexName(copy.lookupVertex("a")));
+    ASSERT_EQ("c", copy.vertexName(copy.lookupVertex("c")));
+    ASSERT_EQ("e2", copy.edgeName(edgeId));
+
+    htd::vertex_t vertex = copy.addVertex("d");
+
+    ASSERT_EQ("d", copy.vertexName(vertex));
+    ASSERT_EQ(vertex, copy.lookupVertex("d"));
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
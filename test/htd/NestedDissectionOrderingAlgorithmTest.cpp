@@ -0,0 +1,229 @@
+/*
+ * File:   NestedDissectionOrderingAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <vector>
+
+class NestedDissectionOrderingAlgorithmTest : public ::testing::Test
+{
+    public:
+        NestedDissectionOrderingAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~NestedDissectionOrderingAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+htd::MultiHypergraph * createGridGraph(const htd::LibraryInstance * const libraryInstance, std::size_t rows, std::size_t columns)
+{
+    htd::MultiHypergraph * ret = new htd::MultiHypergraph(libraryInstance, rows * columns);
+
+    for (std::size_t row = 0; row < rows; ++row)
+    {
+        for (std::size_t column = 0; column < columns; ++column)
+        {
+            htd::vertex_t vertex = (htd::vertex_t)(row * columns + column + 1);
+
+            if (column + 1 < columns)
+            {
+                ret->addEdge(vertex, vertex + 1);
+            }
+
+            if (row + 1 < rows)
+            {
+                ret->addEdge(vertex, vertex + (htd::vertex_t)columns);
+            }
+        }
+    }
+
+    return ret;
+}
+
+bool isPermutation(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering)
+{
+    std::vector<htd::vertex_t> sortedOrdering(ordering);
+
+    std::sort(sortedOrdering.begin(), sortedOrdering.end());
+
+    std::vector<htd::vertex_t> vertices(graph.vertices().begin(), graph.vertices().end());
+
+    std::sort(vertices.begin(), vertices.end());
+
+    return sortedOrdering == vertices;
+}
+
+TEST(NestedDissectionOrderingAlgorithmTest, CheckCloneMethod)
+{
+    htd::LibraryInstance * libraryInstance1 = htd::createManagementInstance(htd::Id::FIRST);
+    htd::LibraryInstance * libraryInstance2 = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::NestedDissectionOrderingAlgorithm algorithm(libraryInstance1);
+
+    ASSERT_EQ((std::size_t)256, algorithm.leafSize());
+    ASSERT_EQ((std::size_t)1, algorithm.threadCount());
+
+    algorithm.setLeafSize(16);
+    algorithm.setThreadCount(4);
+
+    htd::NestedDissectionOrderingAlgorithm * clonedAlgorithm = algorithm.clone();
+
+    ASSERT_EQ(libraryInstance1, algorithm.managementInstance());
+    ASSERT_EQ(libraryInstance1, clonedAlgorithm->managementInstance());
+
+    ASSERT_EQ((std::size_t)16, clonedAlgorithm->leafSize());
+    ASSERT_EQ((std::size_t)4, clonedAlgorithm->threadCount());
+
+    algorithm.setManagementInstance(libraryInstance2);
+
+    ASSERT_EQ(libraryInstance2, algorithm.managementInstance());
+    ASSERT_EQ(libraryInstance1, clonedAlgorithm->managementInstance());
+
+    delete libraryInstance1;
+    delete libraryInstance2;
+    delete clonedAlgorithm;
+}
+
+TEST(NestedDissectionOrderingAlgorithmTest, CheckEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::NestedDissectionOrderingAlgorithm algorithm(libraryInstance);
+
+    const htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+
+    ASSERT_TRUE(ordering->sequence().empty());
+    ASSERT_EQ((std::size_t)1, ordering->requiredIterations());
+
+    delete libraryInstance;
+    delete ordering;
+}
+
+TEST(NestedDissectionOrderingAlgorithmTest, CheckSize1Graph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 1);
+
+    htd::NestedDissectionOrderingAlgorithm algorithm(libraryInstance);
+
+    const htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+
+    ASSERT_EQ((std::size_t)1, ordering->sequence().size());
+    ASSERT_EQ((htd::vertex_t)1, ordering->sequence()[0]);
+
+    delete libraryInstance;
+    delete ordering;
+}
+
+TEST(NestedDissectionOrderingAlgorithmTest, CheckDisconnectedGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 100);
+
+    for (htd::vertex_t vertex = 1; vertex < 60; ++vertex)
+    {
+        graph.addEdge(vertex, vertex + 1);
+    }
+
+    htd::NestedDissectionOrderingAlgorithm algorithm(libraryInstance);
+
+    algorithm.setLeafSize(8);
+
+    const htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+
+    ASSERT_TRUE(isPermutation(graph, ordering->sequence()));
+
+    delete libraryInstance;
+    delete ordering;
+}
+
+TEST(NestedDissectionOrderingAlgorithmTest, CheckGridGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph * graph = createGridGraph(libraryInstance, 40, 40);
+
+    for (std::size_t threadCount : { 1, 4 })
+    {
+        htd::NestedDissectionOrderingAlgorithm * orderingAlgorithm = new htd::NestedDissectionOrderingAlgorithm(libraryInstance);
+
+        orderingAlgorithm->setLeafSize(32);
+        orderingAlgorithm->setThreadCount(threadCount);
+
+        const htd::IVertexOrdering * ordering = orderingAlgorithm->computeOrdering(*graph);
+
+        ASSERT_TRUE(isPermutation(*graph, ordering->sequence()));
+
+        delete ordering;
+
+        htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+        algorithm.setOrderingAlgorithm(orderingAlgorithm);
+
+        htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(*graph);
+
+        ASSERT_NE(decomposition, nullptr);
+
+        htd::TreeDecompositionVerifier verifier;
+
+        ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+        /* The treewidth of the grid is 40, nested dissection guarantees a width within a small constant factor. */
+        ASSERT_LE(decomposition->maximumBagSize(), (std::size_t)120);
+
+        delete decomposition;
+    }
+
+    delete graph;
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
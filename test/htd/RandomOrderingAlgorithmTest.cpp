@@ -26,6 +26,7 @@
 
 #include <htd/main.hpp>
 
+#include <cstdlib>
 #include <vector>
 
 class RandomOrderingAlgorithmTest : public ::testing::Test
@@ -1230,6 +1231,32 @@ TEST(RandomOrderingAlgorithmTest, CheckSize50Graph2)
     delete libraryInstance;
 }
 
+TEST(RandomOrderingAlgorithmTest, CheckStandardSeedReproducibility)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 50);
+
+    htd::RandomOrderingAlgorithm algorithm(libraryInstance);
+
+    std::srand(1234);
+
+    const htd::IVertexOrdering * ordering1 = algorithm.computeOrdering(graph);
+
+    std::srand(1234);
+
+    const htd::IVertexOrdering * ordering2 = algorithm.computeOrdering(graph);
+
+    ASSERT_TRUE(isValidOrdering(graph, ordering1->sequence()));
+
+    ASSERT_EQ(ordering1->sequence(), ordering2->sequence());
+
+    delete ordering1;
+    delete ordering2;
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -285,6 +285,102 @@ TEST(SetCoverAlgorithmTest, CheckSetCoverAlgorithm5)
     delete values;
 }
 
+TEST(SetCoverAlgorithmTest, CheckSetCoverAlgorithmOptimality)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::SetCoverAlgorithm algorithm(libraryInstance);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        std::vector<htd::id_t> * values = createContainer(1, 20, 10, 15);
+
+        std::vector<std::vector<htd::id_t>> * containers = createContainers(1, 20, 12, 1, 6);
+
+        std::vector<htd::index_t> result;
+
+        algorithm.computeSetCover(*values, *containers, result);
+
+        ASSERT_TRUE(isValidSetCover(*values, *containers, result));
+
+        std::size_t minimumCoverSize = (std::size_t)-1;
+
+        for (std::size_t subset = 1; subset < ((std::size_t)1 << containers->size()); ++subset)
+        {
+            std::vector<htd::index_t> selection;
+
+            for (htd::index_t index = 0; index < containers->size(); ++index)
+            {
+                if ((subset >> index) & 1)
+                {
+                    selection.push_back(index);
+                }
+            }
+
+            std::vector<htd::vertex_t> * combinedValues = set_union(*containers, selection);
+
+            if (selection.size() < minimumCoverSize && std::includes(combinedValues->begin(), combinedValues->end(), values->begin(), values->end()))
+            {
+                minimumCoverSize = selection.size();
+            }
+
+            delete combinedValues;
+        }
+
+        if (minimumCoverSize != (std::size_t)-1)
+        {
+            EXPECT_EQ(minimumCoverSize, result.size());
+        }
+
+        EXPECT_TRUE(std::is_sorted(result.begin(), result.end()));
+
+        delete containers;
+        delete values;
+    }
+
+    delete libraryInstance;
+}
+
+TEST(SetCoverAlgorithmTest, CheckBitsetSetCoverWithLargeUniverse)
+{
+    std::vector<htd::id_t> values(200);
+
+    std::iota(values.begin(), values.end(), 1);
+
+    std::vector<std::vector<htd::id_t>> containers;
+
+    for (htd::id_t start = 1; start <= 200; start += 10)
+    {
+        std::vector<htd::id_t> container(20);
+
+        std::iota(container.begin(), container.end(), start);
+
+        containers.push_back(container);
+    }
+
+    containers.push_back(std::vector<htd::id_t> { 500, 501 });
+
+    htd::BitsetSetCover setCover(values, containers);
+
+    ASSERT_TRUE(setCover.isCoverable());
+
+    std::vector<htd::index_t> greedyResult;
+
+    setCover.computeGreedyCover(greedyResult);
+
+    ASSERT_TRUE(isValidSetCover(values, containers, greedyResult));
+
+    std::vector<htd::index_t> minimumResult;
+
+    setCover.computeMinimumCover(minimumResult);
+
+    ASSERT_TRUE(isValidSetCover(values, containers, minimumResult));
+
+    EXPECT_EQ((std::size_t)10, minimumResult.size());
+
+    EXPECT_LE(minimumResult.size(), greedyResult.size());
+}
+
 TEST(SetCoverAlgorithmTest, CheckGreedySetCoverAlgorithm1)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
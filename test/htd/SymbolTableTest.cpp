@@ -0,0 +1,181 @@
+/*
+ * File:   SymbolTableTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <string>
+#include <vector>
+
+class SymbolTableTest : public ::testing::Test
+{
+    public:
+        SymbolTableTest(void)
+        {
+
+        }
+
+        virtual ~SymbolTableTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+TEST(SymbolTableTest, TestGenericSymbols)
+{
+    htd::SymbolTable<int> symbolTable;
+
+    symbolTable.assign(1, 42);
+    symbolTable.assign(3, 7);
+
+    ASSERT_EQ((std::size_t)2, symbolTable.size());
+    ASSERT_TRUE(symbolTable.contains(1));
+    ASSERT_FALSE(symbolTable.contains(2));
+    ASSERT_EQ(42, symbolTable.symbol(1));
+    ASSERT_EQ((htd::id_t)3, symbolTable.identifier(7));
+
+    symbolTable.release(1);
+
+    ASSERT_FALSE(symbolTable.contains(1));
+    ASSERT_FALSE(symbolTable.containsSymbol(42));
+
+    symbolTable.assign(2, 43);
+
+    ASSERT_EQ(43, symbolTable.symbol(2));
+    ASSERT_EQ((std::size_t)2, symbolTable.size());
+}
+
+TEST(SymbolTableTest, TestStringSymbols)
+{
+    htd::SymbolTable<std::string> symbolTable;
+
+    std::vector<std::string> names;
+
+    for (htd::id_t identifier = 1; identifier <= 20000; ++identifier)
+    {
+        names.push_back("name_" + std::to_string(identifier));
+
+        symbolTable.assign(identifier, names.back());
+    }
+
+    htd::StringReference firstName = symbolTable.symbol(1);
+
+    std::string longName(100000, 'x');
+
+    symbolTable.assign(20001, longName);
+    symbolTable.assign(20002, "");
+
+    ASSERT_EQ((std::size_t)20002, symbolTable.size());
+    ASSERT_EQ("name_1", firstName);
+    ASSERT_EQ(longName, symbolTable.symbol(20001));
+    ASSERT_TRUE(symbolTable.contains(20002));
+    ASSERT_TRUE(symbolTable.symbol(20002).empty());
+    ASSERT_EQ((htd::id_t)20002, symbolTable.identifier(""));
+
+    for (htd::id_t identifier = 1; identifier <= 20000; ++identifier)
+    {
+        ASSERT_EQ(names[identifier - 1], symbolTable.symbol(identifier));
+        ASSERT_EQ(identifier, symbolTable.identifier(names[identifier - 1]));
+    }
+
+    htd::id_t result = 0;
+
+    ASSERT_FALSE(symbolTable.find("name_0", result));
+    ASSERT_TRUE(symbolTable.find("name_17", result));
+    ASSERT_EQ((htd::id_t)17, result);
+}
+
+TEST(SymbolTableTest, TestReleasedStringSymbols)
+{
+    htd::SymbolTable<std::string> symbolTable;
+
+    symbolTable.assign(1, "a");
+    symbolTable.assign(2, "b");
+
+    symbolTable.assign(1, "c");
+
+    ASSERT_EQ((std::size_t)2, symbolTable.size());
+    ASSERT_FALSE(symbolTable.containsSymbol("a"));
+    ASSERT_EQ("c", symbolTable.symbol(1));
+
+    symbolTable.release(2);
+
+    ASSERT_FALSE(symbolTable.contains(2));
+    ASSERT_FALSE(symbolTable.containsSymbol("b"));
+    ASSERT_THROW(symbolTable.symbol(2), std::out_of_range);
+
+    symbolTable.assign(3, "b");
+
+    ASSERT_EQ((htd::id_t)3, symbolTable.identifier("b"));
+
+    std::vector<htd::id_t> identifiers;
+
+    symbolTable.forEach([&](htd::id_t identifier, const htd::StringReference &) { identifiers.push_back(identifier); });
+
+    ASSERT_EQ(std::vector<htd::id_t>({ 1, 3 }), identifiers);
+}
+
+TEST(SymbolTableTest, TestCopiedStringSymbols)
+{
+    htd::SymbolTable<std::string> * symbolTable = new htd::SymbolTable<std::string>();
+
+    symbolTable->assign(1, "a");
+    symbolTable->assign(2, "");
+    symbolTable->assign(4, "d");
+
+    symbolTable->release(4);
+
+    htd::SymbolTable<std::string> copy(*symbolTable);
+
+    delete symbolTable;
+
+    ASSERT_EQ((std::size_t)2, copy.size());
+    ASSERT_EQ("a", copy.symbol(1));
+    ASSERT_EQ("", copy.symbol(2));
+    ASSERT_FALSE(copy.contains(4));
+
+    copy.assign(4, "e");
+
+    ASSERT_EQ("e", copy.symbol(4));
+    ASSERT_EQ((htd::id_t)4, copy.identifier("e"));
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
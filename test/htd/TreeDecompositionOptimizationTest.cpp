@@ -26,6 +26,7 @@
 
 #include <htd/main.hpp>
 
+#include <atomic>
 #include <vector>
 
 class TreeDecompositionOptimizationTest : public ::testing::Test
@@ -80,6 +81,53 @@ class FitnessFunction : public htd::ITreeDecompositionFitnessFunction
         }
 };
 
+class BoundedFitnessFunction : public htd::IBoundedTreeDecompositionFitnessFunction
+{
+    public:
+        BoundedFitnessFunction(void) : boundCount_(nullptr)
+        {
+
+        }
+
+        BoundedFitnessFunction(std::atomic<std::size_t> * boundCount) : boundCount_(boundCount)
+        {
+
+        }
+
+        ~BoundedFitnessFunction()
+        {
+
+        }
+
+        htd::FitnessEvaluation * fitness(const htd::IMultiHypergraph & graph,
+                                         const htd::ITreeDecomposition & decomposition) const
+        {
+            HTD_UNUSED(graph)
+
+            return new htd::FitnessEvaluation(1,
+                                              -(double)(decomposition.maximumBagSize()));
+        }
+
+        htd::FitnessEvaluation * fitnessBound(const htd::IMultiHypergraph & graph,
+                                              const htd::ITreeDecomposition & decomposition) const
+        {
+            if (boundCount_ != nullptr)
+            {
+                ++(*boundCount_);
+            }
+
+            return fitness(graph, decomposition);
+        }
+
+        BoundedFitnessFunction * clone(void) const
+        {
+            return new BoundedFitnessFunction(boundCount_);
+        }
+
+    private:
+        std::atomic<std::size_t> * boundCount_;
+};
+
 htd::IMultiHypergraph * createInputGraph(const htd::LibraryInstance * const libraryInstance)
 {
     htd::MultiHypergraph * graph = new htd::MultiHypergraph(libraryInstance, 50);
@@ -1902,6 +1950,144 @@ TEST(TreeDecompositionOptimizationTest, CheckCombinedWidthMinimizationResultComp
     delete libraryInstance;
 }
 
+TEST(TreeDecompositionOptimizationTest, CheckParallelIterativeImprovementWithFitnessBound)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    std::atomic<std::size_t> boundCount(0);
+
+    htd::IterativeImprovementTreeDecompositionAlgorithm algorithm(libraryInstance, new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance), new BoundedFitnessFunction(&boundCount));
+
+    htd::TreeDecompositionVerifier verifier;
+
+    algorithm.setIterationCount(25);
+    algorithm.setThreadCount(4);
+
+    ASSERT_EQ((std::size_t)4, algorithm.threadCount());
+
+    htd::IterativeImprovementTreeDecompositionAlgorithm * clonedAlgorithm = algorithm.clone();
+
+    ASSERT_EQ((std::size_t)4, clonedAlgorithm->threadCount());
+
+    delete clonedAlgorithm;
+
+    std::size_t evaluationCount = 0;
+    std::size_t minimalBagSize = (std::size_t)-1;
+
+    htd::ITreeDecomposition * decomposition =
+        algorithm.computeDecomposition(*graph,
+                                       [&](const htd::IMultiHypergraph & currentGraph, const htd::ITreeDecomposition & currentDecomposition, const htd::FitnessEvaluation & fitness){
+        ASSERT_EQ(graph, &currentGraph);
+
+        ASSERT_TRUE(verifier.verify(currentGraph, currentDecomposition));
+
+        std::size_t currentBagSize = currentDecomposition.maximumBagSize();
+
+        ASSERT_EQ(currentBagSize, (std::size_t)(-fitness.at(0)));
+
+        if (currentBagSize < minimalBagSize)
+        {
+            minimalBagSize = currentBagSize;
+        }
+
+        ++evaluationCount;
+    });
+
+    ASSERT_GE(evaluationCount, (std::size_t)1);
+    ASSERT_LE(evaluationCount, (std::size_t)25);
+
+    ASSERT_EQ((std::size_t)25, boundCount.load());
+
+    /* Each decomposition is either evaluated or pruned because its bound does not exceed the best fitness found so far. */
+    ASSERT_LT(evaluationCount, boundCount.load());
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+    ASSERT_EQ(minimalBagSize, decomposition->maximumBagSize());
+
+    delete graph;
+    delete decomposition;
+    delete libraryInstance;
+}
+
+void checkParallelRootSelection(const htd::LibraryInstance * const libraryInstance, htd::ITreeDecompositionManipulationOperation * manipulationOperation)
+{
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(*graph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    htd::IMutableTreeDecomposition & sequentialDecomposition = *(dynamic_cast<htd::IMutableTreeDecomposition *>(decomposition->clone()));
+    htd::IMutableTreeDecomposition & parallelDecomposition = *(dynamic_cast<htd::IMutableTreeDecomposition *>(decomposition->clone()));
+
+    htd::TreeDecompositionOptimizationOperation sequentialOperation(libraryInstance, new FitnessFunction());
+    htd::TreeDecompositionOptimizationOperation parallelOperation(libraryInstance, new FitnessFunction());
+
+    sequentialOperation.addManipulationOperation(manipulationOperation->clone());
+    parallelOperation.addManipulationOperation(manipulationOperation);
+
+    parallelOperation.setThreadCount(4);
+
+    ASSERT_EQ((std::size_t)1, sequentialOperation.threadCount());
+    ASSERT_EQ((std::size_t)4, parallelOperation.threadCount());
+
+    htd::TreeDecompositionOptimizationOperation * clonedOperation = parallelOperation.clone();
+
+    ASSERT_EQ((std::size_t)4, clonedOperation->threadCount());
+
+    delete clonedOperation;
+
+    BagSizeLabelingFunction labelingFunction(libraryInstance);
+
+    sequentialOperation.apply(*graph, sequentialDecomposition, { &labelingFunction });
+    parallelOperation.apply(*graph, parallelDecomposition, { &labelingFunction });
+
+    ASSERT_TRUE(verifier.verify(*graph, sequentialDecomposition));
+    ASSERT_TRUE(verifier.verify(*graph, parallelDecomposition));
+
+    ASSERT_EQ(sequentialDecomposition.root(), parallelDecomposition.root());
+    ASSERT_EQ(sequentialDecomposition.height(), parallelDecomposition.height());
+    ASSERT_EQ(sequentialDecomposition.vertexCount(), parallelDecomposition.vertexCount());
+    ASSERT_EQ(sequentialDecomposition.joinNodeCount(), parallelDecomposition.joinNodeCount());
+
+    for (htd::vertex_t vertex : parallelDecomposition.vertices())
+    {
+        ASSERT_EQ(parallelDecomposition.bagSize(vertex), htd::accessLabel<std::size_t>(parallelDecomposition.vertexLabel("BAG_SIZE", vertex)));
+    }
+
+    delete graph;
+    delete decomposition;
+    delete &sequentialDecomposition;
+    delete &parallelDecomposition;
+}
+
+TEST(TreeDecompositionOptimizationTest, CheckParallelRootSelectionWithLocalManipulationOperation)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    checkParallelRootSelection(libraryInstance, new htd::AddEmptyLeavesOperation(libraryInstance));
+
+    delete libraryInstance;
+}
+
+TEST(TreeDecompositionOptimizationTest, CheckParallelRootSelectionWithComplexManipulationOperation)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    checkParallelRootSelection(libraryInstance, new htd::JoinNodeReplacementOperation(libraryInstance));
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
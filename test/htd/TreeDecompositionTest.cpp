@@ -1001,6 +1001,38 @@ TEST(TreeDecompositionTest, CheckForgetNodeDetection)
     delete libraryInstance;
 }
 
+TEST(TreeDecompositionTest, CheckCloneBagContent)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::TreeDecomposition td1(libraryInstance);
+
+    htd::vertex_t root = td1.insertRoot(std::vector<htd::vertex_t> { 1, 2 }, htd::FilteredHyperedgeCollection());
+
+    std::vector<htd::vertex_t> & bag = td1.mutableBagContent(root);
+
+    htd::TreeDecomposition * td2 = td1.clone();
+
+    td2->mutableBagContent(root).push_back(3);
+
+    bag.push_back(4);
+
+    htd::vertex_t child = td2->addChild(root, std::vector<htd::vertex_t> { 3 }, htd::FilteredHyperedgeCollection());
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 4 }), td1.bagContent(root));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3 }), td2->bagContent(root));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 3 }), td2->bagContent(child));
+
+    ASSERT_EQ((std::size_t)1, td1.vertexCount());
+    ASSERT_EQ((std::size_t)2, td2->vertexCount());
+
+    delete td2;
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 4 }), td1.bagContent(root));
+
+    delete libraryInstance;
+}
+
 TEST(TreeDecompositionTest, CheckInducedHyperedges)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
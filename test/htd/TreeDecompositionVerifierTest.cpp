@@ -0,0 +1,187 @@
+/*
+ * File:   TreeDecompositionVerifierTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <vector>
+
+class TreeDecompositionVerifierTest : public ::testing::Test
+{
+    public:
+        TreeDecompositionVerifierTest(void)
+        {
+
+        }
+
+        virtual ~TreeDecompositionVerifierTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+TEST(TreeDecompositionVerifierTest, CheckValidDecomposition)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 5);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(std::vector<htd::vertex_t> { 2, 3, 4 });
+    graph.addEdge(4, 5);
+
+    htd::TreeDecomposition decomposition(libraryInstance);
+
+    htd::vertex_t root = decomposition.insertRoot(std::vector<htd::vertex_t> { 2, 3, 4 }, htd::FilteredHyperedgeCollection());
+
+    decomposition.addChild(root, std::vector<htd::vertex_t> { 1, 2 }, htd::FilteredHyperedgeCollection());
+    decomposition.addChild(root, std::vector<htd::vertex_t> { 4, 5 }, htd::FilteredHyperedgeCollection());
+
+    htd::TreeDecompositionVerifier verifier;
+
+    EXPECT_TRUE(verifier.verify(graph, decomposition));
+
+    EXPECT_TRUE(verifier.violationsVertexExistence(graph, decomposition).empty());
+    EXPECT_TRUE(verifier.violationsHyperedgeCoverage(graph, decomposition).empty());
+    EXPECT_TRUE(verifier.violationsConnectednessCriterion(graph, decomposition).empty());
+
+    delete libraryInstance;
+}
+
+TEST(TreeDecompositionVerifierTest, CheckViolations)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 6);
+
+    graph.addEdge(1, 2);
+    htd::id_t uncoveredEdge = graph.addEdge(std::vector<htd::vertex_t> { 2, 3, 4 });
+    graph.addEdge(4, 5);
+
+    htd::TreeDecomposition decomposition(libraryInstance);
+
+    htd::vertex_t root = decomposition.insertRoot(std::vector<htd::vertex_t> { 2, 3 }, htd::FilteredHyperedgeCollection());
+
+    htd::vertex_t child = decomposition.addChild(root, std::vector<htd::vertex_t> { 3, 4 }, htd::FilteredHyperedgeCollection());
+
+    decomposition.addChild(child, std::vector<htd::vertex_t> { 4, 5 }, htd::FilteredHyperedgeCollection());
+    decomposition.addChild(root, std::vector<htd::vertex_t> { 1, 2, 5 }, htd::FilteredHyperedgeCollection());
+
+    htd::TreeDecompositionVerifier verifier;
+
+    EXPECT_FALSE(verifier.verify(graph, decomposition));
+
+    htd::ConstCollection<htd::vertex_t> missingVertices = verifier.violationsVertexExistence(graph, decomposition);
+
+    ASSERT_EQ((std::size_t)1, missingVertices.size());
+    EXPECT_EQ((htd::vertex_t)6, missingVertices[0]);
+
+    htd::ConstCollection<htd::Hyperedge> missingEdges = verifier.violationsHyperedgeCoverage(graph, decomposition);
+
+    ASSERT_EQ((std::size_t)1, missingEdges.size());
+    EXPECT_EQ(uncoveredEdge, missingEdges[0].id());
+
+    htd::ConstCollection<htd::vertex_t> disconnectedVertices = verifier.violationsConnectednessCriterion(graph, decomposition);
+
+    ASSERT_EQ((std::size_t)1, disconnectedVertices.size());
+    EXPECT_EQ((htd::vertex_t)5, disconnectedVertices[0]);
+
+    delete libraryInstance;
+}
+
+TEST(TreeDecompositionVerifierTest, CheckLargeDecomposition)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    const std::size_t vertexCount = 3000;
+
+    const std::size_t bandWidth = 30;
+
+    htd::MultiHypergraph graph(libraryInstance, vertexCount);
+
+    for (htd::vertex_t vertex = 1; vertex <= vertexCount; ++vertex)
+    {
+        for (htd::vertex_t neighbor = vertex + 1; neighbor < vertex + bandWidth && neighbor <= vertexCount; ++neighbor)
+        {
+            graph.addEdge(vertex, neighbor);
+        }
+    }
+
+    htd::TreeDecomposition decomposition(libraryInstance);
+
+    htd::vertex_t node = htd::Vertex::UNKNOWN;
+
+    for (htd::vertex_t vertex = 1; vertex + bandWidth - 1 <= vertexCount; ++vertex)
+    {
+        std::vector<htd::vertex_t> bag;
+
+        for (htd::vertex_t element = vertex; element < vertex + bandWidth; ++element)
+        {
+            bag.push_back(element);
+        }
+
+        if (node == htd::Vertex::UNKNOWN)
+        {
+            node = decomposition.insertRoot(bag, htd::FilteredHyperedgeCollection());
+        }
+        else
+        {
+            node = decomposition.addChild(node, bag, htd::FilteredHyperedgeCollection());
+        }
+    }
+
+    htd::TreeDecompositionVerifier verifier;
+
+    EXPECT_TRUE(verifier.verify(graph, decomposition));
+
+    std::vector<htd::vertex_t> & bag = decomposition.mutableBagContent(decomposition.vertexAtPosition(1000));
+
+    bag.erase(bag.begin() + bandWidth / 2);
+
+    EXPECT_FALSE(verifier.verify(graph, decomposition));
+
+    EXPECT_TRUE(verifier.violationsVertexExistence(graph, decomposition).empty());
+    EXPECT_TRUE(verifier.violationsHyperedgeCoverage(graph, decomposition).empty());
+    EXPECT_EQ((std::size_t)1, verifier.violationsConnectednessCriterion(graph, decomposition).size());
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -692,6 +692,104 @@ TEST(TreeTest, CheckMakeRootFunctionality1)
     delete libraryInstance;
 }
 
+TEST(TreeTest, CheckTemplatedTraversals)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::Tree tree(libraryInstance);
+
+    htd::vertex_t node1 = tree.insertRoot();
+    htd::vertex_t node2 = tree.addChild(node1);
+    htd::vertex_t node3 = tree.addChild(node1);
+    htd::vertex_t node4 = tree.addChild(node2);
+    htd::vertex_t node5 = tree.addChild(node2);
+    htd::vertex_t node6 = tree.addChild(node3);
+
+    std::vector<htd::vertex_t> vertices;
+    std::vector<htd::vertex_t> parents;
+    std::vector<std::size_t> distances;
+
+    auto record = [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distance)
+    {
+        vertices.push_back(vertex);
+        parents.push_back(parent);
+        distances.push_back(distance);
+    };
+
+    htd::TreeTraversal::preOrder(tree, record);
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ node1, node2, node4, node5, node3, node6 }), vertices);
+    EXPECT_EQ(std::vector<htd::vertex_t>({ htd::Vertex::UNKNOWN, node1, node2, node2, node1, node3 }), parents);
+    EXPECT_EQ(std::vector<std::size_t>({ 0, 1, 2, 2, 1, 2 }), distances);
+
+    vertices.clear();
+    parents.clear();
+    distances.clear();
+
+    htd::TreeTraversal::postOrder(tree, record);
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ node6, node3, node5, node4, node2, node1 }), vertices);
+    EXPECT_EQ(std::vector<htd::vertex_t>({ node3, node1, node2, node2, node1, htd::Vertex::UNKNOWN }), parents);
+    EXPECT_EQ(std::vector<std::size_t>({ 2, 1, 2, 2, 1, 0 }), distances);
+
+    vertices.clear();
+    parents.clear();
+    distances.clear();
+
+    htd::TreeTraversal::levelOrder(tree, record, node2);
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ node2, node4, node5 }), vertices);
+    EXPECT_EQ(std::vector<htd::vertex_t>({ htd::Vertex::UNKNOWN, node2, node2 }), parents);
+    EXPECT_EQ(std::vector<std::size_t>({ 0, 1, 1 }), distances);
+
+    std::vector<htd::vertex_t> expectedPostOrder;
+
+    htd::PostOrderTreeTraversal traversal;
+
+    traversal.traverse(tree, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distance)
+    {
+        HTD_UNUSED(parent)
+        HTD_UNUSED(distance)
+
+        expectedPostOrder.push_back(vertex);
+    }, node1);
+
+    htd::Path path(libraryInstance);
+
+    htd::vertex_t pathNode1 = path.insertRoot();
+    htd::vertex_t pathNode2 = path.addChild(pathNode1);
+    htd::vertex_t pathNode3 = path.addChild(pathNode2);
+
+    vertices.clear();
+    parents.clear();
+    distances.clear();
+
+    htd::TreeTraversal::postOrder(path, record);
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ pathNode3, pathNode2, pathNode1 }), vertices);
+    EXPECT_EQ(std::vector<std::size_t>({ 2, 1, 0 }), distances);
+
+    htd::TreeTraversal::postOrder(tree, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t distance)
+    {
+        HTD_UNUSED(distance)
+
+        EXPECT_EQ(expectedPostOrder.front(), vertex);
+
+        expectedPostOrder.erase(expectedPostOrder.begin());
+
+        if (parent != htd::Vertex::UNKNOWN)
+        {
+            tree.removeVertex(vertex);
+        }
+    });
+
+    EXPECT_TRUE(expectedPostOrder.empty());
+
+    EXPECT_EQ((std::size_t)1, tree.vertexCount());
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
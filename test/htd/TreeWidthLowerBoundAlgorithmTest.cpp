@@ -0,0 +1,320 @@
+/*
+ * File:   TreeWidthLowerBoundAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <random>
+#include <vector>
+
+class TreeWidthLowerBoundAlgorithmTest : public ::testing::Test
+{
+    public:
+        TreeWidthLowerBoundAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~TreeWidthLowerBoundAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+void addGridEdges(htd::MultiHypergraph & graph, std::size_t rows, std::size_t columns)
+{
+    for (std::size_t row = 0; row < rows; ++row)
+    {
+        for (std::size_t column = 0; column < columns; ++column)
+        {
+            htd::vertex_t vertex = static_cast<htd::vertex_t>(row * columns + column + 1);
+
+            if (column + 1 < columns)
+            {
+                graph.addEdge(vertex, vertex + 1);
+            }
+
+            if (row + 1 < rows)
+            {
+                graph.addEdge(vertex, static_cast<htd::vertex_t>(vertex + columns));
+            }
+        }
+    }
+}
+
+TEST(TreeWidthLowerBoundAlgorithmTest, CheckCloneMethod)
+{
+    htd::LibraryInstance * libraryInstance1 = htd::createManagementInstance(htd::Id::FIRST);
+    htd::LibraryInstance * libraryInstance2 = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::TreeWidthLowerBoundAlgorithm algorithm(libraryInstance1);
+
+    algorithm.setImprovedGraphEnabled(false);
+
+    htd::TreeWidthLowerBoundAlgorithm * clonedAlgorithm = algorithm.clone();
+
+    ASSERT_FALSE(clonedAlgorithm->isImprovedGraphEnabled());
+    ASSERT_TRUE(clonedAlgorithm->isMinorMinWidthEnabled());
+    ASSERT_TRUE(clonedAlgorithm->isLeastCommonNeighborContractionEnabled());
+
+    algorithm.setManagementInstance(libraryInstance2);
+
+    ASSERT_EQ(libraryInstance2, algorithm.managementInstance());
+    ASSERT_EQ(libraryInstance1, clonedAlgorithm->managementInstance());
+
+    delete clonedAlgorithm;
+    delete libraryInstance1;
+    delete libraryInstance2;
+}
+
+TEST(TreeWidthLowerBoundAlgorithmTest, CheckSimpleGraphs)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::TreeWidthLowerBoundAlgorithm algorithm(libraryInstance);
+
+    htd::MultiHypergraph emptyGraph(libraryInstance);
+
+    ASSERT_EQ((std::size_t)0, algorithm.computeLowerBound(emptyGraph));
+
+    htd::MultiHypergraph path(libraryInstance, 4);
+
+    path.addEdge(1, 2);
+    path.addEdge(2, 3);
+    path.addEdge(3, 4);
+
+    ASSERT_EQ((std::size_t)1, algorithm.computeLowerBound(path));
+
+    htd::MultiHypergraph cycle(libraryInstance, 6);
+
+    for (htd::vertex_t vertex = 1; vertex <= 6; ++vertex)
+    {
+        cycle.addEdge(vertex, vertex % 6 + 1);
+    }
+
+    ASSERT_EQ((std::size_t)2, algorithm.computeLowerBound(cycle));
+
+    htd::MultiHypergraph completeGraph(libraryInstance, 7);
+
+    for (htd::vertex_t vertex1 = 1; vertex1 <= 7; ++vertex1)
+    {
+        for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 <= 7; ++vertex2)
+        {
+            completeGraph.addEdge(vertex1, vertex2);
+        }
+    }
+
+    ASSERT_EQ((std::size_t)6, algorithm.computeLowerBound(completeGraph));
+
+    delete libraryInstance;
+}
+
+TEST(TreeWidthLowerBoundAlgorithmTest, CheckGridGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 36);
+
+    addGridEdges(graph, 6, 6);
+
+    htd::GraphPreprocessor preprocessor(libraryInstance);
+
+    preprocessor.setPreprocessingStrategy(0);
+
+    htd::IPreprocessedGraph * preprocessedGraph = preprocessor.prepare(graph);
+
+    htd::TreeWidthLowerBoundAlgorithm algorithm(libraryInstance);
+
+    algorithm.setMinorMinWidthEnabled(false);
+    algorithm.setLeastCommonNeighborContractionEnabled(false);
+
+    ASSERT_EQ((std::size_t)0, algorithm.computeLowerBound(*preprocessedGraph));
+
+    algorithm.setMinorMinWidthEnabled(true);
+    algorithm.setImprovedGraphEnabled(false);
+
+    std::size_t minorMinWidth = algorithm.computeLowerBound(*preprocessedGraph);
+
+    algorithm.setLeastCommonNeighborContractionEnabled(true);
+
+    std::size_t contractionBound = algorithm.computeLowerBound(*preprocessedGraph);
+
+    algorithm.setImprovedGraphEnabled(true);
+
+    std::size_t improvedBound = algorithm.computeLowerBound(*preprocessedGraph);
+
+    ASSERT_LE((std::size_t)3, minorMinWidth);
+    ASSERT_LE(minorMinWidth, contractionBound);
+    ASSERT_LE(contractionBound, improvedBound);
+    ASSERT_GE((std::size_t)6, improvedBound);
+
+    ASSERT_EQ((std::size_t)2, algorithm.computeLowerBound(*preprocessedGraph, 2));
+
+    delete preprocessedGraph;
+    delete libraryInstance;
+}
+
+TEST(TreeWidthLowerBoundAlgorithmTest, CheckRandomGraphs)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::mt19937 generator(42);
+
+    htd::TreeWidthLowerBoundAlgorithm algorithm(libraryInstance);
+
+    htd::WidthMinimizingTreeDecompositionAlgorithm decompositionAlgorithm(libraryInstance);
+
+    decompositionAlgorithm.setIterationCount(10);
+
+    for (std::size_t round = 0; round < 20; ++round)
+    {
+        htd::MultiHypergraph graph(libraryInstance, 30);
+
+        std::uniform_int_distribution<htd::vertex_t> distribution(1, 30);
+
+        for (std::size_t edge = 0; edge < 20 + round * 5; ++edge)
+        {
+            htd::vertex_t vertex1 = distribution(generator);
+            htd::vertex_t vertex2 = distribution(generator);
+
+            if (vertex1 != vertex2)
+            {
+                graph.addEdge(vertex1, vertex2);
+            }
+        }
+
+        htd::ITreeDecomposition * decomposition = decompositionAlgorithm.computeDecomposition(graph);
+
+        ASSERT_NE(decomposition, nullptr);
+
+        ASSERT_LE(algorithm.computeLowerBound(graph) + 1, decomposition->maximumBagSize());
+
+        delete decomposition;
+    }
+
+    delete libraryInstance;
+}
+
+TEST(TreeWidthLowerBoundAlgorithmTest, CheckLowerBoundTermination)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 8);
+
+    for (htd::vertex_t vertex1 = 1; vertex1 <= 8; ++vertex1)
+    {
+        for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 <= 8; ++vertex2)
+        {
+            if (vertex2 != vertex1 + 4)
+            {
+                graph.addEdge(vertex1, vertex2);
+            }
+        }
+    }
+
+    htd::WidthMinimizingTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    ASSERT_TRUE(algorithm.isLowerBoundTerminationEnabled());
+
+    /* The algorithm would never terminate without the lower bound since the number of iterations is unlimited. */
+    algorithm.setIterationCount(0);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_EQ((std::size_t)7, decomposition->maximumBagSize());
+
+    delete decomposition;
+
+    htd::CombinedWidthMinimizingTreeDecompositionAlgorithm combinedAlgorithm(libraryInstance);
+
+    combinedAlgorithm.addDecompositionAlgorithm(algorithm.clone());
+    combinedAlgorithm.addDecompositionAlgorithm(algorithm.clone());
+
+    decomposition = combinedAlgorithm.computeDecomposition(graph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_EQ((std::size_t)7, decomposition->maximumBagSize());
+
+    delete decomposition;
+    delete libraryInstance;
+}
+
+TEST(TreeWidthLowerBoundAlgorithmTest, CheckOptimalityTest)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 8);
+
+    for (htd::vertex_t vertex1 = 1; vertex1 <= 8; ++vertex1)
+    {
+        for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 <= 8; ++vertex2)
+        {
+            if (vertex2 != vertex1 + 4)
+            {
+                graph.addEdge(vertex1, vertex2);
+            }
+        }
+    }
+
+    htd::GraphPreprocessor preprocessor(libraryInstance);
+
+    preprocessor.setPreprocessingStrategy(0);
+
+    htd::IPreprocessedGraph * preprocessedGraph = preprocessor.prepare(graph);
+
+    std::size_t lowerBound = (std::size_t)-1;
+
+    ASSERT_FALSE(htd::TreeWidthLowerBoundAlgorithm::isOptimal(libraryInstance, *preprocessedGraph, 8, lowerBound));
+
+    ASSERT_EQ((std::size_t)6, lowerBound);
+
+    ASSERT_TRUE(htd::TreeWidthLowerBoundAlgorithm::isOptimal(libraryInstance, *preprocessedGraph, 7, lowerBound));
+
+    ASSERT_EQ((std::size_t)6, lowerBound);
+
+    delete preprocessedGraph;
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,251 @@
+/*
+ * File:   WorkspaceTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <thread>
+#include <vector>
+
+class WorkspaceTest : public ::testing::Test
+{
+    public:
+        WorkspaceTest(void)
+        {
+
+        }
+
+        virtual ~WorkspaceTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+TEST(WorkspaceTest, CheckVisitMarks)
+{
+    htd::Workspace workspace;
+
+    workspace.beginVisit(4);
+
+    EXPECT_FALSE(workspace.isVisited(1));
+    EXPECT_FALSE(workspace.isVisited(100));
+
+    EXPECT_TRUE(workspace.visit(1));
+    EXPECT_FALSE(workspace.visit(1));
+    EXPECT_TRUE(workspace.visit(100));
+
+    EXPECT_TRUE(workspace.isVisited(1));
+    EXPECT_TRUE(workspace.isVisited(100));
+    EXPECT_FALSE(workspace.isVisited(2));
+
+    workspace.beginVisit();
+
+    EXPECT_FALSE(workspace.isVisited(1));
+    EXPECT_FALSE(workspace.isVisited(100));
+
+    EXPECT_TRUE(workspace.visit(100));
+    EXPECT_TRUE(workspace.isVisited(100));
+}
+
+TEST(WorkspaceTest, CheckBuffers)
+{
+    htd::Workspace workspace;
+
+    EXPECT_EQ((std::size_t)0, workspace.bufferCount());
+
+    std::vector<htd::vertex_t> & buffer1 = workspace.buffer<htd::vertex_t>();
+    std::vector<htd::vertex_t> & buffer2 = workspace.buffer<htd::vertex_t>(1);
+    std::vector<double> & buffer3 = workspace.buffer<double>();
+
+    EXPECT_EQ((std::size_t)3, workspace.bufferCount());
+
+    EXPECT_NE(&buffer1, &buffer2);
+
+    buffer1.push_back(1);
+    buffer1.push_back(2);
+
+    buffer3.push_back(1.5);
+
+    EXPECT_EQ(&buffer1, &(workspace.buffer<htd::vertex_t>()));
+
+    EXPECT_EQ((std::size_t)2, workspace.buffer<htd::vertex_t>().size());
+    EXPECT_EQ((std::size_t)0, workspace.buffer<htd::vertex_t>(1).size());
+    EXPECT_EQ((std::size_t)1, workspace.buffer<double>().size());
+
+    EXPECT_EQ((std::size_t)3, workspace.bufferCount());
+}
+
+TEST(WorkspaceTest, CheckPool)
+{
+    htd::Workspace::releaseIdleWorkspaces();
+
+    EXPECT_EQ((std::size_t)0, htd::Workspace::idleWorkspaceCount());
+
+    htd::Workspace * outerWorkspace = nullptr;
+
+    {
+        htd::ScopedWorkspace workspace1;
+
+        outerWorkspace = &(*workspace1);
+
+        outerWorkspace->buffer<int>().push_back(42);
+
+        {
+            htd::ScopedWorkspace workspace2;
+
+            EXPECT_NE(outerWorkspace, &(*workspace2));
+        }
+
+        EXPECT_EQ((std::size_t)1, htd::Workspace::idleWorkspaceCount());
+    }
+
+    EXPECT_EQ((std::size_t)2, htd::Workspace::idleWorkspaceCount());
+
+    {
+        htd::ScopedWorkspace workspace;
+
+        EXPECT_EQ(outerWorkspace, &(*workspace));
+
+        EXPECT_EQ((std::size_t)1, workspace->buffer<int>().size());
+    }
+
+    std::size_t otherThreadIdleWorkspaceCount = 0;
+
+    std::thread thread([&]()
+    {
+        htd::ScopedWorkspace workspace;
+
+        EXPECT_NE(outerWorkspace, &(*workspace));
+
+        otherThreadIdleWorkspaceCount = htd::Workspace::idleWorkspaceCount();
+    });
+
+    thread.join();
+
+    EXPECT_EQ((std::size_t)0, otherThreadIdleWorkspaceCount);
+
+    htd::Workspace::releaseIdleWorkspaces();
+
+    EXPECT_EQ((std::size_t)0, htd::Workspace::idleWorkspaceCount());
+}
+
+TEST(WorkspaceTest, CheckPoolLimit)
+{
+    htd::Workspace::releaseIdleWorkspaces();
+
+    {
+        htd::ScopedWorkspace workspace;
+
+        std::vector<std::vector<htd::vertex_t>> & buffer = workspace->buffer<std::vector<htd::vertex_t>>();
+
+        buffer.resize(4);
+
+        buffer[0].reserve(100);
+
+        EXPECT_LE(100 * sizeof(htd::vertex_t), workspace->retainedBytes());
+    }
+
+    EXPECT_EQ((std::size_t)1, htd::Workspace::idleWorkspaceCount());
+
+    htd::Workspace::releaseIdleWorkspaces();
+
+    {
+        htd::ScopedWorkspace workspace;
+
+        std::vector<std::vector<htd::vertex_t>> & buffer = workspace->buffer<std::vector<htd::vertex_t>>();
+
+        buffer.resize(2);
+
+        buffer[1].reserve(htd::Workspace::maximumPooledBytes() / sizeof(htd::vertex_t) + 1);
+
+        EXPECT_LT(htd::Workspace::maximumPooledBytes(), workspace->retainedBytes());
+    }
+
+    EXPECT_EQ((std::size_t)0, htd::Workspace::idleWorkspaceCount());
+}
+
+TEST(WorkspaceTest, CheckReuseAcrossAlgorithms)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    graph.addVertices(6);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(2, 3);
+    graph.addEdge(3, 1);
+    graph.addEdge(4, 5);
+
+    EXPECT_FALSE(graph.isConnected());
+    EXPECT_TRUE(graph.isConnected(1, 3));
+    EXPECT_FALSE(graph.isConnected(1, 4));
+
+    htd::DepthFirstConnectedComponentAlgorithm connectedComponentAlgorithm(libraryInstance);
+
+    std::vector<std::vector<htd::vertex_t>> components;
+
+    connectedComponentAlgorithm.determineComponents(graph, components);
+
+    ASSERT_EQ((std::size_t)3, components.size());
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3 }), components[0]);
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 4, 5 }), components[1]);
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 6 }), components[2]);
+
+    graph.addEdge(3, 4);
+
+    EXPECT_TRUE(graph.isConnected(1, 5));
+    EXPECT_FALSE(graph.isConnected(1, 6));
+
+    components.clear();
+
+    connectedComponentAlgorithm.determineComponents(graph, components);
+
+    ASSERT_EQ((std::size_t)2, components.size());
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3, 4, 5 }), components[0]);
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 6 }), components[1]);
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,126 @@
+/*
+ * File:   GrFormatImporterTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+#include <htd_io/main.hpp>
+
+#include <limits>
+#include <sstream>
+#include <string>
+
+class GrFormatImporterTest : public ::testing::Test
+{
+    public:
+        GrFormatImporterTest(void)
+        {
+
+        }
+
+        virtual ~GrFormatImporterTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+htd::IMultiGraph * importGraph(const htd::LibraryInstance * const libraryInstance, const std::string & content)
+{
+    htd_io::GrFormatImporter importer(libraryInstance);
+
+    std::istringstream stream(content);
+
+    return importer.import(stream);
+}
+
+TEST(GrFormatImporterTest, CheckImport)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiGraph * graph = importGraph(libraryInstance, "c comment\np tw 3 2\n1 2\n2 3\n");
+
+    ASSERT_NE(nullptr, graph);
+
+    EXPECT_EQ((std::size_t)3, graph->vertexCount());
+    EXPECT_EQ((std::size_t)2, graph->edgeCount());
+
+    EXPECT_TRUE(graph->isEdge(1, 2));
+    EXPECT_TRUE(graph->isEdge(2, 3));
+
+    delete graph;
+
+    delete libraryInstance;
+}
+
+TEST(GrFormatImporterTest, CheckVertexOutOfRange)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    EXPECT_EQ(nullptr, importGraph(libraryInstance, "p tw 3 2\n1 2\n2 4\n"));
+    EXPECT_EQ(nullptr, importGraph(libraryInstance, "p tw 3 2\n1 2\n0 3\n"));
+
+    delete libraryInstance;
+}
+
+TEST(GrFormatImporterTest, CheckVertexCountOutOfRange)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::string vertexCount = std::to_string(std::numeric_limits<htd::vertex_t>::max());
+
+    EXPECT_EQ(nullptr, importGraph(libraryInstance, "p tw " + vertexCount + " 0\n"));
+
+    delete libraryInstance;
+}
+
+#ifdef HTD_USE_COMPACT_INDICES
+TEST(GrFormatImporterTest, CheckEdgeCountOutOfRange)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::string edgeCount = std::to_string((unsigned long long)std::numeric_limits<htd::count_t>::max() + 1);
+
+    EXPECT_EQ(nullptr, importGraph(libraryInstance, "p tw 2 " + edgeCount + "\n1 2\n"));
+
+    delete libraryInstance;
+}
+#endif
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,206 @@
+/*
+ * File:   LpFormatImporterTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+#include <htd_io/main.hpp>
+
+#include <sstream>
+#include <string>
+
+class LpFormatImporterTest : public ::testing::Test
+{
+    public:
+        LpFormatImporterTest(void)
+        {
+
+        }
+
+        virtual ~LpFormatImporterTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+htd::NamedMultiHypergraph<std::string, std::string> * importGraph(const htd::LibraryInstance * const libraryInstance, const std::string & content)
+{
+    htd_io::LpFormatImporter importer(libraryInstance);
+
+    std::istringstream stream(content);
+
+    return importer.import(stream);
+}
+
+std::string exportGraph(const htd::NamedMultiHypergraph<std::string, std::string> & graph)
+{
+    std::ostringstream stream;
+
+    for (const std::string & vertex : graph.vertices())
+    {
+        stream << "vertex(" << vertex << ")." << std::endl;
+    }
+
+    for (const htd::NamedVertexHyperedge<std::string> & hyperedge : graph.hyperedges())
+    {
+        stream << "edge(";
+
+        for (auto it = hyperedge.begin(); it != hyperedge.end(); ++it)
+        {
+            if (it != hyperedge.begin())
+            {
+                stream << ",";
+            }
+
+            stream << *it;
+        }
+
+        stream << ")." << std::endl;
+    }
+
+    return stream.str();
+}
+
+TEST(LpFormatImporterTest, CheckImport)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::NamedMultiHypergraph<std::string, std::string> * graph = importGraph(libraryInstance, "vertex(a).\nedge(a, b, c).\nedge( c ,d ).\nvertex(e).");
+
+    ASSERT_NE(nullptr, graph);
+
+    EXPECT_EQ((std::size_t)5, graph->vertexCount());
+    EXPECT_EQ((std::size_t)2, graph->edgeCount());
+
+    EXPECT_EQ("vertex(a).\nvertex(b).\nvertex(c).\nvertex(d).\nvertex(e).\nedge(a,b,c).\nedge(c,d).\n", exportGraph(*graph));
+
+    delete graph;
+    delete libraryInstance;
+}
+
+TEST(LpFormatImporterTest, CheckMalformedLines)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::NamedMultiHypergraph<std::string, std::string> * graph = importGraph(libraryInstance,
+                                                                              "% comment\n"
+                                                                              "edge(a,b). \n"
+                                                                              " edge(a,b).\n"
+                                                                              "edge(a,b\n"
+                                                                              "edge(a).b).\n"
+                                                                              "edge().\n"
+                                                                              "edge(a,b).\r\n"
+                                                                              "vertex(f)\n"
+                                                                              "edge(a,,b).\n"
+                                                                              "edge( c ,d , ).\n"
+                                                                              "vertex( e ).\n");
+
+    ASSERT_NE(nullptr, graph);
+
+    EXPECT_EQ("vertex(a).\nvertex().\nvertex(b).\nvertex(c).\nvertex(d).\nvertex(e).\nedge(a,,b).\nedge(c,d).\n", exportGraph(*graph));
+
+    delete graph;
+    delete libraryInstance;
+}
+
+std::string vertexName(std::size_t vertex)
+{
+    /* Long names let the lines straddle the blocks in which the input is read without requiring a huge graph. */
+    return "vertex_with_a_rather_long_name_" + std::to_string(vertex);
+}
+
+TEST(LpFormatImporterTest, CheckRoundTrip)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::size_t vertexCount = 2500;
+
+    std::string content;
+
+    for (std::size_t vertex = 0; vertex < vertexCount; ++vertex)
+    {
+        content += "vertex(" + vertexName(vertex) + ").\n";
+    }
+
+    for (std::size_t vertex = 0; vertex + 2 < vertexCount; ++vertex)
+    {
+        if (vertex % 3 == 0)
+        {
+            content += "edge(" + vertexName(vertex) + "," + vertexName(vertex + 1) + "," + vertexName(vertex + 2) + ").\n";
+        }
+        else
+        {
+            content += "edge(" + vertexName(vertex) + "," + vertexName(vertex + 2) + ").\n";
+        }
+    }
+
+    /* The last line exceeds the size of a block and is not terminated by a line break. */
+    content += "edge(" + vertexName(0);
+
+    for (std::size_t vertex = 1; vertex < vertexCount; ++vertex)
+    {
+        content += "," + vertexName(vertex);
+    }
+
+    content += ").";
+
+    htd::NamedMultiHypergraph<std::string, std::string> * graph1 = importGraph(libraryInstance, content);
+
+    ASSERT_NE(nullptr, graph1);
+
+    EXPECT_EQ(vertexCount, graph1->vertexCount());
+    EXPECT_EQ(vertexCount - 1, graph1->edgeCount());
+
+    std::string exportedContent = exportGraph(*graph1);
+
+    EXPECT_EQ(content + "\n", exportedContent);
+
+    htd::NamedMultiHypergraph<std::string, std::string> * graph2 = importGraph(libraryInstance, exportedContent);
+
+    ASSERT_NE(nullptr, graph2);
+
+    EXPECT_EQ(exportedContent, exportGraph(*graph2));
+
+    delete graph1;
+    delete graph2;
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}